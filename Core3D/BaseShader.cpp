@@ -1,47 +1,53 @@
-#include "BaseShader.h"
-#include "Device.h"
-
-namespace Core3D
-{
-	void BaseShader::SetFloat(UINT32 uiIndex, FLOAT32 fValue)
-	{
-		m_afConstants[uiIndex] = fValue;
-	}
-
-	FLOAT32 BaseShader::GetFloat(UINT32 uiIndex)
-	{
-		return m_afConstants[uiIndex];
-	}
-
-	void BaseShader::SetVector(UINT32 uiIndex, const Vector4& rkVector)
-	{
-		m_akConstants[uiIndex] = rkVector;
-	}
-
-	const Vector4& BaseShader::GetVector(UINT32 uiIndex)
-	{
-		return m_akConstants[uiIndex];
-	}
-
-	void BaseShader::SetMatrix(UINT32 uiIndex, const Matrix4x4& rkMatrix)
-	{
-		m_amatConstants[uiIndex] = rkMatrix;
-	}
-
-	const Matrix4x4& BaseShader::GetMatrix(UINT32 uiIndex)
-	{
-		return m_amatConstants[uiIndex];
-	}
-
-	void BaseShader::SetDevice(Device* pkDevice)
-	{
-		m_pkDevice = pkDevice;
-	}
-
-	Result BaseShader::SampleTexture(Vector4& rkColor, UINT32 uiSamplerNumber, FLOAT32 fU, FLOAT32 fV, FLOAT32 fW /* = 0.0f */, 
-		const Vector4* pkXGradient /* = NULL */, const Vector4* pkYGradient /* = NULL */)
-	{
-		return m_pkDevice->SampleTexture(rkColor, uiSamplerNumber, fU, fV, fW, 
-			pkXGradient, pkYGradient);
-	}
+#include "BaseShader.h"
+#include "Device.h"
+
+namespace Core3D
+{
+	void BaseShader::SetFloat(UINT32 uiIndex, FLOAT32 fValue)
+	{
+		m_afConstants[uiIndex] = fValue;
+	}
+
+	FLOAT32 BaseShader::GetFloat(UINT32 uiIndex)
+	{
+		return m_afConstants[uiIndex];
+	}
+
+	void BaseShader::SetVector(UINT32 uiIndex, const Vector4& rkVector)
+	{
+		m_akConstants[uiIndex] = rkVector;
+	}
+
+	const Vector4& BaseShader::GetVector(UINT32 uiIndex)
+	{
+		return m_akConstants[uiIndex];
+	}
+
+	void BaseShader::SetMatrix(UINT32 uiIndex, const Matrix4x4& rkMatrix)
+	{
+		m_amatConstants[uiIndex] = rkMatrix;
+	}
+
+	const Matrix4x4& BaseShader::GetMatrix(UINT32 uiIndex)
+	{
+		return m_amatConstants[uiIndex];
+	}
+
+	Result BaseShader::SampleTexture(Vector4& rkColor, UINT32 uiSamplerNumber, FLOAT32 fU, FLOAT32 fV, FLOAT32 fW /* = 0.0f */, 
+		const Vector4* pkXGradient /* = NULL */, const Vector4* pkYGradient /* = NULL */)
+	{
+		// COMMENT : Textures are sampled with the states of the device which is currently drawing
+		RenderContext* pkContext = GetCurrentRenderContext();
+		if(NULL == pkContext)
+		{
+			rkColor = Vector4(0.0f, 0.0f, 0.0f, 0.0f);
+			CORE3D_ERROR(_T("BaseShader::SampleTexture() - Textures can only be sampled while drawing.\n"));
+			return INVALID_STATE;
+		}
+
+		ProfileStageScope kProfileStage(*pkContext, PST_TEXTURESAMPLING);
+		CORE3D_STATISTIC(if(uiSamplerNumber < MAX_TEXTURE_SAMPLERS) {++pkContext->kStatistics.auiTextureSamples[uiSamplerNumber];});
+		return pkContext->pkDevice->SampleTexture(rkColor, uiSamplerNumber, fU, fV, fW, 
+			pkXGradient, pkYGradient);
+	}
 }
\ No newline at end of file
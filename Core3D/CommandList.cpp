@@ -0,0 +1,357 @@
+#include "CommandList.h"
+#include "Device.h"
+#include "VertexFormat.h"
+#include "PrimitiveAssembler.h"
+#include "Shaders.h"
+#include "IndexBuffer.h"
+#include "VertexBuffer.h"
+#include "BaseTexture.h"
+#include "RenderTarget.h"
+
+namespace Core3D
+{
+	// COMMENT : Every device state has a slot, which remembers the command that set it last
+	static const UINT32 SLOT_RENDERSTATES			= 0;
+	static const UINT32 SLOT_VERTEXFORMAT			= SLOT_RENDERSTATES + RS_NUMRENDERSTATES;
+	static const UINT32 SLOT_PRIMITIVEASSEMBLER		= SLOT_VERTEXFORMAT + 1;
+	static const UINT32 SLOT_VERTEXSHADER			= SLOT_PRIMITIVEASSEMBLER + 1;
+	static const UINT32 SLOT_TRIANGLESHADER			= SLOT_VERTEXSHADER + 1;
+	static const UINT32 SLOT_PIXELSHADER			= SLOT_TRIANGLESHADER + 1;
+	static const UINT32 SLOT_INDEXBUFFER			= SLOT_PIXELSHADER + 1;
+	static const UINT32 SLOT_RENDERTARGET			= SLOT_INDEXBUFFER + 1;
+	static const UINT32 SLOT_SCISSORRECT			= SLOT_RENDERTARGET + 1;
+	static const UINT32 SLOT_VERTEXSTREAMS			= SLOT_SCISSORRECT + 1;
+	static const UINT32 SLOT_TEXTURES				= SLOT_VERTEXSTREAMS + MAX_VERTEX_STREAMS;
+	static const UINT32 SLOT_TEXTURESAMPLERSTATES	= SLOT_TEXTURES + MAX_TEXTURE_SAMPLERS;
+	static const UINT32 NUM_SLOTS					= SLOT_TEXTURESAMPLERSTATES + MAX_TEXTURE_SAMPLERS * TSS_NUMTEXTURESAMPLERSTATES;
+	static const UINT32 NO_SLOT						= NUM_SLOTS;	// Shader constants and draw calls are never dropped
+
+	CommandList::CommandList(Device* pkDevice)
+		: m_pkDevice(pkDevice)
+		, m_veciLastCommands(NUM_SLOTS, -1)
+	{
+		m_pkDevice->AddRef();
+	}
+
+	CommandList::~CommandList()
+	{
+		Reset();
+		CORE3D_SAFE_RELEASE(m_pkDevice);
+	}
+
+	Device* CommandList::GetDevice()
+	{
+		if(NULL != m_pkDevice) {m_pkDevice->AddRef();}
+		return m_pkDevice;
+	}
+
+	void CommandList::Reset()
+	{
+		for(std::vector<Command>::iterator iterCommand = m_vecCommands.begin(); iterCommand != m_vecCommands.end(); ++iterCommand)
+		{
+			CORE3D_SAFE_RELEASE(iterCommand->pkObject);
+		}
+		m_vecCommands.clear();
+		m_vecData.clear();
+		m_veciLastCommands.assign(NUM_SLOTS, -1);
+	}
+
+	UINT32 CommandList::GetNumCommands()
+	{
+		return static_cast<UINT32>(m_vecCommands.size());
+	}
+
+	Result CommandList::AddCommand(CommandType eType, UINT32 uiSlot, RefObject* pkObject, const UINT32* puiArgs, UINT32 uiNumArgs,
+		const FLOAT32* pfData /* = NULL */, UINT32 uiNumFloats /* = 0 */)
+	{
+		Command kCommand;
+		kCommand.eType		= eType;
+		kCommand.pkObject	= pkObject;
+		kCommand.uiData		= static_cast<UINT32>(m_vecData.size());
+		memset(kCommand.auiArgs, 0, sizeof(kCommand.auiArgs));
+		if(0 != uiNumArgs) {memcpy(kCommand.auiArgs, puiArgs, sizeof(UINT32) * uiNumArgs);}
+
+		// COMMENT : Drop states which wouldn't change anything
+		if((NO_SLOT != uiSlot) && (-1 != m_veciLastCommands[uiSlot]))
+		{
+			const Command& rkLastCommand = m_vecCommands[m_veciLastCommands[uiSlot]];
+			if( (rkLastCommand.pkObject == kCommand.pkObject) &&
+				(0 == memcmp(rkLastCommand.auiArgs, kCommand.auiArgs, sizeof(kCommand.auiArgs))) )
+			{
+				return OK;
+			}
+		}
+
+		if(NULL != pkObject) {pkObject->AddRef();}
+		if(0 != uiNumFloats) {m_vecData.insert(m_vecData.end(), pfData, pfData + uiNumFloats);}
+		m_vecCommands.push_back(kCommand);
+		if(NO_SLOT != uiSlot) {m_veciLastCommands[uiSlot] = static_cast<INT32>(m_vecCommands.size()) - 1;}
+		return OK;
+	}
+
+	bool CommandList::IsSlotSet(UINT32 uiSlot)
+	{
+		return -1 != m_veciLastCommands[uiSlot];
+	}
+
+	Result CommandList::SetRenderState(RenderState eRenderState, UINT32 uiValue)
+	{
+		if(eRenderState >= RS_NUMRENDERSTATES)
+		{
+			CORE3D_ERROR(_T("CommandList::SetRenderState() - Invalid render-state.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		const UINT32 ARGS[2] = {eRenderState, uiValue};
+		return AddCommand(CMD_RENDERSTATE, SLOT_RENDERSTATES + eRenderState, NULL, ARGS, 2);
+	}
+
+	Result CommandList::SetVertexFormat(VertexFormat* pkVertexFormat)
+	{
+		return AddCommand(CMD_VERTEXFORMAT, SLOT_VERTEXFORMAT, pkVertexFormat, NULL, 0);
+	}
+
+	Result CommandList::SetPrimitiveAssembler(PrimitiveAssembler* pkPrimitiveAssembler)
+	{
+		return AddCommand(CMD_PRIMITIVEASSEMBLER, SLOT_PRIMITIVEASSEMBLER, pkPrimitiveAssembler, NULL, 0);
+	}
+
+	Result CommandList::SetVertexShader(VertexShader* pkVertexShader)
+	{
+		return AddCommand(CMD_VERTEXSHADER, SLOT_VERTEXSHADER, pkVertexShader, NULL, 0);
+	}
+
+	Result CommandList::SetTriangleShader(TriangleShader* pkTriangleShader)
+	{
+		return AddCommand(CMD_TRIANGLESHADER, SLOT_TRIANGLESHADER, pkTriangleShader, NULL, 0);
+	}
+
+	Result CommandList::SetPixelShader(PixelShader* pkPixelShader)
+	{
+		return AddCommand(CMD_PIXELSHADER, SLOT_PIXELSHADER, pkPixelShader, NULL, 0);
+	}
+
+	Result CommandList::SetIndexBuffer(IndexBuffer* pkIndexBuffer)
+	{
+		return AddCommand(CMD_INDEXBUFFER, SLOT_INDEXBUFFER, pkIndexBuffer, NULL, 0);
+	}
+
+	Result CommandList::SetVertexStream(UINT32 uiStreamNumber, VertexBuffer* pkVertexBuffer, UINT32 uiOffset, UINT32 uiStride)
+	{
+		if(uiStreamNumber >= MAX_VERTEX_STREAMS)
+		{
+			CORE3D_ERROR(_T("CommandList::SetVertexStream() - Stream number exceeds number of available vertex streams.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if(0 == uiStride)
+		{
+			CORE3D_ERROR(_T("CommandList::SetVertexStream() - Stride is 0.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		const UINT32 ARGS[3] = {uiStreamNumber, uiOffset, uiStride};
+		return AddCommand(CMD_VERTEXSTREAM, SLOT_VERTEXSTREAMS + uiStreamNumber, pkVertexBuffer, ARGS, 3);
+	}
+
+	Result CommandList::SetTexture(UINT32 uiSamplerNumber, BaseTexture* pkTexture)
+	{
+		if(uiSamplerNumber >= MAX_TEXTURE_SAMPLERS)
+		{
+			CORE3D_ERROR(_T("CommandList::SetTexture() - Sampler number exceeds number of available texture samplers.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		const UINT32 ARGS[1] = {uiSamplerNumber};
+		return AddCommand(CMD_TEXTURE, SLOT_TEXTURES + uiSamplerNumber, pkTexture, ARGS, 1);
+	}
+
+	Result CommandList::SetTextureSamplerState(UINT32 uiSamplerNumber, TextureSamplerState eTextureSamplerState, UINT32 uiState)
+	{
+		if(uiSamplerNumber >= MAX_TEXTURE_SAMPLERS)
+		{
+			CORE3D_ERROR(_T("CommandList::SetTextureSamplerState() - Sampler number exceeds number of available texture samplers.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if(eTextureSamplerState >= TSS_NUMTEXTURESAMPLERSTATES)
+		{
+			CORE3D_ERROR(_T("CommandList::SetTextureSamplerState() - Invalid texture sampler state.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		const UINT32 ARGS[3] = {uiSamplerNumber, eTextureSamplerState, uiState};
+		return AddCommand(CMD_TEXTURESAMPLERSTATE, SLOT_TEXTURESAMPLERSTATES + uiSamplerNumber * TSS_NUMTEXTURESAMPLERSTATES + eTextureSamplerState,
+			NULL, ARGS, 3);
+	}
+
+	Result CommandList::SetRenderTarget(RenderTarget* pkRenderTarget)
+	{
+		return AddCommand(CMD_RENDERTARGET, SLOT_RENDERTARGET, pkRenderTarget, NULL, 0);
+	}
+
+	Result CommandList::SetScissorRect(const Rect& rcScissorRect)
+	{
+		if(	(rcScissorRect.uiLeft >= rcScissorRect.uiRight) ||
+			(rcScissorRect.uiTop >= rcScissorRect.uiBottom) )
+		{
+			CORE3D_ERROR(_T("CommandList::SetScissorRect() - Invalid scissor rect.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		const UINT32 ARGS[4] = {rcScissorRect.uiLeft, rcScissorRect.uiTop, rcScissorRect.uiRight, rcScissorRect.uiBottom};
+		return AddCommand(CMD_SCISSORRECT, SLOT_SCISSORRECT, NULL, ARGS, 4);
+	}
+
+	Result CommandList::SetShaderFloat(BaseShader* pkShader, UINT32 uiIndex, FLOAT32 fValue)
+	{
+		if((NULL == pkShader) || (uiIndex >= NUM_SHADER_CONSTANTS))
+		{
+			CORE3D_ERROR(_T("CommandList::SetShaderFloat() - Invalid shader or constant index.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		const UINT32 ARGS[1] = {uiIndex};
+		return AddCommand(CMD_SHADERFLOAT, NO_SLOT, pkShader, ARGS, 1, &fValue, 1);
+	}
+
+	Result CommandList::SetShaderVector(BaseShader* pkShader, UINT32 uiIndex, const Vector4& rkVector)
+	{
+		if((NULL == pkShader) || (uiIndex >= NUM_SHADER_CONSTANTS))
+		{
+			CORE3D_ERROR(_T("CommandList::SetShaderVector() - Invalid shader or constant index.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		const UINT32 ARGS[1] = {uiIndex};
+		return AddCommand(CMD_SHADERVECTOR, NO_SLOT, pkShader, ARGS, 1, (const FLOAT32*)&rkVector, 4);
+	}
+
+	Result CommandList::SetShaderMatrix(BaseShader* pkShader, UINT32 uiIndex, const Matrix4x4& rkMatrix)
+	{
+		if((NULL == pkShader) || (uiIndex >= NUM_SHADER_CONSTANTS))
+		{
+			CORE3D_ERROR(_T("CommandList::SetShaderMatrix() - Invalid shader or constant index.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		const UINT32 ARGS[1] = {uiIndex};
+		return AddCommand(CMD_SHADERMATRIX, NO_SLOT, pkShader, ARGS, 1, (const FLOAT32*)&rkMatrix, 16);
+	}
+
+	Result CommandList::DrawPrimitive(PrimitiveType ePrimitiveType, UINT32 uiStartVertex, UINT32 uiPrimitiveCount)
+	{
+		if(0 == uiPrimitiveCount)
+		{
+			CORE3D_ERROR(_T("CommandList::DrawPrimitive() - Primitive count is 0.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if(false == (PT_TRIANGLEFAN == ePrimitiveType || PT_TRIANGLESTRIP == ePrimitiveType || PT_TRIANGLELIST == ePrimitiveType))
+		{
+			CORE3D_ERROR(_T("CommandList::DrawPrimitive() - Invalid primitive type specified.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		const UINT32 ARGS[3] = {ePrimitiveType, uiStartVertex, uiPrimitiveCount};
+		return AddCommand(CMD_DRAWPRIMITIVE, NO_SLOT, NULL, ARGS, 3);
+	}
+
+	Result CommandList::DrawIndexedPrimitive(PrimitiveType ePrimitiveType, UINT32 uiBaseVertexIndex, UINT32 uiMinIndex,
+		UINT32 uiNumVertices, UINT32 uiStartIndex, UINT32 uiPrimitiveCount)
+	{
+		if(0 == uiPrimitiveCount)
+		{
+			CORE3D_ERROR(_T("CommandList::DrawIndexedPrimitive() - Primitive count is 0.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if(0 == uiNumVertices)
+		{
+			CORE3D_ERROR(_T("CommandList::DrawIndexedPrimitive() - Number of vertices is 0.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if(false == (PT_TRIANGLEFAN == ePrimitiveType || PT_TRIANGLESTRIP == ePrimitiveType || PT_TRIANGLELIST == ePrimitiveType))
+		{
+			CORE3D_ERROR(_T("CommandList::DrawIndexedPrimitive() - Invalid primitive type specified.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		const UINT32 ARGS[6] = {ePrimitiveType, uiBaseVertexIndex, uiMinIndex, uiNumVertices, uiStartIndex, uiPrimitiveCount};
+		return AddCommand(CMD_DRAWINDEXEDPRIMITIVE, NO_SLOT, NULL, ARGS, 6);
+	}
+
+	Result CommandList::DrawDynamicPrimitive(UINT32 uiStartVertex, UINT32 uiNumVertices)
+	{
+		if(0 == uiNumVertices)
+		{
+			CORE3D_ERROR(_T("CommandList::DrawDynamicPrimitive() - Number of vertices is 0.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		const UINT32 ARGS[2] = {uiStartVertex, uiNumVertices};
+		return AddCommand(CMD_DRAWDYNAMICPRIMITIVE, NO_SLOT, NULL, ARGS, 2);
+	}
+
+	bool CommandList::SetsRenderState(RenderState eRenderState)
+	{
+		return (eRenderState < RS_NUMRENDERSTATES) && IsSlotSet(SLOT_RENDERSTATES + eRenderState);
+	}
+
+	bool CommandList::SetsVertexFormat()
+	{
+		return IsSlotSet(SLOT_VERTEXFORMAT);
+	}
+
+	bool CommandList::SetsPrimitiveAssembler()
+	{
+		return IsSlotSet(SLOT_PRIMITIVEASSEMBLER);
+	}
+
+	bool CommandList::SetsVertexShader()
+	{
+		return IsSlotSet(SLOT_VERTEXSHADER);
+	}
+
+	bool CommandList::SetsTriangleShader()
+	{
+		return IsSlotSet(SLOT_TRIANGLESHADER);
+	}
+
+	bool CommandList::SetsPixelShader()
+	{
+		return IsSlotSet(SLOT_PIXELSHADER);
+	}
+
+	bool CommandList::SetsIndexBuffer()
+	{
+		return IsSlotSet(SLOT_INDEXBUFFER);
+	}
+
+	bool CommandList::SetsVertexStream(UINT32 uiStreamNumber)
+	{
+		return (uiStreamNumber < MAX_VERTEX_STREAMS) && IsSlotSet(SLOT_VERTEXSTREAMS + uiStreamNumber);
+	}
+
+	bool CommandList::SetsTexture(UINT32 uiSamplerNumber)
+	{
+		return (uiSamplerNumber < MAX_TEXTURE_SAMPLERS) && IsSlotSet(SLOT_TEXTURES + uiSamplerNumber);
+	}
+
+	bool CommandList::SetsTextureSamplerState(UINT32 uiSamplerNumber, TextureSamplerState eTextureSamplerState)
+	{
+		return	(uiSamplerNumber < MAX_TEXTURE_SAMPLERS) && (eTextureSamplerState < TSS_NUMTEXTURESAMPLERSTATES) &&
+				IsSlotSet(SLOT_TEXTURESAMPLERSTATES + uiSamplerNumber * TSS_NUMTEXTURESAMPLERSTATES + eTextureSamplerState);
+	}
+
+	bool CommandList::SetsRenderTarget()
+	{
+		return IsSlotSet(SLOT_RENDERTARGET);
+	}
+
+	bool CommandList::SetsScissorRect()
+	{
+		return IsSlotSet(SLOT_SCISSORRECT);
+	}
+}
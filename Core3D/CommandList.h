@@ -0,0 +1,115 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+#include "Core3DTypes.h"
+#include <vector>
+
+namespace Core3D
+{
+	class Device;
+	class BaseShader;
+	class VertexFormat;
+	class PrimitiveAssembler;
+	class VertexShader;
+	class TriangleShader;
+	class PixelShader;
+	class IndexBuffer;
+	class VertexBuffer;
+	class BaseTexture;
+	class RenderTarget;
+
+	// COMMENT : Records state changes, shader constants and draw calls to be executed by the device later.
+	// Lists can be recorded on any thread, but each list by one thread at a time. States which are set
+	// to the value recorded last for them are dropped. Referenced objects are kept alive until Reset().
+	class CommandList : public RefObject
+	{
+	public:
+		Device*	GetDevice();
+		void	Reset();
+		UINT32	GetNumCommands();
+
+		Result	SetRenderState(RenderState eRenderState, UINT32 uiValue);
+		Result	SetVertexFormat(VertexFormat* pkVertexFormat);
+		Result	SetPrimitiveAssembler(PrimitiveAssembler* pkPrimitiveAssembler);
+		Result	SetVertexShader(VertexShader* pkVertexShader);
+		Result	SetTriangleShader(TriangleShader* pkTriangleShader);
+		Result	SetPixelShader(PixelShader* pkPixelShader);
+		Result	SetIndexBuffer(IndexBuffer* pkIndexBuffer);
+		Result	SetVertexStream(UINT32 uiStreamNumber, VertexBuffer* pkVertexBuffer, UINT32 uiOffset, UINT32 uiStride);
+		Result	SetTexture(UINT32 uiSamplerNumber, BaseTexture* pkTexture);
+		Result	SetTextureSamplerState(UINT32 uiSamplerNumber, TextureSamplerState eTextureSamplerState, UINT32 uiState);
+		Result	SetRenderTarget(RenderTarget* pkRenderTarget);
+		Result	SetScissorRect(const Rect& rcScissorRect);
+
+		// COMMENT : Shader constants are written to the shader when the list is executed
+		Result	SetShaderFloat(BaseShader* pkShader, UINT32 uiIndex, FLOAT32 fValue);
+		Result	SetShaderVector(BaseShader* pkShader, UINT32 uiIndex, const Vector4& rkVector);
+		Result	SetShaderMatrix(BaseShader* pkShader, UINT32 uiIndex, const Matrix4x4& rkMatrix);
+
+		Result	DrawPrimitive(PrimitiveType ePrimitiveType, UINT32 uiStartVertex, UINT32 uiPrimitiveCount);
+		Result	DrawIndexedPrimitive(PrimitiveType ePrimitiveType, UINT32 uiBaseVertexIndex, UINT32 uiMinIndex,
+			UINT32 uiNumVertices, UINT32 uiStartIndex, UINT32 uiPrimitiveCount);
+		Result	DrawDynamicPrimitive(UINT32 uiStartVertex, UINT32 uiNumVertices);
+
+		// COMMENT : Device states which are changed by executing the list
+		bool	SetsRenderState(RenderState eRenderState);
+		bool	SetsVertexFormat();
+		bool	SetsPrimitiveAssembler();
+		bool	SetsVertexShader();
+		bool	SetsTriangleShader();
+		bool	SetsPixelShader();
+		bool	SetsIndexBuffer();
+		bool	SetsVertexStream(UINT32 uiStreamNumber);
+		bool	SetsTexture(UINT32 uiSamplerNumber);
+		bool	SetsTextureSamplerState(UINT32 uiSamplerNumber, TextureSamplerState eTextureSamplerState);
+		bool	SetsRenderTarget();
+		bool	SetsScissorRect();
+	protected:
+		friend class Device;
+
+		CommandList(Device* pkDevice);
+		~CommandList();
+	private:
+		enum CommandType
+		{
+			CMD_RENDERSTATE = 0,
+			CMD_VERTEXFORMAT,
+			CMD_PRIMITIVEASSEMBLER,
+			CMD_VERTEXSHADER,
+			CMD_TRIANGLESHADER,
+			CMD_PIXELSHADER,
+			CMD_INDEXBUFFER,
+			CMD_VERTEXSTREAM,
+			CMD_TEXTURE,
+			CMD_TEXTURESAMPLERSTATE,
+			CMD_RENDERTARGET,
+			CMD_SCISSORRECT,
+			CMD_SHADERFLOAT,
+			CMD_SHADERVECTOR,
+			CMD_SHADERMATRIX,
+			CMD_DRAWPRIMITIVE,
+			CMD_DRAWINDEXEDPRIMITIVE,
+			CMD_DRAWDYNAMICPRIMITIVE
+		};
+
+		struct Command
+		{
+			CommandType	eType;
+			UINT32		auiArgs[6];		// State numbers and values, draw parameters
+			RefObject*	pkObject;		// Bound object or shader(referenced by the list), NULL for unbinding
+			UINT32		uiData;			// Index of floating-point parameters in m_vecData
+		};
+
+		Result	AddCommand(CommandType eType, UINT32 uiSlot, RefObject* pkObject, const UINT32* puiArgs, UINT32 uiNumArgs,
+			const FLOAT32* pfData = NULL, UINT32 uiNumFloats = 0);
+		bool	IsSlotSet(UINT32 uiSlot);
+	private:
+		Device*					m_pkDevice;
+		std::vector<Command>	m_vecCommands;
+		std::vector<FLOAT32>	m_vecData;
+		std::vector<INT32>		m_veciLastCommands;	// Per device state the command which set it last(-1 : not set)
+	};
+}
@@ -1,82 +1,146 @@
-#pragma once
-//////////////////////////////////////////////////////////////////////////
-// Core3D : Software Graphic API
-// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
-//////////////////////////////////////////////////////////////////////////
-
-#include <stdlib.h>
-#include <tchar.h>
-#include <memory.h>
-#include <vector>
-
-#include <float.h>
-
-// COMMENT : Basic macro definitions
-#define CORE3D_SAFE_RELEASE(p)		{if((p)) {(p)->Release(); (p) = NULL;}}
-#define CORE3D_SAFE_DELETE(p)		{if((p)) {delete (p); (p) = NULL;}}
-#define CORE3D_SAFE_DELETEARRAY(p)	{if((p)) {delete[] (p); (p) = NULL;}}
-
-namespace Core3D
-{
-	// COMMENT : Basic variable definitions
-	typedef char			INT8;
-	typedef short			INT16;
-	typedef int				INT32;
-	typedef unsigned char	UINT8;
-	typedef unsigned short	UINT16;
-	typedef unsigned int	UINT32;
-	typedef float			FLOAT32;
-	typedef double			FLOAT64;
-	typedef unsigned char	BYTE8;
-
-	// COMMENT : Describes function return values
-	enum Result
-	{
-		OK = 0,
-		UNKNOWN, 
-		INVALID_PARAMETERS, 
-		OUT_OF_MEMORY, 
-		INVALID_FORMAT, 
-		INVALID_STATE
-	};
-
-	// COMMENT : custom boolean type
-	enum BoolType
-	{
-		BT_FALSE = 0,
-		BT_TRUE,
-	};
-
-	// COMMENT : Sets FPU to truncation mode and single precision.
-	inline void		FpuTruncate()	{_set_controlfp(_RC_DOWN + _PC_24, _MCW_RC | _MCW_PC);}
-	// COMMENT : Resets FPU to default.
-	inline void		FpuReset()		{_set_controlfp(_CW_DEFAULT, _MCW_RC | _MCW_PC);}
-	// COMMENT : Performs fast float to integer conversion.
-	inline INT32	FtoL(FLOAT32 f)
-	{
-		static INT32 temp;
-		__asm
-		{
-			fld f
-			fistp temp
-		}
-		return temp;
-	}
-
-	// COMMENT : RefObject is the base class for all Core3D classes.
-	// It implements a reference counter with functions AddRef() and Release() known from COM interfaces
-	class RefObject
-	{
-	protected:
-		RefObject() : m_uiRefCount(1)	{}
-		virtual ~RefObject()			{}
-	private:
-		RefObject(const RefObject&);
-		RefObject& operator=(const RefObject&);
-	public:
-		inline void AddRef()	{++m_uiRefCount;}
-		inline void Release()	{if(0 == (--m_uiRefCount)) {delete this;}}
-	private:
-		UINT32 m_uiRefCount;
-	};
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include <stddef.h>
+#ifdef WIN32
+#include <tchar.h>
+#endif
+#include <memory.h>
+#include <string.h>
+#include <vector>
+
+#include <float.h>
+#include <xmmintrin.h>
+
+// COMMENT : Reference counting is atomic unless CORE3D_ATOMIC_REFCOUNT is defined as 0.
+// Single-threaded applications may turn it off to save the locked instructions.
+#ifndef CORE3D_ATOMIC_REFCOUNT
+#define CORE3D_ATOMIC_REFCOUNT 1
+#endif
+
+// COMMENT : Pipeline statistics are counted unless CORE3D_PIPELINE_STATISTICS is defined as 0,
+// which is the default for release builds.
+#ifndef CORE3D_PIPELINE_STATISTICS
+#	ifdef NDEBUG
+#	define CORE3D_PIPELINE_STATISTICS 0
+#	else
+#	define CORE3D_PIPELINE_STATISTICS 1
+#	endif
+#endif
+
+#if CORE3D_ATOMIC_REFCOUNT && defined(WIN32)
+#include <intrin.h>
+#pragma intrinsic(_InterlockedIncrement, _InterlockedDecrement)
+#endif
+
+// COMMENT : Basic macro definitions
+#define CORE3D_SAFE_RELEASE(p)		{if((p)) {(p)->Release(); (p) = NULL;}}
+#define CORE3D_SAFE_DELETE(p)		{if((p)) {delete (p); (p) = NULL;}}
+#define CORE3D_SAFE_DELETEARRAY(p)	{if((p)) {delete[] (p); (p) = NULL;}}
+
+namespace Core3D
+{
+	// COMMENT : Basic variable definitions
+	typedef char			INT8;
+	typedef short			INT16;
+	typedef int				INT32;
+	typedef unsigned char	UINT8;
+	typedef unsigned short	UINT16;
+	typedef unsigned int	UINT32;
+#ifdef WIN32
+	typedef __int64				INT64;
+	typedef unsigned __int64	UINT64;
+#else
+	typedef long long			INT64;
+	typedef unsigned long long	UINT64;
+#endif
+	typedef float			FLOAT32;
+	typedef double			FLOAT64;
+	typedef unsigned char	BYTE8;
+
+	// COMMENT : Describes function return values
+	enum Result
+	{
+		OK = 0,
+		UNKNOWN, 
+		INVALID_PARAMETERS, 
+		OUT_OF_MEMORY, 
+		INVALID_FORMAT, 
+		INVALID_STATE
+	};
+
+	// COMMENT : custom boolean type
+	enum BoolType
+	{
+		BT_FALSE = 0,
+		BT_TRUE,
+	};
+
+	// COMMENT : Sets SSE rounding to round-down(floor) mode, so FtoL() behaves like floor().
+	// The rounding mode is per-thread state(MXCSR) and works the same on x86 and x64.
+	inline void		FpuTruncate()	{_MM_SET_ROUNDING_MODE(_MM_ROUND_DOWN);}
+	// COMMENT : Resets SSE rounding to default(round to nearest).
+	inline void		FpuReset()		{_MM_SET_ROUNDING_MODE(_MM_ROUND_NEAREST);}
+	// COMMENT : Performs fast float to integer conversion using the current rounding mode.
+	inline INT32	FtoL(FLOAT32 f)	{return _mm_cvtss_si32(_mm_set_ss(f));}
+
+	// COMMENT : RefObject is the base class for all Core3D classes.
+	// It implements a reference counter with functions AddRef() and Release() known from COM interfaces,
+	// both return the new reference count.
+	//
+	// Sharing objects between threads:
+	// - AddRef() and Release() may be called from any thread(with CORE3D_ATOMIC_REFCOUNT).
+	// - Surfaces, volumes, textures, vertex/index-buffers, vertex-formats and shaders may be read by
+	//   several threads at the same time: sampling, GetPointer(), GetMipLevel(), drawing with them on
+	//   different devices. Nothing may modify them meanwhile, i.e. LockRect(), Clear(),
+	//   GenerateMipSubLevels() and setting shader constants need exclusive access.
+	//   LockRect() is exclusive even for reading; a resource can only be locked once at a time.
+	// - Devices, render-targets and swap-chains are used by one thread at a time. Creating resources
+	//   through a device only allocates them, so loader threads may call the device's Create*() functions.
+	class RefObject
+	{
+	protected:
+		RefObject() : m_iRefCount(1)	{}
+		virtual ~RefObject()			{}
+	private:
+		RefObject(const RefObject&);
+		RefObject& operator=(const RefObject&);
+	public:
+	#	if !CORE3D_ATOMIC_REFCOUNT
+		inline UINT32 AddRef()	{return static_cast<UINT32>(++m_iRefCount);}
+		inline UINT32 Release()
+		{
+			const INT32 iRefCount = --m_iRefCount;
+			if(0 == iRefCount) {delete this;}
+			return static_cast<UINT32>(iRefCount);
+		}
+	#	elif defined(WIN32)
+		inline UINT32 AddRef()	{return static_cast<UINT32>(_InterlockedIncrement(reinterpret_cast<volatile long*>(&m_iRefCount)));}
+		inline UINT32 Release()
+		{
+			const INT32 iRefCount = _InterlockedDecrement(reinterpret_cast<volatile long*>(&m_iRefCount));
+			if(0 == iRefCount) {delete this;}
+			return static_cast<UINT32>(iRefCount);
+		}
+	#	else
+		inline UINT32 AddRef()	{return static_cast<UINT32>(__sync_add_and_fetch(&m_iRefCount, 1));}
+		inline UINT32 Release()
+		{
+			// COMMENT : Full barrier, all writes of other owners are visible before deleting
+			const INT32 iRefCount = __sync_sub_and_fetch(&m_iRefCount, 1);
+			if(0 == iRefCount) {delete this;}
+			return static_cast<UINT32>(iRefCount);
+		}
+	#	endif
+	private:
+	#	if CORE3D_ATOMIC_REFCOUNT
+		volatile INT32	m_iRefCount;
+	#	else
+		INT32			m_iRefCount;
+	#	endif
+	};
 }
\ No newline at end of file
@@ -1,19 +1,22 @@
-#pragma once
-//////////////////////////////////////////////////////////////////////////
-// Core3D : Software Graphic API
-// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
-//////////////////////////////////////////////////////////////////////////
-
-#include "Object.h"
-#include "Device.h"
-#include "CubeTexture.h"
-#include "IndexBuffer.h"
-#include "RenderTarget.h"
-#include "Shaders.h"
-#include "Surface.h"
-#include "Texture.h"
-#include "PrimitiveAssembler.h"
-#include "VertexBuffer.h"
-#include "VertexFormat.h"
-#include "Volume.h"
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+#include "Object.h"
+#include "Device.h"
+#include "CommandList.h"
+#include "CubeTexture.h"
+#include "FrameReplay.h"
+#include "IndexBuffer.h"
+#include "RenderTarget.h"
+#include "Shaders.h"
+#include "Surface.h"
+#include "Texture.h"
+#include "PrimitiveAssembler.h"
+#include "Profiler.h"
+#include "VertexBuffer.h"
+#include "VertexFormat.h"
+#include "Volume.h"
 #include "VolumeTexture.h"
\ No newline at end of file
@@ -0,0 +1,232 @@
+#include "Core3DThread.h"
+
+#ifndef WIN32
+#include <unistd.h>
+#include <sched.h>
+#include <time.h>
+#endif
+
+namespace Core3D
+{
+	//---------------------------------------------------------------------------------------
+	// COMMENT : Atomic operations
+	#ifdef WIN32
+	INT32 AtomicIncrement(volatile INT32* piValue)			{return ::InterlockedIncrement(reinterpret_cast<volatile LONG*>(piValue));}
+	INT32 AtomicDecrement(volatile INT32* piValue)			{return ::InterlockedDecrement(reinterpret_cast<volatile LONG*>(piValue));}
+	INT32 AtomicAdd(volatile INT32* piValue, INT32 iAddend)	{return ::InterlockedExchangeAdd(reinterpret_cast<volatile LONG*>(piValue), iAddend) + iAddend;}
+	INT32 AtomicExchange(volatile INT32* piValue, INT32 iExchange)
+	{
+		return ::InterlockedExchange(reinterpret_cast<volatile LONG*>(piValue), iExchange);
+	}
+	INT32 AtomicCompareExchange(volatile INT32* piValue, INT32 iExchange, INT32 iComparand)
+	{
+		return ::InterlockedCompareExchange(reinterpret_cast<volatile LONG*>(piValue), iExchange, iComparand);
+	}
+	#else
+	INT32 AtomicIncrement(volatile INT32* piValue)			{return __sync_add_and_fetch(piValue, 1);}
+	INT32 AtomicDecrement(volatile INT32* piValue)			{return __sync_sub_and_fetch(piValue, 1);}
+	INT32 AtomicAdd(volatile INT32* piValue, INT32 iAddend)	{return __sync_add_and_fetch(piValue, iAddend);}
+	INT32 AtomicExchange(volatile INT32* piValue, INT32 iExchange)
+	{
+		// COMMENT : __sync_lock_test_and_set() is only an acquire barrier
+		__sync_synchronize();
+		return __sync_lock_test_and_set(piValue, iExchange);
+	}
+	INT32 AtomicCompareExchange(volatile INT32* piValue, INT32 iExchange, INT32 iComparand)
+	{
+		return __sync_val_compare_and_swap(piValue, iComparand, iExchange);
+	}
+	#endif
+
+	UINT32 GetNumProcessors()
+	{
+	#	ifdef WIN32
+		SYSTEM_INFO kSystemInfo;
+		::GetSystemInfo(&kSystemInfo);
+		return (0 != kSystemInfo.dwNumberOfProcessors) ? kSystemInfo.dwNumberOfProcessors : 1;
+	#	else
+		long lProcessors = ::sysconf(_SC_NPROCESSORS_ONLN);
+		return (lProcessors > 0) ? static_cast<UINT32>(lProcessors) : 1;
+	#	endif
+	}
+
+	void YieldThread()
+	{
+	#	ifdef WIN32
+		::SwitchToThread();
+	#	else
+		::sched_yield();
+	#	endif
+	}
+
+	FLOAT64 GetSeconds()
+	{
+	#	ifdef WIN32
+		LARGE_INTEGER kFrequency, kCounter;
+		::QueryPerformanceFrequency(&kFrequency);
+		::QueryPerformanceCounter(&kCounter);
+		return (FLOAT64)kCounter.QuadPart / (FLOAT64)kFrequency.QuadPart;
+	#	else
+		timespec kTime;
+		::clock_gettime(CLOCK_MONOTONIC, &kTime);
+		return (FLOAT64)kTime.tv_sec + (FLOAT64)kTime.tv_nsec * 1e-9;
+	#	endif
+	}
+
+	//---------------------------------------------------------------------------------------
+	// COMMENT : Thread
+	struct ThreadStartInfo
+	{
+		PFN_THREADFUNCTION	pfnThreadFunction;
+		void*				pvArgument;
+	};
+
+	#ifdef WIN32
+	static DWORD WINAPI ThreadEntry(LPVOID pvStartInfo)
+	#else
+	static void* ThreadEntry(void* pvStartInfo)
+	#endif
+	{
+		ThreadStartInfo kStartInfo = *reinterpret_cast<ThreadStartInfo*>(pvStartInfo);
+		delete reinterpret_cast<ThreadStartInfo*>(pvStartInfo);
+
+		kStartInfo.pfnThreadFunction(kStartInfo.pvArgument);
+		return 0;
+	}
+
+	Thread::Thread()
+		: m_bRunning(false)
+	{
+	#	ifdef WIN32
+		m_hThread = NULL;
+	#	endif
+	}
+
+	Thread::~Thread()
+	{
+		Join();
+	}
+
+	Result Thread::Start(PFN_THREADFUNCTION pfnThreadFunction, void* pvArgument)
+	{
+		if(NULL == pfnThreadFunction)
+		{
+			CORE3D_ERROR(_T("Thread::Start() - Parameter thread function pointers to NULL.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if(true == m_bRunning)
+		{
+			CORE3D_ERROR(_T("Thread::Start() - Thread is already running.\n"));
+			return INVALID_STATE;
+		}
+
+		ThreadStartInfo* pkStartInfo = new ThreadStartInfo;
+		if(NULL == pkStartInfo)
+		{
+			CORE3D_ERROR(_T("Thread::Start() - Out of memory, cannot start thread.\n"));
+			return OUT_OF_MEMORY;
+		}
+		pkStartInfo->pfnThreadFunction	= pfnThreadFunction;
+		pkStartInfo->pvArgument			= pvArgument;
+
+	#	ifdef WIN32
+		m_hThread = ::CreateThread(NULL, 0, ThreadEntry, pkStartInfo, 0, NULL);
+		if(NULL == m_hThread)
+	#	else
+		if(0 != ::pthread_create(&m_kThread, NULL, ThreadEntry, pkStartInfo))
+	#	endif
+		{
+			delete pkStartInfo;
+			CORE3D_ERROR(_T("Thread::Start() - Couldn't create thread.\n"));
+			return UNKNOWN;
+		}
+
+		m_bRunning = true;
+		return OK;
+	}
+
+	void Thread::Join()
+	{
+		if(false == m_bRunning) {return;}
+
+	#	ifdef WIN32
+		::WaitForSingleObject(m_hThread, INFINITE);
+		::CloseHandle(m_hThread);
+		m_hThread = NULL;
+	#	else
+		::pthread_join(m_kThread, NULL);
+	#	endif
+		m_bRunning = false;
+	}
+
+	//---------------------------------------------------------------------------------------
+	// COMMENT : Mutex
+	#ifdef WIN32
+	Mutex::Mutex()			{::InitializeCriticalSection(&m_kCriticalSection);}
+	Mutex::~Mutex()			{::DeleteCriticalSection(&m_kCriticalSection);}
+	void Mutex::Lock()		{::EnterCriticalSection(&m_kCriticalSection);}
+	void Mutex::Unlock()	{::LeaveCriticalSection(&m_kCriticalSection);}
+	#else
+	Mutex::Mutex()			{::pthread_mutex_init(&m_kMutex, NULL);}
+	Mutex::~Mutex()			{::pthread_mutex_destroy(&m_kMutex);}
+	void Mutex::Lock()		{::pthread_mutex_lock(&m_kMutex);}
+	void Mutex::Unlock()	{::pthread_mutex_unlock(&m_kMutex);}
+	#endif
+
+	//---------------------------------------------------------------------------------------
+	// COMMENT : Semaphore
+	#ifdef WIN32
+	Semaphore::Semaphore()
+	{
+		m_hSemaphore = ::CreateSemaphore(NULL, 0, 0x7fffffff, NULL);
+	}
+
+	Semaphore::~Semaphore()
+	{
+		if(NULL != m_hSemaphore) {::CloseHandle(m_hSemaphore);}
+	}
+
+	void Semaphore::Post(UINT32 uiCount /* = 1 */)
+	{
+		if(0 != uiCount) {::ReleaseSemaphore(m_hSemaphore, uiCount, NULL);}
+	}
+
+	void Semaphore::Wait()
+	{
+		::WaitForSingleObject(m_hSemaphore, INFINITE);
+	}
+	#else
+	Semaphore::Semaphore()
+		: m_uiCount(0)
+	{
+		::pthread_mutex_init(&m_kMutex, NULL);
+		::pthread_cond_init(&m_kCondition, NULL);
+	}
+
+	Semaphore::~Semaphore()
+	{
+		::pthread_cond_destroy(&m_kCondition);
+		::pthread_mutex_destroy(&m_kMutex);
+	}
+
+	void Semaphore::Post(UINT32 uiCount /* = 1 */)
+	{
+		if(0 == uiCount) {return;}
+
+		::pthread_mutex_lock(&m_kMutex);
+		m_uiCount += uiCount;
+		if(1 == uiCount)	{::pthread_cond_signal(&m_kCondition);}
+		else				{::pthread_cond_broadcast(&m_kCondition);}
+		::pthread_mutex_unlock(&m_kMutex);
+	}
+
+	void Semaphore::Wait()
+	{
+		::pthread_mutex_lock(&m_kMutex);
+		while(0 == m_uiCount) {::pthread_cond_wait(&m_kCondition, &m_kMutex);}
+		--m_uiCount;
+		::pthread_mutex_unlock(&m_kMutex);
+	}
+	#endif
+}
@@ -0,0 +1,123 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+#include "Core3DTypes.h"
+
+//------------------------------------------------------------------------
+// COMMENT : Non-WIN32 Version
+#ifndef WIN32
+#include <pthread.h>
+#endif
+//------------------------------------------------------------------------
+
+// COMMENT : Time-stamp counter intrinsics
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+//------------------------------------------------------------------------
+
+// COMMENT : Storage class of variables which exist once per thread
+#ifdef WIN32
+#define CORE3D_THREAD_LOCAL __declspec(thread)
+#else
+#define CORE3D_THREAD_LOCAL __thread
+#endif
+
+namespace Core3D
+{
+	typedef void (*PFN_THREADFUNCTION)(void* pvArgument);
+
+	// COMMENT : Atomic operations on 32-bit integers. All of them act as full memory barriers.
+	INT32	AtomicIncrement(volatile INT32* piValue);								// Returns the incremented value
+	INT32	AtomicDecrement(volatile INT32* piValue);								// Returns the decremented value
+	INT32	AtomicAdd(volatile INT32* piValue, INT32 iAddend);						// Returns the new value
+	INT32	AtomicExchange(volatile INT32* piValue, INT32 iExchange);				// Returns the previous value
+	INT32	AtomicCompareExchange(volatile INT32* piValue, INT32 iExchange, INT32 iComparand);	// Returns the previous value
+
+	// COMMENT : Returns the number of logical processors of the system.
+	UINT32	GetNumProcessors();
+	// COMMENT : Gives the rest of the calling thread's time slice to other threads.
+	void	YieldThread();
+	// COMMENT : Returns the time of a high-resolution monotonic clock in seconds, for measurements.
+	FLOAT64	GetSeconds();
+
+	// COMMENT : Returns the processor's time-stamp counter, which is much cheaper to read than GetSeconds().
+	// Its frequency has to be measured against GetSeconds(). Without a counter it's the time in nanoseconds.
+	inline UINT64 ReadTimeStamp()
+	{
+	#	if defined(_MSC_VER) || defined(__i386__) || defined(__x86_64__)
+		return __rdtsc();
+	#	else
+		return static_cast<UINT64>(GetSeconds() * 1e9);
+	#	endif
+	}
+
+	// COMMENT : Thin wrapper of an operating system thread.
+	class Thread
+	{
+	public:
+		Thread();
+		~Thread();
+
+		Result	Start(PFN_THREADFUNCTION pfnThreadFunction, void* pvArgument);
+		void	Join();
+		bool	IsRunning() const {return m_bRunning;}
+	private:
+		Thread(const Thread&);
+		Thread& operator=(const Thread&);
+	private:
+	#	ifdef WIN32
+		HANDLE		m_hThread;
+	#	else
+		pthread_t	m_kThread;
+	#	endif
+		bool		m_bRunning;
+	};
+
+	// COMMENT : Non-recursive mutual exclusion lock.
+	class Mutex
+	{
+	public:
+		Mutex();
+		~Mutex();
+
+		void	Lock();
+		void	Unlock();
+	private:
+		Mutex(const Mutex&);
+		Mutex& operator=(const Mutex&);
+	private:
+	#	ifdef WIN32
+		CRITICAL_SECTION	m_kCriticalSection;
+	#	else
+		pthread_mutex_t		m_kMutex;
+	#	endif
+	};
+
+	// COMMENT : Counting semaphore used to put threads to sleep until work is available.
+	class Semaphore
+	{
+	public:
+		Semaphore();
+		~Semaphore();
+
+		void	Post(UINT32 uiCount = 1);
+		void	Wait();
+	private:
+		Semaphore(const Semaphore&);
+		Semaphore& operator=(const Semaphore&);
+	private:
+	#	ifdef WIN32
+		HANDLE				m_hSemaphore;
+	#	else
+		pthread_mutex_t		m_kMutex;
+		pthread_cond_t		m_kCondition;
+		UINT32				m_uiCount;
+	#	endif
+	};
+}
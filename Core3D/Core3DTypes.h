@@ -1,301 +1,452 @@
-#pragma once
-//////////////////////////////////////////////////////////////////////////
-// Core3D : Software Graphic API
-// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
-//////////////////////////////////////////////////////////////////////////
-
-#include "Core3DBase.h"
-#include "Core3DMath.h"
-
-//------------------------------------------------------------------------
-// COMMENT : WIN32 Version
-#ifdef WIN32
-#define WIN32_LEAN_AND_MEAN
-#include <Windows.h>
-
-#define CORE3D_ERROR(desc)		{::OutputDebugString(desc);}
-#define CORE3D_NOTIFY(desc)		{::OutputDebugString(desc);}
-#endif
-//------------------------------------------------------------------------
-
-#ifndef WIN32
-#	ifdef _UNICODE
-#		define __T(x)	L ## x
-#	else
-#		define __T(x)	x
-#	endif
-#	define _T(x)       __T(x)
-#endif
-
-#define CORE3D_SUCCESSFUL(res)	(Core3D::OK == res)
-#define CORE3D_FAILED(res)		(Core3D::OK != res)
-#define CORE3D_VERTEXFORMAT_DECL(iStream, iType, iRegister) \
-	{iStream, iType, iRegister}
-
-namespace Core3D
-{
-//------------------------------------------------------------------------
-// COMMENT : WIN32 Version
-	#ifdef WIN32
-	typedef HWND	WinHandle;
-	#endif
-//------------------------------------------------------------------------
-	typedef Vector4 ShaderReg;
-
-	const UINT32 VERTEX_CACH_SIZE			= 32;
-	const UINT32 VERTEX_SHADER_REGISTERS	= 8;
-	const UINT32 PIXEL_SHADER_REGISTERS		= 8;
-	const UINT32 NUM_SHADER_CONSTANTS		= 32;
-	const UINT32 MAX_VERTEX_STREAMS			= 8;
-	const UINT32 MAX_TEXTURE_SAMPLERS		= 16;
-
-	enum RenderState
-	{
-		RS_ZENABLE = 0,
-		RS_ZWRITEENABLE,
-		RS_ZFUNC,
-
-		RS_COLORWRITEENABLE,
-		RS_FILLMODE,
-		RS_CULLMODE,
-
-		RS_SUBDIVISIONMODE,
-		RS_SUBDIVISIONLEVELS,
-		RS_SUBDIVISIONPOSITIONREGISTER,
-		RS_SUBDIVISIONNORMALREGISTER,
-		RS_SUBDIVISIONMAXSCREENAREA,
-		RS_SUBDIVISIONMAXINNERLEVELS,
-
-		RS_SCISSORTESTENABLE,
-		RS_LINETHICKNESS,
-
-		RS_NUMRENDERSTATES
-	};
-
-	enum CmpFunc
-	{
-		CMP_NEVER = 0,
-		CMP_EQUAL,
-		CMP_NOTEQUAL,
-		CMP_LESS,
-		CMP_LESSEQUAL,
-		CMP_GREATEREQUAL,
-		CMP_GREATER,
-		CMP_ALWAYS
-	};
-
-	enum Cull
-	{
-		CULL_NONE = 0,
-		CULL_CW,
-		CULL_CCW
-	};
-
-	enum Fill
-	{
-		FILL_SOLID = 0,
-		FILL_WIREFRAME
-	};
-
-	enum TextureSamplerState
-	{
-		TSS_ADDRESSU = 0,
-		TSS_ADDRESSV,
-		TSS_ADDRESSW,
-		TSS_MINFILTER,
-		TSS_MAGFILTER,
-		TSS_MIPFILTER,
-		TSS_MIPLODBIAS,
-		TSS_MAXMIPLEVEL,
-
-		TSS_NUMTEXTURESAMPLERSTATES
-	};
-
-	enum TextureAddress
-	{
-		TA_WRAP = 0,
-		TA_CLAMP
-	};
-
-	enum TextureFilter
-	{
-		TF_POINT = 0,
-		TF_LINEAR
-	};
-
-	enum SubDiv
-	{
-		SUBDIV_NONE = 0,
-		SUBDIV_SIMPLE,
-		SUBDIV_SMOOTH,
-		SUBDIV_ADAPTIVE
-	};
-
-	enum Format
-	{
-		FMT_R32F = 0,
-		FMT_R32G32F,
-		FMT_R32G32B32F,
-		FMT_R32G32B32A32F,
-
-		FMT_INDEX16,
-		FMT_INDEX32
-	};
-
-	enum PrimitiveType
-	{
-		PT_TRIANGLEFAN = 0,
-		PT_TRIANGLESTRIP,
-		PT_TRIANGLELIST
-	};
-
-	enum VertexElementType
-	{
-		VET_FLOAT32 = 0,
-		VET_VECTOR2,
-		VET_VECTOR3,
-		VET_VECTOR4
-	};
-
-	enum ShaderConstant
-	{
-		SC_WORLDMATRIX = 0,
-		SC_VIEWMATRIX,
-		SC_PROJECTIONMATRIX,
-		SC_WVPMATRIX
-	};
-
-	enum TextureSampleInput
-	{
-		TSI_2COORDS = 0,
-		TSI_3COORDS,
-		TSI_VECTOR
-	};
-
-	enum CubeFaces
-	{
-		CF_POSITIVE_X = 0,
-		CF_NEGATIVE_X,
-		CF_POSITIVE_Y,
-		CF_NEGATIVE_Y,
-		CF_POSITIVE_Z,
-		CF_NEGATIVE_Z
-	};
-
-	enum PixelShaderOutput
-	{
-		PSO_COLORONLY = 0,
-		PSO_COLORDEPTH
-	};
-
-	enum ShaderRegType
-	{
-		SRT_UNUSED = 0,
-		SRT_FLOAT32,
-		SRT_VECTOR2,
-		SRT_VECTOR3,
-		SRT_VECTOR4
-	};
-
-	enum ClippingPlanes
-	{
-		CP_LEFT = 0,
-		CP_RIGHT,
-		CP_TOP,
-		CP_BOTTOM,
-		CP_NEAR,
-		CP_FAR,
-
-		CP_USER0,
-		CP_USER1,
-		CP_USER2,
-		CP_USER3,
-
-		CP_NUMPLANES
-	};
-
-	//////////////////////////////////////////////////////////////////////////
-	// Structures
-	//////////////////////////////////////////////////////////////////////////
-	// COMMENT : Defines a rectangle.
-	struct Rect
-	{
-		UINT32		uiLeft, uiTop;
-		UINT32		uiRight, uiBottom;
-	};
-
-	// COMMENT : Defines a box. Added for volume texture support.
-	struct Box
-	{
-		UINT32		uiLeft, uiTop, uiFront;
-		UINT32		uiRight, uiBottom, uiBack;
-	};
-
-	// COMMENT : This structure defines the device parameters.
-	struct DeviceParameters
-	{
-		WinHandle	hDeviceWnd;								// Handle to the output window
-		bool		bWindowed;								// True if the application runs windowed, false if it runs in full screen
-		UINT32		uiFullScreenColorBits;					// Bit depth of back-buffer in full screen mode(ignored in windowed mode). Valid values : 32, 24, 16.
-		UINT32		uiBackBufferWidth, uiBackBufferHeight;	// Dimension of the back-buffer in pixels.
-	};
-
-	// COMMENT : Describes a vertex element.
-	struct VertexElement
-	{
-		UINT32				uiStream;		// Index of the stream this element is loaded from.
-		VertexElementType	eType;			// Type of this vertex element. Set this field to a member of the enumeration type.
-		UINT32				uiRegister;		// The register of the vertex shader the vertex element's value will be passed to.
-	};
-
-	//////////////////////////////////////////////////////////////////////////
-	// Internal structures
-	//////////////////////////////////////////////////////////////////////////
-	// COMMENT : Describes the vertex shader input.
-	// this structure is used internally by devices.
-	struct VertexShaderInput
-	{
-		ShaderReg	kShaderInputs[VERTEX_SHADER_REGISTERS];
-	};
-
-	// COMMENT : Describes the vertex shader output.
-	// this structure is used internally by devices.
-	struct VertexShaderOutput
-	{
-		ShaderReg			kShaderOutputs[PIXEL_SHADER_REGISTERS];	// Vertex shader output registers, which are in turn used as pixel
-																	// shader input registers.
-		Vector4				kPosition;								// Position of this vertex.
-		VertexShaderInput	kSourceInput;							// Original vertex shader input fetched from vertex streams: 
-																	// added for triangle subdivision.
-	};
-
-	// COMMENT : Describes a structure that is used for triangle gradient storage.
-	// this structure is used internally by devices.
-	struct TriangleInfo
-	{
-		FLOAT32		fCommonGradient;								// Gradient constant.
-		const VertexShaderOutput* pkBaseVertex;						// Base vertex for gradient computations.
-		FLOAT32		fZDdx, fZDdy;									// Z partial derivatives with respect to the screen space 
-																	// X and Y coordinates.
-		FLOAT32		fWDdx, fWDdy;									// W partial derivatives with respect to the screen space
-																	// X and Y coordinates.
-		ShaderReg	kShaderOutputsDdx[PIXEL_SHADER_REGISTERS];		// Shader register partial derivatives with respect to the
-																	// screen space X coordinates.
-		ShaderReg	kShaderOutputsDdy[PIXEL_SHADER_REGISTERS];		// Shader register partial derivatives with respect to the
-																	// screen space Y coordinates.
-		UINT32		uiCurrentPixelX, uiCurrentPixelY;				// Integer coordinates of current pixel:
-																	// needed by pixel shader for computation of partial derivatives.
-		FLOAT32		fCurrentPixelInvW;								// 1.0f / W of the current pixel:
-																	// needed by pixel shader for computation of partial derivatives.
-	};
-
-	// COMMENT : Describes a structure that is used for vertex caching.
-	// this structure is used internally by devices.
-	struct VertexCacheEntry
-	{
-		UINT32				uiVertexIndex;	// Index of the contained vertex in the vertex buffer.
-		VertexShaderOutput	kVertexOutput;	// Vertex shader output, vertex data.
-		UINT32				uiFetchTime;	// Whenever a vertex cache entry is reserved for drawing(updated or simply 'touched
-											// and returned') it's fetch-time is set to m_uiFetchedVertices.
-	};
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+#include "Core3DBase.h"
+#include "Core3DMath.h"
+
+//------------------------------------------------------------------------
+// COMMENT : WIN32 Version
+#ifdef WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+
+#define CORE3D_ERROR(desc)		{::OutputDebugString(desc);}
+#define CORE3D_NOTIFY(desc)		{::OutputDebugString(desc);}
+#endif
+//------------------------------------------------------------------------
+
+#ifndef WIN32
+#	ifdef _UNICODE
+#		define __T(x)	L ## x
+#	else
+#		define __T(x)	x
+#	endif
+#	define _T(x)       __T(x)
+
+#	include <stdio.h>
+#	define CORE3D_ERROR(desc)	{::fputs(desc, stderr);}
+#	ifdef _DEBUG
+#		define CORE3D_NOTIFY(desc)	{::fputs(desc, stderr);}
+#	else
+#		define CORE3D_NOTIFY(desc)	{}
+#	endif
+#endif
+
+#define CORE3D_SUCCESSFUL(res)	(Core3D::OK == res)
+#define CORE3D_FAILED(res)		(Core3D::OK != res)
+#define CORE3D_VERTEXFORMAT_DECL(iStream, iType, iRegister) \
+	{iStream, iType, iRegister}
+
+namespace Core3D
+{
+//------------------------------------------------------------------------
+// COMMENT : WIN32 Version
+	#ifdef WIN32
+	typedef HWND	WinHandle;
+	#else
+	typedef void*	WinHandle;
+	#endif
+//------------------------------------------------------------------------
+	typedef Vector4 ShaderReg;
+
+	const UINT32 VERTEX_CACH_SIZE			= 32;
+	const UINT32 VERTEX_SHADER_REGISTERS	= 8;
+	const UINT32 PIXEL_SHADER_REGISTERS		= 8;
+	const UINT32 NUM_SHADER_CONSTANTS		= 32;
+	const UINT32 MAX_VERTEX_STREAMS			= 8;
+	const UINT32 MAX_TEXTURE_SAMPLERS		= 16;
+	const UINT32 MAX_COLOR_BUFFERS			= 4;
+	const UINT32 MAX_SWAPCHAIN_BUFFERS		= 4;
+	const UINT32 MAX_WORKER_THREADS			= 64;
+	const UINT32 MAX_STENCIL_VALUE			= 0xff;
+
+	enum RenderState
+	{
+		RS_ZENABLE = 0,
+		RS_ZWRITEENABLE,
+		RS_ZFUNC,
+
+		RS_COLORWRITEENABLE,
+		RS_FILLMODE,
+		RS_CULLMODE,
+
+		RS_SUBDIVISIONMODE,
+		RS_SUBDIVISIONLEVELS,
+		RS_SUBDIVISIONPOSITIONREGISTER,
+		RS_SUBDIVISIONNORMALREGISTER,
+		RS_SUBDIVISIONMAXSCREENAREA,
+		RS_SUBDIVISIONMAXINNERLEVELS,
+
+		RS_SCISSORTESTENABLE,
+		RS_LINETHICKNESS,
+
+		// COMMENT : A pixel passes the stencil test if (RS_STENCILREF & RS_STENCILMASK) compares to (stencil & RS_STENCILMASK).
+		// The states apply to clockwise triangles and, unless two-sided stencil mode is enabled, counter-clockwise ones.
+		RS_STENCILENABLE,
+		RS_STENCILFUNC,						// CmpFunc
+		RS_STENCILREF,
+		RS_STENCILMASK,
+		RS_STENCILWRITEMASK,				// Bits of the stencil-buffer the operations change
+		RS_STENCILFAIL,						// StencilOp : Stencil test failed
+		RS_STENCILZFAIL,					// StencilOp : Stencil test passed, depth test failed
+		RS_STENCILPASS,						// StencilOp : Both tests passed
+		RS_TWOSIDEDSTENCILMODE,				// Counter-clockwise triangles use the RS_CCW_STENCIL* states
+		RS_CCW_STENCILFUNC,
+		RS_CCW_STENCILFAIL,
+		RS_CCW_STENCILZFAIL,
+		RS_CCW_STENCILPASS,
+
+		RS_NUMRENDERSTATES
+	};
+
+	enum CmpFunc
+	{
+		CMP_NEVER = 0,
+		CMP_EQUAL,
+		CMP_NOTEQUAL,
+		CMP_LESS,
+		CMP_LESSEQUAL,
+		CMP_GREATEREQUAL,
+		CMP_GREATER,
+		CMP_ALWAYS
+	};
+
+	enum StencilOp
+	{
+		SOP_KEEP = 0,
+		SOP_ZERO,
+		SOP_REPLACE,			// Sets RS_STENCILREF
+		SOP_INCRSAT,			// Increments, clamping to the largest stencil value
+		SOP_DECRSAT,			// Decrements, clamping to 0
+		SOP_INVERT,
+		SOP_INCR,				// Increments, wrapping around
+		SOP_DECR				// Decrements, wrapping around
+	};
+
+	enum Cull
+	{
+		CULL_NONE = 0,
+		CULL_CW,
+		CULL_CCW
+	};
+
+	enum Fill
+	{
+		FILL_SOLID = 0,
+		FILL_WIREFRAME
+	};
+
+	enum TextureSamplerState
+	{
+		TSS_ADDRESSU = 0,
+		TSS_ADDRESSV,
+		TSS_ADDRESSW,
+		TSS_MINFILTER,
+		TSS_MAGFILTER,
+		TSS_MIPFILTER,
+		TSS_MIPLODBIAS,
+		TSS_MAXMIPLEVEL,
+
+		TSS_NUMTEXTURESAMPLERSTATES
+	};
+
+	enum TextureAddress
+	{
+		TA_WRAP = 0,
+		TA_CLAMP
+	};
+
+	enum TextureFilter
+	{
+		TF_POINT = 0,
+		TF_LINEAR
+	};
+
+	enum SubDiv
+	{
+		SUBDIV_NONE = 0,
+		SUBDIV_SIMPLE,
+		SUBDIV_SMOOTH,
+		SUBDIV_ADAPTIVE
+	};
+
+	enum Format
+	{
+		FMT_R32F = 0,
+		FMT_R32G32F,
+		FMT_R32G32B32F,
+		FMT_R32G32B32A32F,
+
+		FMT_INDEX16,
+		FMT_INDEX32,
+
+		FMT_S8					// Stencil-buffers : 8-bit values, each pixel's is kept in a UINT32
+	};
+
+	enum PrimitiveType
+	{
+		PT_TRIANGLEFAN = 0,
+		PT_TRIANGLESTRIP,
+		PT_TRIANGLELIST
+	};
+
+	enum VertexElementType
+	{
+		VET_FLOAT32 = 0,
+		VET_VECTOR2,
+		VET_VECTOR3,
+		VET_VECTOR4
+	};
+
+	enum ShaderConstant
+	{
+		SC_WORLDMATRIX = 0,
+		SC_VIEWMATRIX,
+		SC_PROJECTIONMATRIX,
+		SC_WVPMATRIX
+	};
+
+	enum TextureSampleInput
+	{
+		TSI_2COORDS = 0,
+		TSI_3COORDS,
+		TSI_VECTOR
+	};
+
+	enum CubeFaces
+	{
+		CF_POSITIVE_X = 0,
+		CF_NEGATIVE_X,
+		CF_POSITIVE_Y,
+		CF_NEGATIVE_Y,
+		CF_POSITIVE_Z,
+		CF_NEGATIVE_Z
+	};
+
+	enum PixelShaderOutput
+	{
+		PSO_COLORONLY = 0,
+		PSO_COLORDEPTH
+	};
+
+	enum ShaderRegType
+	{
+		SRT_UNUSED = 0,
+		SRT_FLOAT32,
+		SRT_VECTOR2,
+		SRT_VECTOR3,
+		SRT_VECTOR4
+	};
+
+	// COMMENT : How the rasterizer interpolates a vertex shader output register across a triangle
+	enum ShaderRegInterpolation
+	{
+		SRI_PERSPECTIVE = 0,	// Perspective correct
+		SRI_LINEAR,				// Linear in screen-space, skips the division by W per pixel
+		SRI_FLAT				// Constant, taken from the triangle's first vertex
+	};
+
+	enum ClippingPlanes
+	{
+		CP_LEFT = 0,
+		CP_RIGHT,
+		CP_TOP,
+		CP_BOTTOM,
+		CP_NEAR,
+		CP_FAR,
+
+		CP_USER0,
+		CP_USER1,
+		CP_USER2,
+		CP_USER3,
+
+		CP_NUMPLANES
+	};
+
+	enum PresentFormat
+	{
+		PF_R8G8B8A8 = 0,
+		PF_B8G8R8A8,
+		PF_B8G8R8,
+		PF_R5G6B5,
+		PF_CUSTOM16		// 16 bit with arbitrary channel masks(see PresentConverter::SetCustom16BitLayout())
+	};
+
+	enum ToneMapping
+	{
+		TM_NONE = 0,	// Colors are clamped to [0, 1]
+		TM_REINHARD		// c / (1 + c)
+	};
+
+	enum PipelineStatisticsRange
+	{
+		PSR_DRAW = 0,	// Last draw call(consecutive draws of a command list are counted together)
+		PSR_FRAME,		// Draws of the last presented frame
+		PSR_TOTAL,		// Draws since the last call to Device::ResetPipelineStatistics()
+
+		PSR_NUMRANGES
+	};
+
+	enum ProfileStage
+	{
+		PST_SETUP = 0,			// Draw setup, primitive assembly and everything else not covered by a stage
+		PST_VERTEXFETCH,		// Vertex cache, stream decoding and vertex shader
+		PST_SUBDIVISION,
+		PST_CLIPPING,			// Triangle shader, clipping and culling
+		PST_TRIANGLESETUP,		// Gradients and edge setup
+		PST_RASTERIZATION,		// Scanlines and lines, including depth tests and buffer writes
+		PST_PIXELSHADING,		// Pixel shader, excluding its texture samples
+		PST_TEXTURESAMPLING,
+
+		PST_NUMSTAGES
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Structures
+	//////////////////////////////////////////////////////////////////////////
+	// COMMENT : Defines a rectangle.
+	struct Rect
+	{
+		UINT32		uiLeft, uiTop;
+		UINT32		uiRight, uiBottom;
+	};
+
+	// COMMENT : Defines a box. Added for volume texture support.
+	struct Box
+	{
+		UINT32		uiLeft, uiTop, uiFront;
+		UINT32		uiRight, uiBottom, uiBack;
+	};
+
+	// COMMENT : Callback receiving frames from a headless present-target.
+	// pFrame holds uiHeight rows of pixels in DeviceParameters::eFrameBufferFormat, uiPitch bytes apart.
+	// With a swap-chain the callback runs on the present thread, the presented back-buffer is free again once it returns.
+	typedef void (*PFN_PRESENTCALLBACK)(const BYTE8* pFrame, UINT32 uiWidth, UINT32 uiHeight, UINT32 uiPitch, void* pvUserData);
+
+	// COMMENT : Describes how color-buffers are converted when presented.
+	struct PresentConversion
+	{
+		ToneMapping	eToneMapping;	// Tone-mapping curve applied to red, green and blue
+		FLOAT32		fExposure;		// Scale applied to red, green and blue before tone-mapping
+		bool		bDither;		// Applies 4x4 ordered dithering before quantization
+	};
+
+	// COMMENT : Counters of the pipeline stages, see Device::GetPipelineStatistics().
+	// Only counted if CORE3D_PIPELINE_STATISTICS is enabled.
+	struct PipelineStatistics
+	{
+		UINT32		uiFetchedVertices;					// Vertex indices read by the primitive assembly
+		UINT32		uiVertexCacheHits;
+		UINT32		uiVertexCacheMisses;
+		UINT32		uiVertexShaderInvocations;			// Including the invocations for subdivided vertices
+		UINT32		uiSubdivisionVertices;				// Vertices generated by subdivision
+
+		UINT32		uiInputTriangles;					// Triangles assembled from the fetched vertices
+		UINT32		uiSubdividedTriangles;				// Triangles entering the triangle shader after subdivision
+		UINT32		uiRejectedTriangles;				// Rejected by the triangle shader
+		UINT32		uiClippedTriangles;					// Cut by at least one clipping plane
+		UINT32		auiPlaneClippedTriangles[CP_NUMPLANES];	// Cut by each clipping plane
+		UINT32		uiGuardBandTriangles;				// Crossing the view-port inside of the guard-band(not clipped to its sides)
+		UINT32		uiInvisibleTriangles;				// Entirely outside of a clipping plane or the scissor rectangle
+		UINT32		uiCulledTriangles;
+		UINT32		uiRasterizedTriangles;				// Triangles of the clipped polygons passed to the rasterizer
+		UINT32		uiEmptyTriangles;					// Covering no pixel center, discarded before their setup
+		UINT32		uiSmallTriangles;					// Rasterized by testing the pixel centers of their bounding box
+
+		UINT32		uiStencilTestedPixels;
+		UINT32		uiStencilPassedPixels;
+		UINT32		uiDepthTestedPixels;
+		UINT32		uiDepthPassedPixels;
+		UINT32		uiShadedPixels;						// Pixel shader invocations
+		UINT32		uiKilledPixels;						// Pixels the pixel shader rejected
+		UINT32		auiTextureSamples[MAX_TEXTURE_SAMPLERS];	// Samples taken by shaders per sampler
+	};
+
+	// COMMENT : This structure defines the device parameters.
+	struct DeviceParameters
+	{
+		WinHandle	hDeviceWnd;								// Handle to the output window(NULL for headless presentation)
+		bool		bWindowed;								// True if the application runs windowed, false if it runs in full screen
+		UINT32		uiFullScreenColorBits;					// Bit depth of back-buffer in full screen mode(ignored in windowed mode). Valid values : 32, 24, 16.
+		UINT32		uiBackBufferWidth, uiBackBufferHeight;	// Dimension of the back-buffer in pixels.
+
+		// COMMENT : Headless presentation(used if hDeviceWnd is NULL or on platforms without a window system)
+		BYTE8*				pFrameBuffer;					// Optional destination of presented frames(uiBackBufferWidth * uiBackBufferHeight pixels, tightly packed).
+		PFN_PRESENTCALLBACK	pfnPresentCallback;				// Optional function called after each presented frame.
+		void*				pvPresentUserData;				// User data passed to pfnPresentCallback.
+		PresentFormat		eFrameBufferFormat;				// Pixel format of presented frames. PF_CUSTOM16 isn't supported.
+
+		UINT32				uiWorkerThreads;				// Number of threads executing the device's jobs, including the waiting thread(0 : one per processor).
+		UINT32				uiBackBufferCount;				// Number of back-buffers presented asynchronously(0 or 1 : Present() is synchronous, at most MAX_SWAPCHAIN_BUFFERS).
+	};
+
+	// COMMENT : Describes a vertex element.
+	struct VertexElement
+	{
+		UINT32				uiStream;		// Index of the stream this element is loaded from.
+		VertexElementType	eType;			// Type of this vertex element. Set this field to a member of the enumeration type.
+		UINT32				uiRegister;		// The register of the vertex shader the vertex element's value will be passed to.
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Internal structures
+	//////////////////////////////////////////////////////////////////////////
+	// COMMENT : Describes the vertex shader input.
+	// this structure is used internally by devices.
+	struct VertexShaderInput
+	{
+		ShaderReg	kShaderInputs[VERTEX_SHADER_REGISTERS];
+	};
+
+	// COMMENT : Describes the vertex shader output.
+	// this structure is used internally by devices. The position comes first, so the registers in use up to the
+	// highest one form a prefix of the structure and only that part needs to be copied.
+	struct VertexShaderOutput
+	{
+		Vector4				kPosition;								// Position of this vertex.
+		ShaderReg			kShaderOutputs[PIXEL_SHADER_REGISTERS];	// Vertex shader output registers, which are in turn used as pixel
+																	// shader input registers.
+	};
+
+	// COMMENT : Describes a vertex of triangle subdivision.
+	// this structure is used internally by devices.
+	struct SubdivisionVertex
+	{
+		VertexShaderOutput	kVertexOutput;							// Vertex shader output computed from kSourceInput.
+		VertexShaderInput	kSourceInput;							// Original vertex shader input fetched from vertex streams
+																	// or interpolated for a new vertex.
+	};
+
+	// COMMENT : Describes a structure that is used for triangle gradient storage.
+	// this structure is used internally by devices.
+	struct TriangleInfo
+	{
+		FLOAT32		fCommonGradient;								// Gradient constant.
+		const VertexShaderOutput* pkBaseVertex;						// Base vertex for gradient computations.
+		FLOAT32		fZDdx, fZDdy;									// Z partial derivatives with respect to the screen space 
+																	// X and Y coordinates.
+		FLOAT32		fWDdx, fWDdy;									// W partial derivatives with respect to the screen space
+																	// X and Y coordinates.
+		ShaderReg	kShaderOutputsDdx[PIXEL_SHADER_REGISTERS];		// Shader register partial derivatives with respect to the
+																	// screen space X coordinates.
+		ShaderReg	kShaderOutputsDdy[PIXEL_SHADER_REGISTERS];		// Shader register partial derivatives with respect to the
+																	// screen space Y coordinates.
+		UINT32		uiCurrentPixelX, uiCurrentPixelY;				// Integer coordinates of current pixel:
+																	// needed by pixel shader for computation of partial derivatives.
+		FLOAT32		fCurrentPixelInvW;								// 1.0f / W of the current pixel:
+																	// needed by pixel shader for computation of partial derivatives.
+	};
+
+	// COMMENT : Describes a structure that is used for vertex caching.
+	// this structure is used internally by devices.
+	struct VertexCacheEntry
+	{
+		UINT32				uiVertexIndex;	// Index of the contained vertex in the vertex buffer.
+		VertexShaderOutput	kVertexOutput;	// Vertex shader output, vertex data.
+		UINT32				uiFetchTime;	// Whenever a vertex cache entry is reserved for drawing(updated or simply 'touched
+											// and returned') it's fetch-time is set to m_uiFetchedVertices.
+	};
 }
\ No newline at end of file
@@ -1,2448 +1,4068 @@
-#include "Device.h"
-#include "Object.h"
-#include "BaseTexture.h"
-#include "CubeTexture.h"
-#include "IndexBuffer.h"
-#include "PresentTarget.h"
-#include "RenderTarget.h"
-#include "Shaders.h"
-#include "Surface.h"
-#include "Texture.h"
-#include "PrimitiveAssembler.h"
-#include "VertexBuffer.h"
-#include "VertexFormat.h"
-#include "Volume.h"
-#include "VolumeTexture.h"
-
-namespace Core3D
-{
-	Device::Device(Object* pkParent, const DeviceParameters* pkDeviceParameters)
-		: m_pkParent(pkParent)
-		, m_pkPresentTarget(NULL)
-		, m_pkVertexFormat(NULL)
-		, m_pkPrimitiveAssembler(NULL)
-		, m_pkVertexShader(NULL)
-		, m_pkTriangleShader(NULL)
-		, m_pkPixelShader(NULL)
-		, m_pkIndexBuffer(NULL)
-		, m_pkRenderTarget(NULL)
-	{
-		m_pkParent->AddRef();
-
-		memcpy(&m_kDeviceParameters, pkDeviceParameters, sizeof(DeviceParameters));
-		
-		memset(m_akVertexStreams,	0, sizeof(m_akVertexStreams));
-		memset(m_akTextureSamplers, 0, sizeof(m_akTextureSamplers));
-		memset(&m_rcScissorRect,	0, sizeof(m_rcScissorRect));
-		memset(&m_kRenderInfo,		0, sizeof(m_kRenderInfo));
-		memset(&m_kTriangleInfo,	0, sizeof(m_kTriangleInfo));
-		memset(m_akVertexCache,		0, sizeof(m_akVertexCache));
-		memset(m_akClipVertices,	0, sizeof(m_akClipVertices));
-		memset(m_aapkClipVertices,	0, sizeof(m_aapkClipVertices));
-
-		SetDefaultRenderStates();
-		SetDefaultTextureSamplerStates();
-		SetDefaultClippingPlanes();
-	}
-
-	Device::~Device()
-	{
-		CORE3D_SAFE_RELEASE(m_pkPresentTarget);
-		CORE3D_SAFE_RELEASE(m_pkParent);
-	}
-
-	Result Device::Create()
-	{
-		m_pkPresentTarget = new PresentTargetWin32(this);
-
-		if(NULL == m_pkPresentTarget)
-		{
-			CORE3D_ERROR(_T("Device::Create() - Out of memory, cannot create present target.\n"));
-			return OUT_OF_MEMORY;
-		}
-		return m_pkPresentTarget->Create();
-	}
-
-	void Device::SetDefaultRenderStates()
-	{
-		SetRenderState(RS_ZENABLE, BT_TRUE);
-		SetRenderState(RS_ZWRITEENABLE, BT_TRUE);
-		SetRenderState(RS_ZFUNC, CMP_LESS);
-
-		SetRenderState(RS_COLORWRITEENABLE, BT_TRUE);
-		SetRenderState(RS_FILLMODE, FILL_SOLID);
-		SetRenderState(RS_CULLMODE, CULL_CCW);
-
-		SetRenderState(RS_SUBDIVISIONMODE, SUBDIV_NONE);
-		SetRenderState(RS_SUBDIVISIONLEVELS, 1);
-		SetRenderState(RS_SUBDIVISIONPOSITIONREGISTER, 0);
-		SetRenderState(RS_SUBDIVISIONNORMALREGISTER, 1);
-		const FLOAT32 DEFAULT_SUBDIVISION_MAX_SCREENAREA = 1.0f;
-		SetRenderState(RS_SUBDIVISIONMAXSCREENAREA, *((UINT32*)&DEFAULT_SUBDIVISION_MAX_SCREENAREA));
-		SetRenderState(RS_SUBDIVISIONMAXINNERLEVELS, 1);
-
-		SetRenderState(RS_SCISSORTESTENABLE, BT_FALSE);
-		SetRenderState(RS_LINETHICKNESS, 1);
-	}
-
-	void Device::SetDefaultTextureSamplerStates()
-	{
-		const FLOAT32 MIP_LOD_BIAS	= 0.0f;
-		const FLOAT32 MAX_MIP_LEVEL = 16.0f;
-		for(UINT32 uiTextureSampler = 0; uiTextureSampler < MAX_TEXTURE_SAMPLERS; ++uiTextureSampler)
-		{
-			SetTextureSamplerState(uiTextureSampler, TSS_ADDRESSU, TA_WRAP);
-			SetTextureSamplerState(uiTextureSampler, TSS_ADDRESSV, TA_WRAP);
-			SetTextureSamplerState(uiTextureSampler, TSS_ADDRESSW, TA_WRAP);
-
-			SetTextureSamplerState(uiTextureSampler, TSS_MINFILTER, TF_LINEAR);
-			SetTextureSamplerState(uiTextureSampler, TSS_MAGFILTER, TF_LINEAR);
-			SetTextureSamplerState(uiTextureSampler, TSS_MIPFILTER, TF_POINT);
-
-			SetTextureSamplerState(uiTextureSampler, TSS_MIPLODBIAS, *((UINT32*)&MIP_LOD_BIAS));
-			SetTextureSamplerState(uiTextureSampler, TSS_MAXMIPLEVEL, *((UINT32*)&MAX_MIP_LEVEL));
-		}
-	}
-
-	void Device::SetDefaultClippingPlanes()
-	{
-		m_kRenderInfo.akClippingPlanes[CP_LEFT]		= Plane( 1.0f,  0.0f,  0.0f, 1.0f);
-		m_kRenderInfo.akClippingPlanes[CP_RIGHT]	= Plane(-1.0f,  0.0f,  0.0f, 1.0f);
-		m_kRenderInfo.akClippingPlanes[CP_TOP]		= Plane( 0.0f, -1.0f,  0.0f, 1.0f);
-		m_kRenderInfo.akClippingPlanes[CP_BOTTOM]	= Plane( 0.0f,  1.0f,  0.0f, 1.0f);
-		m_kRenderInfo.akClippingPlanes[CP_NEAR]		= Plane( 0.0f,  0.0f,  1.0f, 0.0f);
-		m_kRenderInfo.akClippingPlanes[CP_FAR]		= Plane( 0.0f,  0.0f, -1.0f, 1.0f);
-
-		// COMMENT : Enable the default clipping planes.
-		for(UINT32 uiPlane = CP_LEFT; uiPlane <= CP_FAR; ++uiPlane)
-		{
-			m_kRenderInfo.abClippingPlaneEnabled[uiPlane] = true;
-		}
-	}
-
-	Result Device::SetRenderState(RenderState eRenderState, UINT32 uiValue)
-	{
-		if(eRenderState >= RS_NUMRENDERSTATES)
-		{
-			CORE3D_ERROR(_T("Device::SetRenderState() - Invalid render-state.\n"));
-			return INVALID_PARAMETERS;
-		}
-		m_auiRenderStates[eRenderState] = uiValue;
-		return OK;
-	}
-
-	Result Device::GetRenderState(RenderState eRenderState, UINT32& ruiValue)
-	{
-		if(eRenderState >= RS_NUMRENDERSTATES)
-		{
-			ruiValue = 0;
-			CORE3D_ERROR(_T("Device::GetRenderState() - Invalid render-state.\n"));
-			return INVALID_PARAMETERS;
-		}
-		ruiValue = m_auiRenderStates[eRenderState];
-		return OK;
-	}
-
-	Result Device::SetVertexFormat(VertexFormat* pkVertexFormat)
-	{
-		m_pkVertexFormat = pkVertexFormat;
-		if(NULL == pkVertexFormat) {return OK;}
-
-		// COMMENT : Initialize part of internal render-information structure.
-		for(UINT32 uiReg = 0; uiReg < VERTEX_SHADER_REGISTERS; ++uiReg)
-		{
-			m_kRenderInfo.aeVSInputs[uiReg] = SRT_UNUSED;
-		}
-
-		const VertexElement* pkCurrentVertexElement = m_pkVertexFormat->GetElements();
-		UINT32 uiElement = m_pkVertexFormat->GetNumVertexElements();
-		while(uiElement--)
-		{
-			switch(pkCurrentVertexElement->eType)
-			{
-			case VET_FLOAT32: m_kRenderInfo.aeVSInputs[pkCurrentVertexElement->uiRegister] = SRT_FLOAT32; break;
-			case VET_VECTOR2: m_kRenderInfo.aeVSInputs[pkCurrentVertexElement->uiRegister] = SRT_VECTOR2; break;
-			case VET_VECTOR3: m_kRenderInfo.aeVSInputs[pkCurrentVertexElement->uiRegister] = SRT_VECTOR3; break;
-			case VET_VECTOR4: m_kRenderInfo.aeVSInputs[pkCurrentVertexElement->uiRegister] = SRT_VECTOR4; break;
-			default: CORE3D_ERROR(_T("Device::SetVertexFormat() - Invalid vertex element type.\n")); return INVALID_PARAMETERS;
-			}
-			++pkCurrentVertexElement;
-		}
-		return OK;
-	}
-
-	VertexFormat* Device::GetVertexFormat()
-	{
-		if(NULL != m_pkVertexFormat) {m_pkVertexFormat->AddRef();}
-		return m_pkVertexFormat;
-	}
-
-	void Device::SetPrimitiveAssembler(PrimitiveAssembler* pkPrimitiveAsembler)
-	{
-		m_pkPrimitiveAssembler = pkPrimitiveAsembler;
-	}
-
-	PrimitiveAssembler* Device::GetPrimitiveAssembler()
-	{
-		if(NULL != m_pkPrimitiveAssembler) {m_pkPrimitiveAssembler->AddRef();}
-		return m_pkPrimitiveAssembler;
-	}
-
-	Result Device::SetVertexShader(VertexShader* pkVertexShader)
-	{
-		if(NULL == pkVertexShader)
-		{
-			m_pkVertexShader = pkVertexShader;
-			return OK;
-		}
-
-		// COMMENT : Validate vertex shader register output types.
-		for(UINT32 uiReg = 0; uiReg < VERTEX_SHADER_REGISTERS; ++uiReg)
-		{
-			UINT32 uiType = pkVertexShader->GetOutputRegisters(uiReg);
-			if((uiType < SRT_UNUSED) || (uiType > SRT_VECTOR4))
-			{
-				CORE3D_ERROR(_T("Device::SetVertexShader() - Type of vertex-shader output register is invalid.\n"));
-				return INVALID_STATE;
-			}
-		}
-		m_pkVertexShader = pkVertexShader;
-		return OK;
-	}
-
-	VertexShader* Device::GetVertexShader()
-	{
-		if(NULL != m_pkVertexShader) {m_pkVertexShader->AddRef();}
-		return m_pkVertexShader;
-	}
-
-	void Device::SetTriangleShader(TriangleShader* pkTriangleShader)
-	{
-		m_pkTriangleShader = pkTriangleShader;
-	}
-
-	TriangleShader* Device::GetTriangleShader()
-	{
-		if(NULL != m_pkTriangleShader) {m_pkTriangleShader->AddRef();}
-		return m_pkTriangleShader;
-	}
-
-	Result Device::SetPixelShader(PixelShader* pkPixelShader)
-	{
-		m_pkPixelShader = pkPixelShader;
-		return OK;
-	}
-
-	PixelShader* Device::GetPixelShader()
-	{
-		if(NULL != m_pkPixelShader) {m_pkPixelShader->AddRef();}
-		return m_pkPixelShader;
-	}
-
-	Result Device::SetIndexBuffer(IndexBuffer* pkIndexBuffer)
-	{
-		m_pkIndexBuffer = pkIndexBuffer;
-		return OK;
-	}
-
-	IndexBuffer* Device::GetIndexBuffer()
-	{
-		if(NULL != m_pkIndexBuffer) {m_pkIndexBuffer->AddRef();}
-		return m_pkIndexBuffer;
-	}
-
-	Result Device::SetVertexStream(UINT32 uiStreamNumber, VertexBuffer* pkVertexBuffer, UINT32 uiOffset, UINT32 uiStride)
-	{
-		if(uiStreamNumber >= MAX_VERTEX_STREAMS)
-		{
-			CORE3D_ERROR(_T("Device::SetVertexStream() - Stream number exceeds number of available vertex streams.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		if(0 == uiStride)
-		{
-			CORE3D_ERROR(_T("Device::SetVertexStream() - Stride is 0.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		m_akVertexStreams[uiStreamNumber].pkVertexBuffer	= pkVertexBuffer;
-		m_akVertexStreams[uiStreamNumber].uiOffset			= uiOffset;
-		m_akVertexStreams[uiStreamNumber].uiStride			= uiStride;
-		return OK;
-	}
-
-	Result Device::GetVertexStream(UINT32 uiStreamNumber, VertexBuffer** ppkVertexBuffer, UINT32& ruiOffset, UINT32& ruiStride)
-	{
-		if(uiStreamNumber >= MAX_VERTEX_STREAMS)
-		{
-			if(NULL != ppkVertexBuffer) {*ppkVertexBuffer = NULL;}
-			ruiOffset = 0;
-			ruiStride = 0;
-			CORE3D_ERROR(_T("Device::GetVertexStream() - Stream number exceeds number of available vertex stream.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		if(NULL != ppkVertexBuffer)
-		{
-			*ppkVertexBuffer = m_akVertexStreams[uiStreamNumber].pkVertexBuffer;
-			if(NULL != m_akVertexStreams[uiStreamNumber].pkVertexBuffer) {m_akVertexStreams[uiStreamNumber].pkVertexBuffer->AddRef();}
-		}
-		ruiOffset = m_akVertexStreams[uiStreamNumber].uiOffset;
-		ruiStride = m_akVertexStreams[uiStreamNumber].uiStride;
-		return OK;
-	}
-
-	Result Device::SetTexture(UINT32 uiSamplerNumber, BaseTexture* pkTexture)
-	{
-		if(uiSamplerNumber >= MAX_TEXTURE_SAMPLERS)
-		{
-			CORE3D_ERROR(_T("Device::SetTexture() - Sampler number exceeds number of available texture samplers.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		m_akTextureSamplers[uiSamplerNumber].pkTexture = pkTexture;
-		if(NULL != pkTexture)
-		{
-			m_akTextureSamplers[uiSamplerNumber].eTextureSampleInput = pkTexture->GetTextureSampleInput();
-		}
-		return OK;
-	}
-
-	Result Device::GetTexture(UINT32 uiSamplerNumber, BaseTexture** ppkTexture)
-	{
-		if(uiSamplerNumber >= MAX_TEXTURE_SAMPLERS)
-		{
-			if(NULL != ppkTexture) {*ppkTexture = NULL;}
-			CORE3D_ERROR(_T("Device::GetTexture() - Sampler number exceeds number of available texture samplers.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		if(NULL == ppkTexture)
-		{
-			CORE3D_ERROR(_T("Device::GetTexture() - Parameter output texture pointer to NULL.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		*ppkTexture = m_akTextureSamplers[uiSamplerNumber].pkTexture;
-		if(NULL != m_akTextureSamplers[uiSamplerNumber].pkTexture) {m_akTextureSamplers[uiSamplerNumber].pkTexture->AddRef();}
-		return OK;
-	}
-
-	Result Device::SetTextureSamplerState(UINT32 uiSamplerNumber, TextureSamplerState eTextureSamplerState, UINT32 uiState)
-	{
-		if(uiSamplerNumber >= MAX_TEXTURE_SAMPLERS)
-		{
-			CORE3D_ERROR(_T("Device::SetTextureSamplerState() - Sampler number exceeds number of available texture samplers.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		if(eTextureSamplerState >= TSS_NUMTEXTURESAMPLERSTATES)
-		{
-			CORE3D_ERROR(_T("Device::SetTextureSamplerState() - Invalid texture sampler state.\n"));
-			return INVALID_PARAMETERS;
-		}
-		m_akTextureSamplers[uiSamplerNumber].auiTexureSamplerStates[eTextureSamplerState] = uiState;
-		return OK;
-	}
-
-	Result Device::GetTextureSamplerState(UINT32 uiSamplerNumber, TextureSamplerState eTextureSamplerState, UINT32& ruiState)
-	{
-		if(uiSamplerNumber >= MAX_TEXTURE_SAMPLERS)
-		{
-			ruiState = 0;
-			CORE3D_ERROR(_T("Device::GetTextureSamplerState() - Sampler number exceeds number of available texture samplers.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		if(eTextureSamplerState >= TSS_NUMTEXTURESAMPLERSTATES)
-		{
-			CORE3D_ERROR(_T("Device::GetTextureSamplerState() - Invalid texture sampler state.\n"));
-			return INVALID_PARAMETERS;
-		}
-		ruiState = m_akTextureSamplers[uiSamplerNumber].auiTexureSamplerStates[eTextureSamplerState];
-		return OK;
-	}
-
-	Result Device::SampleTexture(Vector4& rkColor, UINT32 uiSamplerNumber, FLOAT32 fU, FLOAT32 fV, FLOAT32 fW, const Vector4* pkXGradient, const Vector4* pkYGradient)
-	{
-		if(uiSamplerNumber >= MAX_TEXTURE_SAMPLERS)
-		{
-			rkColor = Vector4(0.0f, 0.0f, 0.0f, 0.0f);
-			CORE3D_ERROR(_T("Device::SampleTexture() - Sample number exceeds number of available texture samplers.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		const TextureSampler& rkTextureSampler	= m_akTextureSamplers[uiSamplerNumber];
-		BaseTexture* pkTexture					= rkTextureSampler.pkTexture;
-		if(NULL == pkTexture)
-		{
-			rkColor = Vector4(0.0f, 0.0f, 0.0f, 0.0f);
-			return OK;
-		}
-
-		switch(rkTextureSampler.eTextureSampleInput)
-		{
-		case TSI_VECTOR:
-			if((0.0f == fU) && (0.0f == fV) && (0.0f == fW))
-			{
-				rkColor = Vector4(0.0f, 0.0f, 0.0f, 0.0f);
-				CORE3D_ERROR(_T("Device::SampleTexture() - Sampling vector [u, v, w] = [0, 0, 0].\n"));
-				return INVALID_PARAMETERS;
-			}
-			break;
-		case TSI_3COORDS:
-			switch(rkTextureSampler.auiTexureSamplerStates[TSS_ADDRESSW])
-			{
-			case TA_WRAP:	fW -= ((FLOAT32)Core3D::FtoL(fW));
-			case TA_CLAMP:	fW = Core3D::Saturate(fW);			break;
-			default:
-				rkColor = Vector4(0.0f, 0.0f, 0.0f, 0.0f);
-				CORE3D_ERROR(_T("Device::SampleTexture() - Value of texture sampler state TSS_ADDRESSW is invalid.\n"));
-				return INVALID_STATE;
-			}
-		case TSI_2COORDS:
-			switch(rkTextureSampler.auiTexureSamplerStates[TSS_ADDRESSU])
-			{
-			case TA_WRAP:	fU -= ((FLOAT32)Core3D::FtoL(fU));
-			case TA_CLAMP:	fU = Core3D::Saturate(fU);			break;
-			default:
-				rkColor = Vector4(0.0f, 0.0f, 0.0f, 0.0f);
-				CORE3D_ERROR(_T("Device::SampleTexture() - Value of texture sampler state TSS_ADDRESSU is invalid.\n"));
-				return INVALID_STATE;
-			}
-
-			switch(rkTextureSampler.auiTexureSamplerStates[TSS_ADDRESSV])
-			{
-			case TA_WRAP:	fV -= ((FLOAT32)Core3D::FtoL(fV));
-			case TA_CLAMP:	fV = Core3D::Saturate(fV);			break;
-			default:
-				rkColor = Vector4(0.0f, 0.0f, 0.0f, 0.0f);
-				CORE3D_ERROR(_T("Device::SampleTexture() - Value of texture sampler state TSS_ADDRESSV is invalid.\n"));
-				return INVALID_STATE;
-			}
-			break;
-		default:
-			rkColor = Vector4(0.0f, 0.0f, 0.0f, 0.0f);
-			CORE3D_ERROR(_T("Device::SampleTexture() - Invalid texture sampling input.\n"));
-			return INVALID_STATE;
-		}
-
-		return pkTexture->SampleTexture(rkColor, fU, fV, fW, pkXGradient, pkYGradient, rkTextureSampler.auiTexureSamplerStates);
-	}
-
-	void Device::SetRenderTarget(RenderTarget* pkRenderTarget)
-	{
-		m_pkRenderTarget = pkRenderTarget;
-	}
-
-	RenderTarget* Device::GetRenderTarget()
-	{
-		if(NULL != m_pkRenderTarget) {m_pkRenderTarget->AddRef();}
-		return m_pkRenderTarget;
-	}
-
-	Result Device::SetScissorRect(const Rect& rcScissorRect)
-	{
-		if(	(rcScissorRect.uiLeft >= rcScissorRect.uiRight) || 
-			(rcScissorRect.uiTop >= rcScissorRect.uiBottom) )
-		{
-			CORE3D_ERROR(_T("Device::SetScissorRect() - Invalid scissor rect.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		m_rcScissorRect = rcScissorRect;
-		// COMMENT : Construct planes for clipping to the scissor rect.
-		m_kRenderInfo.akScissorPlanes[0] = Plane( 1.0f,  0.0f, 0.0f, -(FLOAT32)m_rcScissorRect.uiLeft);
-		m_kRenderInfo.akScissorPlanes[1] = Plane(-1.0f,  0.0f, 0.0f,  (FLOAT32)m_rcScissorRect.uiRight);
-		m_kRenderInfo.akScissorPlanes[2] = Plane( 0.0f,  1.0f, 0.0f, -(FLOAT32)m_rcScissorRect.uiTop);
-		m_kRenderInfo.akScissorPlanes[3] = Plane( 0.0f, -1.0f, 0.0f,  (FLOAT32)m_rcScissorRect.uiBottom);
-
-		return OK;
-	}
-
-	Rect Device::GetScissorRect()
-	{
-		return m_rcScissorRect;
-	}
-
-	Result Device::SetDepthBounds(FLOAT32 fMinZ, FLOAT32 fMaxZ)
-	{
-		if( (fMinZ < 0.0f) || (fMinZ > 1.0f) || 
-			(fMaxZ < 0.0f) || (fMaxZ > 1.0f) || 
-			(fMinZ >= fMaxZ) )
-		{
-			CORE3D_ERROR(_T("Device::SetDepthBounds() - Invalid depth bounds.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		m_kRenderInfo.akClippingPlanes[CP_NEAR].d	= fMinZ;
-		m_kRenderInfo.akClippingPlanes[CP_FAR].d	= fMaxZ;
-
-		return OK;
-	}
-
-	void Device::GetDepthBounds(FLOAT32& rfMinZ, FLOAT32& rfMaxZ)
-	{
-		rfMinZ = m_kRenderInfo.akClippingPlanes[CP_NEAR].d;
-		rfMaxZ = m_kRenderInfo.akClippingPlanes[CP_FAR].d;
-	}
-
-	Result Device::SetClippingPlane(ClippingPlanes eIndex, const Plane* pkPlane)
-	{
-		if((eIndex < CP_USER0) || (eIndex >= CP_NUMPLANES)) {return INVALID_PARAMETERS;}
-
-		if(NULL != pkPlane)
-		{
-			m_kRenderInfo.akClippingPlanes[eIndex]			= *pkPlane;
-			m_kRenderInfo.abClippingPlaneEnabled[eIndex]	= true;
-		}
-		else
-		{
-			m_kRenderInfo.abClippingPlaneEnabled[eIndex]	= false;
-		}
-		return OK;
-	}
-
-	Result Device::GetClippingPlane(ClippingPlanes eIndex, Plane& rkPlane)
-	{
-		if((eIndex < CP_USER0) || (eIndex >= CP_NUMPLANES))			{return INVALID_PARAMETERS;}
-		if(false == m_kRenderInfo.abClippingPlaneEnabled[eIndex])	{return INVALID_STATE;}
-
-		rkPlane = m_kRenderInfo.akClippingPlanes[eIndex];
-		return OK;
-	}
-
-	UINT32 Device::GetRenderedPixels()
-	{
-		return m_kRenderInfo.uiRenderedPixels;
-	}
-
-	Result Device::CreateVertexFormat(VertexFormat** ppkVertexFormat, const VertexElement* pkVertexDeclaration, UINT32 uiVertexDeclSize)
-	{
-		if(NULL == ppkVertexFormat)
-		{
-			CORE3D_ERROR(_T("Device::CreateVertexFormat() - Parameter vertex-format pointers to NULL.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		*ppkVertexFormat = new VertexFormat(this);
-		if(NULL == (*ppkVertexFormat))
-		{
-			CORE3D_ERROR(_T("Device::CreateVertexFormat() - Out of memory, cannot create vertex format.\n"));
-			return OUT_OF_MEMORY;
-		}
-
-		Result eResult = (*ppkVertexFormat)->Create(pkVertexDeclaration, uiVertexDeclSize);
-		if(CORE3D_FAILED(eResult))
-		{
-			CORE3D_SAFE_RELEASE(*ppkVertexFormat);
-			return eResult;
-		}
-		return OK;
-	}
-
-	Result Device::CreateIndexBuffer(IndexBuffer** ppkIndexBuffer, UINT32 uiLength, Format eFormat)
-	{
-		if(NULL == ppkIndexBuffer)
-		{
-			CORE3D_ERROR(_T("Device::CreateIndexBuffer() - Parameter index-buffer pointers to NULL.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		*ppkIndexBuffer = new IndexBuffer(this);
-		if(NULL == (*ppkIndexBuffer))
-		{
-			CORE3D_ERROR(_T("Device::CreateIndexBuffer() - Out of memory, cannot create indexbuffer.\n"));
-			return OUT_OF_MEMORY;
-		}
-
-		Result eResult = (*ppkIndexBuffer)->Create(uiLength, eFormat);
-		if(CORE3D_FAILED(eResult))
-		{
-			CORE3D_SAFE_RELEASE(*ppkIndexBuffer);
-			return eResult;
-		}
-		return OK;
-	}
-
-	Result Device::CreateVertexBuffer(VertexBuffer** ppkVertexBuffer, UINT32 uiLength)
-	{
-		if(NULL == ppkVertexBuffer)
-		{
-			CORE3D_ERROR(_T("Device::CreateVertexBuffer() - Parameter vertex-buffer pointers to NULL.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		*ppkVertexBuffer = new VertexBuffer(this);
-		if(NULL == (*ppkVertexBuffer))
-		{
-			CORE3D_ERROR(_T("Device::CreateVertexBuffer() - Out of memory, cannot create vertexbuffer.\n"));
-			return OUT_OF_MEMORY;
-		}
-
-		Result eResult = (*ppkVertexBuffer)->Create(uiLength);
-		if(CORE3D_FAILED(eResult))
-		{
-			CORE3D_SAFE_RELEASE(*ppkVertexBuffer);
-			return eResult;
-		}
-		return OK;
-	}
-
-	Result Device::CreateSurface(Surface** ppkSurface, UINT32 uiWidth, UINT32 uiHeight, Format eFormat)
-	{
-		if(NULL == ppkSurface)
-		{
-			CORE3D_ERROR(_T("Device::CreateSurface() - Parameter surface pointers to NULL.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		*ppkSurface = new Surface(this);
-		if(NULL == (*ppkSurface))
-		{
-			CORE3D_ERROR(_T("Device::CreateSurface() - Out of memory, cannot create surface.\n"));
-			return OUT_OF_MEMORY;
-		}
-
-		Result eResult = (*ppkSurface)->Create(uiWidth, uiHeight, eFormat);
-		if(CORE3D_FAILED(eResult))
-		{
-			CORE3D_SAFE_RELEASE(*ppkSurface);
-			return eResult;
-		}
-		return OK;
-	}
-
-	Result Device::CreateTexture(Texture** ppkTexture, UINT32 uiWidth, UINT32 uiHeight, UINT32 uiMipLevels, Format eFormat)
-	{
-		if(NULL == ppkTexture)
-		{
-			CORE3D_ERROR(_T("Device::CreateTexture() - Parameter texture pointers to NULL.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		*ppkTexture = new Texture(this);
-		if(NULL == (*ppkTexture))
-		{
-			CORE3D_ERROR(_T("Device::CreateTexture() - Out of memory, cannot create texture.\n"));
-			return OUT_OF_MEMORY;
-		}
-
-		Result eResult = (*ppkTexture)->Create(uiWidth, uiHeight, uiMipLevels, eFormat);
-		if(CORE3D_FAILED(eResult))
-		{
-			CORE3D_SAFE_RELEASE(*ppkTexture);
-			return eResult;
-		}
-		return OK;
-	}
-
-	Result Device::CreateCubeTexture(CubeTexture** ppkCubeTexture, UINT32 uiEdgeLength, UINT32 uiMipLevels, Format eFormat)
-	{
-		if(NULL == ppkCubeTexture)
-		{
-			CORE3D_ERROR(_T("Device::CreateCubeTexture() - Parameter cube-texture pointers to NULL.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		*ppkCubeTexture = new CubeTexture(this);
-		if(NULL == (*ppkCubeTexture))
-		{
-			CORE3D_ERROR(_T("Device::CreateCubeTexture() - Out of memory, cannot create cube-texture.\n"));
-			return OUT_OF_MEMORY;
-		}
-
-		Result eResult = (*ppkCubeTexture)->Create(uiEdgeLength, uiMipLevels, eFormat);
-		if(CORE3D_FAILED(eResult))
-		{
-			CORE3D_SAFE_RELEASE(*ppkCubeTexture);
-			return eResult;
-		}
-		return OK;
-	}
-
-	Result Device::CreateVolume(Volume** ppkVolume, UINT32 uiWidth, UINT32 uiHeight, UINT32 uiDepth, Format eFormat)
-	{
-		if(NULL == ppkVolume)
-		{
-			CORE3D_ERROR(_T("Device::CreateVolume() - Parameter volume pointers to NULL.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		*ppkVolume = new Volume(this);
-		if(NULL == (*ppkVolume))
-		{
-			CORE3D_ERROR(_T("Device::CreateVolume() - Out of memory, cannot create volume.\n"));
-			return OUT_OF_MEMORY;
-		}
-
-		Result eResult = (*ppkVolume)->Create(uiWidth, uiHeight, uiDepth, eFormat);
-		if(CORE3D_FAILED(eResult))
-		{
-			CORE3D_SAFE_RELEASE(*ppkVolume);
-			return eResult;
-		}
-		return OK;
-	}
-
-	Result Device::CreateVolumeTexture(VolumeTexture** ppkVolumeTexture, UINT32 uiWidth, UINT32 uiHeight, UINT32 uiDepth, UINT32 uiMipLevels, Format eFormat)
-	{
-		if(NULL == ppkVolumeTexture)
-		{
-			CORE3D_ERROR(_T("Device::CreateVolumeTexture() - Parameter volume-texture pointers to NULL.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		*ppkVolumeTexture = new VolumeTexture(this);
-		if(NULL == (*ppkVolumeTexture))
-		{
-			CORE3D_ERROR(_T("Device::CreateVolumeTexture() - Out of memory, cannot create volume-texture.\n"));
-			return OUT_OF_MEMORY;
-		}
-
-		Result eResult = (*ppkVolumeTexture)->Create(uiWidth, uiHeight, uiDepth, uiMipLevels, eFormat);
-		if(CORE3D_FAILED(eResult))
-		{
-			CORE3D_SAFE_RELEASE(*ppkVolumeTexture);
-			return eResult;
-		}
-		return OK;
-	}
-
-	Result Device::CreateRenderTarget(RenderTarget** ppkRenderTarget)
-	{
-		if(NULL == ppkRenderTarget)
-		{
-			CORE3D_ERROR(_T("Device::CreateRenderTarget() - Parameter render-target pointers to NULL.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		*ppkRenderTarget = new RenderTarget(this);
-		if(NULL == (*ppkRenderTarget))
-		{
-			CORE3D_ERROR(_T("Device::CreateRenderTarget() - Out of memory, cannot create render-target.\n"));
-			return OUT_OF_MEMORY;
-		}
-		return OK;
-	}
-
-	Object* Device::GetObject()
-	{
-		if(NULL != m_pkParent) {m_pkParent->AddRef();}
-		return m_pkParent;
-	}
-
-	const DeviceParameters& Device::GetDeviceParameters()
-	{
-		return m_kDeviceParameters;
-	}
-
-	Result Device::Present(RenderTarget* pkRenderTarget)
-	{
-		if(NULL == pkRenderTarget)
-		{
-			CORE3D_ERROR(_T("Device::Present() - Parameter render-target pointers to NULL.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		// COMMENT : Get pointer to the color-buffer of the render-target
-		Surface* pkColorBuffer = pkRenderTarget->GetColorBuffer();
-		if(NULL == pkColorBuffer)
-		{
-			CORE3D_ERROR(_T("Device::Present() - Render-target doesn't have a color-buffer attached.\n"));
-			return INVALID_STATE;
-		}
-
-		if( (pkColorBuffer->GetWidth() != m_kDeviceParameters.uiBackBufferWidth) || 
-			(pkColorBuffer->GetHeight() != m_kDeviceParameters.uiBackBufferHeight) )
-		{
-			CORE3D_SAFE_RELEASE(pkColorBuffer);
-			CORE3D_ERROR(_T("Device::Present() - Color-buffer's dimensions don't match back-buffer.\n"));
-			return INVALID_STATE;
-		}
-
-		UINT32 uiFloats = pkColorBuffer->GetFormatFloats();
-		if(uiFloats < 3)
-		{
-			CORE3D_SAFE_RELEASE(pkColorBuffer);
-			CORE3D_ERROR(_T("Device::Present() - Invalid color-buffer format (Only FMT_R32G32B32F and FMT_R32G32B32A32F are supported).\n"));
-			return INVALID_FORMAT;
-		}
-
-		FLOAT32* pfSource = NULL;
-		if(CORE3D_FAILED(pkColorBuffer->LockRect((void**)&pfSource, NULL)))
-		{
-			CORE3D_SAFE_RELEASE(pkColorBuffer);
-			CORE3D_ERROR(_T("Device::Present() - Couldn't access color-buffer.\n"));
-			return UNKNOWN;
-		}
-
-		Result eResult = m_pkPresentTarget->Present(pfSource, uiFloats);
-		pkColorBuffer->UnlockRect();
-		CORE3D_SAFE_RELEASE(pkColorBuffer);
-		
-		return eResult;
-	}
-
-	Result Device::PreRender()
-	{
-		if(NULL == m_pkVertexFormat)
-		{
-			CORE3D_ERROR(_T("Device::PreRender() - No vertex format has been set.\n"));
-			return INVALID_STATE;
-		}
-
-		if(NULL == m_pkVertexShader)
-		{
-			CORE3D_ERROR(_T("Device::PreRender() - No vertex shader has been set.\n"));
-			return INVALID_STATE;
-		}
-
-		if(NULL == m_pkPixelShader)
-		{
-			CORE3D_ERROR(_T("Device::PreRender() - No pixel shader has been set.\n"));
-			return INVALID_STATE;
-		}
-
-		if(NULL == m_pkRenderTarget)
-		{
-			CORE3D_ERROR(_T("Device::PreRender() - No render-target has been set.\n"));
-			return INVALID_STATE;
-		}
-
-		const Matrix4x4& rkMatViewport			= m_pkRenderTarget->GetViewportMatrix();
-		m_kRenderInfo.rcViewportRect.uiLeft		= static_cast<UINT32>(Core3D::FtoL(rkMatViewport._41 - rkMatViewport._11));
-		m_kRenderInfo.rcViewportRect.uiRight	= static_cast<UINT32>(Core3D::FtoL(rkMatViewport._41 + rkMatViewport._11));
-		m_kRenderInfo.rcViewportRect.uiTop		= static_cast<UINT32>(Core3D::FtoL(rkMatViewport._42 + rkMatViewport._22));
-		m_kRenderInfo.rcViewportRect.uiBottom	= static_cast<UINT32>(Core3D::FtoL(rkMatViewport._42 - rkMatViewport._22));
-
-		if( (m_kRenderInfo.rcViewportRect.uiLeft >= m_kRenderInfo.rcViewportRect.uiRight)	|| 
-			(m_kRenderInfo.rcViewportRect.uiTop >= m_kRenderInfo.rcViewportRect.uiBottom)	)
-		{
-			CORE3D_ERROR(_T("Device::PreRender() - Invalid view-port matrix.\n"));
-			return INVALID_STATE;
-		}
-
-		Surface* pkColorBuffer = m_pkRenderTarget->GetColorBuffer();
-		Surface* pkDepthBuffer = m_pkRenderTarget->GetDepthBuffer();
-		if((NULL == pkColorBuffer) && (NULL == pkDepthBuffer))
-		{
-			CORE3D_ERROR(_T("Device::PreRender() - Render-target has no associated frame and depth-buffer.\n"));
-			return INVALID_STATE;
-		}
-
-		if( (NULL != pkColorBuffer) && ((pkColorBuffer->GetWidth() < m_kRenderInfo.rcViewportRect.uiRight) || 
-			(pkColorBuffer->GetHeight() < m_kRenderInfo.rcViewportRect.uiBottom)) )
-		{
-			CORE3D_SAFE_RELEASE(pkColorBuffer);
-			CORE3D_SAFE_RELEASE(pkDepthBuffer);
-			CORE3D_ERROR(_T("Device::PreRender() - Color-buffer's dimensions are smaller than set view-port.\n"));
-			return INVALID_STATE;
-		}
-
-		if( (NULL != pkDepthBuffer) && ((pkDepthBuffer->GetWidth() < m_kRenderInfo.rcViewportRect.uiRight) || 
-			(pkDepthBuffer->GetHeight() < m_kRenderInfo.rcViewportRect.uiBottom)) )
-		{
-			CORE3D_SAFE_RELEASE(pkColorBuffer);
-			CORE3D_SAFE_RELEASE(pkDepthBuffer);
-			CORE3D_ERROR(_T("Device::PreRender() - Depth-buffer's dimensions are smaller than set view-port.\n"));
-			return INVALID_STATE;
-		}
-
-		CORE3D_SAFE_RELEASE(pkColorBuffer);
-		CORE3D_SAFE_RELEASE(pkDepthBuffer);
-
-		const VertexStream* pkCurrentVertexStream = m_akVertexStreams;
-		for(UINT32 uiStream = 0; uiStream <= m_pkVertexFormat->GetHighestStream(); ++uiStream, ++pkCurrentVertexStream)
-		{
-			if(NULL == pkCurrentVertexStream->pkVertexBuffer)
-			{
-				CORE3D_ERROR(_T("Device::PreRender() - Vertex format references an empty vertex stream.\n"));
-				return INVALID_STATE;
-			}
-		}
-
-		// COMMENT : Check status of scissor testing
-		if(BT_FALSE != m_auiRenderStates[RS_SCISSORTESTENABLE])
-		{
-			if( false == (m_rcScissorRect.uiLeft	>=	m_kRenderInfo.rcViewportRect.uiLeft && m_rcScissorRect.uiLeft	<	m_kRenderInfo.rcViewportRect.uiRight)	|| 
-				false == (m_rcScissorRect.uiRight	>	m_kRenderInfo.rcViewportRect.uiLeft && m_rcScissorRect.uiRight	<=	m_kRenderInfo.rcViewportRect.uiRight)	|| 
-				false == (m_rcScissorRect.uiTop		>=	m_kRenderInfo.rcViewportRect.uiTop	&& m_rcScissorRect.uiTop	<	m_kRenderInfo.rcViewportRect.uiBottom)	|| 
-				false == (m_rcScissorRect.uiBottom	>	m_kRenderInfo.rcViewportRect.uiTop	&& m_rcScissorRect.uiBottom <=	m_kRenderInfo.rcViewportRect.uiBottom)	)
-			{
-				CORE3D_ERROR(_T("Device::PreRender() - Scissor rect exceeds view-port's dimensions.\n"));
-				return INVALID_STATE;
-			}
-		}
-
-		// COMMENT : Check line thickness
-		if(0 == m_auiRenderStates[RS_LINETHICKNESS])
-		{
-			CORE3D_ERROR(_T("Device::PreRender() - Line thickness is invalid.\n"));
-			return INVALID_STATE;
-		}
-
-		// COMMENT : Check if render-states for subdivision mode are valid
-		switch(m_auiRenderStates[RS_SUBDIVISIONMODE])
-		{
-		case SUBDIV_NONE:
-			break;
-		case SUBDIV_SIMPLE:
-			if(0 == m_auiRenderStates[RS_SUBDIVISIONLEVELS])
-			{
-				CORE3D_ERROR(_T("Device::PreRender() - Subdivision levels for simple subdivision are 0.\n"));
-				return INVALID_STATE;
-			}
-			break;
-		case SUBDIV_SMOOTH:
-			if(0 == m_auiRenderStates[RS_SUBDIVISIONLEVELS])
-			{
-				CORE3D_ERROR(_T("Device::PreRender() - Subdivision levels for smooth subdivision are 0.\n"));
-				return INVALID_STATE;
-			}
-			else if(m_auiRenderStates[RS_SUBDIVISIONPOSITIONREGISTER] >= VERTEX_SHADER_REGISTERS)
-			{
-				CORE3D_ERROR(_T("Device::PreRender() - Position register for smooth subdivision exceeds number of avilable vertex shader input registers.\n"));
-				return INVALID_STATE;
-			}
-			else if(m_auiRenderStates[RS_SUBDIVISIONNORMALREGISTER] >= VERTEX_SHADER_REGISTERS)
-			{
-				CORE3D_ERROR(_T("Device::PreRender() - Normal register for smooth subdivision exceeds number of avilable vertex shader input registers.\n"));
-				return INVALID_STATE;
-			}
-			break;
-		case SUBDIV_ADAPTIVE:
-			if((0 == m_auiRenderStates[RS_SUBDIVISIONLEVELS]) && (0 == m_auiRenderStates[RS_SUBDIVISIONMAXINNERLEVELS]))
-			{
-				CORE3D_ERROR(_T("Device::PreRender() - Both subdivision levels for adaptive subdivision are 0.\n"));
-				return INVALID_STATE;
-			}
-			else if(*(FLOAT32*)&m_auiRenderStates[RS_SUBDIVISIONMAXSCREENAREA] <= 0.0f)
-			{
-				CORE3D_ERROR(_T("Device::PreRender() - Max screen-area for smooth subdivision is <= 0.0f.\n"));
-				return INVALID_STATE;
-			}
-			break;
-		default:
-			CORE3D_ERROR(_T("Device::PreRender() - Value of renderstate RS_SUBDIVISIONMODE is invalid.\n"));
-			return  INVALID_STATE;
-		}
-
-		// COMMENT : Check for valid device states, which won't produce any output
-		if((BT_FALSE != m_auiRenderStates[RS_ZENABLE]) && (CMP_NEVER == m_auiRenderStates[RS_ZFUNC]))
-		{
-			CORE3D_NOTIFY(_T("Device::PreRender() - Nothing will be rendered[Depth buffering has been enabled and the compare function has been set to CMP_NEVER")
-						  _T("- Nothing will be rendered to the screen].\n"));
-		}
-
-		if(BT_FALSE != m_auiRenderStates[RS_SCISSORTESTENABLE])
-		{
-			if( m_rcScissorRect.uiLeft == m_rcScissorRect.uiRight || 
-				m_rcScissorRect.uiTop == m_rcScissorRect.uiBottom )
-			{
-				CORE3D_NOTIFY(_T("Device::PreRender() = Nothing will be rendered[Scissor testing is enabled and scissor rect spans across an area of 0 pixels].\n"));
-			}
-		}
-
-		if((BT_FALSE == m_auiRenderStates[RS_COLORWRITEENABLE]) && (BT_FALSE == m_auiRenderStates[RS_ZENABLE] || BT_FALSE == m_auiRenderStates[RS_ZWRITEENABLE]))
-		{
-			CORE3D_NOTIFY(_T("Device::PreRender() - Nothing will be rendered[Writing to the color-buffer and the depth-buffer has been disabled].\n"));
-		}
-
-		// COMMENT : Add more checks
-		// Initialize internal render info structure
-		for(UINT32 uiReg = 0; uiReg < PIXEL_SHADER_REGISTERS; ++uiReg)
-		{
-			m_kRenderInfo.aeVSOutputs[uiReg] = m_pkVertexShader->GetOutputRegisters(uiReg);
-		}
-
-		// COMMENT : Get color-buffer related states
-		pkColorBuffer = m_pkRenderTarget->GetColorBuffer();
-		if(NULL != pkColorBuffer)
-		{
-			Result eResult = pkColorBuffer->LockRect((void**)&m_kRenderInfo.pfFrameData, NULL);
-			if(CORE3D_FAILED(eResult))
-			{
-				CORE3D_SAFE_RELEASE(pkColorBuffer);
-				CORE3D_ERROR(_T("Device::PreRender() - Couldn't access color-buffer.\n"));
-				return eResult;
-			}
-
-			m_kRenderInfo.uiColorFloats = pkColorBuffer->GetFormatFloats();
-			if(0 == m_kRenderInfo.uiColorFloats)
-			{
-				pkColorBuffer->UnlockRect();
-				CORE3D_SAFE_RELEASE(pkColorBuffer);
-				return UNKNOWN;
-			}
-
-			m_kRenderInfo.uiColorBufferPitch	= pkColorBuffer->GetWidth() * m_kRenderInfo.uiColorFloats;
-			m_kRenderInfo.bColorWrite			= BT_TRUE == m_auiRenderStates[RS_COLORWRITEENABLE] ? true : false;
-		}
-		else
-		{
-			m_kRenderInfo.pfFrameData			= NULL;
-			m_kRenderInfo.uiColorFloats			= 0;
-			m_kRenderInfo.uiColorBufferPitch	= 0;
-			m_kRenderInfo.bColorWrite			= false;
-		}
-
-		// COMMENT : Get depth-buffer related states
-		pkDepthBuffer = BT_TRUE == m_auiRenderStates[RS_ZENABLE] ? m_pkRenderTarget->GetDepthBuffer() : NULL;
-		if(NULL != pkDepthBuffer)
-		{
-			Result eResult = pkDepthBuffer->LockRect((void**)&m_kRenderInfo.pfDepthData, NULL);
-			if(CORE3D_FAILED(eResult))
-			{
-				CORE3D_SAFE_RELEASE(pkColorBuffer);
-				CORE3D_SAFE_RELEASE(pkDepthBuffer);
-				CORE3D_ERROR(_T("Device::PreRender() - Couldn't access depth-buffer.\n"));
-				if(NULL != m_kRenderInfo.pfFrameData) {pkColorBuffer->UnlockRect();}
-				return eResult;
-			}
-
-			m_kRenderInfo.uiDepthBufferPitch	= pkDepthBuffer->GetWidth();
-			m_kRenderInfo.eDepthCompare			= (CmpFunc)m_auiRenderStates[RS_ZFUNC];
-			m_kRenderInfo.bDepthWrite			= BT_TRUE == m_auiRenderStates[RS_ZWRITEENABLE] ? true : false;
-		}
-		else
-		{
-			m_kRenderInfo.pfDepthData			= NULL;
-			m_kRenderInfo.uiDepthBufferPitch	= 0;
-			m_kRenderInfo.eDepthCompare			= CMP_ALWAYS;
-			m_kRenderInfo.bDepthWrite			= false;
-		}
-
-		CORE3D_SAFE_RELEASE(pkColorBuffer);
-		CORE3D_SAFE_RELEASE(pkDepthBuffer);
-
-		// COMMENT : Reset pixel counter to 0
-		m_kRenderInfo.uiRenderedPixels = 0;
-
-		// COMMENT : Depending on m_pkPixelShader->GetShaderOutput() chose the appropriate
-		// RasterizeScanline function and assign it to the function pointer
-		switch(m_pkPixelShader->GetShaderOutput())
-		{
-		case PSO_COLORONLY:
-			m_kRenderInfo.pfnRasterizeScanLine	= m_pkPixelShader->MightKillPixels() ? &Device::RasterizeScanlineColorOnlyMightKillPixels : &Device::RasterizeScanlineColorOnly;
-			m_kRenderInfo.pfnDrawPixel			= &Device::DrawPixelColorOnly;
-			break;
-		case PSO_COLORDEPTH:
-			m_kRenderInfo.pfnRasterizeScanLine	= &Device::RasterizeScanlineColorDepth;
-			m_kRenderInfo.pfnDrawPixel			= &Device::DrawPixelColorDepth;
-			break;
-		default: CORE3D_ERROR(_T("Device::PreRender() - Type of pixelshader is invalid.\n")); return INVALID_STATE;
-		}
-
-		// COMMENT : Initialize shader's pointer to the rendering device
-		// Have to do this right before drawing and not at set time, because a shader
-		// may be used with different devices
-		m_pkVertexShader->SetDevice(this);
-		m_pkPixelShader->SetDevice(this);
-		if(NULL != m_pkTriangleShader) {m_pkTriangleShader->SetDevice(this);}
-
-		// COMMENT : Initialize pixel shader's pointers to info structures
-		m_pkPixelShader->SetInfo(m_kRenderInfo.aeVSOutputs, &m_kTriangleInfo);
-
-		// COMMENT : Initialize vertex cache
-		m_uiNumValidCacheEntries	= 0;
-		m_uiFetchedVertices			= 0;
-
-		// COMMENT : FtoL() returns expected integer values
-		Core3D::FpuTruncate();
-		return OK;
-	}
-
-	void Device::PostRender()
-	{
-		// COMMENT : Reset FPU to (default)rounding mode
-		Core3D::FpuReset();
-
-		if(NULL != m_kRenderInfo.pfFrameData)
-		{
-			Surface* pkColorBuffer = m_pkRenderTarget->GetColorBuffer();
-			if(NULL != pkColorBuffer) {pkColorBuffer->UnlockRect();}
-			CORE3D_SAFE_RELEASE(pkColorBuffer);
-		}
-
-		if(NULL != m_kRenderInfo.pfDepthData)
-		{
-			Surface* pkDepthBuffer = m_pkRenderTarget->GetDepthBuffer();
-			if(NULL != pkDepthBuffer) {pkDepthBuffer->UnlockRect();}
-			CORE3D_SAFE_RELEASE(pkDepthBuffer);
-		}
-	}
-
-	Result Device::DecodeVertexStream(VertexShaderInput& rkVertexShaderInput, UINT32 uiVertex)
-	{
-		const BYTE8* apkVertex[MAX_VERTEX_STREAMS];
-		const VertexStream* pkCurrentVertexStream = m_akVertexStreams;
-		for(UINT32 uiStream = 0; uiStream <= m_pkVertexFormat->GetHighestStream(); ++uiStream, ++pkCurrentVertexStream)
-		{
-			const UINT32 uiOffset = pkCurrentVertexStream->uiOffset + uiVertex * pkCurrentVertexStream->uiStride;
-			if(uiOffset >= pkCurrentVertexStream->pkVertexBuffer->GetLength())
-			{
-				CORE3D_ERROR(_T("Device::DecodeVertexStream() - Vertex stream offset exceeds vertex buffer length.\n"));
-				return UNKNOWN;
-			}
-			Result eResult = pkCurrentVertexStream->pkVertexBuffer->GetPointer(uiOffset, (void**)&apkVertex[uiStream]);
-			if(CORE3D_FAILED(eResult)) {return eResult;}
-		}
-
-		// COMMENT : Fill vertex-information structure, which can be passed to the vertex shader,
-		// with data from the vertex-streams, depending on the current vertex-format.
-		const VertexElement* pkCurrentVertexElement = m_pkVertexFormat->GetElements();
-		UINT32 uiElement							= m_pkVertexFormat->GetNumVertexElements();
-		while(uiElement--)
-		{
-			ShaderReg& rkRegister = rkVertexShaderInput.kShaderInputs[pkCurrentVertexElement->uiRegister];
-			const FLOAT32* pfData = reinterpret_cast<const FLOAT32*>(apkVertex[pkCurrentVertexElement->uiStream]);
-			switch(pkCurrentVertexElement->eType)
-			{
-			case VET_FLOAT32:
-				apkVertex[pkCurrentVertexElement->uiStream] += sizeof(FLOAT32);
-				rkRegister = ShaderReg(pfData[0], 0.0f, 0.0f, 1.0f);
-				break;
-			case VET_VECTOR2:
-				apkVertex[pkCurrentVertexElement->uiStream] += 2 * sizeof(FLOAT32);
-				rkRegister = ShaderReg(pfData[0], pfData[1], 0.0f, 1.0f);
-				break;
-			case VET_VECTOR3:
-				apkVertex[pkCurrentVertexElement->uiStream] += 3 * sizeof(FLOAT32);
-				rkRegister = ShaderReg(pfData[0], pfData[1], pfData[2], 1.0f);
-				break;
-			case VET_VECTOR4:
-				apkVertex[pkCurrentVertexElement->uiStream] += 4 * sizeof(FLOAT32);
-				rkRegister = ShaderReg(pfData[0], pfData[1], pfData[2], pfData[3]);
-				break;
-			}
-			++pkCurrentVertexElement;
-		}
-		return OK;
-	}
-
-	Result Device::FetchVertex(VertexCacheEntry** ppkVertex, UINT32 uiVertex)
-	{
-		// COMMENT : Check if the incoming point already points to the desired vertex.
-		if(NULL != *ppkVertex && (*ppkVertex)->uiVertexIndex == uiVertex)
-		{
-			(*ppkVertex)->uiFetchTime = m_uiFetchedVertices++;
-			return OK;
-		}
-
-		const bool bCanAppend = (m_uiNumValidCacheEntries < VERTEX_CACH_SIZE);
-
-		// COMMENT : Find vertex in cache
-		VertexCacheEntry* pkCacheEntry	= &m_akVertexCache[0];
-		VertexCacheEntry* pkDestEntry	= pkCacheEntry;
-		for(UINT32 uiEntry = 0; uiEntry < m_uiNumValidCacheEntries; ++uiEntry, ++pkCacheEntry)
-		{
-			if(pkCacheEntry->uiVertexIndex == uiVertex)
-			{
-				// COMMENT : Vertex is already in cache, return it
-				pkCacheEntry->uiFetchTime	= m_uiFetchedVertices++;
-				*ppkVertex					= pkCacheEntry;
-				return OK;
-			}
-
-			// COMMENT : The vertex cache is full, so we have to look for the oldest entry
-			// and replace it in case we cannot find the desired vertex in the cache.
-			if(pkCacheEntry->uiFetchTime < pkDestEntry->uiFetchTime)
-			{
-				pkDestEntry = pkCacheEntry;
-			}
-		}
-
-		// COMMENT : The cache is not full yet, so we can append a new vertex.
-		if(bCanAppend) {pkDestEntry = &m_akVertexCache[m_uiNumValidCacheEntries++];}
-
-		// COMMENT : Update the destination cache entry and return it
-		pkDestEntry->uiVertexIndex	= uiVertex;
-		pkDestEntry->uiFetchTime	= m_uiFetchedVertices++;
-
-		Result eResult = DecodeVertexStream(pkDestEntry->kVertexOutput.kSourceInput, uiVertex);
-		if(CORE3D_FAILED(eResult)) {return eResult;}
-
-		m_pkVertexShader->Execute(pkDestEntry->kVertexOutput.kSourceInput.kShaderInputs, 
-			pkDestEntry->kVertexOutput.kPosition, pkDestEntry->kVertexOutput.kShaderOutputs);
-
-		*ppkVertex = pkDestEntry;
-		return OK;
-	}
-
-	void Device::ProcessTriangle(const VertexShaderOutput* pkVSOutput0, const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2)
-	{
-		switch(m_auiRenderStates[RS_SUBDIVISIONMODE])
-		{
-		case SUBDIV_NONE:		DrawTriangle(pkVSOutput0, pkVSOutput1, pkVSOutput2);				break;
-		case SUBDIV_SIMPLE:		SubdivideTriangleSimple(0, pkVSOutput0, pkVSOutput1, pkVSOutput2);	break;
-		case SUBDIV_SMOOTH:		SubdivideTriangleSmooth(0, pkVSOutput0, pkVSOutput1, pkVSOutput2);	break;
-		case SUBDIV_ADAPTIVE:	SubdivideTriangleAdaptive(pkVSOutput0, pkVSOutput1, pkVSOutput2);	break;
-		}
-	}
-
-	Result Device::DrawPrimitive(PrimitiveType ePrimitiveType, UINT32 uiStartVertex, UINT32 uiPrimitiveCount)
-	{
-		if(0 == uiPrimitiveCount)
-		{
-			CORE3D_ERROR(_T("Device::DrawPrimitive() - Primitive count is 0.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		// COMMENT : Process incoming vertices
-		UINT32 uiNumVertices = 0;
-		switch(ePrimitiveType)
-		{
-		case PT_TRIANGLEFAN:	uiNumVertices = uiPrimitiveCount + 2; break;
-		case PT_TRIANGLESTRIP:	uiNumVertices = uiPrimitiveCount + 2; break;
-		case PT_TRIANGLELIST:	uiNumVertices = uiPrimitiveCount * 3; break;
-		default: CORE3D_ERROR(_T("Device::DrawPrimitive() - Invalid primitive type specified.\n")); return INVALID_PARAMETERS;
-		}
-
-		Result eCheck = PreRender();
-		if(CORE3D_FAILED(eCheck)) {return eCheck;}
-
-		UINT32 auiVertexIndices[3]	= {uiStartVertex, uiStartVertex + 1, uiStartVertex + 2};
-		bool bFlip					= false; // Used when drawing triangle strips
-		while(uiPrimitiveCount--)
-		{
-			VertexCacheEntry* apkVertices[3] = {NULL, NULL, NULL};
-			for(UINT32 uiVertex = 0; uiVertex < 3; ++uiVertex)
-			{
-				Result eFetch = FetchVertex(&apkVertices[uiVertex], auiVertexIndices[uiVertex]);
-				if(CORE3D_FAILED(eFetch))
-				{
-					CORE3D_ERROR(_T("Device::DrawPrimitive() - Couldn't fetch vertex from streams.\n"));
-					PostRender();
-					return eFetch;
-				}
-			}
-
-			if(bFlip)	{ProcessTriangle(&apkVertices[0]->kVertexOutput, &apkVertices[2]->kVertexOutput, &apkVertices[1]->kVertexOutput);}
-			else		{ProcessTriangle(&apkVertices[0]->kVertexOutput, &apkVertices[1]->kVertexOutput, &apkVertices[2]->kVertexOutput);}
-
-			// COMMENT : Prepare vertex-indices for the next triangle
-			switch(ePrimitiveType)
-			{
-			case PT_TRIANGLEFAN:
-				auiVertexIndices[1] = auiVertexIndices[2];
-				++auiVertexIndices[2];
-				break;
-			case PT_TRIANGLESTRIP:
-				bFlip = !bFlip;
-				auiVertexIndices[0] = auiVertexIndices[1];
-				auiVertexIndices[1] = auiVertexIndices[2];
-				++auiVertexIndices[2];
-				break;
-			case PT_TRIANGLELIST:
-				auiVertexIndices[0] += 3;
-				auiVertexIndices[1] += 3;
-				auiVertexIndices[2] += 3;
-				break;
-			}
-		}
-
-		PostRender();
-		return OK;
-	}
-
-	Result Device::DrawIndexedPrimitive(PrimitiveType ePrimitiveType, UINT32 uiBaseVertexIndex, UINT32 uiMinIndex, UINT32 uiNumVertices, UINT32 uiStartIndex, UINT32 uiPrimitiveCount)
-	{
-		if(0 == uiPrimitiveCount)
-		{
-			CORE3D_ERROR(_T("Device::DrawIndexedPrimitive() - Primitive count is 0.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		if(0 == uiNumVertices)
-		{
-			CORE3D_ERROR(_T("Device::DrawIndexedPrimitive() - Number of vertices is 0.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		if(FALSE == (PT_TRIANGLEFAN == ePrimitiveType || PT_TRIANGLESTRIP == ePrimitiveType || PT_TRIANGLELIST == ePrimitiveType))
-		{
-			CORE3D_ERROR(_T("Device::DrawIndexedPrimitive() - Invalid primitive type specified.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		if(NULL == m_pkIndexBuffer)
-		{
-			CORE3D_ERROR(_T("Device::DrawIndexedPrimitive() - No index-buffer has been set.\n"));
-			return INVALID_STATE;
-		}
-
-		Result eResult = PreRender();
-		if(CORE3D_FAILED(eResult)) {return eResult;}
-
-		UINT32 auiIndexIndices[3]	= {uiStartIndex, uiStartIndex + 1, uiStartIndex + 2};
-		bool bFlip					= false; // Used when drawing triangle strips
-		while(uiPrimitiveCount--)
-		{
-			VertexCacheEntry* apkVertices[3] = {NULL, NULL, NULL};
-			for(UINT32 uiVertex = 0; uiVertex < 3; ++uiVertex)
-			{
-				UINT32 uiVertexIndex	= 0;
-				Result eVertexIndex		= m_pkIndexBuffer->GetVertexIndex(auiIndexIndices[uiVertex], uiVertexIndex);
-				if(CORE3D_FAILED(eVertexIndex))
-				{
-					CORE3D_ERROR(_T("Device::DrawIndexedPrimitive() - Couldn't read vertex index from index-buffer.\n"));
-					PostRender();
-					return eVertexIndex;
-				}
-
-				Result eFetch = FetchVertex(&apkVertices[uiVertex], uiVertexIndex + uiBaseVertexIndex);
-				if(CORE3D_FAILED(eFetch))
-				{
-					CORE3D_ERROR(_T("Device::DrawIndexedPrimitive() - Couldn't fetch vertex from streams.\n"));
-					PostRender();
-					return eFetch;
-				}
-			}
-
-			if(true == bFlip)	{ProcessTriangle(&apkVertices[0]->kVertexOutput, &apkVertices[2]->kVertexOutput, &apkVertices[1]->kVertexOutput);}
-			else				{ProcessTriangle(&apkVertices[0]->kVertexOutput, &apkVertices[1]->kVertexOutput, &apkVertices[2]->kVertexOutput);}
-
-			// COMMENT : Prepare vertex indices for the next triangle
-			switch(ePrimitiveType)
-			{
-			case PT_TRIANGLEFAN:
-				auiIndexIndices[1] = auiIndexIndices[2];
-				++auiIndexIndices[2];
-				break;
-			case PT_TRIANGLESTRIP:
-				bFlip = !bFlip;
-				auiIndexIndices[0] = auiIndexIndices[1];
-				auiIndexIndices[1] = auiIndexIndices[2];
-				++auiIndexIndices[2];
-				break;
-			case PT_TRIANGLELIST:
-				auiIndexIndices[0] += 3;
-				auiIndexIndices[1] += 3;
-				auiIndexIndices[2] += 3;
-				break;
-			}
-		}
-		
-		PostRender();
-		return OK;
-	}
-
-	Result Device::DrawDynamicPrimitive(UINT uiStartVertex, UINT32 uiNumVertices)
-	{
-		if(0 == uiNumVertices)
-		{
-			CORE3D_ERROR(_T("Device::DrawDynamicPrimitive() - Number of vertices is 0.\n"));
-			return INVALID_PARAMETERS;
-		}
-
-		if(NULL == m_pkPrimitiveAssembler)
-		{
-			CORE3D_ERROR(_T("Device::DrawDynamicPrimitive() - No primitive assembler has been set.\n"));
-			return INVALID_STATE;
-		}
-
-		Result eResult = PreRender();
-		if(CORE3D_FAILED(eResult)) {return eResult;}
-
-		std::vector<UINT32> vecVertexIndices;
-		PrimitiveType ePrimitiveType = m_pkPrimitiveAssembler->Execute(vecVertexIndices, uiNumVertices);
-
-		UINT32 uiPrimitiveCount = 0;
-		switch(ePrimitiveType)
-		{
-		case PT_TRIANGLEFAN:	uiPrimitiveCount = static_cast<UINT32>(vecVertexIndices.size()) - 2; break;
-		case PT_TRIANGLESTRIP:	uiPrimitiveCount = static_cast<UINT32>(vecVertexIndices.size()) - 2; break;
-		case PT_TRIANGLELIST:	uiPrimitiveCount = static_cast<UINT32>(vecVertexIndices.size()) / 3; break;
-		default: CORE3D_ERROR(_T("Device::DrawDynamicPrimitive() - Invalid primitive type specified.\n")); return INVALID_PARAMETERS;
-		}
-		if(0 == uiPrimitiveCount) {return OK;}
-
-		std::vector<UINT32>::iterator iterVertexIndex = vecVertexIndices.begin();
-		UINT auiVertexIndices[3]	= {*iterVertexIndex++, *iterVertexIndex++, *iterVertexIndex++};
-		bool bFlip					= false; // Used when drawing triangle strips
-		while(--uiPrimitiveCount)
-		{
-			VertexCacheEntry* apkVertices[3] = {NULL, NULL, NULL};
-			for(UINT32 uiVertex = 0; uiVertex < 3; ++uiVertex)
-			{
-				Result eFetch = FetchVertex(&apkVertices[uiVertex], auiVertexIndices[uiVertex]);
-				if(CORE3D_FAILED(eFetch))
-				{
-					CORE3D_ERROR(_T("Device::DrawIndexedPrimitive() - Couldn't fetch vertex from streams.\n"));
-					PostRender();
-					return eFetch;
-				}
-			}
-
-			if(true == bFlip)	{ProcessTriangle(&apkVertices[0]->kVertexOutput, &apkVertices[2]->kVertexOutput, &apkVertices[1]->kVertexOutput);}
-			else				{ProcessTriangle(&apkVertices[0]->kVertexOutput, &apkVertices[1]->kVertexOutput, &apkVertices[2]->kVertexOutput);}
-
-			// COMMENT : Prepare vertex-indices for the next triangle
-			switch(ePrimitiveType)
-			{
-			case PT_TRIANGLEFAN:
-				auiVertexIndices[1] = auiVertexIndices[2];
-				auiVertexIndices[2] = *iterVertexIndex++;
-				break;
-			case PT_TRIANGLESTRIP:
-				bFlip = !bFlip;
-				auiVertexIndices[0] = auiVertexIndices[1];
-				auiVertexIndices[1] = auiVertexIndices[2];
-				auiVertexIndices[2] = *iterVertexIndex++;
-				break;
-			case PT_TRIANGLELIST:
-				auiVertexIndices[0] = *iterVertexIndex++;
-				auiVertexIndices[1] = *iterVertexIndex++;
-				auiVertexIndices[2] = *iterVertexIndex++;
-				break;
-			}
-		}
-
-		PostRender();
-		return OK;
-	}
-
-	void Device::InterpolateVertexShaderOutput(VertexShaderOutput* pkVSOutput, const VertexShaderOutput* pkVSOutputA, const VertexShaderOutput* pkVSOutputB, FLOAT32 fInterpolation)
-	{
-		// COMMENT : Interpolate vertex position
-		Core3D::Vec4Lerp(pkVSOutput->kPosition, pkVSOutputA->kPosition, pkVSOutputB->kPosition, fInterpolation);
-
-		// COMMENT : Interpolate registers
-		ShaderReg* pkOutput			= pkVSOutput->kShaderOutputs;
-		const ShaderReg* pkOutputA	= pkVSOutputA->kShaderOutputs;
-		const ShaderReg* pkOutputB	= pkVSOutputB->kShaderOutputs;
-
-		for(UINT32 uiReg = 0; uiReg < PIXEL_SHADER_REGISTERS; ++uiReg, ++pkOutput, ++pkOutputA, ++pkOutputB)
-		{
-			switch(m_kRenderInfo.aeVSOutputs[uiReg])
-			{
-			case SRT_VECTOR4: pkOutput->w = Core3D::Lerp(pkOutputA->w, pkOutputB->w, fInterpolation);
-			case SRT_VECTOR3: pkOutput->z = Core3D::Lerp(pkOutputA->z, pkOutputB->z, fInterpolation);
-			case SRT_VECTOR2: pkOutput->y = Core3D::Lerp(pkOutputA->y, pkOutputB->y, fInterpolation);
-			case SRT_FLOAT32: pkOutput->x = Core3D::Lerp(pkOutputA->x, pkOutputB->x, fInterpolation);
-			case SRT_UNUSED:  break;
-			}
-		}
-	}
-
-	void Device::MultiplyVertexShaderOutputRegisters(VertexShaderOutput* pkDest, const VertexShaderOutput* pkSrc, FLOAT32 fVal)
-	{
-		ShaderReg* pkDestReg		= pkDest->kShaderOutputs;
-		const ShaderReg* pkSrcReg	= pkSrc->kShaderOutputs;
-		for(UINT32 uiReg = 0; uiReg < PIXEL_SHADER_REGISTERS; ++uiReg, ++pkDestReg, ++pkSrcReg)
-		{
-			switch(m_kRenderInfo.aeVSOutputs[uiReg])
-			{
-			case SRT_VECTOR4: pkDestReg->w = pkSrcReg->w * fVal;
-			case SRT_VECTOR3: pkDestReg->z = pkSrcReg->z * fVal;
-			case SRT_VECTOR2: pkDestReg->y = pkSrcReg->y * fVal;
-			case SRT_FLOAT32: pkDestReg->x = pkSrcReg->x * fVal;
-			case SRT_UNUSED:  break;
-			}
-		}
-	}
-
-	void Device::InterpolateVertexShaderInput(VertexShaderInput* pkVSInput, const VertexShaderInput* pkVSInputA, const VertexShaderInput* pkVSInputB, FLOAT32 fInterpolation)
-	{
-		// COMMENT : Interpolate registers
-		ShaderReg* pkOutput			= pkVSInput->kShaderInputs;
-		const ShaderReg* pkInputA	= pkVSInputA->kShaderInputs;
-		const ShaderReg* pkInputB	= pkVSInputB->kShaderInputs;
-		for(UINT32 uiReg = 0; uiReg < VERTEX_SHADER_REGISTERS; ++uiReg, ++pkOutput, ++pkInputA, ++pkInputB)
-		{
-			switch(m_kRenderInfo.aeVSInputs[uiReg])
-			{
-			case SRT_FLOAT32:
-				pkOutput->x = Core3D::Lerp(pkInputA->x, pkInputB->x, fInterpolation);
-				pkOutput->y = 0.0f; pkOutput->z = 0.0f; pkOutput->w = 1.0f;
-				break;
-			case SRT_VECTOR2:
-				pkOutput->x = Core3D::Lerp(pkInputA->x, pkInputB->x, fInterpolation);
-				pkOutput->y = Core3D::Lerp(pkInputA->y, pkInputB->y, fInterpolation);
-				pkOutput->z = 0.0f; pkOutput->w = 1.0f;
-				break;
-			case SRT_VECTOR3:
-				pkOutput->x = Core3D::Lerp(pkInputA->x, pkInputB->x, fInterpolation);
-				pkOutput->y = Core3D::Lerp(pkInputA->y, pkInputB->y, fInterpolation);
-				pkOutput->z = Core3D::Lerp(pkInputA->z, pkInputB->z, fInterpolation);
-				pkOutput->w = 1.0f;
-				break;
-			case SRT_VECTOR4:
-				pkOutput->x = Core3D::Lerp(pkInputA->x, pkInputB->x, fInterpolation);
-				pkOutput->y = Core3D::Lerp(pkInputA->y, pkInputB->y, fInterpolation);
-				pkOutput->z = Core3D::Lerp(pkInputA->z, pkInputB->z, fInterpolation);
-				pkOutput->w = Core3D::Lerp(pkInputA->w, pkInputB->w, fInterpolation);
-				break;
-			case SRT_UNUSED:
-				break;
-			}
-		}
-	}
-
-	void Device::ProjectVertex(VertexShaderOutput* pkVSOutput)
-	{
-		if(pkVSOutput->kPosition.w < FLT_EPSILON) {return;}
-
-		const FLOAT32 fInvW		= 1.0f / pkVSOutput->kPosition.w;
-		pkVSOutput->kPosition.Homogenize(fInvW);
-		pkVSOutput->kPosition	*= m_pkRenderTarget->GetViewportMatrix();
-
-		// COMMENT : Divide shader output registers by W; this way we can interpolate them lineary while rasterizing
-		pkVSOutput->kPosition.w	= fInvW;
-		MultiplyVertexShaderOutputRegisters(pkVSOutput, pkVSOutput, pkVSOutput->kPosition.w);
-	}
-
-	void Device::SubdivideTriangleSimple(UINT32 uiSubdivisionLevel, const VertexShaderOutput* pkVSOutput0, const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2)
-	{
-		// COMMENT : In case the triangle has been subdivided to the requested level, draw it.
-		if(uiSubdivisionLevel >= m_auiRenderStates[RS_SUBDIVISIONLEVELS])
-		{
-			DrawTriangle(pkVSOutput0, pkVSOutput1, pkVSOutput2);
-			return;
-		}
-		++uiSubdivisionLevel;
-
-		// COMMENT : Generate three new vertices: in the middle of each edge
-		// Interpolate inputs for the new vertices(we're splitting the triangle's edges)
-		VertexShaderOutput akNewVSOutputs[3];
-		InterpolateVertexShaderInput(&akNewVSOutputs[0].kSourceInput, &pkVSOutput0->kSourceInput, &pkVSOutput1->kSourceInput, 0.5f); // Edge between V0 and V1
-		InterpolateVertexShaderInput(&akNewVSOutputs[1].kSourceInput, &pkVSOutput1->kSourceInput, &pkVSOutput2->kSourceInput, 0.5f); // Edge between V1 and V2
-		InterpolateVertexShaderInput(&akNewVSOutputs[2].kSourceInput, &pkVSOutput2->kSourceInput, &pkVSOutput0->kSourceInput, 0.5f); // Edge between V2 and V0
-
-		// COMMENT : Calculate new vertex shader outputs
-		VertexShaderOutput* pkCurrentVSOutput = akNewVSOutputs;
-		for(UINT32 i = 0; i < 3; ++i, ++pkCurrentVSOutput)
-		{
-			m_pkVertexShader->Execute(pkCurrentVSOutput->kSourceInput.kShaderInputs, pkCurrentVSOutput->kPosition, pkCurrentVSOutput->kShaderOutputs);
-		}
-
-		SubdivideTriangleSimple(uiSubdivisionLevel, pkVSOutput0, &akNewVSOutputs[0], &akNewVSOutputs[2]);
-		SubdivideTriangleSimple(uiSubdivisionLevel, pkVSOutput1, &akNewVSOutputs[1], &akNewVSOutputs[0]);
-		SubdivideTriangleSimple(uiSubdivisionLevel, pkVSOutput2, &akNewVSOutputs[2], &akNewVSOutputs[1]);
-		SubdivideTriangleSimple(uiSubdivisionLevel, &akNewVSOutputs[0], &akNewVSOutputs[1], &akNewVSOutputs[2]);
-	}
-
-	void Device::SubdivideTriangleSmooth(UINT32 uiSubdivisionLevel, const VertexShaderOutput* pkVSOutput0, const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2)
-	{
-		static const FLOAT32 MULT_DEVIDE_BY_SIX = 1.0f / 6.0f;
-		// COMMENT : In case the triangle has been subdivided to the  requested level, draw it
-		if(uiSubdivisionLevel >= m_auiRenderStates[RS_SUBDIVISIONLEVELS])
-		{
-			DrawTriangle(pkVSOutput0, pkVSOutput1, pkVSOutput2);
-			return;
-		}
-		++uiSubdivisionLevel;
-
-		// COMMENT : Generate three new vertices: in the middle of each edge
-		// Interpolate inputs for the new vertices(we're splitting the triangle's edges)
-		VertexShaderOutput akNewVSOutputs[3];
-		InterpolateVertexShaderInput(&akNewVSOutputs[0].kSourceInput, &pkVSOutput0->kSourceInput, &pkVSOutput1->kSourceInput, 0.5f); // Edge between V0 and V1
-		InterpolateVertexShaderInput(&akNewVSOutputs[1].kSourceInput, &pkVSOutput1->kSourceInput, &pkVSOutput2->kSourceInput, 0.5f); // Edge between V1 and V2
-		InterpolateVertexShaderInput(&akNewVSOutputs[2].kSourceInput, &pkVSOutput2->kSourceInput, &pkVSOutput0->kSourceInput, 0.5f); // Edge between V2 and V0
-
-		// COMMENT : Offset positions using normals as a base
-		const UINT32 uiPos		= m_auiRenderStates[RS_SUBDIVISIONPOSITIONREGISTER];
-		const UINT32 uiNormal	= m_auiRenderStates[RS_SUBDIVISIONNORMALREGISTER];
-
-		// COMMENT : Normal vectors should be re-normalized(they're not unit length anymore due
-		// to linear interpolation) for best results, but because the error is very small
-		// this step is skipped.
-		const ShaderReg* apkShaderInputs[3] = {pkVSOutput0->kSourceInput.kShaderInputs, pkVSOutput1->kSourceInput.kShaderInputs, pkVSOutput2->kSourceInput.kShaderInputs};
-
-		// COMMENT : Offset middle of edge between V0 and V1
-		{
-			const Vector3 kNormalA	= apkShaderInputs[0][uiNormal] * Core3D::Vec3Dot((Vector3)apkShaderInputs[1][uiPos] - (Vector3)apkShaderInputs[0][uiPos], apkShaderInputs[0][uiNormal]);
-			const Vector3 kNormalB	= apkShaderInputs[1][uiNormal] * Core3D::Vec3Dot((Vector3)apkShaderInputs[0][uiPos] - (Vector3)apkShaderInputs[1][uiPos], apkShaderInputs[1][uiNormal]);
-			Vector4& rkPosition		= akNewVSOutputs[0].kSourceInput.kShaderInputs[uiPos];
-			rkPosition				-= (kNormalA + kNormalB) * MULT_DEVIDE_BY_SIX;
-		}
-
-		// COMMENT : Offset middle of edge between V1 and V2
-		{
-			const Vector3 kNormalA	= apkShaderInputs[1][uiNormal] * Core3D::Vec3Dot((Vector3)apkShaderInputs[2][uiPos] - (Vector3)apkShaderInputs[1][uiPos], apkShaderInputs[1][uiNormal]);
-			const Vector3 kNormalB	= apkShaderInputs[2][uiNormal] * Core3D::Vec3Dot((Vector3)apkShaderInputs[1][uiPos] - (Vector3)apkShaderInputs[2][uiPos], apkShaderInputs[2][uiNormal]);
-			Vector4& rkPosition		= akNewVSOutputs[1].kSourceInput.kShaderInputs[uiPos];
-			rkPosition				-= (kNormalA + kNormalB) * MULT_DEVIDE_BY_SIX;
-		}
-
-		// COMMENT : Offset middle of edge between V2 and V0
-		{
-			const Vector3 kNormalA	= apkShaderInputs[2][uiNormal] * Core3D::Vec3Dot((Vector3)apkShaderInputs[0][uiPos] - (Vector3)apkShaderInputs[2][uiPos], apkShaderInputs[2][uiNormal]);
-			const Vector3 kNormalB	= apkShaderInputs[0][uiNormal] * Core3D::Vec3Dot((Vector3)apkShaderInputs[2][uiPos] - (Vector3)apkShaderInputs[0][uiPos], apkShaderInputs[0][uiNormal]);
-			Vector4& rkPosition		= akNewVSOutputs[2].kSourceInput.kShaderInputs[uiPos];
-			rkPosition				-= (kNormalA + kNormalB) * MULT_DEVIDE_BY_SIX;
-		}
-
-		// COMMENT : Calculate new vertex shader outputs
-		VertexShaderOutput* pkCurrentVSOutput = akNewVSOutputs;
-		for(UINT32 i = 0; i < 3; ++i, ++pkCurrentVSOutput)
-		{
-			m_pkVertexShader->Execute(pkCurrentVSOutput->kSourceInput.kShaderInputs, pkCurrentVSOutput->kPosition, pkCurrentVSOutput->kShaderOutputs);
-		}
-
-		SubdivideTriangleSmooth(uiSubdivisionLevel, pkVSOutput0, &akNewVSOutputs[0], &akNewVSOutputs[2]);
-		SubdivideTriangleSmooth(uiSubdivisionLevel, pkVSOutput1, &akNewVSOutputs[1], &akNewVSOutputs[0]);
-		SubdivideTriangleSmooth(uiSubdivisionLevel, pkVSOutput2, &akNewVSOutputs[2], &akNewVSOutputs[1]);
-		SubdivideTriangleSmooth(uiSubdivisionLevel, &akNewVSOutputs[0], &akNewVSOutputs[1], &akNewVSOutputs[2]);
-	}
-
-	void Device::SubdivideTriangleAdaptiveSubdivideInnerPart(UINT32 uiSubdivisionLevel, const VertexShaderOutput* pkVSOutput0, const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2)
-	{
-		static const FLOAT32 MULT_DIVIDIE_BY_TREE1 = 1.0f / 3.0f;
-		// COMMENT : Information about subdivision level: here we are counting the maximum inner subdivisions
-		if(uiSubdivisionLevel >= m_auiRenderStates[RS_SUBDIVISIONMAXINNERLEVELS])
-		{
-			DrawTriangle(pkVSOutput0, pkVSOutput1, pkVSOutput2);
-			return;
-		}
-
-		// COMMENT : Check area of triangle in screen space
-		{
-			Vector4 akPos[3] = {pkVSOutput0->kPosition, pkVSOutput1->kPosition, pkVSOutput2->kPosition};
-			for(UINT32 uiVertex = 0; uiVertex < 3; ++uiVertex)
-			{
-				// TODO : Should actually be clipped to view frustum
-				// Project vertex position + Scale to render-target's viewport
-				akPos[uiVertex].Homogenize();
-				akPos[uiVertex] *= m_pkRenderTarget->GetViewportMatrix();
-			}
-
-			const Vector3 k0To1 = (Vector3)akPos[1] - (Vector3)akPos[0];
-			const Vector3 k0To2 = (Vector3)akPos[2] - (Vector3)akPos[0];
-			Vector3 kNormal;
-			Core3D::Vec3Cross(kNormal, k0To1, k0To2);
-			const FLOAT32 fArea = 0.5f * kNormal.Length();
-			if(fArea < *(FLOAT32*)&m_auiRenderStates[RS_SUBDIVISIONMAXSCREENAREA])
-			{
-				DrawTriangle(pkVSOutput0, pkVSOutput1, pkVSOutput2);
-				return;
-			}
-		}
-
-		// COMMENT : Continue splitting: find center vertex and call subdivide innter part for the three new vertices
-		++uiSubdivisionLevel;
-
-		// COMMENT : Average inputs for the center vertex
-		const Vector4* apkShaderInputs[3] = {pkVSOutput0->kSourceInput.kShaderInputs, pkVSOutput1->kSourceInput.kShaderInputs, pkVSOutput2->kSourceInput.kShaderInputs};
-		VertexShaderOutput kVSOutputCenter;
-		for(UINT32 i = 0; i < VERTEX_SHADER_REGISTERS; ++i)
-		{
-			kVSOutputCenter.kSourceInput.kShaderInputs[i] = (apkShaderInputs[0][i] + apkShaderInputs[1][i] + apkShaderInputs[2][i]) * MULT_DIVIDIE_BY_TREE1;
-		}
-
-		// COMMENT : Call vertex shader
-		m_pkVertexShader->Execute(kVSOutputCenter.kSourceInput.kShaderInputs, kVSOutputCenter.kPosition, kVSOutputCenter.kShaderOutputs);
-
-		// COMMENT : Split outer triangle edges
-		SubdivideTriangleAdaptiveSubdivideInnerPart(uiSubdivisionLevel, pkVSOutput0, pkVSOutput1, &kVSOutputCenter);
-		SubdivideTriangleAdaptiveSubdivideInnerPart(uiSubdivisionLevel, pkVSOutput1, pkVSOutput2, &kVSOutputCenter);
-		SubdivideTriangleAdaptiveSubdivideInnerPart(uiSubdivisionLevel, pkVSOutput2, pkVSOutput0, &kVSOutputCenter);
-	}
-
-	void Device::SubdivideTriangleAdaptiveSubdivideEdges(UINT32 uiSubdivisionLevel, const VertexShaderOutput* pkVSOutputEdge0, const VertexShaderOutput* pkVSOutputEdge1, const VertexShaderOutput* pkVSOutputCenter)
-	{
-		// COMMENT : In case the triangle edges have been subdivided to the requested level, begin adaptive subdivision of inner part
-		if(uiSubdivisionLevel >= m_auiRenderStates[RS_SUBDIVISIONLEVELS])
-		{
-			SubdivideTriangleAdaptiveSubdivideInnerPart(0, pkVSOutputEdge0, pkVSOutputEdge1, pkVSOutputCenter);
-			return;
-		}
-		++uiSubdivisionLevel;
-
-		// COMMENT : Split edge and call subdivide-edge recursively
-		VertexShaderOutput kVSOutputMiddleEdge;
-		InterpolateVertexShaderInput(&kVSOutputMiddleEdge.kSourceInput, &pkVSOutputEdge0->kSourceInput, &pkVSOutputEdge1->kSourceInput, 0.5f);
-
-		// COMMENT : Call vertex shader
-		m_pkVertexShader->Execute(kVSOutputMiddleEdge.kSourceInput.kShaderInputs, kVSOutputMiddleEdge.kPosition, kVSOutputMiddleEdge.kShaderOutputs);
-
-		SubdivideTriangleAdaptiveSubdivideEdges(uiSubdivisionLevel, pkVSOutputEdge0, &kVSOutputMiddleEdge, pkVSOutputCenter);
-		SubdivideTriangleAdaptiveSubdivideEdges(uiSubdivisionLevel, &kVSOutputMiddleEdge, pkVSOutputEdge1, pkVSOutputCenter);
-	}
-
-	void Device::SubdivideTriangleAdaptive(const VertexShaderOutput* pkVSOutput0, const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2)
-	{
-		static const FLOAT32 MUL_DIVIDE_BY_TREE2 = 1.0f / 3.0f;
-		// COMMENT : Average inputs for the center vertex
-		const ShaderReg* apkShaderInputs[3] = {pkVSOutput0->kSourceInput.kShaderInputs, pkVSOutput1->kSourceInput.kShaderInputs, pkVSOutput2->kSourceInput.kShaderInputs};
-
-		VertexShaderOutput kVSOutputCenter;
-		for(UINT32 i = 0; i < VERTEX_SHADER_REGISTERS; ++i)
-		{
-			kVSOutputCenter.kSourceInput.kShaderInputs[i] = (apkShaderInputs[0][i] + apkShaderInputs[1][i] + apkShaderInputs[2][i]) * MUL_DIVIDE_BY_TREE2;
-		}
-
-		// COMMENT : Call vertex shader
-		m_pkVertexShader->Execute(kVSOutputCenter.kSourceInput.kShaderInputs, kVSOutputCenter.kPosition, kVSOutputCenter.kShaderOutputs);
-
-		// COMMENT : Split outer triangle edge
-		SubdivideTriangleAdaptiveSubdivideEdges(0, pkVSOutput0, pkVSOutput1, &kVSOutputCenter);
-		SubdivideTriangleAdaptiveSubdivideEdges(0, pkVSOutput1, pkVSOutput2, &kVSOutputCenter);
-		SubdivideTriangleAdaptiveSubdivideEdges(0, pkVSOutput2, pkVSOutput0, &kVSOutputCenter);
-	}
-
-	bool Device::CullTriangle(const VertexShaderOutput* pkVSOutput0, const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2)
-	{
-		// COMMENT : Do back-face culling
-		if(CULL_NONE == m_auiRenderStates[RS_CULLMODE]) {return false;}
-
-		const FLOAT32 DIR_TEST = (pkVSOutput1->kPosition.x - pkVSOutput0->kPosition.x) * (pkVSOutput2->kPosition.y - pkVSOutput0->kPosition.y) - 
-			(pkVSOutput1->kPosition.y - pkVSOutput0->kPosition.y) * (pkVSOutput2->kPosition.x - pkVSOutput0->kPosition.x);
-		if(CULL_CCW == m_auiRenderStates[RS_CULLMODE])
-		{
-			if(DIR_TEST <= 0.0f) {return true;}
-		}
-		else
-		{
-			if(DIR_TEST >= 0.0f) {return true;}
-		}
-		return false;
-	}
-
-	UINT32 Device::ClipToPlane(UINT32 uiNumVertices, UINT32 uiStage, const Plane& rkPlane, bool bHomogenous)
-	{
-		VertexShaderOutput** ppkSrcVertices		= m_aapkClipVertices[uiStage];
-		VertexShaderOutput** ppkDestVertices	= m_aapkClipVertices[(uiStage + 1) & 1];
-
-		UINT32 uiNumClippedVertices = 0;
-		for(UINT32 i = 0, j = 1; i < uiNumVertices; ++i, ++j)
-		{
-			// COMMENT : Wrap over
-			if(j == uiNumVertices) {j = 0;}
-			// COMMENT : Distances of current and next vertex to clipping plane.
-			FLOAT32 fDI, fDJ;
-			if(true == bHomogenous)
-			{
-				fDI = rkPlane * ppkSrcVertices[i]->kPosition;
-				fDJ = rkPlane * ppkSrcVertices[j]->kPosition;
-			}
-			else
-			{
-				fDI = rkPlane * (*(Vector3*)&ppkSrcVertices[i]->kPosition);
-				fDJ = rkPlane * (*(Vector3*)&ppkSrcVertices[j]->kPosition);
-			}
-
-			if(fDI >= 0.0f)
-			{
-				ppkDestVertices[uiNumClippedVertices++] = ppkSrcVertices[i];
-				if(fDJ < 0.0f)
-				{
-					InterpolateVertexShaderOutput(&m_akClipVertices[m_uiNextFreeClipVertex], ppkSrcVertices[i], ppkSrcVertices[j], fDI / (fDI - fDJ));
-					ppkDestVertices[uiNumClippedVertices++] = &m_akClipVertices[m_uiNextFreeClipVertex];
-					m_uiNextFreeClipVertex = (m_uiNextFreeClipVertex + 1) % 20;
-				#	ifdef _DEBUG
-					if(0 == m_uiNextFreeClipVertex) {CORE3D_NOTIFY(_T("Wrap over: vertex creation during clipping! array too small...?\n"));}
-				#	endif
-				}
-			}
-			else
-			{
-				if(fDJ >= 0.0f)
-				{
-					InterpolateVertexShaderOutput(&m_akClipVertices[m_uiNextFreeClipVertex], ppkSrcVertices[j], ppkSrcVertices[i], fDJ / (fDJ - fDI));
-					ppkDestVertices[uiNumClippedVertices++] = &m_akClipVertices[m_uiNextFreeClipVertex];
-					m_uiNextFreeClipVertex = (m_uiNextFreeClipVertex + 1) % 20;
-				#	ifdef _DEBUG
-					if(0 == m_uiNextFreeClipVertex) {CORE3D_NOTIFY(_T("Wrap over: vertex creation during clipping! array too small...?\n"));}
-				#	endif
-				}
-			}
-		}
-		return uiNumClippedVertices;
-	}
-
-	void Device::DrawTriangle(const VertexShaderOutput* pkVSOutput0, const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2)
-	{
-		// COMMENT : Prepare triangle for homogeneous clipping
-		UINT32 uiNumVertices	= 3;
-		memcpy(&m_akClipVertices[0], pkVSOutput0, sizeof(VertexShaderOutput));
-		memcpy(&m_akClipVertices[1], pkVSOutput1, sizeof(VertexShaderOutput));
-		memcpy(&m_akClipVertices[2], pkVSOutput2, sizeof(VertexShaderOutput));
-		m_uiNextFreeClipVertex	= 3;
-
-		UINT32 uiStage			= 0;
-		m_aapkClipVertices[uiStage][0] = &m_akClipVertices[0];
-		m_aapkClipVertices[uiStage][1] = &m_akClipVertices[1];
-		m_aapkClipVertices[uiStage][2] = &m_akClipVertices[2];
-
-		// COMMENT : Call the triangle shader
-		if(NULL != m_pkTriangleShader)
-		{
-			if(false == m_pkTriangleShader->Execute(m_aapkClipVertices[0][0]->kShaderOutputs, 
-				m_aapkClipVertices[0][1]->kShaderOutputs, m_aapkClipVertices[0][2]->kShaderOutputs))
-			{
-				// COMMENT : Triangle got rejected.
-				return;
-			}
-		}
-
-		// COMMENT : Perform clipping to the frustum planes
-		for(UINT32 uiPlane = 0; uiPlane < CP_NUMPLANES; ++uiPlane)
-		{
-			if(false == m_kRenderInfo.abClippingPlaneEnabled[uiPlane]) {continue;}
-
-			uiNumVertices	= ClipToPlane(uiNumVertices, uiStage, m_kRenderInfo.akClippingPlanes[uiPlane], true);
-			if(uiNumVertices < 3) {return;}
-			uiStage			= (uiStage + 1) & 1;
-		}
-
-		// COMMENT : Project and rasterize the clipped triangle
-		UINT32 uiVertex;
-		// COMMENT : Project the first three vertices for culling
-		VertexShaderOutput** ppkSrc = m_aapkClipVertices[uiStage];
-		for(uiVertex = 0; uiVertex < 3; ++uiVertex)
-		{
-			ProjectVertex(ppkSrc[uiVertex]);
-		}
-
-		// COMMENT : We do not have to check for culling for each sub-polygon of the triangle, as they
-		// are all in the same plane. If the first polygon is culled then all other polygons
-		// would be culled, too.
-		if(true == CullTriangle(ppkSrc[0], ppkSrc[1], ppkSrc[2])) {return;}
-
-		// COMMENT : Project the remaining vertices
-		for(uiVertex = 3; uiVertex < uiNumVertices; ++uiVertex)
-		{
-			ProjectVertex(ppkSrc[uiVertex]);
-		}
-
-		// COMMENT : Perform clipping(in screen-space) to the scissor rectangle if enabled
-		if(BT_TRUE == m_auiRenderStates[RS_SCISSORTESTENABLE])
-		{
-			for(UINT32 uiPlane = 0; uiPlane < 4; ++uiPlane)
-			{
-				uiNumVertices	= ClipToPlane(uiNumVertices, uiStage, m_kRenderInfo.akScissorPlanes[uiPlane], false);
-				if(uiNumVertices < 3) {return;}
-				uiStage			= (uiStage + 1) & 1;
-			}
-
-			// COMMENT : New source for rasterization after scissoring
-			ppkSrc = m_aapkClipVertices[uiStage];
-		}
-
-		for(uiVertex = 1; uiVertex < uiNumVertices - 1; ++uiVertex)
-		{
-			RasterizeTriangle(ppkSrc[0], ppkSrc[uiVertex], ppkSrc[uiVertex + 1]);
-		}
-	}
-
-	void Device::CalculateTriangleGradients(const VertexShaderOutput* pkVSOutput0, const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2)
-	{
-		const FLOAT32 DELTA_X[2]	= {pkVSOutput1->kPosition.x - pkVSOutput0->kPosition.x, pkVSOutput2->kPosition.x - pkVSOutput0->kPosition.x};
-		const FLOAT32 DELTA_Y[2]	= {pkVSOutput1->kPosition.y - pkVSOutput0->kPosition.y, pkVSOutput2->kPosition.y - pkVSOutput0->kPosition.y};
-		m_kTriangleInfo.fCommonGradient = 1.0f / (DELTA_X[0] * DELTA_Y[1] - DELTA_X[1] * DELTA_Y[0]);
-		m_kTriangleInfo.pkBaseVertex	= pkVSOutput0;
-
-		// COMMENT : The derivatives with respect to the Y-coordinate are negated, because in screen-space the Y-axis is reversed.
-		const FLOAT32 DELTA_Z[2]	= {pkVSOutput1->kPosition.z - pkVSOutput0->kPosition.z, pkVSOutput2->kPosition.z - pkVSOutput0->kPosition.z};
-		m_kTriangleInfo.fZDdx		=  (DELTA_Z[0] * DELTA_Y[1] - DELTA_Z[1] * DELTA_Y[0]) * m_kTriangleInfo.fCommonGradient;
-		m_kTriangleInfo.fZDdy		= -(DELTA_Z[0] * DELTA_X[1] - DELTA_Z[1] * DELTA_X[0]) * m_kTriangleInfo.fCommonGradient;
-
-		const FLOAT32 DELTA_W[2]	= {pkVSOutput1->kPosition.w - pkVSOutput0->kPosition.w, pkVSOutput2->kPosition.w - pkVSOutput0->kPosition.w};
-		m_kTriangleInfo.fWDdx		=  (DELTA_W[0] * DELTA_Y[1] - DELTA_W[1] * DELTA_Y[0]) * m_kTriangleInfo.fCommonGradient;
-		m_kTriangleInfo.fWDdy		= -(DELTA_W[0] * DELTA_X[1] - DELTA_W[1] * DELTA_X[0]) * m_kTriangleInfo.fCommonGradient;
-
-		ShaderReg* pkDestDdx = m_kTriangleInfo.kShaderOutputsDdx;
-		ShaderReg* pkDestDdy = m_kTriangleInfo.kShaderOutputsDdy;
-		for(UINT32 uiReg = 0; uiReg < PIXEL_SHADER_REGISTERS; ++uiReg, ++pkDestDdx, ++pkDestDdy)
-		{
-			switch(m_kRenderInfo.aeVSOutputs[uiReg])
-			{
-			case SRT_VECTOR4:
-				{
-					const FLOAT32 DELTA_REG_VAL[2] = {pkVSOutput1->kShaderOutputs[uiReg].w - pkVSOutput0->kShaderOutputs[uiReg].w, 
-					pkVSOutput2->kShaderOutputs[uiReg].w - pkVSOutput0->kShaderOutputs[uiReg].w};
-					pkDestDdx->w =  (DELTA_REG_VAL[0] * DELTA_Y[1] - DELTA_REG_VAL[1] * DELTA_Y[0]) * m_kTriangleInfo.fCommonGradient;
-					pkDestDdy->w = -(DELTA_REG_VAL[0] * DELTA_X[1] - DELTA_REG_VAL[1] * DELTA_X[0]) * m_kTriangleInfo.fCommonGradient;
-				}
-			case SRT_VECTOR3:
-				{
-					const FLOAT32 DELTA_REG_VAL[2] = {pkVSOutput1->kShaderOutputs[uiReg].z - pkVSOutput0->kShaderOutputs[uiReg].z, 
-					pkVSOutput2->kShaderOutputs[uiReg].z - pkVSOutput0->kShaderOutputs[uiReg].z};
-					pkDestDdx->z =  (DELTA_REG_VAL[0] * DELTA_Y[1] - DELTA_REG_VAL[1] * DELTA_Y[0]) * m_kTriangleInfo.fCommonGradient;
-					pkDestDdy->z = -(DELTA_REG_VAL[0] * DELTA_X[1] - DELTA_REG_VAL[1] * DELTA_X[0]) * m_kTriangleInfo.fCommonGradient;
-				}
-			case SRT_VECTOR2:
-				{
-					const FLOAT32 DELTA_REG_VAL[2] = {pkVSOutput1->kShaderOutputs[uiReg].y - pkVSOutput0->kShaderOutputs[uiReg].y, 
-					pkVSOutput2->kShaderOutputs[uiReg].y - pkVSOutput0->kShaderOutputs[uiReg].y};
-					pkDestDdx->y =  (DELTA_REG_VAL[0] * DELTA_Y[1] - DELTA_REG_VAL[1] * DELTA_Y[0]) * m_kTriangleInfo.fCommonGradient;
-					pkDestDdy->y = -(DELTA_REG_VAL[0] * DELTA_X[1] - DELTA_REG_VAL[1] * DELTA_X[0]) * m_kTriangleInfo.fCommonGradient;
-				}
-			case SRT_FLOAT32:
-				{
-					const FLOAT32 DELTA_REG_VAL[2] = {pkVSOutput1->kShaderOutputs[uiReg].x - pkVSOutput0->kShaderOutputs[uiReg].x, 
-					pkVSOutput2->kShaderOutputs[uiReg].x - pkVSOutput0->kShaderOutputs[uiReg].x};
-					pkDestDdx->x =  (DELTA_REG_VAL[0] * DELTA_Y[1] - DELTA_REG_VAL[1] * DELTA_Y[0]) * m_kTriangleInfo.fCommonGradient;
-					pkDestDdy->x = -(DELTA_REG_VAL[0] * DELTA_X[1] - DELTA_REG_VAL[1] * DELTA_X[0]) * m_kTriangleInfo.fCommonGradient;
-				}
-			case SRT_UNUSED:
-			default: break;
-			}
-		}
-	}
-
-	void Device::SetVSOutputFromGradient(VertexShaderOutput* pkVSOutput, FLOAT32 fX, FLOAT32 fY)
-	{
-		const FLOAT32 OFFSET_X	= (fX - m_kTriangleInfo.pkBaseVertex->kPosition.x);
-		const FLOAT32 OFFSET_Y	= (fY - m_kTriangleInfo.pkBaseVertex->kPosition.y);
-
-		pkVSOutput->kPosition.z = m_kTriangleInfo.pkBaseVertex->kPosition.z + 
-			m_kTriangleInfo.fZDdx * OFFSET_X + m_kTriangleInfo.fZDdy * OFFSET_Y;
-		pkVSOutput->kPosition.w = m_kTriangleInfo.pkBaseVertex->kPosition.w + 
-			m_kTriangleInfo.fWDdx * OFFSET_X + m_kTriangleInfo.fWDdy * OFFSET_Y;
-
-		ShaderReg* pkDest		= pkVSOutput->kShaderOutputs;
-		const ShaderReg* BASE	= m_kTriangleInfo.pkBaseVertex->kShaderOutputs;
-		const ShaderReg* DDX	= m_kTriangleInfo.kShaderOutputsDdx;
-		const ShaderReg* DDY	= m_kTriangleInfo.kShaderOutputsDdy;
-		for(UINT32 uiReg = 0; uiReg < PIXEL_SHADER_REGISTERS; ++uiReg, ++pkDest, ++BASE, ++DDX, ++DDY)
-		{
-			// COMMENT : The following assignments to pkDest automatically zero out unused components
-			switch(m_kRenderInfo.aeVSOutputs[uiReg])
-			{
-			case SRT_FLOAT32:
-				*pkDest = *(FLOAT32*)BASE + *(FLOAT32*)DDX * OFFSET_X + *(FLOAT32*)DDY * OFFSET_Y; break;
-			case SRT_VECTOR2:
-				*pkDest = *(Vector2*)BASE + *(Vector2*)DDX * OFFSET_X + *(Vector2*)DDY * OFFSET_Y; break;
-			case SRT_VECTOR3:
-				*pkDest = *(Vector3*)BASE + *(Vector3*)DDX * OFFSET_X + *(Vector3*)DDY * OFFSET_Y; break;
-			case SRT_VECTOR4:
-				*pkDest = *(Vector4*)BASE + *(Vector4*)DDX * OFFSET_X + *(Vector4*)DDY * OFFSET_Y; break;
-			case SRT_UNUSED:
-			default: break;
-			}
-		}
-	}
-
-	void Device::StepXVSOutputFromGradient(VertexShaderOutput* pkVSOutput)
-	{
-		pkVSOutput->kPosition.z += m_kTriangleInfo.fZDdx;
-		pkVSOutput->kPosition.w += m_kTriangleInfo.fWDdx;
-
-		ShaderReg* pkDest		= pkVSOutput->kShaderOutputs;
-		const ShaderReg* DDX	= m_kTriangleInfo.kShaderOutputsDdx;
-		for(UINT32 uiReg = 0; uiReg < PIXEL_SHADER_REGISTERS; ++uiReg, ++pkDest, ++DDX)
-		{
-			switch(m_kRenderInfo.aeVSOutputs[uiReg])
-			{
-			case SRT_VECTOR4: pkDest->w += DDX->w;
-			case SRT_VECTOR3: pkDest->z += DDX->z;
-			case SRT_VECTOR2: pkDest->y += DDX->y;
-			case SRT_FLOAT32: pkDest->x += DDX->x;
-			case SRT_UNUSED:
-			default: break;
-			}
-		}
-	}
-
-	void Device::RasterizeTriangle(const VertexShaderOutput* pkVSOutput0, const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2)
-	{
-		CalculateTriangleGradients(pkVSOutput0, pkVSOutput1, pkVSOutput2);
-		// COMMENT : If in wire-frame mode draw triangle edges as lines
-		if(FILL_WIREFRAME == m_auiRenderStates[RS_FILLMODE])
-		{
-			RasterizeLine(pkVSOutput0, pkVSOutput1);
-			RasterizeLine(pkVSOutput1, pkVSOutput2);
-			RasterizeLine(pkVSOutput2, pkVSOutput0);
-			return;
-		}
-
-		// COMMENT : Sort vertices by Y-coordinate
-		const VertexShaderOutput* VERTICES[3] = {pkVSOutput0, pkVSOutput1, pkVSOutput2};
-		if(pkVSOutput1->kPosition.y < VERTICES[0]->kPosition.y) {VERTICES[1] = VERTICES[0]; VERTICES[0] = pkVSOutput1;}
-		if(pkVSOutput2->kPosition.y < VERTICES[0]->kPosition.y) {VERTICES[2] = VERTICES[1]; VERTICES[1] = VERTICES[0]; VERTICES[0] = pkVSOutput2;}
-		else 
-		if(pkVSOutput2->kPosition.y < VERTICES[1]->kPosition.y) {VERTICES[2] = VERTICES[1]; VERTICES[1] = pkVSOutput2;}
-
-		// COMMENT : Screen-space position references
-		const Vector4& vA = VERTICES[0]->kPosition;
-		const Vector4& vB = VERTICES[1]->kPosition;
-		const Vector4& vC = VERTICES[2]->kPosition;
-
-		// COMMENT : Calculate slopes for stepping
-		const FLOAT32 STEP_X[3] = 
-		{
-			((vB.y - vA.y) > 0.0f) ? (vB.x - vA.x) / (vB.y - vA.y) : 0.0f,
-			((vC.y - vA.y) > 0.0f) ? (vC.x - vA.x) / (vC.y - vA.y) : 0.0f,
-			((vC.y - vB.y) > 0.0f) ? (vC.x - vB.x) / (vC.y - vB.y) : 0.0f
-		};
-
-		// COMMENT : Begin rasterization
-		FLOAT32 afX[2] = {vA.x, vA.x};
-		for(UINT32 uiPart = 0; uiPart < 2; ++uiPart)
-		{
-			UINT32 auiY[2]		= {0, 0};
-			FLOAT32 afDeltaX[2] = {0.0f, 0.0f};
-
-			switch(uiPart)
-			{
-			case 0: // Draw upper triangle part
-				{
-					auiY[0] = static_cast<UINT32>(Core3D::FtoL(ceilf(vA.y)));
-					auiY[1] = static_cast<UINT32>(Core3D::FtoL(ceilf(vB.y)));
-					
-					if(STEP_X[0] > STEP_X[1]) // left <-> right?
-					{
-						afDeltaX[0] = STEP_X[1];
-						afDeltaX[1] = STEP_X[0];
-					}
-					else
-					{
-						afDeltaX[0] = STEP_X[0];
-						afDeltaX[1] = STEP_X[1];
-					}
-					
-					const FLOAT32 PRE_STEP_Y = static_cast<FLOAT32>(auiY[0]) - vA.y;
-					afX[0] += afDeltaX[0] * PRE_STEP_Y;
-					afX[1] += afDeltaX[1] * PRE_STEP_Y;
-				}
-				break;
-			case 1: // Draw lower triangle part
-				{
-					auiY[0] = static_cast<UINT32>(Core3D::FtoL(ceilf(vB.y)));
-					auiY[1] = static_cast<UINT32>(Core3D::FtoL(ceilf(vC.y)));
-					const FLOAT32 PRE_STEP_Y = static_cast<FLOAT32>(auiY[0]) - vB.y;
-
-					if(STEP_X[1] > STEP_X[2]) // left <-> right?
-					{
-						afDeltaX[0] = STEP_X[1];
-						afDeltaX[1] = STEP_X[2];
-						afX[1]		= vB.x + afDeltaX[1] * PRE_STEP_Y;
-					}
-					else
-					{
-						afDeltaX[0] = STEP_X[2];
-						afDeltaX[1] = STEP_X[1];
-						afX[0]		= vB.x + afDeltaX[0] * PRE_STEP_Y;
-					}
-				}
-				break;
-			}
-
-			for( ; auiY[0] < auiY[1]; ++auiY[0], afX[0] += afDeltaX[0], afX[1] += afDeltaX[1])
-			{
-				const INT32 aiX[2] = {Core3D::FtoL(ceilf(afX[0])), Core3D::FtoL(ceilf(afX[1]))};
-				VertexShaderOutput kVSOutput;
-				SetVSOutputFromGradient(&kVSOutput, static_cast<FLOAT32>(aiX[0]), static_cast<FLOAT32>(auiY[0]));
-				m_kTriangleInfo.uiCurrentPixelY = auiY[0];
-				(this->*m_kRenderInfo.pfnRasterizeScanLine)(auiY[0], static_cast<UINT32>(aiX[0]), static_cast<UINT32>(aiX[1]), &kVSOutput);
-			}
-		}
-	}
-
-	void Device::RasterizeScanlineColorOnly(UINT32 uiY, UINT32 uiX, UINT32 uiX2, VertexShaderOutput* pkVSOutput)
-	{
-		FLOAT32* pfFrameData = m_kRenderInfo.pfFrameData + (uiY * m_kRenderInfo.uiColorBufferPitch + uiX * m_kRenderInfo.uiColorFloats);
-		FLOAT32* pfDepthData = m_kRenderInfo.pfDepthData + (uiY * m_kRenderInfo.uiDepthBufferPitch + uiX);
-
-		for( ; uiX < uiX2; ++uiX, pfFrameData += m_kRenderInfo.uiColorFloats, ++pfDepthData, StepXVSOutputFromGradient(pkVSOutput))
-		{
-			// COMMENT : Get depth of current pixel
-			FLOAT32 fDepth = pkVSOutput->kPosition.z;
-			
-			// COMMENT : Perform depth test
-			switch(m_kRenderInfo.eDepthCompare)
-			{
-			case CMP_NEVER:			return;
-			case CMP_EQUAL:			if(fabsf(fDepth - *pfDepthData) < FLT_EPSILON)	{break;} else {continue;}
-			case CMP_NOTEQUAL:		if(fabsf(fDepth - *pfDepthData) >= FLT_EPSILON) {break;} else {continue;}
-			case CMP_LESS:			if(fDepth < *pfDepthData)	{break;} else {continue;}
-			case CMP_LESSEQUAL:		if(fDepth <= *pfDepthData)	{break;} else {continue;}
-			case CMP_GREATEREQUAL:	if(fDepth >= *pfDepthData)	{break;} else {continue;}
-			case CMP_GREATER:		if(fDepth > *pfDepthData)	{break;} else {continue;}
-			case CMP_ALWAYS:		break;
-			}
-
-			// COMMENT : Passed depth test - update depth buffer
-			if(true == m_kRenderInfo.bDepthWrite)
-			{
-				*pfDepthData = fDepth;
-			}
-
-			if(true == m_kRenderInfo.bColorWrite)
-			{
-				VertexShaderOutput kPSInput;
-				m_kTriangleInfo.fCurrentPixelInvW = 1.0f / pkVSOutput->kPosition.w;
-				MultiplyVertexShaderOutputRegisters(&kPSInput, pkVSOutput, m_kTriangleInfo.fCurrentPixelInvW);
-
-				// NOTE: kPSInput now only contains valid register data, position etc. are not initialized
-				// Read in current pixel's color in the color-buffer
-				Vector4 kPixelColor(0.0f, 0.0f, 0.0f, 1.0f);
-				switch(m_kRenderInfo.uiColorFloats)
-				{
-				case 4: kPixelColor.a = pfFrameData[3];
-				case 3: kPixelColor.b = pfFrameData[2];
-				case 2: kPixelColor.g = pfFrameData[1];
-				case 1: kPixelColor.r = pfFrameData[0];
-				}
-
-				// COMMENT : Execute the pixel shader
-				m_kTriangleInfo.uiCurrentPixelX = uiX;
-				m_pkPixelShader->Execute(kPSInput.kShaderOutputs, kPixelColor, fDepth);
-
-				// COMMENT : Write the new color to the color-buffer
-				switch(m_kRenderInfo.uiColorFloats)
-				{
-				case 4: pfFrameData[3] = kPixelColor.a;
-				case 3: pfFrameData[2] = kPixelColor.b;
-				case 2: pfFrameData[1] = kPixelColor.g;
-				case 1: pfFrameData[0] = kPixelColor.r;
-				}
-			}
-			++m_kRenderInfo.uiRenderedPixels;
-		}
-	}
-
-	void Device::RasterizeScanlineColorOnlyMightKillPixels(UINT32 uiY, UINT32 uiX, UINT32 uiX2, VertexShaderOutput* pkVSOutput)
-	{
-		FLOAT32* pfFrameData = m_kRenderInfo.pfFrameData + (uiY * m_kRenderInfo.uiColorBufferPitch + uiX * m_kRenderInfo.uiColorFloats);
-		FLOAT32* pfDepthData = m_kRenderInfo.pfDepthData + (uiY * m_kRenderInfo.uiDepthBufferPitch + uiX);
-
-		for( ; uiX < uiX2; ++uiX, pfFrameData += m_kRenderInfo.uiColorFloats, ++pfDepthData, StepXVSOutputFromGradient(pkVSOutput))
-		{
-			// COMMENT : Get depth of current pixel
-			FLOAT32 fDepth = pkVSOutput->kPosition.z;
-
-			// COMMENT : Perform depth test
-			switch(m_kRenderInfo.eDepthCompare)
-			{
-			case CMP_NEVER:			return;
-			case CMP_EQUAL:			if(fabsf(fDepth - *pfDepthData) < FLT_EPSILON)	{break;} else {continue;}
-			case CMP_NOTEQUAL:		if(fabsf(fDepth - *pfDepthData) >= FLT_EPSILON) {break;} else {continue;}
-			case CMP_LESS:			if(fDepth < *pfDepthData)	{break;} else {continue;}
-			case CMP_LESSEQUAL:		if(fDepth <= *pfDepthData)	{break;} else {continue;}
-			case CMP_GREATEREQUAL:	if(fDepth >= *pfDepthData)	{break;} else {continue;}
-			case CMP_GREATER:		if(fDepth > *pfDepthData)	{break;} else {continue;}
-			case CMP_ALWAYS:		break;
-			}
-
-			if(true == m_kRenderInfo.bColorWrite || true == m_kRenderInfo.bDepthWrite)
-			{
-				VertexShaderOutput kPSInput;
-				m_kTriangleInfo.fCurrentPixelInvW = 1.0f / pkVSOutput->kPosition.w;
-				MultiplyVertexShaderOutputRegisters(&kPSInput, pkVSOutput, m_kTriangleInfo.fCurrentPixelInvW);
-
-				// NOTE: kPSInput now only contains valid register data, position etc. are not initialized
-				// Read in current pixel's color in the color-buffer
-				Vector4 kPixelColor(0.0f, 0.0f, 0.0f, 1.0f);
-				switch(m_kRenderInfo.uiColorFloats)
-				{
-				case 4: kPixelColor.a = pfFrameData[3];
-				case 3: kPixelColor.b = pfFrameData[2];
-				case 2: kPixelColor.g = pfFrameData[1];
-				case 1: kPixelColor.r = pfFrameData[0];
-				}
-
-				// COMMENT : Execute the pixel shader
-				m_kTriangleInfo.uiCurrentPixelX = uiX;
-				if(false == m_pkPixelShader->Execute(kPSInput.kShaderOutputs, kPixelColor, fDepth))
-				{
-					// COMMENT : Pixel got killed
-					continue;
-				}
-
-				// COMMENT : Passed depth test and pixel was not killed, so update depth-buffer
-				if(true == m_kRenderInfo.bDepthWrite)
-				{
-					*pfDepthData = fDepth;
-				}
-
-				// COMMENT : Write the new color to the color-buffer
-				if(true == m_kRenderInfo.bColorWrite)
-				{
-					switch(m_kRenderInfo.uiColorFloats)
-					{
-					case 4: pfFrameData[3] = kPixelColor.a;
-					case 3: pfFrameData[2] = kPixelColor.b;
-					case 2: pfFrameData[1] = kPixelColor.g;
-					case 1: pfFrameData[0] = kPixelColor.r;
-					}
-				}
-			}
-			++m_kRenderInfo.uiRenderedPixels;
-		}
-	}
-
-	void Device::RasterizeScanlineColorDepth(UINT32 uiY, UINT32 uiX, UINT32 uiX2, VertexShaderOutput* pkVSOutput)
-	{
-		FLOAT32* pfFrameData = m_kRenderInfo.pfFrameData + (uiY * m_kRenderInfo.uiColorBufferPitch + uiX * m_kRenderInfo.uiColorFloats);
-		FLOAT32* pfDepthData = m_kRenderInfo.pfDepthData + (uiY * m_kRenderInfo.uiDepthBufferPitch + uiX);
-
-		for( ; uiX < uiX2; ++uiX, pfFrameData += m_kRenderInfo.uiColorFloats, ++ pfDepthData, StepXVSOutputFromGradient(pkVSOutput))
-		{
-			VertexShaderOutput kPSInput;
-			m_kTriangleInfo.fCurrentPixelInvW = 1.0f / pkVSOutput->kPosition.w;
-			MultiplyVertexShaderOutputRegisters(&kPSInput, pkVSOutput, m_kTriangleInfo.fCurrentPixelInvW);
-
-			// NOTE: kPSInput now only contains valid register data, position etc. are not initialized
-			// Read in current color-buffer color
-			Vector4 kPixelColor(0.0f, 0.0f, 0.0f, 1.0f);
-			switch(m_kRenderInfo.uiColorFloats)
-			{
-			case 4: kPixelColor.a = pfFrameData[3];
-			case 3: kPixelColor.b = pfFrameData[2];
-			case 2: kPixelColor.g = pfFrameData[1];
-			case 1: kPixelColor.r = pfFrameData[0];
-			}
-
-			// COMMENT : Get depth of current pixel
-			FLOAT32 fDepth = pkVSOutput->kPosition.z;
-
-			// COMMENT : Execute pixel shader
-			m_kTriangleInfo.uiCurrentPixelX = uiX;
-			if(false == m_pkPixelShader->Execute(kPSInput.kShaderOutputs, kPixelColor, fDepth))
-			{
-				// COMMENT : Pixel got killed
-				continue;
-			}
-
-			// COMMENT : Perform depth test
-			switch(m_kRenderInfo.eDepthCompare)
-			{
-			case CMP_NEVER:			return;
-			case CMP_EQUAL:			if(fabsf(fDepth - *pfDepthData) < FLT_EPSILON)	{break;} else {continue;}
-			case CMP_NOTEQUAL:		if(fabsf(fDepth - *pfDepthData) >= FLT_EPSILON) {break;} else {continue;}
-			case CMP_LESS:			if(fDepth < *pfDepthData)	{break;} else {continue;}
-			case CMP_LESSEQUAL:		if(fDepth <= *pfDepthData)	{break;} else {continue;}
-			case CMP_GREATEREQUAL:	if(fDepth >= *pfDepthData)	{break;} else {continue;}
-			case CMP_GREATER:		if(fDepth > *pfDepthData)	{break;} else {continue;}
-			case CMP_ALWAYS:		break;
-			}
-
-			// COMMENT : Passed depth test, so update depth buffer
-			if(true == m_kRenderInfo.bDepthWrite)
-			{
-				*pfDepthData = fDepth;
-			}
-
-			// COMMENT : Write new color to color buffer
-			if(true == m_kRenderInfo.bColorWrite)
-			{
-				switch(m_kRenderInfo.uiColorFloats)
-				{
-				case 4: pfFrameData[3] = kPixelColor.a;
-				case 3: pfFrameData[2] = kPixelColor.b;
-				case 2: pfFrameData[1] = kPixelColor.g;
-				case 1: pfFrameData[0] = kPixelColor.r;
-				}
-			}
-			++m_kRenderInfo.uiRenderedPixels;
-		}
-	}
-
-	void Device::RasterizeLine(const VertexShaderOutput* pkVSOutput0, const VertexShaderOutput* pkVSOutput1)
-	{
-		const Vector4& vA = pkVSOutput0->kPosition;
-		const Vector4& vB = pkVSOutput1->kPosition;
-
-		const UINT32 INT_COORDS_A[2]	= {static_cast<UINT32>(Core3D::FtoL(vA.x)), static_cast<UINT32>(Core3D::FtoL(vA.y))};
-		const FLOAT32 DELTA_X			= vB.x - vA.x;
-		const FLOAT32 DELTA_Y			= vB.y - vA.y;
-
-		const INT32 LINE_THICKNESS_HALF	= -(static_cast<INT32>(m_auiRenderStates[RS_LINETHICKNESS] / 2));
-		const INT32 POS_OFFSET			= (m_auiRenderStates[RS_LINETHICKNESS] & 1) ? 0 : 1;
-
-		if(fabsf(DELTA_X) > fabsf(DELTA_Y))
-		{
-			// COMMENT : Drawing a line which is more horizontal than vertical
-			const INT32 PIXELS_X		= Core3D::FtoL((FLOAT32)DELTA_X);
-			if(0 == PIXELS_X) {return;}
-
-			const INT32 SIGN_X			= PIXELS_X > 0 ? 1 : -1;
-			const FLOAT32 SLOPE			= DELTA_Y / DELTA_X;
-
-			FLOAT32 fInterpolation		= SIGN_X > 0 ? 0.0f : 1.0f;
-			const FLOAT32 INTERPOLATION_STEP = static_cast<const FLOAT32>(SIGN_X) / static_cast<const FLOAT32>(abs(PIXELS_X) - 1);
-
-			for(INT32 i = 0; i != PIXELS_X; i += SIGN_X, fInterpolation += INTERPOLATION_STEP)
-			{
-				UINT32 uiPixelX			= INT_COORDS_A[0] + i;
-				UINT32 uiPixelY			= INT_COORDS_A[1] + Core3D::FtoL((FLOAT32)(SLOPE * i));
-
-				VertexShaderOutput kPSInput;
-				SetVSOutputFromGradient(&kPSInput, static_cast<FLOAT32>(uiPixelX), static_cast<FLOAT32>(uiPixelY));
-				m_kTriangleInfo.fCurrentPixelInvW = 1.0f / kPSInput.kPosition.w;
-				MultiplyVertexShaderOutputRegisters(&kPSInput, &kPSInput, m_kTriangleInfo.fCurrentPixelInvW);
-
-				if(uiPixelY > m_pkRenderTarget->GetColorBuffer()->GetHeight()) {continue;} // uiPixelY  Color Buffer ũ  Ŭ  ־    .
-				if(0 == LINE_THICKNESS_HALF) {(this->*m_kRenderInfo.pfnDrawPixel)(uiPixelX, uiPixelY, &kPSInput);}
-				else
-				{
-					for(INT32 j = LINE_THICKNESS_HALF + POS_OFFSET; j <= -LINE_THICKNESS_HALF; ++j)
-					{
-						INT32 iNewPixelY = uiPixelY + j;
-						if( (iNewPixelY < static_cast<INT32>(m_kRenderInfo.rcViewportRect.uiTop))	|| 
-							(iNewPixelY >= static_cast<INT32>(m_kRenderInfo.rcViewportRect.uiBottom)) )
-						{
-							continue;
-						}
-						(this->*m_kRenderInfo.pfnDrawPixel)(uiPixelX, static_cast<UINT32>(iNewPixelY), &kPSInput);
-					}
-				}
-			}
-		}
-		else
-		{
-			const INT32 PIXELS_Y		= Core3D::FtoL((FLOAT32)DELTA_Y);
-			if(0 == PIXELS_Y) {return;}
-
-			const INT32 SIGN_Y			= PIXELS_Y > 0 ? 1 : -1;
-			const FLOAT32 SLOPE			= DELTA_X / DELTA_Y;
-
-			FLOAT32 fInterpolation		= SIGN_Y > 0 ? 0.0f : 1.0f;
-			const FLOAT32 INTERPOLATION_STEP = static_cast<const FLOAT32>(SIGN_Y) / static_cast<const FLOAT32>(abs(PIXELS_Y) - 1);
-
-			for(INT32 i = 0; i != PIXELS_Y; i += SIGN_Y, fInterpolation += INTERPOLATION_STEP)
-			{
-				UINT32 uiPixelX			= INT_COORDS_A[0] + Core3D::FtoL((FLOAT32)(SLOPE * i));
-				UINT32 uiPixelY			= INT_COORDS_A[1] + i;
-
-				VertexShaderOutput kPSInput;
-				SetVSOutputFromGradient(&kPSInput, static_cast<FLOAT>(uiPixelX), static_cast<FLOAT32>(uiPixelY));
-				m_kTriangleInfo.fCurrentPixelInvW = 1.0f / kPSInput.kPosition.w;
-				MultiplyVertexShaderOutputRegisters(&kPSInput, &kPSInput, m_kTriangleInfo.fCurrentPixelInvW);
-
-				if(uiPixelY > m_pkRenderTarget->GetColorBuffer()->GetHeight()) {continue;} // uiPixelY  Color Buffer ũ  Ŭ  ־    .
-				if(0 == LINE_THICKNESS_HALF) {(this->*m_kRenderInfo.pfnDrawPixel)(uiPixelX, uiPixelY, &kPSInput);}
-				else
-				{
-					for(INT32 j = LINE_THICKNESS_HALF + POS_OFFSET; j <= -LINE_THICKNESS_HALF; ++j)
-					{
-						INT32 iNewPixelX = uiPixelX + j;
-						if( (iNewPixelX < static_cast<INT32>(m_kRenderInfo.rcViewportRect.uiLeft)) || 
-							(iNewPixelX >= static_cast<INT32>(m_kRenderInfo.rcViewportRect.uiRight)) )
-						{
-							continue;
-						}
-						(this->*m_kRenderInfo.pfnDrawPixel)(static_cast<UINT32>(iNewPixelX), uiPixelY, &kPSInput);
-					}
-				}
-			}
-		}
-	}
-
-	void Device::DrawPixelColorOnly(UINT32 uiX, UINT32 uiY, const VertexShaderOutput* pkVSOutput)
-	{
-		FLOAT32* pfFrameData = m_kRenderInfo.pfFrameData + (uiY * m_kRenderInfo.uiColorBufferPitch + uiX * m_kRenderInfo.uiColorFloats);
-		FLOAT32* pfDepthData = m_kRenderInfo.pfDepthData + (uiY * m_kRenderInfo.uiDepthBufferPitch + uiX);
-
-		// COMMENT : Perform depth test
-		switch(m_kRenderInfo.eDepthCompare)
-		{
-		case CMP_NEVER:			return;
-		case CMP_EQUAL:			if(fabsf(pkVSOutput->kPosition.z - *pfDepthData) < FLT_EPSILON)		{break;} else {return;}
-		case CMP_NOTEQUAL:		if(fabsf(pkVSOutput->kPosition.z - *pfDepthData) >= FLT_EPSILON)	{break;} else {return;}
-		case CMP_LESS:			if(pkVSOutput->kPosition.z < *pfDepthData)	{break;} else {return;}
-		case CMP_LESSEQUAL:		if(pkVSOutput->kPosition.z <= *pfDepthData) {break;} else {return;}
-		case CMP_GREATEREQUAL:	if(pkVSOutput->kPosition.z >= *pfDepthData) {break;} else {return;}
-		case CMP_GREATER:		if(pkVSOutput->kPosition.z > *pfDepthData)	{break;} else {return;}
-		case CMP_ALWAYS:		break;
-		}
-
-		if(true == m_kRenderInfo.bColorWrite || true == m_kRenderInfo.bDepthWrite)
-		{
-			// COMMENT : Read in current pixel's color in the color-buffer
-			Vector4 kPixelColor(0.0f, 0.0f, 0.0f, 1.0f);
-			switch(m_kRenderInfo.uiColorFloats)
-			{
-			case 4: kPixelColor.a = pfFrameData[3];
-			case 3: kPixelColor.b = pfFrameData[2];
-			case 2: kPixelColor.g = pfFrameData[1];
-			case 1: kPixelColor.r = pfFrameData[0];
-			}
-
-			// COMMENT : Execute the pixel shader
-			FLOAT32 fPSDepth = pkVSOutput->kPosition.z; // If we passed pkVSOutput->kPosition.z directly to the pixel shader,
-														// It might modify it, which is not allowed in this function.
-			m_kTriangleInfo.uiCurrentPixelX = uiX;
-			m_kTriangleInfo.uiCurrentPixelY = uiY;
-
-			if(false == m_pkPixelShader->Execute(pkVSOutput->kShaderOutputs, kPixelColor, fPSDepth))
-			{
-				// COMMENT : Pixel got killed
-				return;
-			}
-
-			// COMMENT : Passed depth test and pixel was not killed, so update depth buffer
-			if(true == m_kRenderInfo.bDepthWrite)
-			{
-				*pfDepthData = pkVSOutput->kPosition.z;
-			}
-
-			// COMMENT : Write the new color to the color buffer
-			if(true == m_kRenderInfo.bColorWrite)
-			{
-				switch(m_kRenderInfo.uiColorFloats)
-				{
-				case 4: pfFrameData[3] = kPixelColor.a;
-				case 3: pfFrameData[2] = kPixelColor.b;
-				case 2: pfFrameData[1] = kPixelColor.g;
-				case 1: pfFrameData[0] = kPixelColor.r;
-				}
-			}
-		}
-		++m_kRenderInfo.uiRenderedPixels;
-	}
-
-	void Device::DrawPixelColorDepth(UINT32 uiX, UINT32 uiY, const VertexShaderOutput* pkVSOutput)
-	{
-		FLOAT32* pfFrameData = m_kRenderInfo.pfFrameData + (uiY * m_kRenderInfo.uiColorBufferPitch + uiX * m_kRenderInfo.uiColorFloats);
-		FLOAT32* pfDepthData = m_kRenderInfo.pfDepthData + (uiY * m_kRenderInfo.uiDepthBufferPitch + uiX);
-
-		// COMMENT : Read in current pixel's color in the color buffer
-		Vector4 kPixelColor(0.0f, 0.0f, 0.0f, 1.0f);
-		switch(m_kRenderInfo.uiColorFloats)
-		{
-		case 4: kPixelColor.a = pfFrameData[3];
-		case 3: kPixelColor.b = pfFrameData[2];
-		case 2: kPixelColor.g = pfFrameData[1];
-		case 1: kPixelColor.r = pfFrameData[0];
-		}
-
-		// COMMENT : Execute the pixel shader
-		FLOAT32 fPSDepth = pkVSOutput->kPosition.z; // If we passed pkVSOutput->kPosition.z directly to the pixel shader,
-													// It might modify it, which is not allowed in this function.
-		m_kTriangleInfo.uiCurrentPixelX = uiX;
-		m_kTriangleInfo.uiCurrentPixelY = uiY;
-
-		if(false == m_pkPixelShader->Execute(pkVSOutput->kShaderOutputs, kPixelColor, fPSDepth))
-		{
-			// COMMENT : Pixel got killed
-			return;
-		}
-
-		// COMMENT : Perform depth test
-		switch(m_kRenderInfo.eDepthCompare)
-		{
-		case CMP_NEVER:			return;
-		case CMP_EQUAL:			if(fabsf(fPSDepth - *pfDepthData) < FLT_EPSILON)	{break;} else {return;}
-		case CMP_NOTEQUAL:		if(fabsf(fPSDepth - *pfDepthData) >= FLT_EPSILON)	{break;} else {return;}
-		case CMP_LESS:			if(fPSDepth < *pfDepthData)		{break;} else {return;}
-		case CMP_LESSEQUAL:		if(fPSDepth <= *pfDepthData)	{break;} else {return;}
-		case CMP_GREATEREQUAL:	if(fPSDepth >= *pfDepthData)	{break;} else {return;}
-		case CMP_GREATER:		if(fPSDepth > *pfDepthData)		{break;} else {return;}
-		case CMP_ALWAYS:		break;
-		}
-
-		// COMMENT : Passed depth test and pixel was not killed, so update depth buffer
-		if(true == m_kRenderInfo.bDepthWrite)
-		{
-			*pfDepthData = fPSDepth;
-		}
-
-		// COMMENT : Write the new color to the color buffer
-		if(true == m_kRenderInfo.bColorWrite)
-		{
-			switch(m_kRenderInfo.uiColorFloats)
-			{
-			case 4: pfFrameData[3] = kPixelColor.a;
-			case 3: pfFrameData[2] = kPixelColor.b;
-			case 2: pfFrameData[1] = kPixelColor.g;
-			case 1: pfFrameData[0] = kPixelColor.r;
-			}
-		}
-		++m_kRenderInfo.uiRenderedPixels;
-	}
+#include "Device.h"
+#include "Object.h"
+#include "BaseTexture.h"
+#include "CommandList.h"
+#include "CubeTexture.h"
+#include "FrameCapture.h"
+#include "IndexBuffer.h"
+#include "PresentTarget.h"
+#include "SwapChain.h"
+#include "RenderTarget.h"
+#include "Shaders.h"
+#include "Surface.h"
+#include "Texture.h"
+#include "PrimitiveAssembler.h"
+#include "VertexBuffer.h"
+#include "VertexFormat.h"
+#include "Volume.h"
+#include "VolumeTexture.h"
+#include <algorithm>
+
+namespace Core3D
+{
+	Device::Device(Object* pkParent, const DeviceParameters* pkDeviceParameters)
+		: m_pkParent(pkParent)
+		, m_pkPresentTarget(NULL)
+		, m_pkSwapChain(NULL)
+		, m_pkVertexFormat(NULL)
+		, m_pkPrimitiveAssembler(NULL)
+		, m_pkVertexShader(NULL)
+		, m_pkTriangleShader(NULL)
+		, m_pkPixelShader(NULL)
+		, m_pkIndexBuffer(NULL)
+		, m_pkRenderTarget(NULL)
+		, m_pkFrameCapture(NULL)
+		, m_bVisibilityPass(false)
+		, m_pkVisibilityTarget(NULL)
+		, m_uiVisibilityPitch(0)
+	{
+		m_pkParent->AddRef();
+
+		memcpy(&m_kDeviceParameters, pkDeviceParameters, sizeof(DeviceParameters));
+
+		m_kPresentConversion.eToneMapping	= TM_NONE;
+		m_kPresentConversion.fExposure		= 1.0f;
+		m_kPresentConversion.bDither		= false;
+		
+		memset(m_akVertexStreams,	0, sizeof(m_akVertexStreams));
+		memset(m_akTextureSamplers, 0, sizeof(m_akTextureSamplers));
+		memset(&m_rcScissorRect,	0, sizeof(m_rcScissorRect));
+		memset(&m_kRenderInfo,		0, sizeof(m_kRenderInfo));
+		memset(&m_kRenderContext,	0, sizeof(m_kRenderContext));
+		m_kRenderContext.pkDevice = this;
+		ResetPipelineStatistics();
+
+		SetDefaultRenderStates();
+		SetDefaultTextureSamplerStates();
+		SetDefaultClippingPlanes();
+	}
+
+	Device::~Device()
+	{
+		CORE3D_SAFE_DELETE(m_pkFrameCapture);
+		ReleaseVisibilityPass();
+
+		// COMMENT : The swap-chain presents through the present-target until it is released
+		CORE3D_SAFE_RELEASE(m_pkSwapChain);
+		CORE3D_SAFE_RELEASE(m_pkPresentTarget);
+		CORE3D_SAFE_RELEASE(m_pkParent);
+	}
+
+	Result Device::Create()
+	{
+		// COMMENT : Has to exist before the present-target, which converts frames with jobs
+		Result eResult = m_kJobSystem.Create(m_kDeviceParameters.uiWorkerThreads);
+		if(CORE3D_FAILED(eResult)) {return eResult;}
+
+	#	ifdef WIN32
+		if(NULL != m_kDeviceParameters.hDeviceWnd)	{m_pkPresentTarget = new PresentTargetWin32(this);}
+		else										{m_pkPresentTarget = new PresentTargetHeadless(this);}
+	#	else
+		m_pkPresentTarget = new PresentTargetHeadless(this);
+	#	endif
+
+		if(NULL == m_pkPresentTarget)
+		{
+			CORE3D_ERROR(_T("Device::Create() - Out of memory, cannot create present target.\n"));
+			return OUT_OF_MEMORY;
+		}
+
+		eResult = m_pkPresentTarget->Create();
+		if(CORE3D_FAILED(eResult)) {return eResult;}
+
+		// COMMENT : Present asynchronously if more than one back-buffer has been requested
+		if(m_kDeviceParameters.uiBackBufferCount > 1)
+		{
+			m_pkSwapChain = new SwapChain(this);
+			if(NULL == m_pkSwapChain)
+			{
+				CORE3D_ERROR(_T("Device::Create() - Out of memory, cannot create swap-chain.\n"));
+				return OUT_OF_MEMORY;
+			}
+			return m_pkSwapChain->Create(m_pkPresentTarget, m_kDeviceParameters.uiBackBufferCount);
+		}
+		return OK;
+	}
+
+	void Device::SetDefaultRenderStates()
+	{
+		SetRenderState(RS_ZENABLE, BT_TRUE);
+		SetRenderState(RS_ZWRITEENABLE, BT_TRUE);
+		SetRenderState(RS_ZFUNC, CMP_LESS);
+
+		SetRenderState(RS_COLORWRITEENABLE, BT_TRUE);
+		SetRenderState(RS_FILLMODE, FILL_SOLID);
+		SetRenderState(RS_CULLMODE, CULL_CCW);
+
+		SetRenderState(RS_SUBDIVISIONMODE, SUBDIV_NONE);
+		SetRenderState(RS_SUBDIVISIONLEVELS, 1);
+		SetRenderState(RS_SUBDIVISIONPOSITIONREGISTER, 0);
+		SetRenderState(RS_SUBDIVISIONNORMALREGISTER, 1);
+		const FLOAT32 DEFAULT_SUBDIVISION_MAX_SCREENAREA = 1.0f;
+		SetRenderState(RS_SUBDIVISIONMAXSCREENAREA, *((UINT32*)&DEFAULT_SUBDIVISION_MAX_SCREENAREA));
+		SetRenderState(RS_SUBDIVISIONMAXINNERLEVELS, 1);
+
+		SetRenderState(RS_SCISSORTESTENABLE, BT_FALSE);
+		SetRenderState(RS_LINETHICKNESS, 1);
+
+		SetRenderState(RS_STENCILENABLE, BT_FALSE);
+		SetRenderState(RS_STENCILFUNC, CMP_ALWAYS);
+		SetRenderState(RS_STENCILREF, 0);
+		SetRenderState(RS_STENCILMASK, MAX_STENCIL_VALUE);
+		SetRenderState(RS_STENCILWRITEMASK, MAX_STENCIL_VALUE);
+		SetRenderState(RS_STENCILFAIL, SOP_KEEP);
+		SetRenderState(RS_STENCILZFAIL, SOP_KEEP);
+		SetRenderState(RS_STENCILPASS, SOP_KEEP);
+		SetRenderState(RS_TWOSIDEDSTENCILMODE, BT_FALSE);
+		SetRenderState(RS_CCW_STENCILFUNC, CMP_ALWAYS);
+		SetRenderState(RS_CCW_STENCILFAIL, SOP_KEEP);
+		SetRenderState(RS_CCW_STENCILZFAIL, SOP_KEEP);
+		SetRenderState(RS_CCW_STENCILPASS, SOP_KEEP);
+	}
+
+	void Device::SetDefaultTextureSamplerStates()
+	{
+		const FLOAT32 MIP_LOD_BIAS	= 0.0f;
+		const FLOAT32 MAX_MIP_LEVEL = 16.0f;
+		for(UINT32 uiTextureSampler = 0; uiTextureSampler < MAX_TEXTURE_SAMPLERS; ++uiTextureSampler)
+		{
+			SetTextureSamplerState(uiTextureSampler, TSS_ADDRESSU, TA_WRAP);
+			SetTextureSamplerState(uiTextureSampler, TSS_ADDRESSV, TA_WRAP);
+			SetTextureSamplerState(uiTextureSampler, TSS_ADDRESSW, TA_WRAP);
+
+			SetTextureSamplerState(uiTextureSampler, TSS_MINFILTER, TF_LINEAR);
+			SetTextureSamplerState(uiTextureSampler, TSS_MAGFILTER, TF_LINEAR);
+			SetTextureSamplerState(uiTextureSampler, TSS_MIPFILTER, TF_POINT);
+
+			SetTextureSamplerState(uiTextureSampler, TSS_MIPLODBIAS, *((UINT32*)&MIP_LOD_BIAS));
+			SetTextureSamplerState(uiTextureSampler, TSS_MAXMIPLEVEL, *((UINT32*)&MAX_MIP_LEVEL));
+		}
+	}
+
+	void Device::SetDefaultClippingPlanes()
+	{
+		m_kRenderInfo.akClippingPlanes[CP_LEFT]		= Plane( 1.0f,  0.0f,  0.0f, 1.0f);
+		m_kRenderInfo.akClippingPlanes[CP_RIGHT]	= Plane(-1.0f,  0.0f,  0.0f, 1.0f);
+		m_kRenderInfo.akClippingPlanes[CP_TOP]		= Plane( 0.0f, -1.0f,  0.0f, 1.0f);
+		m_kRenderInfo.akClippingPlanes[CP_BOTTOM]	= Plane( 0.0f,  1.0f,  0.0f, 1.0f);
+		m_kRenderInfo.akClippingPlanes[CP_NEAR]		= Plane( 0.0f,  0.0f,  1.0f, 0.0f);
+		m_kRenderInfo.akClippingPlanes[CP_FAR]		= Plane( 0.0f,  0.0f, -1.0f, 1.0f);
+
+		// COMMENT : Enable the default clipping planes.
+		for(UINT32 uiPlane = CP_LEFT; uiPlane <= CP_FAR; ++uiPlane)
+		{
+			m_kRenderInfo.abClippingPlaneEnabled[uiPlane] = true;
+		}
+	}
+
+	Result Device::SetRenderState(RenderState eRenderState, UINT32 uiValue)
+	{
+		if(eRenderState >= RS_NUMRENDERSTATES)
+		{
+			CORE3D_ERROR(_T("Device::SetRenderState() - Invalid render-state.\n"));
+			return INVALID_PARAMETERS;
+		}
+		m_auiRenderStates[eRenderState] = uiValue;
+		return OK;
+	}
+
+	Result Device::GetRenderState(RenderState eRenderState, UINT32& ruiValue)
+	{
+		if(eRenderState >= RS_NUMRENDERSTATES)
+		{
+			ruiValue = 0;
+			CORE3D_ERROR(_T("Device::GetRenderState() - Invalid render-state.\n"));
+			return INVALID_PARAMETERS;
+		}
+		ruiValue = m_auiRenderStates[eRenderState];
+		return OK;
+	}
+
+	Result Device::SetVertexFormat(VertexFormat* pkVertexFormat)
+	{
+		m_pkVertexFormat = pkVertexFormat;
+		if(NULL == pkVertexFormat) {return OK;}
+
+		// COMMENT : Initialize part of internal render-information structure.
+		for(UINT32 uiReg = 0; uiReg < VERTEX_SHADER_REGISTERS; ++uiReg)
+		{
+			m_kRenderInfo.aeVSInputs[uiReg] = SRT_UNUSED;
+		}
+
+		const VertexElement* pkCurrentVertexElement = m_pkVertexFormat->GetElements();
+		UINT32 uiElement = m_pkVertexFormat->GetNumVertexElements();
+		while(uiElement--)
+		{
+			switch(pkCurrentVertexElement->eType)
+			{
+			case VET_FLOAT32: m_kRenderInfo.aeVSInputs[pkCurrentVertexElement->uiRegister] = SRT_FLOAT32; break;
+			case VET_VECTOR2: m_kRenderInfo.aeVSInputs[pkCurrentVertexElement->uiRegister] = SRT_VECTOR2; break;
+			case VET_VECTOR3: m_kRenderInfo.aeVSInputs[pkCurrentVertexElement->uiRegister] = SRT_VECTOR3; break;
+			case VET_VECTOR4: m_kRenderInfo.aeVSInputs[pkCurrentVertexElement->uiRegister] = SRT_VECTOR4; break;
+			default: CORE3D_ERROR(_T("Device::SetVertexFormat() - Invalid vertex element type.\n")); return INVALID_PARAMETERS;
+			}
+			++pkCurrentVertexElement;
+		}
+		return OK;
+	}
+
+	VertexFormat* Device::GetVertexFormat()
+	{
+		if(NULL != m_pkVertexFormat) {m_pkVertexFormat->AddRef();}
+		return m_pkVertexFormat;
+	}
+
+	void Device::SetPrimitiveAssembler(PrimitiveAssembler* pkPrimitiveAsembler)
+	{
+		m_pkPrimitiveAssembler = pkPrimitiveAsembler;
+	}
+
+	PrimitiveAssembler* Device::GetPrimitiveAssembler()
+	{
+		if(NULL != m_pkPrimitiveAssembler) {m_pkPrimitiveAssembler->AddRef();}
+		return m_pkPrimitiveAssembler;
+	}
+
+	Result Device::SetVertexShader(VertexShader* pkVertexShader)
+	{
+		if(NULL == pkVertexShader)
+		{
+			m_pkVertexShader = pkVertexShader;
+			return OK;
+		}
+
+		// COMMENT : Validate vertex shader register output types.
+		for(UINT32 uiReg = 0; uiReg < VERTEX_SHADER_REGISTERS; ++uiReg)
+		{
+			UINT32 uiType = pkVertexShader->GetOutputRegisters(uiReg);
+			if((uiType < SRT_UNUSED) || (uiType > SRT_VECTOR4))
+			{
+				CORE3D_ERROR(_T("Device::SetVertexShader() - Type of vertex-shader output register is invalid.\n"));
+				return INVALID_STATE;
+			}
+		}
+		for(UINT32 uiReg = 0; uiReg < PIXEL_SHADER_REGISTERS; ++uiReg)
+		{
+			UINT32 uiInterpolation = pkVertexShader->GetOutputInterpolation(uiReg);
+			if(uiInterpolation > SRI_FLAT)
+			{
+				CORE3D_ERROR(_T("Device::SetVertexShader() - Interpolation of vertex-shader output register is invalid.\n"));
+				return INVALID_STATE;
+			}
+		}
+		m_pkVertexShader = pkVertexShader;
+		return OK;
+	}
+
+	VertexShader* Device::GetVertexShader()
+	{
+		if(NULL != m_pkVertexShader) {m_pkVertexShader->AddRef();}
+		return m_pkVertexShader;
+	}
+
+	void Device::SetTriangleShader(TriangleShader* pkTriangleShader)
+	{
+		m_pkTriangleShader = pkTriangleShader;
+	}
+
+	TriangleShader* Device::GetTriangleShader()
+	{
+		if(NULL != m_pkTriangleShader) {m_pkTriangleShader->AddRef();}
+		return m_pkTriangleShader;
+	}
+
+	Result Device::SetPixelShader(PixelShader* pkPixelShader)
+	{
+		m_pkPixelShader = pkPixelShader;
+		return OK;
+	}
+
+	PixelShader* Device::GetPixelShader()
+	{
+		if(NULL != m_pkPixelShader) {m_pkPixelShader->AddRef();}
+		return m_pkPixelShader;
+	}
+
+	Result Device::SetIndexBuffer(IndexBuffer* pkIndexBuffer)
+	{
+		m_pkIndexBuffer = pkIndexBuffer;
+		return OK;
+	}
+
+	IndexBuffer* Device::GetIndexBuffer()
+	{
+		if(NULL != m_pkIndexBuffer) {m_pkIndexBuffer->AddRef();}
+		return m_pkIndexBuffer;
+	}
+
+	Result Device::SetVertexStream(UINT32 uiStreamNumber, VertexBuffer* pkVertexBuffer, UINT32 uiOffset, UINT32 uiStride)
+	{
+		if(uiStreamNumber >= MAX_VERTEX_STREAMS)
+		{
+			CORE3D_ERROR(_T("Device::SetVertexStream() - Stream number exceeds number of available vertex streams.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if(0 == uiStride)
+		{
+			CORE3D_ERROR(_T("Device::SetVertexStream() - Stride is 0.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		m_akVertexStreams[uiStreamNumber].pkVertexBuffer	= pkVertexBuffer;
+		m_akVertexStreams[uiStreamNumber].uiOffset			= uiOffset;
+		m_akVertexStreams[uiStreamNumber].uiStride			= uiStride;
+		return OK;
+	}
+
+	Result Device::GetVertexStream(UINT32 uiStreamNumber, VertexBuffer** ppkVertexBuffer, UINT32& ruiOffset, UINT32& ruiStride)
+	{
+		if(uiStreamNumber >= MAX_VERTEX_STREAMS)
+		{
+			if(NULL != ppkVertexBuffer) {*ppkVertexBuffer = NULL;}
+			ruiOffset = 0;
+			ruiStride = 0;
+			CORE3D_ERROR(_T("Device::GetVertexStream() - Stream number exceeds number of available vertex stream.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if(NULL != ppkVertexBuffer)
+		{
+			*ppkVertexBuffer = m_akVertexStreams[uiStreamNumber].pkVertexBuffer;
+			if(NULL != m_akVertexStreams[uiStreamNumber].pkVertexBuffer) {m_akVertexStreams[uiStreamNumber].pkVertexBuffer->AddRef();}
+		}
+		ruiOffset = m_akVertexStreams[uiStreamNumber].uiOffset;
+		ruiStride = m_akVertexStreams[uiStreamNumber].uiStride;
+		return OK;
+	}
+
+	Result Device::SetTexture(UINT32 uiSamplerNumber, BaseTexture* pkTexture)
+	{
+		if(uiSamplerNumber >= MAX_TEXTURE_SAMPLERS)
+		{
+			CORE3D_ERROR(_T("Device::SetTexture() - Sampler number exceeds number of available texture samplers.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		m_akTextureSamplers[uiSamplerNumber].pkTexture = pkTexture;
+		if(NULL != pkTexture)
+		{
+			m_akTextureSamplers[uiSamplerNumber].eTextureSampleInput = pkTexture->GetTextureSampleInput();
+		}
+		return OK;
+	}
+
+	Result Device::GetTexture(UINT32 uiSamplerNumber, BaseTexture** ppkTexture)
+	{
+		if(uiSamplerNumber >= MAX_TEXTURE_SAMPLERS)
+		{
+			if(NULL != ppkTexture) {*ppkTexture = NULL;}
+			CORE3D_ERROR(_T("Device::GetTexture() - Sampler number exceeds number of available texture samplers.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if(NULL == ppkTexture)
+		{
+			CORE3D_ERROR(_T("Device::GetTexture() - Parameter output texture pointer to NULL.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		*ppkTexture = m_akTextureSamplers[uiSamplerNumber].pkTexture;
+		if(NULL != m_akTextureSamplers[uiSamplerNumber].pkTexture) {m_akTextureSamplers[uiSamplerNumber].pkTexture->AddRef();}
+		return OK;
+	}
+
+	Result Device::SetTextureSamplerState(UINT32 uiSamplerNumber, TextureSamplerState eTextureSamplerState, UINT32 uiState)
+	{
+		if(uiSamplerNumber >= MAX_TEXTURE_SAMPLERS)
+		{
+			CORE3D_ERROR(_T("Device::SetTextureSamplerState() - Sampler number exceeds number of available texture samplers.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if(eTextureSamplerState >= TSS_NUMTEXTURESAMPLERSTATES)
+		{
+			CORE3D_ERROR(_T("Device::SetTextureSamplerState() - Invalid texture sampler state.\n"));
+			return INVALID_PARAMETERS;
+		}
+		m_akTextureSamplers[uiSamplerNumber].auiTexureSamplerStates[eTextureSamplerState] = uiState;
+		return OK;
+	}
+
+	Result Device::GetTextureSamplerState(UINT32 uiSamplerNumber, TextureSamplerState eTextureSamplerState, UINT32& ruiState)
+	{
+		if(uiSamplerNumber >= MAX_TEXTURE_SAMPLERS)
+		{
+			ruiState = 0;
+			CORE3D_ERROR(_T("Device::GetTextureSamplerState() - Sampler number exceeds number of available texture samplers.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if(eTextureSamplerState >= TSS_NUMTEXTURESAMPLERSTATES)
+		{
+			CORE3D_ERROR(_T("Device::GetTextureSamplerState() - Invalid texture sampler state.\n"));
+			return INVALID_PARAMETERS;
+		}
+		ruiState = m_akTextureSamplers[uiSamplerNumber].auiTexureSamplerStates[eTextureSamplerState];
+		return OK;
+	}
+
+	Result Device::SampleTexture(Vector4& rkColor, UINT32 uiSamplerNumber, FLOAT32 fU, FLOAT32 fV, FLOAT32 fW, const Vector4* pkXGradient, const Vector4* pkYGradient)
+	{
+		if(uiSamplerNumber >= MAX_TEXTURE_SAMPLERS)
+		{
+			rkColor = Vector4(0.0f, 0.0f, 0.0f, 0.0f);
+			CORE3D_ERROR(_T("Device::SampleTexture() - Sample number exceeds number of available texture samplers.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		const TextureSampler& rkTextureSampler	= m_akTextureSamplers[uiSamplerNumber];
+		BaseTexture* pkTexture					= rkTextureSampler.pkTexture;
+		if(NULL == pkTexture)
+		{
+			rkColor = Vector4(0.0f, 0.0f, 0.0f, 0.0f);
+			return OK;
+		}
+
+		switch(rkTextureSampler.eTextureSampleInput)
+		{
+		case TSI_VECTOR:
+			if((0.0f == fU) && (0.0f == fV) && (0.0f == fW))
+			{
+				rkColor = Vector4(0.0f, 0.0f, 0.0f, 0.0f);
+				CORE3D_ERROR(_T("Device::SampleTexture() - Sampling vector [u, v, w] = [0, 0, 0].\n"));
+				return INVALID_PARAMETERS;
+			}
+			break;
+		case TSI_3COORDS:
+			switch(rkTextureSampler.auiTexureSamplerStates[TSS_ADDRESSW])
+			{
+			case TA_WRAP:	fW -= ((FLOAT32)Core3D::FtoL(fW));
+			case TA_CLAMP:	fW = Core3D::Saturate(fW);			break;
+			default:
+				rkColor = Vector4(0.0f, 0.0f, 0.0f, 0.0f);
+				CORE3D_ERROR(_T("Device::SampleTexture() - Value of texture sampler state TSS_ADDRESSW is invalid.\n"));
+				return INVALID_STATE;
+			}
+		case TSI_2COORDS:
+			switch(rkTextureSampler.auiTexureSamplerStates[TSS_ADDRESSU])
+			{
+			case TA_WRAP:	fU -= ((FLOAT32)Core3D::FtoL(fU));
+			case TA_CLAMP:	fU = Core3D::Saturate(fU);			break;
+			default:
+				rkColor = Vector4(0.0f, 0.0f, 0.0f, 0.0f);
+				CORE3D_ERROR(_T("Device::SampleTexture() - Value of texture sampler state TSS_ADDRESSU is invalid.\n"));
+				return INVALID_STATE;
+			}
+
+			switch(rkTextureSampler.auiTexureSamplerStates[TSS_ADDRESSV])
+			{
+			case TA_WRAP:	fV -= ((FLOAT32)Core3D::FtoL(fV));
+			case TA_CLAMP:	fV = Core3D::Saturate(fV);			break;
+			default:
+				rkColor = Vector4(0.0f, 0.0f, 0.0f, 0.0f);
+				CORE3D_ERROR(_T("Device::SampleTexture() - Value of texture sampler state TSS_ADDRESSV is invalid.\n"));
+				return INVALID_STATE;
+			}
+			break;
+		default:
+			rkColor = Vector4(0.0f, 0.0f, 0.0f, 0.0f);
+			CORE3D_ERROR(_T("Device::SampleTexture() - Invalid texture sampling input.\n"));
+			return INVALID_STATE;
+		}
+
+		return pkTexture->SampleTexture(rkColor, fU, fV, fW, pkXGradient, pkYGradient, rkTextureSampler.auiTexureSamplerStates);
+	}
+
+	void Device::SetRenderTarget(RenderTarget* pkRenderTarget)
+	{
+		m_pkRenderTarget = pkRenderTarget;
+	}
+
+	RenderTarget* Device::GetRenderTarget()
+	{
+		if(NULL != m_pkRenderTarget) {m_pkRenderTarget->AddRef();}
+		return m_pkRenderTarget;
+	}
+
+	Result Device::SetScissorRect(const Rect& rcScissorRect)
+	{
+		if(	(rcScissorRect.uiLeft >= rcScissorRect.uiRight) || 
+			(rcScissorRect.uiTop >= rcScissorRect.uiBottom) )
+		{
+			CORE3D_ERROR(_T("Device::SetScissorRect() - Invalid scissor rect.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		m_rcScissorRect = rcScissorRect;
+		return OK;
+	}
+
+	Rect Device::GetScissorRect()
+	{
+		return m_rcScissorRect;
+	}
+
+	Result Device::SetDepthBounds(FLOAT32 fMinZ, FLOAT32 fMaxZ)
+	{
+		if( (fMinZ < 0.0f) || (fMinZ > 1.0f) || 
+			(fMaxZ < 0.0f) || (fMaxZ > 1.0f) || 
+			(fMinZ >= fMaxZ) )
+		{
+			CORE3D_ERROR(_T("Device::SetDepthBounds() - Invalid depth bounds.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		m_kRenderInfo.akClippingPlanes[CP_NEAR].d	= fMinZ;
+		m_kRenderInfo.akClippingPlanes[CP_FAR].d	= fMaxZ;
+
+		return OK;
+	}
+
+	void Device::GetDepthBounds(FLOAT32& rfMinZ, FLOAT32& rfMaxZ)
+	{
+		rfMinZ = m_kRenderInfo.akClippingPlanes[CP_NEAR].d;
+		rfMaxZ = m_kRenderInfo.akClippingPlanes[CP_FAR].d;
+	}
+
+	Result Device::SetClippingPlane(ClippingPlanes eIndex, const Plane* pkPlane)
+	{
+		if((eIndex < CP_USER0) || (eIndex >= CP_NUMPLANES)) {return INVALID_PARAMETERS;}
+
+		if(NULL != pkPlane)
+		{
+			m_kRenderInfo.akClippingPlanes[eIndex]			= *pkPlane;
+			m_kRenderInfo.abClippingPlaneEnabled[eIndex]	= true;
+		}
+		else
+		{
+			m_kRenderInfo.abClippingPlaneEnabled[eIndex]	= false;
+		}
+		return OK;
+	}
+
+	Result Device::GetClippingPlane(ClippingPlanes eIndex, Plane& rkPlane)
+	{
+		if((eIndex < CP_USER0) || (eIndex >= CP_NUMPLANES))			{return INVALID_PARAMETERS;}
+		if(false == m_kRenderInfo.abClippingPlaneEnabled[eIndex])	{return INVALID_STATE;}
+
+		rkPlane = m_kRenderInfo.akClippingPlanes[eIndex];
+		return OK;
+	}
+
+	UINT32 Device::GetRenderedPixels()
+	{
+		return m_kRenderContext.kRenderInfo.uiRenderedPixels;
+	}
+
+	Result Device::GetPipelineStatistics(PipelineStatistics& rkStatistics, PipelineStatisticsRange eRange)
+	{
+		if(eRange >= PSR_NUMRANGES)
+		{
+			memset(&rkStatistics, 0, sizeof(rkStatistics));
+			CORE3D_ERROR(_T("Device::GetPipelineStatistics() - Invalid statistics range.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+	#	if CORE3D_PIPELINE_STATISTICS
+		rkStatistics = m_akPipelineStatistics[eRange];
+		return OK;
+	#	else
+		memset(&rkStatistics, 0, sizeof(rkStatistics));
+		return INVALID_STATE;
+	#	endif
+	}
+
+	void Device::ResetPipelineStatistics()
+	{
+		memset(m_akPipelineStatistics, 0, sizeof(m_akPipelineStatistics));
+		memset(&m_kFrameStatistics, 0, sizeof(m_kFrameStatistics));
+	}
+
+	void Device::AddPipelineStatistics(const PipelineStatistics& rkStatistics)
+	{
+		// COMMENT : The statistics consist of UINT32 counters only
+		m_akPipelineStatistics[PSR_DRAW] = rkStatistics;
+
+		const UINT32* puiSource	= reinterpret_cast<const UINT32*>(&rkStatistics);
+		UINT32* puiFrame		= reinterpret_cast<UINT32*>(&m_kFrameStatistics);
+		UINT32* puiTotal		= reinterpret_cast<UINT32*>(&m_akPipelineStatistics[PSR_TOTAL]);
+		for(UINT32 uiCounter = 0; uiCounter < sizeof(PipelineStatistics) / sizeof(UINT32); ++uiCounter)
+		{
+			puiFrame[uiCounter] += puiSource[uiCounter];
+			puiTotal[uiCounter] += puiSource[uiCounter];
+		}
+	}
+
+	Result Device::CreateVertexFormat(VertexFormat** ppkVertexFormat, const VertexElement* pkVertexDeclaration, UINT32 uiVertexDeclSize)
+	{
+		if(NULL == ppkVertexFormat)
+		{
+			CORE3D_ERROR(_T("Device::CreateVertexFormat() - Parameter vertex-format pointers to NULL.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		*ppkVertexFormat = new VertexFormat(this);
+		if(NULL == (*ppkVertexFormat))
+		{
+			CORE3D_ERROR(_T("Device::CreateVertexFormat() - Out of memory, cannot create vertex format.\n"));
+			return OUT_OF_MEMORY;
+		}
+
+		Result eResult = (*ppkVertexFormat)->Create(pkVertexDeclaration, uiVertexDeclSize);
+		if(CORE3D_FAILED(eResult))
+		{
+			CORE3D_SAFE_RELEASE(*ppkVertexFormat);
+			return eResult;
+		}
+		return OK;
+	}
+
+	Result Device::CreateIndexBuffer(IndexBuffer** ppkIndexBuffer, UINT32 uiLength, Format eFormat)
+	{
+		if(NULL == ppkIndexBuffer)
+		{
+			CORE3D_ERROR(_T("Device::CreateIndexBuffer() - Parameter index-buffer pointers to NULL.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		*ppkIndexBuffer = new IndexBuffer(this);
+		if(NULL == (*ppkIndexBuffer))
+		{
+			CORE3D_ERROR(_T("Device::CreateIndexBuffer() - Out of memory, cannot create indexbuffer.\n"));
+			return OUT_OF_MEMORY;
+		}
+
+		Result eResult = (*ppkIndexBuffer)->Create(uiLength, eFormat);
+		if(CORE3D_FAILED(eResult))
+		{
+			CORE3D_SAFE_RELEASE(*ppkIndexBuffer);
+			return eResult;
+		}
+		return OK;
+	}
+
+	Result Device::CreateVertexBuffer(VertexBuffer** ppkVertexBuffer, UINT32 uiLength)
+	{
+		if(NULL == ppkVertexBuffer)
+		{
+			CORE3D_ERROR(_T("Device::CreateVertexBuffer() - Parameter vertex-buffer pointers to NULL.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		*ppkVertexBuffer = new VertexBuffer(this);
+		if(NULL == (*ppkVertexBuffer))
+		{
+			CORE3D_ERROR(_T("Device::CreateVertexBuffer() - Out of memory, cannot create vertexbuffer.\n"));
+			return OUT_OF_MEMORY;
+		}
+
+		Result eResult = (*ppkVertexBuffer)->Create(uiLength);
+		if(CORE3D_FAILED(eResult))
+		{
+			CORE3D_SAFE_RELEASE(*ppkVertexBuffer);
+			return eResult;
+		}
+		return OK;
+	}
+
+	Result Device::CreateSurface(Surface** ppkSurface, UINT32 uiWidth, UINT32 uiHeight, Format eFormat)
+	{
+		if(NULL == ppkSurface)
+		{
+			CORE3D_ERROR(_T("Device::CreateSurface() - Parameter surface pointers to NULL.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		*ppkSurface = new Surface(this);
+		if(NULL == (*ppkSurface))
+		{
+			CORE3D_ERROR(_T("Device::CreateSurface() - Out of memory, cannot create surface.\n"));
+			return OUT_OF_MEMORY;
+		}
+
+		Result eResult = (*ppkSurface)->Create(uiWidth, uiHeight, eFormat);
+		if(CORE3D_FAILED(eResult))
+		{
+			CORE3D_SAFE_RELEASE(*ppkSurface);
+			return eResult;
+		}
+		return OK;
+	}
+
+	Result Device::CreateTexture(Texture** ppkTexture, UINT32 uiWidth, UINT32 uiHeight, UINT32 uiMipLevels, Format eFormat)
+	{
+		if(NULL == ppkTexture)
+		{
+			CORE3D_ERROR(_T("Device::CreateTexture() - Parameter texture pointers to NULL.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		*ppkTexture = new Texture(this);
+		if(NULL == (*ppkTexture))
+		{
+			CORE3D_ERROR(_T("Device::CreateTexture() - Out of memory, cannot create texture.\n"));
+			return OUT_OF_MEMORY;
+		}
+
+		Result eResult = (*ppkTexture)->Create(uiWidth, uiHeight, uiMipLevels, eFormat);
+		if(CORE3D_FAILED(eResult))
+		{
+			CORE3D_SAFE_RELEASE(*ppkTexture);
+			return eResult;
+		}
+		return OK;
+	}
+
+	Result Device::CreateCubeTexture(CubeTexture** ppkCubeTexture, UINT32 uiEdgeLength, UINT32 uiMipLevels, Format eFormat)
+	{
+		if(NULL == ppkCubeTexture)
+		{
+			CORE3D_ERROR(_T("Device::CreateCubeTexture() - Parameter cube-texture pointers to NULL.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		*ppkCubeTexture = new CubeTexture(this);
+		if(NULL == (*ppkCubeTexture))
+		{
+			CORE3D_ERROR(_T("Device::CreateCubeTexture() - Out of memory, cannot create cube-texture.\n"));
+			return OUT_OF_MEMORY;
+		}
+
+		Result eResult = (*ppkCubeTexture)->Create(uiEdgeLength, uiMipLevels, eFormat);
+		if(CORE3D_FAILED(eResult))
+		{
+			CORE3D_SAFE_RELEASE(*ppkCubeTexture);
+			return eResult;
+		}
+		return OK;
+	}
+
+	Result Device::CreateVolume(Volume** ppkVolume, UINT32 uiWidth, UINT32 uiHeight, UINT32 uiDepth, Format eFormat)
+	{
+		if(NULL == ppkVolume)
+		{
+			CORE3D_ERROR(_T("Device::CreateVolume() - Parameter volume pointers to NULL.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		*ppkVolume = new Volume(this);
+		if(NULL == (*ppkVolume))
+		{
+			CORE3D_ERROR(_T("Device::CreateVolume() - Out of memory, cannot create volume.\n"));
+			return OUT_OF_MEMORY;
+		}
+
+		Result eResult = (*ppkVolume)->Create(uiWidth, uiHeight, uiDepth, eFormat);
+		if(CORE3D_FAILED(eResult))
+		{
+			CORE3D_SAFE_RELEASE(*ppkVolume);
+			return eResult;
+		}
+		return OK;
+	}
+
+	Result Device::CreateVolumeTexture(VolumeTexture** ppkVolumeTexture, UINT32 uiWidth, UINT32 uiHeight, UINT32 uiDepth, UINT32 uiMipLevels, Format eFormat)
+	{
+		if(NULL == ppkVolumeTexture)
+		{
+			CORE3D_ERROR(_T("Device::CreateVolumeTexture() - Parameter volume-texture pointers to NULL.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		*ppkVolumeTexture = new VolumeTexture(this);
+		if(NULL == (*ppkVolumeTexture))
+		{
+			CORE3D_ERROR(_T("Device::CreateVolumeTexture() - Out of memory, cannot create volume-texture.\n"));
+			return OUT_OF_MEMORY;
+		}
+
+		Result eResult = (*ppkVolumeTexture)->Create(uiWidth, uiHeight, uiDepth, uiMipLevels, eFormat);
+		if(CORE3D_FAILED(eResult))
+		{
+			CORE3D_SAFE_RELEASE(*ppkVolumeTexture);
+			return eResult;
+		}
+		return OK;
+	}
+
+	Result Device::CreateRenderTarget(RenderTarget** ppkRenderTarget)
+	{
+		if(NULL == ppkRenderTarget)
+		{
+			CORE3D_ERROR(_T("Device::CreateRenderTarget() - Parameter render-target pointers to NULL.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		*ppkRenderTarget = new RenderTarget(this);
+		if(NULL == (*ppkRenderTarget))
+		{
+			CORE3D_ERROR(_T("Device::CreateRenderTarget() - Out of memory, cannot create render-target.\n"));
+			return OUT_OF_MEMORY;
+		}
+		return OK;
+	}
+
+	Result Device::CreateCommandList(CommandList** ppkCommandList)
+	{
+		if(NULL == ppkCommandList)
+		{
+			CORE3D_ERROR(_T("Device::CreateCommandList() - Parameter command-list pointers to NULL.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		*ppkCommandList = new CommandList(this);
+		if(NULL == (*ppkCommandList))
+		{
+			CORE3D_ERROR(_T("Device::CreateCommandList() - Out of memory, cannot create command-list.\n"));
+			return OUT_OF_MEMORY;
+		}
+		return OK;
+	}
+
+	Object* Device::GetObject()
+	{
+		if(NULL != m_pkParent) {m_pkParent->AddRef();}
+		return m_pkParent;
+	}
+
+	const DeviceParameters& Device::GetDeviceParameters()
+	{
+		return m_kDeviceParameters;
+	}
+
+	Result Device::SetPresentConversion(const PresentConversion& rkConversion)
+	{
+		if( (rkConversion.eToneMapping < TM_NONE) || (rkConversion.eToneMapping > TM_REINHARD) || 
+			(rkConversion.fExposure <= 0.0f) )
+		{
+			CORE3D_ERROR(_T("Device::SetPresentConversion() - Invalid present conversion.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		m_kPresentConversion = rkConversion;
+		return OK;
+	}
+
+	const PresentConversion& Device::GetPresentConversion()
+	{
+		return m_kPresentConversion;
+	}
+
+	Surface* Device::GetBackBuffer()
+	{
+		return (NULL != m_pkSwapChain) ? m_pkSwapChain->GetBackBuffer() : NULL;
+	}
+
+	UINT32 Device::GetPresentedFrames()
+	{
+		return (NULL != m_pkSwapChain) ? m_pkSwapChain->GetPresentedFrames() : 0;
+	}
+
+	Result Device::WaitForPresent()
+	{
+		return (NULL != m_pkSwapChain) ? m_pkSwapChain->WaitForPresent() : OK;
+	}
+
+	JobSystem* Device::GetJobSystem()
+	{
+		return &m_kJobSystem;
+	}
+
+	Profiler* Device::GetProfiler()
+	{
+		return &m_kProfiler;
+	}
+
+	Result Device::CaptureNextFrame(const char* szFileName)
+	{
+		if(NULL != m_pkFrameCapture)
+		{
+			CORE3D_ERROR(_T("Device::CaptureNextFrame() - A frame is already being captured.\n"));
+			return INVALID_STATE;
+		}
+
+		if(true == m_bVisibilityPass)
+		{
+			CORE3D_ERROR(_T("Device::CaptureNextFrame() - Frames can't be captured during a visibility pass.\n"));
+			return INVALID_STATE;
+		}
+
+		m_pkFrameCapture = new FrameCapture(this);
+		if(NULL == m_pkFrameCapture)
+		{
+			CORE3D_ERROR(_T("Device::CaptureNextFrame() - Out of memory, cannot create frame capture.\n"));
+			return OUT_OF_MEMORY;
+		}
+
+		Result eResult = m_pkFrameCapture->Create(szFileName);
+		if(CORE3D_FAILED(eResult)) {CORE3D_SAFE_DELETE(m_pkFrameCapture);}
+		return eResult;
+	}
+
+	Result Device::Present(RenderTarget* pkRenderTarget)
+	{
+		ProfileScope kProfileScope(&m_kProfiler, "Device::Present");
+
+		if(NULL == pkRenderTarget)
+		{
+			CORE3D_ERROR(_T("Device::Present() - Parameter render-target pointers to NULL.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if(NULL != m_pkFrameCapture)
+		{
+			m_pkFrameCapture->Finish(pkRenderTarget);
+			CORE3D_SAFE_DELETE(m_pkFrameCapture);
+		}
+
+	#	if CORE3D_PIPELINE_STATISTICS
+		m_akPipelineStatistics[PSR_FRAME] = m_kFrameStatistics;
+		memset(&m_kFrameStatistics, 0, sizeof(m_kFrameStatistics));
+	#	endif
+
+		// COMMENT : Get pointer to the color-buffer of the render-target
+		Surface* pkColorBuffer = pkRenderTarget->GetColorBuffer();
+		if(NULL == pkColorBuffer)
+		{
+			CORE3D_ERROR(_T("Device::Present() - Render-target doesn't have a color-buffer attached.\n"));
+			return INVALID_STATE;
+		}
+
+		if( (pkColorBuffer->GetWidth() != m_kDeviceParameters.uiBackBufferWidth) || 
+			(pkColorBuffer->GetHeight() != m_kDeviceParameters.uiBackBufferHeight) )
+		{
+			CORE3D_SAFE_RELEASE(pkColorBuffer);
+			CORE3D_ERROR(_T("Device::Present() - Color-buffer's dimensions don't match back-buffer.\n"));
+			return INVALID_STATE;
+		}
+
+		if(NULL != m_pkSwapChain)
+		{
+			Surface* pkBackBuffer	= m_pkSwapChain->GetBackBuffer();
+			const bool bBackBuffer	= (pkBackBuffer == pkColorBuffer);
+			CORE3D_SAFE_RELEASE(pkBackBuffer);
+			if(true == bBackBuffer)
+			{
+				// COMMENT : Queue the back-buffer and let the render-target continue with the next one
+				CORE3D_SAFE_RELEASE(pkColorBuffer);
+				Result eResult = m_pkSwapChain->Present(m_kPresentConversion);
+
+				pkBackBuffer = m_pkSwapChain->GetBackBuffer();
+				pkRenderTarget->SetColorBuffer(pkBackBuffer);
+				CORE3D_SAFE_RELEASE(pkBackBuffer);
+				return eResult;
+			}
+
+			// COMMENT : Other color-buffers are presented synchronously, after all queued frames
+			m_pkSwapChain->WaitForPresent();
+		}
+
+		UINT32 uiFloats = pkColorBuffer->GetFormatFloats();
+		if(uiFloats < 3)
+		{
+			CORE3D_SAFE_RELEASE(pkColorBuffer);
+			CORE3D_ERROR(_T("Device::Present() - Invalid color-buffer format (Only FMT_R32G32B32F and FMT_R32G32B32A32F are supported).\n"));
+			return INVALID_FORMAT;
+		}
+
+		FLOAT32* pfSource = NULL;
+		if(CORE3D_FAILED(pkColorBuffer->LockRect((void**)&pfSource, NULL)))
+		{
+			CORE3D_SAFE_RELEASE(pkColorBuffer);
+			CORE3D_ERROR(_T("Device::Present() - Couldn't access color-buffer.\n"));
+			return UNKNOWN;
+		}
+
+		Result eResult = m_pkPresentTarget->Present(pfSource, uiFloats, m_kPresentConversion);
+		pkColorBuffer->UnlockRect();
+		CORE3D_SAFE_RELEASE(pkColorBuffer);
+		
+		return eResult;
+	}
+
+	Result Device::PreRender(RenderContext& rkContext)
+	{
+		// COMMENT : The stages of the draw are timed while profiling, everything before the first stage counts as setup
+		rkContext.bProfiling = m_kProfiler.IsEnabled();
+		if(true == rkContext.bProfiling)
+		{
+			memset(rkContext.auiStageTicks, 0, sizeof(rkContext.auiStageTicks));
+			rkContext.eProfileStage			= PST_SETUP;
+			rkContext.uiProfileBegin		= ReadTimeStamp();
+			rkContext.uiProfileTimeStamp	= rkContext.uiProfileBegin;
+		}
+
+		if(NULL == m_pkVertexFormat)
+		{
+			CORE3D_ERROR(_T("Device::PreRender() - No vertex format has been set.\n"));
+			return INVALID_STATE;
+		}
+
+		if(NULL == m_pkVertexShader)
+		{
+			CORE3D_ERROR(_T("Device::PreRender() - No vertex shader has been set.\n"));
+			return INVALID_STATE;
+		}
+
+		if(NULL == m_pkRenderTarget)
+		{
+			CORE3D_ERROR(_T("Device::PreRender() - No render-target has been set.\n"));
+			return INVALID_STATE;
+		}
+
+		// COMMENT : Start from the states which have been set through the device
+		rkContext.kRenderInfo = m_kRenderInfo;
+
+		const Matrix4x4& rkMatViewport			= m_pkRenderTarget->GetViewportMatrix();
+		rkContext.kRenderInfo.rcViewportRect.uiLeft		= static_cast<UINT32>(Core3D::FtoL(rkMatViewport._41 - rkMatViewport._11));
+		rkContext.kRenderInfo.rcViewportRect.uiRight	= static_cast<UINT32>(Core3D::FtoL(rkMatViewport._41 + rkMatViewport._11));
+		rkContext.kRenderInfo.rcViewportRect.uiTop		= static_cast<UINT32>(Core3D::FtoL(rkMatViewport._42 + rkMatViewport._22));
+		rkContext.kRenderInfo.rcViewportRect.uiBottom	= static_cast<UINT32>(Core3D::FtoL(rkMatViewport._42 - rkMatViewport._22));
+
+		if( (rkContext.kRenderInfo.rcViewportRect.uiLeft >= rkContext.kRenderInfo.rcViewportRect.uiRight)	|| 
+			(rkContext.kRenderInfo.rcViewportRect.uiTop >= rkContext.kRenderInfo.rcViewportRect.uiBottom)	)
+		{
+			CORE3D_ERROR(_T("Device::PreRender() - Invalid view-port matrix.\n"));
+			return INVALID_STATE;
+		}
+
+		// COMMENT : Filled triangles are limited to the view-port by the rasterizer, so the default side planes only need to be
+		// clipped against, if a triangle leaves the guard-band. Lines are not limited; wire-frames are always clipped.
+		rkContext.kRenderInfo.uiGuardBandPlanes = 0;
+		if(FILL_WIREFRAME != m_auiRenderStates[RS_FILLMODE])
+		{
+			static const Plane DEFAULT_SIDE_PLANES[4] = 
+			{
+				Plane( 1.0f,  0.0f,  0.0f, 1.0f), Plane(-1.0f,  0.0f,  0.0f, 1.0f), 
+				Plane( 0.0f, -1.0f,  0.0f, 1.0f), Plane( 0.0f,  1.0f,  0.0f, 1.0f)
+			};
+			for(UINT32 uiPlane = CP_LEFT; uiPlane <= CP_BOTTOM; ++uiPlane)
+			{
+				if(0 == memcmp(&rkContext.kRenderInfo.akClippingPlanes[uiPlane], &DEFAULT_SIDE_PLANES[uiPlane], sizeof(Plane)))
+				{
+					rkContext.kRenderInfo.uiGuardBandPlanes |= (1 << uiPlane);
+				}
+			}
+		}
+
+		Surface* pkColorBuffer = m_pkRenderTarget->GetColorBuffer();
+		Surface* pkDepthBuffer = m_pkRenderTarget->GetDepthBuffer();
+		if((NULL == pkColorBuffer) && (NULL == pkDepthBuffer))
+		{
+			CORE3D_ERROR(_T("Device::PreRender() - Render-target has no associated frame and depth-buffer.\n"));
+			return INVALID_STATE;
+		}
+
+		// COMMENT : Passes which don't write colors(shadow-maps, depth pre-passes) are rendered depth-only. They need no pixel shader,
+		// one which might kill pixels or outputs depth is still executed.
+		const bool bColorWrite = (NULL != pkColorBuffer) && (BT_FALSE != m_auiRenderStates[RS_COLORWRITEENABLE]);
+		if(NULL == m_pkPixelShader && true == bColorWrite)
+		{
+			CORE3D_SAFE_RELEASE(pkColorBuffer);
+			CORE3D_SAFE_RELEASE(pkDepthBuffer);
+			CORE3D_ERROR(_T("Device::PreRender() - No pixel shader has been set.\n"));
+			return INVALID_STATE;
+		}
+		rkContext.kRenderInfo.bDepthOnly = (false == bColorWrite) && (NULL == m_pkPixelShader || 
+			(PSO_COLORONLY == m_pkPixelShader->GetShaderOutput() && false == m_pkPixelShader->MightKillPixels()));
+
+		// COMMENT : Colors written into the render-target of a visibility pass are shaded when it's resolved. Draws which might
+		// blend with the colors behind them render as usual, over the pixels of the pass shaded so far.
+		rkContext.kRenderInfo.bDeferred = (true == m_bVisibilityPass) && (m_pkVisibilityTarget == m_pkRenderTarget) && (true == bColorWrite);
+		if(true == rkContext.kRenderInfo.bDeferred && true == m_pkPixelShader->MightBlendColors())
+		{
+			const Result eResult = ShadeVisibilityPass();
+			if(CORE3D_FAILED(eResult))
+			{
+				CORE3D_SAFE_RELEASE(pkColorBuffer);
+				CORE3D_SAFE_RELEASE(pkDepthBuffer);
+				return eResult;
+			}
+			rkContext.kRenderInfo.bDeferred = false;
+		}
+		if(true == rkContext.kRenderInfo.bDeferred)
+		{
+			if(PSO_COLORONLY != m_pkPixelShader->GetShaderOutput() || true == m_pkPixelShader->MightKillPixels())
+			{
+				CORE3D_SAFE_RELEASE(pkColorBuffer);
+				CORE3D_SAFE_RELEASE(pkDepthBuffer);
+				CORE3D_ERROR(_T("Device::PreRender() - Pixel shaders of a visibility pass have to output colors only and mustn't kill pixels.\n"));
+				return INVALID_STATE;
+			}
+
+			if(m_pkRenderTarget->GetNumColorBuffers() > 1)
+			{
+				CORE3D_SAFE_RELEASE(pkColorBuffer);
+				CORE3D_SAFE_RELEASE(pkDepthBuffer);
+				CORE3D_ERROR(_T("Device::PreRender() - Render-targets of a visibility pass can only have one color-buffer.\n"));
+				return INVALID_STATE;
+			}
+
+			if(BT_TRUE == m_auiRenderStates[RS_STENCILENABLE])
+			{
+				CORE3D_SAFE_RELEASE(pkColorBuffer);
+				CORE3D_SAFE_RELEASE(pkDepthBuffer);
+				CORE3D_ERROR(_T("Device::PreRender() - Stencil testing isn't supported in a visibility pass.\n"));
+				return INVALID_STATE;
+			}
+
+			if(pkColorBuffer->GetWidth() != m_uiVisibilityPitch || 
+				pkColorBuffer->GetWidth() * pkColorBuffer->GetHeight() != static_cast<UINT32>(m_vecVisibilityIDs.size()))
+			{
+				CORE3D_SAFE_RELEASE(pkColorBuffer);
+				CORE3D_SAFE_RELEASE(pkDepthBuffer);
+				CORE3D_ERROR(_T("Device::PreRender() - Color-buffer's dimensions have changed during the visibility pass.\n"));
+				return INVALID_STATE;
+			}
+		}
+
+		if( (NULL != pkColorBuffer) && ((pkColorBuffer->GetWidth() < rkContext.kRenderInfo.rcViewportRect.uiRight) || 
+			(pkColorBuffer->GetHeight() < rkContext.kRenderInfo.rcViewportRect.uiBottom)) )
+		{
+			CORE3D_SAFE_RELEASE(pkColorBuffer);
+			CORE3D_SAFE_RELEASE(pkDepthBuffer);
+			CORE3D_ERROR(_T("Device::PreRender() - Color-buffer's dimensions are smaller than set view-port.\n"));
+			return INVALID_STATE;
+		}
+
+		if( (NULL != pkDepthBuffer) && ((pkDepthBuffer->GetWidth() < rkContext.kRenderInfo.rcViewportRect.uiRight) || 
+			(pkDepthBuffer->GetHeight() < rkContext.kRenderInfo.rcViewportRect.uiBottom)) )
+		{
+			CORE3D_SAFE_RELEASE(pkColorBuffer);
+			CORE3D_SAFE_RELEASE(pkDepthBuffer);
+			CORE3D_ERROR(_T("Device::PreRender() - Depth-buffer's dimensions are smaller than set view-port.\n"));
+			return INVALID_STATE;
+		}
+
+		CORE3D_SAFE_RELEASE(pkColorBuffer);
+		CORE3D_SAFE_RELEASE(pkDepthBuffer);
+
+		const VertexStream* pkCurrentVertexStream = m_akVertexStreams;
+		for(UINT32 uiStream = 0; uiStream <= m_pkVertexFormat->GetHighestStream(); ++uiStream, ++pkCurrentVertexStream)
+		{
+			if(NULL == pkCurrentVertexStream->pkVertexBuffer)
+			{
+				CORE3D_ERROR(_T("Device::PreRender() - Vertex format references an empty vertex stream.\n"));
+				return INVALID_STATE;
+			}
+		}
+
+		// COMMENT : Check status of scissor testing
+		if(BT_FALSE != m_auiRenderStates[RS_SCISSORTESTENABLE])
+		{
+			if( false == (m_rcScissorRect.uiLeft	>=	rkContext.kRenderInfo.rcViewportRect.uiLeft && m_rcScissorRect.uiLeft	<	rkContext.kRenderInfo.rcViewportRect.uiRight)	|| 
+				false == (m_rcScissorRect.uiRight	>	rkContext.kRenderInfo.rcViewportRect.uiLeft && m_rcScissorRect.uiRight	<=	rkContext.kRenderInfo.rcViewportRect.uiRight)	|| 
+				false == (m_rcScissorRect.uiTop		>=	rkContext.kRenderInfo.rcViewportRect.uiTop	&& m_rcScissorRect.uiTop	<	rkContext.kRenderInfo.rcViewportRect.uiBottom)	|| 
+				false == (m_rcScissorRect.uiBottom	>	rkContext.kRenderInfo.rcViewportRect.uiTop	&& m_rcScissorRect.uiBottom <=	rkContext.kRenderInfo.rcViewportRect.uiBottom)	)
+			{
+				CORE3D_ERROR(_T("Device::PreRender() - Scissor rect exceeds view-port's dimensions.\n"));
+				return INVALID_STATE;
+			}
+		}
+
+		// COMMENT : The rasterizer limits scan-lines and spans to the view-port or the scissor rect within it
+		rkContext.kRenderInfo.rcRasterRect = (BT_FALSE != m_auiRenderStates[RS_SCISSORTESTENABLE]) ? m_rcScissorRect : rkContext.kRenderInfo.rcViewportRect;
+
+		// COMMENT : Check line thickness
+		if(0 == m_auiRenderStates[RS_LINETHICKNESS])
+		{
+			CORE3D_ERROR(_T("Device::PreRender() - Line thickness is invalid.\n"));
+			return INVALID_STATE;
+		}
+
+		// COMMENT : Check if render-states for subdivision mode are valid
+		switch(m_auiRenderStates[RS_SUBDIVISIONMODE])
+		{
+		case SUBDIV_NONE:
+			break;
+		case SUBDIV_SIMPLE:
+			if(0 == m_auiRenderStates[RS_SUBDIVISIONLEVELS])
+			{
+				CORE3D_ERROR(_T("Device::PreRender() - Subdivision levels for simple subdivision are 0.\n"));
+				return INVALID_STATE;
+			}
+			break;
+		case SUBDIV_SMOOTH:
+			if(0 == m_auiRenderStates[RS_SUBDIVISIONLEVELS])
+			{
+				CORE3D_ERROR(_T("Device::PreRender() - Subdivision levels for smooth subdivision are 0.\n"));
+				return INVALID_STATE;
+			}
+			else if(m_auiRenderStates[RS_SUBDIVISIONPOSITIONREGISTER] >= VERTEX_SHADER_REGISTERS)
+			{
+				CORE3D_ERROR(_T("Device::PreRender() - Position register for smooth subdivision exceeds number of avilable vertex shader input registers.\n"));
+				return INVALID_STATE;
+			}
+			else if(m_auiRenderStates[RS_SUBDIVISIONNORMALREGISTER] >= VERTEX_SHADER_REGISTERS)
+			{
+				CORE3D_ERROR(_T("Device::PreRender() - Normal register for smooth subdivision exceeds number of avilable vertex shader input registers.\n"));
+				return INVALID_STATE;
+			}
+			break;
+		case SUBDIV_ADAPTIVE:
+			if((0 == m_auiRenderStates[RS_SUBDIVISIONLEVELS]) && (0 == m_auiRenderStates[RS_SUBDIVISIONMAXINNERLEVELS]))
+			{
+				CORE3D_ERROR(_T("Device::PreRender() - Both subdivision levels for adaptive subdivision are 0.\n"));
+				return INVALID_STATE;
+			}
+			else if(*(FLOAT32*)&m_auiRenderStates[RS_SUBDIVISIONMAXSCREENAREA] <= 0.0f)
+			{
+				CORE3D_ERROR(_T("Device::PreRender() - Max screen-area for smooth subdivision is <= 0.0f.\n"));
+				return INVALID_STATE;
+			}
+			break;
+		default:
+			CORE3D_ERROR(_T("Device::PreRender() - Value of renderstate RS_SUBDIVISIONMODE is invalid.\n"));
+			return  INVALID_STATE;
+		}
+
+		// COMMENT : Check for valid device states, which won't produce any output
+		if((BT_FALSE != m_auiRenderStates[RS_ZENABLE]) && (CMP_NEVER == m_auiRenderStates[RS_ZFUNC]))
+		{
+			CORE3D_NOTIFY(_T("Device::PreRender() - Nothing will be rendered[Depth buffering has been enabled and the compare function has been set to CMP_NEVER")
+						  _T("- Nothing will be rendered to the screen].\n"));
+		}
+
+		if(BT_FALSE != m_auiRenderStates[RS_SCISSORTESTENABLE])
+		{
+			if( m_rcScissorRect.uiLeft == m_rcScissorRect.uiRight || 
+				m_rcScissorRect.uiTop == m_rcScissorRect.uiBottom )
+			{
+				CORE3D_NOTIFY(_T("Device::PreRender() = Nothing will be rendered[Scissor testing is enabled and scissor rect spans across an area of 0 pixels].\n"));
+			}
+		}
+
+		if((BT_FALSE == m_auiRenderStates[RS_COLORWRITEENABLE]) && (BT_FALSE == m_auiRenderStates[RS_ZENABLE] || BT_FALSE == m_auiRenderStates[RS_ZWRITEENABLE]) && 
+			(BT_FALSE == m_auiRenderStates[RS_STENCILENABLE]))
+		{
+			CORE3D_NOTIFY(_T("Device::PreRender() - Nothing will be rendered[Writing to the color-buffer, the depth-buffer and the stencil-buffer has been disabled].\n"));
+		}
+
+		// COMMENT : Add more checks
+		// Initialize internal render info structure
+		// COMMENT : Vertices are copied only up to the highest output register in use, depth-only passes use none
+		rkContext.kRenderInfo.uiVSOutputSize = sizeof(Vector4);
+		for(UINT32 uiReg = 0; uiReg < PIXEL_SHADER_REGISTERS; ++uiReg)
+		{
+			rkContext.kRenderInfo.aeVSOutputs[uiReg] = (false == rkContext.kRenderInfo.bDepthOnly) ? m_pkVertexShader->GetOutputRegisters(uiReg) : SRT_UNUSED;
+			if(SRT_UNUSED != rkContext.kRenderInfo.aeVSOutputs[uiReg])
+			{
+				rkContext.kRenderInfo.uiVSOutputSize = static_cast<UINT32>(offsetof(VertexShaderOutput, kShaderOutputs) + (uiReg + 1) * sizeof(ShaderReg));
+			}
+		}
+
+		// COMMENT : Split the output registers by their interpolation, so the per-pixel loops only visit the ones they handle
+		rkContext.kRenderInfo.bPerspectiveVSOutputs	= false;
+		rkContext.kRenderInfo.bLinearVSOutputs		= false;
+		rkContext.kRenderInfo.bFlatVSOutputs		= false;
+		for(UINT32 uiReg = 0; uiReg < PIXEL_SHADER_REGISTERS; ++uiReg)
+		{
+			const ShaderRegType eType					= rkContext.kRenderInfo.aeVSOutputs[uiReg];
+			const ShaderRegInterpolation eInterpolation	= m_pkVertexShader->GetOutputInterpolation(uiReg);
+			rkContext.kRenderInfo.aeVSOutputInterpolations[uiReg]	= eInterpolation;
+			rkContext.kRenderInfo.aePerspectiveVSOutputs[uiReg]		= (SRI_PERSPECTIVE == eInterpolation)	? eType : SRT_UNUSED;
+			rkContext.kRenderInfo.aeLinearVSOutputs[uiReg]			= (SRI_LINEAR == eInterpolation)		? eType : SRT_UNUSED;
+			rkContext.kRenderInfo.aeFlatVSOutputs[uiReg]			= (SRI_FLAT == eInterpolation)			? eType : SRT_UNUSED;
+			rkContext.kRenderInfo.aeInterpolatedVSOutputs[uiReg]	= (SRI_FLAT != eInterpolation)			? eType : SRT_UNUSED;
+			if(SRT_UNUSED == eType) {continue;}
+
+			switch(eInterpolation)
+			{
+			case SRI_PERSPECTIVE:	rkContext.kRenderInfo.bPerspectiveVSOutputs	= true; break;
+			case SRI_LINEAR:		rkContext.kRenderInfo.bLinearVSOutputs		= true; break;
+			case SRI_FLAT:			rkContext.kRenderInfo.bFlatVSOutputs		= true; break;
+			}
+		}
+
+		// COMMENT : Get color-buffer related states
+		const UINT32 uiColorBuffers = m_pkRenderTarget->GetNumColorBuffers();
+		for(UINT32 uiIndex = 0; uiIndex < uiColorBuffers; ++uiIndex)
+		{
+			pkColorBuffer = m_pkRenderTarget->GetColorBuffer(uiIndex);
+			Result eResult = pkColorBuffer->LockRect((void**)&rkContext.kRenderInfo.apfColorData[uiIndex], NULL);
+			if(CORE3D_FAILED(eResult))
+			{
+				CORE3D_SAFE_RELEASE(pkColorBuffer);
+				UnlockColorBuffers(uiIndex);
+				CORE3D_ERROR(_T("Device::PreRender() - Couldn't access color-buffer.\n"));
+				return eResult;
+			}
+
+			rkContext.kRenderInfo.auiColorFloats[uiIndex] = pkColorBuffer->GetFormatFloats();
+			if(0 == rkContext.kRenderInfo.auiColorFloats[uiIndex])
+			{
+				CORE3D_SAFE_RELEASE(pkColorBuffer);
+				UnlockColorBuffers(uiIndex + 1);
+				return UNKNOWN;
+			}
+
+			rkContext.kRenderInfo.auiColorBufferPitches[uiIndex] = pkColorBuffer->GetWidth() * rkContext.kRenderInfo.auiColorFloats[uiIndex];
+			CORE3D_SAFE_RELEASE(pkColorBuffer);
+		}
+		rkContext.kRenderInfo.uiColorBuffers = uiColorBuffers;
+
+		if(0 != uiColorBuffers)
+		{
+			rkContext.kRenderInfo.pfFrameData			= rkContext.kRenderInfo.apfColorData[0];
+			rkContext.kRenderInfo.uiColorFloats			= rkContext.kRenderInfo.auiColorFloats[0];
+			rkContext.kRenderInfo.uiColorBufferPitch	= rkContext.kRenderInfo.auiColorBufferPitches[0];
+			rkContext.kRenderInfo.bColorWrite			= BT_TRUE == m_auiRenderStates[RS_COLORWRITEENABLE] ? true : false;
+		}
+		else
+		{
+			rkContext.kRenderInfo.pfFrameData			= NULL;
+			rkContext.kRenderInfo.uiColorFloats			= 0;
+			rkContext.kRenderInfo.uiColorBufferPitch	= 0;
+			rkContext.kRenderInfo.bColorWrite			= false;
+		}
+
+		// COMMENT : Get depth-buffer related states
+		pkDepthBuffer = BT_TRUE == m_auiRenderStates[RS_ZENABLE] ? m_pkRenderTarget->GetDepthBuffer() : NULL;
+		if(NULL != pkDepthBuffer)
+		{
+			Result eResult = pkDepthBuffer->LockRect((void**)&rkContext.kRenderInfo.pfDepthData, NULL);
+			if(CORE3D_FAILED(eResult))
+			{
+				CORE3D_SAFE_RELEASE(pkDepthBuffer);
+				UnlockColorBuffers(uiColorBuffers);
+				CORE3D_ERROR(_T("Device::PreRender() - Couldn't access depth-buffer.\n"));
+				return eResult;
+			}
+
+			rkContext.kRenderInfo.uiDepthBufferPitch	= pkDepthBuffer->GetWidth();
+			rkContext.kRenderInfo.eDepthCompare			= (CmpFunc)m_auiRenderStates[RS_ZFUNC];
+			rkContext.kRenderInfo.bDepthWrite			= BT_TRUE == m_auiRenderStates[RS_ZWRITEENABLE] ? true : false;
+		}
+		else
+		{
+			rkContext.kRenderInfo.pfDepthData			= NULL;
+			rkContext.kRenderInfo.uiDepthBufferPitch	= 0;
+			rkContext.kRenderInfo.eDepthCompare			= CMP_ALWAYS;
+			rkContext.kRenderInfo.bDepthWrite			= false;
+		}
+
+		CORE3D_SAFE_RELEASE(pkDepthBuffer);
+
+		// COMMENT : Get stencil-buffer related states. Without a write mask the operations can be skipped.
+		Surface* pkStencilBuffer = BT_TRUE == m_auiRenderStates[RS_STENCILENABLE] ? m_pkRenderTarget->GetStencilBuffer() : NULL;
+		if(NULL != pkStencilBuffer)
+		{
+			Result eResult = pkStencilBuffer->LockRect((void**)&rkContext.kRenderInfo.puiStencilData, NULL);
+			if(CORE3D_FAILED(eResult))
+			{
+				CORE3D_SAFE_RELEASE(pkStencilBuffer);
+				UnlockColorBuffers(uiColorBuffers);
+				if(NULL != rkContext.kRenderInfo.pfDepthData)
+				{
+					pkDepthBuffer = m_pkRenderTarget->GetDepthBuffer();
+					pkDepthBuffer->UnlockRect();
+					CORE3D_SAFE_RELEASE(pkDepthBuffer);
+				}
+				CORE3D_ERROR(_T("Device::PreRender() - Couldn't access stencil-buffer.\n"));
+				return eResult;
+			}
+
+			static const RenderState STENCIL_STATES[2][4] = 
+			{
+				{RS_STENCILFUNC,		RS_STENCILFAIL,		RS_STENCILZFAIL,		RS_STENCILPASS}, 
+				{RS_CCW_STENCILFUNC,	RS_CCW_STENCILFAIL, RS_CCW_STENCILZFAIL,	RS_CCW_STENCILPASS}
+			};
+			rkContext.kRenderInfo.uiStencilBufferPitch	= pkStencilBuffer->GetWidth();
+			rkContext.kRenderInfo.uiStencilRef			= m_auiRenderStates[RS_STENCILREF] & MAX_STENCIL_VALUE;
+			rkContext.kRenderInfo.uiStencilMask			= m_auiRenderStates[RS_STENCILMASK] & MAX_STENCIL_VALUE;
+			rkContext.kRenderInfo.uiStencilWriteMask	= m_auiRenderStates[RS_STENCILWRITEMASK] & MAX_STENCIL_VALUE;
+			rkContext.kRenderInfo.bTwoSidedStencil		= BT_TRUE == m_auiRenderStates[RS_TWOSIDEDSTENCILMODE] ? true : false;
+			for(UINT32 uiFace = 0; uiFace < 2; ++uiFace)
+			{
+				const RenderState* STATES	= STENCIL_STATES[(true == rkContext.kRenderInfo.bTwoSidedStencil) ? uiFace : 0];
+				const bool bWrite			= (0 != rkContext.kRenderInfo.uiStencilWriteMask);
+				StencilFace& rkFace			= rkContext.kRenderInfo.akStencilFaces[uiFace];
+				rkFace.eCompare				= (CmpFunc)m_auiRenderStates[STATES[0]];
+				rkFace.eFail				= (true == bWrite) ? (StencilOp)m_auiRenderStates[STATES[1]] : SOP_KEEP;
+				rkFace.eDepthFail			= (true == bWrite) ? (StencilOp)m_auiRenderStates[STATES[2]] : SOP_KEEP;
+				rkFace.ePass				= (true == bWrite) ? (StencilOp)m_auiRenderStates[STATES[3]] : SOP_KEEP;
+			}
+			rkContext.pkStencilFace = &rkContext.kRenderInfo.akStencilFaces[0];
+		}
+		else
+		{
+			rkContext.kRenderInfo.puiStencilData		= NULL;
+			rkContext.kRenderInfo.uiStencilBufferPitch	= 0;
+			rkContext.kRenderInfo.bTwoSidedStencil		= false;
+			rkContext.pkStencilFace						= NULL;
+		}
+
+		CORE3D_SAFE_RELEASE(pkStencilBuffer);
+
+		rkContext.kRenderInfo.puiVisibilityData	= (true == rkContext.kRenderInfo.bDeferred) ? &m_vecVisibilityIDs[0] : NULL;
+		rkContext.kRenderInfo.puiVisibilitySpans	= (true == rkContext.kRenderInfo.bDeferred) ? &m_vecVisibilitySpans[0] : NULL;
+		rkContext.kRenderInfo.uiVisibilityPitch	= m_uiVisibilityPitch;
+		rkContext.uiVisibilityID				= 0;
+
+		// COMMENT : Reset pixel counter to 0
+		rkContext.kRenderInfo.uiRenderedPixels = 0;
+		CORE3D_STATISTIC(memset(&rkContext.kStatistics, 0, sizeof(rkContext.kStatistics)));
+
+		// COMMENT : Depending on m_pkPixelShader->GetShaderOutput() chose the appropriate
+		// RasterizeScanline function and assign it to the function pointer. Deferred draws only test depth, too.
+		if(true == rkContext.kRenderInfo.bDepthOnly || true == rkContext.kRenderInfo.bDeferred)
+		{
+			rkContext.kRenderInfo.pfnRasterizeScanLine	= &Device::RasterizeScanlineDepthOnly;
+			rkContext.kRenderInfo.pfnDrawPixel			= &Device::DrawPixelDepthOnly;
+		}
+		else if(uiColorBuffers > 1)
+		{
+			rkContext.kRenderInfo.pfnRasterizeScanLine	= &Device::RasterizeScanlineColors;
+			rkContext.kRenderInfo.pfnDrawPixel			= &Device::DrawPixelColors;
+		}
+		else switch(m_pkPixelShader->GetShaderOutput())
+		{
+		case PSO_COLORONLY:
+			rkContext.kRenderInfo.pfnRasterizeScanLine	= m_pkPixelShader->MightKillPixels() ? &Device::RasterizeScanlineColorOnlyMightKillPixels : &Device::RasterizeScanlineColorOnly;
+			rkContext.kRenderInfo.pfnDrawPixel			= &Device::DrawPixelColorOnly;
+			break;
+		case PSO_COLORDEPTH:
+			rkContext.kRenderInfo.pfnRasterizeScanLine	= &Device::RasterizeScanlineColorDepth;
+			rkContext.kRenderInfo.pfnDrawPixel			= &Device::DrawPixelColorDepth;
+			break;
+		default: CORE3D_ERROR(_T("Device::PreRender() - Type of pixelshader is invalid.\n")); return INVALID_STATE;
+		}
+
+		if(true == rkContext.kRenderInfo.bDeferred) {AddVisibilityDraw(rkContext);}
+
+		// COMMENT : Shaders find the rendering device and the current triangle through the thread's context.
+		// Nothing is stored in the shaders, because a shader may be used by different devices at the same time
+		SetCurrentRenderContext(&rkContext);
+
+		// COMMENT : FtoL() returns expected integer values
+		Core3D::FpuTruncate();
+		return OK;
+	}
+
+	void Device::PostRender(RenderContext& rkContext)
+	{
+		// COMMENT : Reset FPU to (default)rounding mode
+		Core3D::FpuReset();
+		SetCurrentRenderContext(NULL);
+		CORE3D_STATISTIC(AddPipelineStatistics(rkContext.kStatistics));
+
+		// COMMENT : Deferred draws without a visible triangle aren't kept
+		if(true == rkContext.kRenderInfo.bDeferred && 
+			(true == m_vecVisibilityTriangles.empty() || m_vecVisibilityTriangles.back().uiDraw + 1 != m_vecVisibilityDraws.size()))
+		{
+			ReleaseVisibilityDraw(static_cast<UINT32>(m_vecVisibilityDraws.size() - 1));
+			m_vecVisibilityDraws.pop_back();
+		}
+
+		UnlockColorBuffers(rkContext.kRenderInfo.uiColorBuffers);
+
+		if(NULL != rkContext.kRenderInfo.pfDepthData)
+		{
+			Surface* pkDepthBuffer = m_pkRenderTarget->GetDepthBuffer();
+			if(NULL != pkDepthBuffer) {pkDepthBuffer->UnlockRect();}
+			CORE3D_SAFE_RELEASE(pkDepthBuffer);
+		}
+
+		if(NULL != rkContext.kRenderInfo.puiStencilData)
+		{
+			Surface* pkStencilBuffer = m_pkRenderTarget->GetStencilBuffer();
+			if(NULL != pkStencilBuffer) {pkStencilBuffer->UnlockRect();}
+			CORE3D_SAFE_RELEASE(pkStencilBuffer);
+		}
+
+		if(true == rkContext.bProfiling)
+		{
+			SwitchProfileStage(rkContext, PST_SETUP);
+			m_kProfiler.AddEvent("Draw", NULL, rkContext.uiProfileBegin, rkContext.uiProfileTimeStamp, rkContext.auiStageTicks);
+			rkContext.bProfiling = false;
+		}
+	}
+
+	Result Device::DecodeVertexStream(VertexShaderInput& rkVertexShaderInput, UINT32 uiVertex)
+	{
+		const BYTE8* apkVertex[MAX_VERTEX_STREAMS];
+		const VertexStream* pkCurrentVertexStream = m_akVertexStreams;
+		for(UINT32 uiStream = 0; uiStream <= m_pkVertexFormat->GetHighestStream(); ++uiStream, ++pkCurrentVertexStream)
+		{
+			const UINT32 uiOffset = pkCurrentVertexStream->uiOffset + uiVertex * pkCurrentVertexStream->uiStride;
+			if(uiOffset >= pkCurrentVertexStream->pkVertexBuffer->GetLength())
+			{
+				CORE3D_ERROR(_T("Device::DecodeVertexStream() - Vertex stream offset exceeds vertex buffer length.\n"));
+				return UNKNOWN;
+			}
+			Result eResult = pkCurrentVertexStream->pkVertexBuffer->GetPointer(uiOffset, (void**)&apkVertex[uiStream]);
+			if(CORE3D_FAILED(eResult)) {return eResult;}
+		}
+
+		// COMMENT : Fill vertex-information structure, which can be passed to the vertex shader,
+		// with data from the vertex-streams, depending on the current vertex-format.
+		const VertexElement* pkCurrentVertexElement = m_pkVertexFormat->GetElements();
+		UINT32 uiElement							= m_pkVertexFormat->GetNumVertexElements();
+		while(uiElement--)
+		{
+			ShaderReg& rkRegister = rkVertexShaderInput.kShaderInputs[pkCurrentVertexElement->uiRegister];
+			const FLOAT32* pfData = reinterpret_cast<const FLOAT32*>(apkVertex[pkCurrentVertexElement->uiStream]);
+			switch(pkCurrentVertexElement->eType)
+			{
+			case VET_FLOAT32:
+				apkVertex[pkCurrentVertexElement->uiStream] += sizeof(FLOAT32);
+				rkRegister = ShaderReg(pfData[0], 0.0f, 0.0f, 1.0f);
+				break;
+			case VET_VECTOR2:
+				apkVertex[pkCurrentVertexElement->uiStream] += 2 * sizeof(FLOAT32);
+				rkRegister = ShaderReg(pfData[0], pfData[1], 0.0f, 1.0f);
+				break;
+			case VET_VECTOR3:
+				apkVertex[pkCurrentVertexElement->uiStream] += 3 * sizeof(FLOAT32);
+				rkRegister = ShaderReg(pfData[0], pfData[1], pfData[2], 1.0f);
+				break;
+			case VET_VECTOR4:
+				apkVertex[pkCurrentVertexElement->uiStream] += 4 * sizeof(FLOAT32);
+				rkRegister = ShaderReg(pfData[0], pfData[1], pfData[2], pfData[3]);
+				break;
+			}
+			++pkCurrentVertexElement;
+		}
+		return OK;
+	}
+
+	Result Device::FetchVertex(RenderContext& rkContext, VertexCacheEntry** ppkVertex, UINT32 uiVertex)
+	{
+		ProfileStageScope kProfileStage(rkContext, PST_VERTEXFETCH);
+		CORE3D_STATISTIC(++rkContext.kStatistics.uiFetchedVertices);
+
+		// COMMENT : Check if the incoming point already points to the desired vertex.
+		if(NULL != *ppkVertex && (*ppkVertex)->uiVertexIndex == uiVertex)
+		{
+			(*ppkVertex)->uiFetchTime = rkContext.uiFetchedVertices++;
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiVertexCacheHits);
+			return OK;
+		}
+
+		const bool bCanAppend = (rkContext.uiNumValidCacheEntries < VERTEX_CACH_SIZE);
+
+		// COMMENT : Find vertex in cache
+		VertexCacheEntry* pkCacheEntry	= &rkContext.akVertexCache[0];
+		VertexCacheEntry* pkDestEntry	= pkCacheEntry;
+		for(UINT32 uiEntry = 0; uiEntry < rkContext.uiNumValidCacheEntries; ++uiEntry, ++pkCacheEntry)
+		{
+			if(pkCacheEntry->uiVertexIndex == uiVertex)
+			{
+				// COMMENT : Vertex is already in cache, return it
+				pkCacheEntry->uiFetchTime	= rkContext.uiFetchedVertices++;
+				*ppkVertex					= pkCacheEntry;
+				CORE3D_STATISTIC(++rkContext.kStatistics.uiVertexCacheHits);
+				return OK;
+			}
+
+			// COMMENT : The vertex cache is full, so we have to look for the oldest entry
+			// and replace it in case we cannot find the desired vertex in the cache.
+			if(pkCacheEntry->uiFetchTime < pkDestEntry->uiFetchTime)
+			{
+				pkDestEntry = pkCacheEntry;
+			}
+		}
+
+		// COMMENT : The cache is not full yet, so we can append a new vertex.
+		if(bCanAppend) {pkDestEntry = &rkContext.akVertexCache[rkContext.uiNumValidCacheEntries++];}
+
+		// COMMENT : Update the destination cache entry and return it
+		pkDestEntry->uiVertexIndex	= uiVertex;
+		pkDestEntry->uiFetchTime	= rkContext.uiFetchedVertices++;
+
+		// COMMENT : The input is kept with the cache entry only if subdivision needs it again
+		VertexShaderInput& rkInput = (SUBDIV_NONE == m_auiRenderStates[RS_SUBDIVISIONMODE]) ? 
+			rkContext.kVertexInput : rkContext.akVertexCacheInputs[pkDestEntry - rkContext.akVertexCache];
+		Result eResult = DecodeVertexStream(rkInput, uiVertex);
+		if(CORE3D_FAILED(eResult)) {return eResult;}
+
+		m_pkVertexShader->Execute(rkInput.kShaderInputs, pkDestEntry->kVertexOutput.kPosition, pkDestEntry->kVertexOutput.kShaderOutputs);
+		CORE3D_STATISTIC(++rkContext.kStatistics.uiVertexCacheMisses; ++rkContext.kStatistics.uiVertexShaderInvocations);
+
+		*ppkVertex = pkDestEntry;
+		return OK;
+	}
+
+	void Device::ProcessTriangle(RenderContext& rkContext, const VertexCacheEntry* pkVertex0, const VertexCacheEntry* pkVertex1, const VertexCacheEntry* pkVertex2)
+	{
+		CORE3D_STATISTIC(++rkContext.kStatistics.uiInputTriangles);
+		ProfileStageScope kProfileStage(rkContext, PST_SUBDIVISION);
+		if(SUBDIV_NONE == m_auiRenderStates[RS_SUBDIVISIONMODE])
+		{
+			DrawTriangle(rkContext, &pkVertex0->kVertexOutput, &pkVertex1->kVertexOutput, &pkVertex2->kVertexOutput);
+			return;
+		}
+
+		// COMMENT : Join the cached vertices with their inputs for subdivision
+		const VertexCacheEntry* CACHE_ENTRIES[3] = {pkVertex0, pkVertex1, pkVertex2};
+		SubdivisionVertex akVertices[3];
+		for(UINT32 uiVertex = 0; uiVertex < 3; ++uiVertex)
+		{
+			akVertices[uiVertex].kVertexOutput	= CACHE_ENTRIES[uiVertex]->kVertexOutput;
+			akVertices[uiVertex].kSourceInput	= rkContext.akVertexCacheInputs[CACHE_ENTRIES[uiVertex] - rkContext.akVertexCache];
+		}
+
+		switch(m_auiRenderStates[RS_SUBDIVISIONMODE])
+		{
+		case SUBDIV_SIMPLE:		SubdivideTriangleSimple(rkContext, 0, &akVertices[0], &akVertices[1], &akVertices[2]);	break;
+		case SUBDIV_SMOOTH:		SubdivideTriangleSmooth(rkContext, 0, &akVertices[0], &akVertices[1], &akVertices[2]);	break;
+		case SUBDIV_ADAPTIVE:	SubdivideTriangleAdaptive(rkContext, &akVertices[0], &akVertices[1], &akVertices[2]);	break;
+		}
+	}
+
+	Result Device::DrawPrimitive(PrimitiveType ePrimitiveType, UINT32 uiStartVertex, UINT32 uiPrimitiveCount)
+	{
+		if(0 == uiPrimitiveCount)
+		{
+			CORE3D_ERROR(_T("Device::DrawPrimitive() - Primitive count is 0.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		// COMMENT : Process incoming vertices
+		UINT32 uiNumVertices = 0;
+		switch(ePrimitiveType)
+		{
+		case PT_TRIANGLEFAN:	uiNumVertices = uiPrimitiveCount + 2; break;
+		case PT_TRIANGLESTRIP:	uiNumVertices = uiPrimitiveCount + 2; break;
+		case PT_TRIANGLELIST:	uiNumVertices = uiPrimitiveCount * 3; break;
+		default: CORE3D_ERROR(_T("Device::DrawPrimitive() - Invalid primitive type specified.\n")); return INVALID_PARAMETERS;
+		}
+
+		if(NULL != m_pkFrameCapture)
+		{
+			const UINT32 auiParameters[6] = {ePrimitiveType, uiStartVertex, uiPrimitiveCount, 0, 0, 0};
+			m_pkFrameCapture->CaptureDraw(CDT_PRIMITIVE, auiParameters);
+		}
+
+		Result eResult = PreRender(m_kRenderContext);
+		if(CORE3D_FAILED(eResult)) {return eResult;}
+
+		eResult = ProcessPrimitives(m_kRenderContext, ePrimitiveType, uiStartVertex, uiPrimitiveCount);
+		PostRender(m_kRenderContext);
+		if(NULL != m_pkFrameCapture) {m_pkFrameCapture->CaptureDrawResult();}
+		return eResult;
+	}
+
+	Result Device::ProcessPrimitives(RenderContext& rkContext, PrimitiveType ePrimitiveType, UINT32 uiStartVertex, UINT32 uiPrimitiveCount)
+	{
+		// COMMENT : Vertices are cached per draw call
+		rkContext.uiNumValidCacheEntries	= 0;
+		rkContext.uiFetchedVertices			= 0;
+
+		UINT32 auiVertexIndices[3]	= {uiStartVertex, uiStartVertex + 1, uiStartVertex + 2};
+		bool bFlip					= false; // Used when drawing triangle strips
+		while(uiPrimitiveCount--)
+		{
+			VertexCacheEntry* apkVertices[3] = {NULL, NULL, NULL};
+			for(UINT32 uiVertex = 0; uiVertex < 3; ++uiVertex)
+			{
+				Result eFetch = FetchVertex(rkContext, &apkVertices[uiVertex], auiVertexIndices[uiVertex]);
+				if(CORE3D_FAILED(eFetch))
+				{
+					CORE3D_ERROR(_T("Device::DrawPrimitive() - Couldn't fetch vertex from streams.\n"));
+					return eFetch;
+				}
+			}
+
+			if(bFlip)	{ProcessTriangle(rkContext, apkVertices[0], apkVertices[2], apkVertices[1]);}
+			else		{ProcessTriangle(rkContext, apkVertices[0], apkVertices[1], apkVertices[2]);}
+
+			// COMMENT : Prepare vertex-indices for the next triangle
+			switch(ePrimitiveType)
+			{
+			case PT_TRIANGLEFAN:
+				auiVertexIndices[1] = auiVertexIndices[2];
+				++auiVertexIndices[2];
+				break;
+			case PT_TRIANGLESTRIP:
+				bFlip = !bFlip;
+				auiVertexIndices[0] = auiVertexIndices[1];
+				auiVertexIndices[1] = auiVertexIndices[2];
+				++auiVertexIndices[2];
+				break;
+			case PT_TRIANGLELIST:
+				auiVertexIndices[0] += 3;
+				auiVertexIndices[1] += 3;
+				auiVertexIndices[2] += 3;
+				break;
+			}
+		}
+
+		return OK;
+	}
+
+	Result Device::DrawIndexedPrimitive(PrimitiveType ePrimitiveType, UINT32 uiBaseVertexIndex, UINT32 uiMinIndex, UINT32 uiNumVertices, UINT32 uiStartIndex, UINT32 uiPrimitiveCount)
+	{
+		if(0 == uiPrimitiveCount)
+		{
+			CORE3D_ERROR(_T("Device::DrawIndexedPrimitive() - Primitive count is 0.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if(0 == uiNumVertices)
+		{
+			CORE3D_ERROR(_T("Device::DrawIndexedPrimitive() - Number of vertices is 0.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if(false == (PT_TRIANGLEFAN == ePrimitiveType || PT_TRIANGLESTRIP == ePrimitiveType || PT_TRIANGLELIST == ePrimitiveType))
+		{
+			CORE3D_ERROR(_T("Device::DrawIndexedPrimitive() - Invalid primitive type specified.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if(NULL != m_pkFrameCapture)
+		{
+			const UINT32 auiParameters[6] = {ePrimitiveType, uiBaseVertexIndex, uiMinIndex, uiNumVertices, uiStartIndex, uiPrimitiveCount};
+			m_pkFrameCapture->CaptureDraw(CDT_INDEXEDPRIMITIVE, auiParameters);
+		}
+
+		Result eResult = PreRender(m_kRenderContext);
+		if(CORE3D_FAILED(eResult)) {return eResult;}
+
+		eResult = ProcessIndexedPrimitives(m_kRenderContext, ePrimitiveType, uiBaseVertexIndex, uiStartIndex, uiPrimitiveCount);
+		PostRender(m_kRenderContext);
+		if(NULL != m_pkFrameCapture) {m_pkFrameCapture->CaptureDrawResult();}
+		return eResult;
+	}
+
+	Result Device::ProcessIndexedPrimitives(RenderContext& rkContext, PrimitiveType ePrimitiveType, UINT32 uiBaseVertexIndex, 
+		UINT32 uiStartIndex, UINT32 uiPrimitiveCount)
+	{
+		if(NULL == m_pkIndexBuffer)
+		{
+			CORE3D_ERROR(_T("Device::DrawIndexedPrimitive() - No index-buffer has been set.\n"));
+			return INVALID_STATE;
+		}
+
+		// COMMENT : Vertices are cached per draw call
+		rkContext.uiNumValidCacheEntries	= 0;
+		rkContext.uiFetchedVertices			= 0;
+
+		UINT32 auiIndexIndices[3]	= {uiStartIndex, uiStartIndex + 1, uiStartIndex + 2};
+		bool bFlip					= false; // Used when drawing triangle strips
+		while(uiPrimitiveCount--)
+		{
+			VertexCacheEntry* apkVertices[3] = {NULL, NULL, NULL};
+			for(UINT32 uiVertex = 0; uiVertex < 3; ++uiVertex)
+			{
+				UINT32 uiVertexIndex	= 0;
+				Result eVertexIndex		= m_pkIndexBuffer->GetVertexIndex(auiIndexIndices[uiVertex], uiVertexIndex);
+				if(CORE3D_FAILED(eVertexIndex))
+				{
+					CORE3D_ERROR(_T("Device::DrawIndexedPrimitive() - Couldn't read vertex index from index-buffer.\n"));
+					return eVertexIndex;
+				}
+
+				Result eFetch = FetchVertex(rkContext, &apkVertices[uiVertex], uiVertexIndex + uiBaseVertexIndex);
+				if(CORE3D_FAILED(eFetch))
+				{
+					CORE3D_ERROR(_T("Device::DrawIndexedPrimitive() - Couldn't fetch vertex from streams.\n"));
+					return eFetch;
+				}
+			}
+
+			if(true == bFlip)	{ProcessTriangle(rkContext, apkVertices[0], apkVertices[2], apkVertices[1]);}
+			else				{ProcessTriangle(rkContext, apkVertices[0], apkVertices[1], apkVertices[2]);}
+
+			// COMMENT : Prepare vertex indices for the next triangle
+			switch(ePrimitiveType)
+			{
+			case PT_TRIANGLEFAN:
+				auiIndexIndices[1] = auiIndexIndices[2];
+				++auiIndexIndices[2];
+				break;
+			case PT_TRIANGLESTRIP:
+				bFlip = !bFlip;
+				auiIndexIndices[0] = auiIndexIndices[1];
+				auiIndexIndices[1] = auiIndexIndices[2];
+				++auiIndexIndices[2];
+				break;
+			case PT_TRIANGLELIST:
+				auiIndexIndices[0] += 3;
+				auiIndexIndices[1] += 3;
+				auiIndexIndices[2] += 3;
+				break;
+			}
+		}
+		
+		return OK;
+	}
+
+	Result Device::DrawDynamicPrimitive(UINT32 uiStartVertex, UINT32 uiNumVertices)
+	{
+		if(0 == uiNumVertices)
+		{
+			CORE3D_ERROR(_T("Device::DrawDynamicPrimitive() - Number of vertices is 0.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if(NULL != m_pkFrameCapture)
+		{
+			const UINT32 auiParameters[6] = {uiStartVertex, uiNumVertices, 0, 0, 0, 0};
+			m_pkFrameCapture->CaptureDraw(CDT_DYNAMICPRIMITIVE, auiParameters);
+		}
+
+		Result eResult = PreRender(m_kRenderContext);
+		if(CORE3D_FAILED(eResult)) {return eResult;}
+
+		eResult = ProcessDynamicPrimitives(m_kRenderContext, uiNumVertices);
+		PostRender(m_kRenderContext);
+		if(NULL != m_pkFrameCapture) {m_pkFrameCapture->CaptureDrawResult();}
+		return eResult;
+	}
+
+	Result Device::ProcessDynamicPrimitives(RenderContext& rkContext, UINT32 uiNumVertices)
+	{
+		if(NULL == m_pkPrimitiveAssembler)
+		{
+			CORE3D_ERROR(_T("Device::DrawDynamicPrimitive() - No primitive assembler has been set.\n"));
+			return INVALID_STATE;
+		}
+
+		// COMMENT : Vertices are cached per draw call
+		rkContext.uiNumValidCacheEntries	= 0;
+		rkContext.uiFetchedVertices			= 0;
+
+		std::vector<UINT32> vecVertexIndices;
+		PrimitiveType ePrimitiveType = m_pkPrimitiveAssembler->Execute(vecVertexIndices, uiNumVertices);
+
+		UINT32 uiPrimitiveCount = 0;
+		switch(ePrimitiveType)
+		{
+		case PT_TRIANGLEFAN:	uiPrimitiveCount = static_cast<UINT32>(vecVertexIndices.size()) - 2; break;
+		case PT_TRIANGLESTRIP:	uiPrimitiveCount = static_cast<UINT32>(vecVertexIndices.size()) - 2; break;
+		case PT_TRIANGLELIST:	uiPrimitiveCount = static_cast<UINT32>(vecVertexIndices.size()) / 3; break;
+		default: CORE3D_ERROR(_T("Device::DrawDynamicPrimitive() - Invalid primitive type specified.\n")); return INVALID_PARAMETERS;
+		}
+		if(0 == uiPrimitiveCount) {return OK;}
+
+		std::vector<UINT32>::iterator iterVertexIndex = vecVertexIndices.begin();
+		UINT32 auiVertexIndices[3]	= {*iterVertexIndex++, *iterVertexIndex++, *iterVertexIndex++};
+		bool bFlip					= false; // Used when drawing triangle strips
+		while(--uiPrimitiveCount)
+		{
+			VertexCacheEntry* apkVertices[3] = {NULL, NULL, NULL};
+			for(UINT32 uiVertex = 0; uiVertex < 3; ++uiVertex)
+			{
+				Result eFetch = FetchVertex(rkContext, &apkVertices[uiVertex], auiVertexIndices[uiVertex]);
+				if(CORE3D_FAILED(eFetch))
+				{
+					CORE3D_ERROR(_T("Device::DrawIndexedPrimitive() - Couldn't fetch vertex from streams.\n"));
+					return eFetch;
+				}
+			}
+
+			if(true == bFlip)	{ProcessTriangle(rkContext, apkVertices[0], apkVertices[2], apkVertices[1]);}
+			else				{ProcessTriangle(rkContext, apkVertices[0], apkVertices[1], apkVertices[2]);}
+
+			// COMMENT : Prepare vertex-indices for the next triangle
+			switch(ePrimitiveType)
+			{
+			case PT_TRIANGLEFAN:
+				auiVertexIndices[1] = auiVertexIndices[2];
+				auiVertexIndices[2] = *iterVertexIndex++;
+				break;
+			case PT_TRIANGLESTRIP:
+				bFlip = !bFlip;
+				auiVertexIndices[0] = auiVertexIndices[1];
+				auiVertexIndices[1] = auiVertexIndices[2];
+				auiVertexIndices[2] = *iterVertexIndex++;
+				break;
+			case PT_TRIANGLELIST:
+				auiVertexIndices[0] = *iterVertexIndex++;
+				auiVertexIndices[1] = *iterVertexIndex++;
+				auiVertexIndices[2] = *iterVertexIndex++;
+				break;
+			}
+		}
+
+		return OK;
+	}
+
+	Result Device::ExecuteCommandList(CommandList* pkCommandList)
+	{
+		if(NULL == pkCommandList)
+		{
+			CORE3D_ERROR(_T("Device::ExecuteCommandList() - Parameter command-list pointers to NULL.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if(this != pkCommandList->m_pkDevice)
+		{
+			CORE3D_ERROR(_T("Device::ExecuteCommandList() - Command-list has been created by another device.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		ProfileScope kProfileScope(&m_kProfiler, "Device::ExecuteCommandList");
+
+		// COMMENT : Draws are rendered between PreRender() and PostRender() as long as no device state changes.
+		// Shader constants don't affect PreRender(), so they don't end a batch, unless its draws are deferred:
+		// those keep the pixel shader's constants from PreRender() for the resolve.
+		Result eResult	= OK;
+		bool bRendering	= false;
+		for(std::vector<CommandList::Command>::const_iterator iterCommand = pkCommandList->m_vecCommands.begin(); 
+			iterCommand != pkCommandList->m_vecCommands.end(); ++iterCommand)
+		{
+			const UINT32* puiArgs	= iterCommand->auiArgs;
+			const FLOAT32* pfData	= (iterCommand->uiData < pkCommandList->m_vecData.size()) ? &pkCommandList->m_vecData[iterCommand->uiData] : NULL;
+			if(true == bRendering && true == m_kRenderContext.kRenderInfo.bDeferred && (CommandList::CMD_SHADERFLOAT == iterCommand->eType || 
+				CommandList::CMD_SHADERVECTOR == iterCommand->eType || CommandList::CMD_SHADERMATRIX == iterCommand->eType))
+			{
+				PostRender(m_kRenderContext);
+				bRendering = false;
+			}
+
+			switch(iterCommand->eType)
+			{
+			case CommandList::CMD_SHADERFLOAT:
+				static_cast<BaseShader*>(iterCommand->pkObject)->SetFloat(puiArgs[0], *pfData);
+				continue;
+			case CommandList::CMD_SHADERVECTOR:
+				static_cast<BaseShader*>(iterCommand->pkObject)->SetVector(puiArgs[0], *(const Vector4*)pfData);
+				continue;
+			case CommandList::CMD_SHADERMATRIX:
+				static_cast<BaseShader*>(iterCommand->pkObject)->SetMatrix(puiArgs[0], *(const Matrix4x4*)pfData);
+				continue;
+			case CommandList::CMD_DRAWPRIMITIVE:
+			case CommandList::CMD_DRAWINDEXEDPRIMITIVE:
+			case CommandList::CMD_DRAWDYNAMICPRIMITIVE:
+				// COMMENT : Captured draws need unlocked buffers, so they aren't batched
+				if(NULL != m_pkFrameCapture)
+				{
+					if(true == bRendering)
+					{
+						PostRender(m_kRenderContext);
+						bRendering = false;
+					}
+
+					CaptureDrawType eDrawType = CDT_DYNAMICPRIMITIVE;
+					if(CommandList::CMD_DRAWPRIMITIVE == iterCommand->eType)				{eDrawType = CDT_PRIMITIVE;}
+					else if(CommandList::CMD_DRAWINDEXEDPRIMITIVE == iterCommand->eType)	{eDrawType = CDT_INDEXEDPRIMITIVE;}
+					m_pkFrameCapture->CaptureDraw(eDrawType, puiArgs);
+				}
+
+				if(false == bRendering)
+				{
+					eResult = PreRender(m_kRenderContext);
+					if(CORE3D_FAILED(eResult)) {return eResult;}
+					bRendering = true;
+				}
+
+				switch(iterCommand->eType)
+				{
+				case CommandList::CMD_DRAWPRIMITIVE:
+					eResult = ProcessPrimitives(m_kRenderContext, (PrimitiveType)puiArgs[0], puiArgs[1], puiArgs[2]);
+					break;
+				case CommandList::CMD_DRAWINDEXEDPRIMITIVE:
+					eResult = ProcessIndexedPrimitives(m_kRenderContext, (PrimitiveType)puiArgs[0], puiArgs[1], puiArgs[4], puiArgs[5]);
+					break;
+				default:
+					eResult = ProcessDynamicPrimitives(m_kRenderContext, puiArgs[1]);
+					break;
+				}
+				if(CORE3D_FAILED(eResult))
+				{
+					PostRender(m_kRenderContext);
+					return eResult;
+				}
+
+				if(NULL != m_pkFrameCapture)
+				{
+					PostRender(m_kRenderContext);
+					bRendering = false;
+					m_pkFrameCapture->CaptureDrawResult();
+				}
+				continue;
+			default:
+				break;
+			}
+
+			// COMMENT : Device states
+			if(true == bRendering)
+			{
+				PostRender(m_kRenderContext);
+				bRendering = false;
+			}
+
+			switch(iterCommand->eType)
+			{
+			case CommandList::CMD_RENDERSTATE:			eResult = SetRenderState((RenderState)puiArgs[0], puiArgs[1]);								break;
+			case CommandList::CMD_VERTEXFORMAT:			eResult = SetVertexFormat(static_cast<VertexFormat*>(iterCommand->pkObject));				break;
+			case CommandList::CMD_PRIMITIVEASSEMBLER:	SetPrimitiveAssembler(static_cast<PrimitiveAssembler*>(iterCommand->pkObject));				break;
+			case CommandList::CMD_VERTEXSHADER:			eResult = SetVertexShader(static_cast<VertexShader*>(iterCommand->pkObject));				break;
+			case CommandList::CMD_TRIANGLESHADER:		SetTriangleShader(static_cast<TriangleShader*>(iterCommand->pkObject));						break;
+			case CommandList::CMD_PIXELSHADER:			eResult = SetPixelShader(static_cast<PixelShader*>(iterCommand->pkObject));					break;
+			case CommandList::CMD_INDEXBUFFER:			eResult = SetIndexBuffer(static_cast<IndexBuffer*>(iterCommand->pkObject));					break;
+			case CommandList::CMD_VERTEXSTREAM:
+				eResult = SetVertexStream(puiArgs[0], static_cast<VertexBuffer*>(iterCommand->pkObject), puiArgs[1], puiArgs[2]);
+				break;
+			case CommandList::CMD_TEXTURE:				eResult = SetTexture(puiArgs[0], static_cast<BaseTexture*>(iterCommand->pkObject));		break;
+			case CommandList::CMD_TEXTURESAMPLERSTATE:	eResult = SetTextureSamplerState(puiArgs[0], (TextureSamplerState)puiArgs[1], puiArgs[2]);	break;
+			case CommandList::CMD_RENDERTARGET:			SetRenderTarget(static_cast<RenderTarget*>(iterCommand->pkObject));							break;
+			case CommandList::CMD_SCISSORRECT:
+				{
+					Rect rcScissorRect;
+					rcScissorRect.uiLeft	= puiArgs[0];
+					rcScissorRect.uiTop		= puiArgs[1];
+					rcScissorRect.uiRight	= puiArgs[2];
+					rcScissorRect.uiBottom	= puiArgs[3];
+					eResult = SetScissorRect(rcScissorRect);
+				}
+				break;
+			default:
+				CORE3D_ERROR(_T("Device::ExecuteCommandList() - Invalid command.\n"));
+				return INVALID_STATE;
+			}
+			if(CORE3D_FAILED(eResult)) {return eResult;}
+		}
+
+		if(true == bRendering) {PostRender(m_kRenderContext);}
+		return OK;
+	}
+
+	Result Device::BeginVisibilityPass()
+	{
+		if(true == m_bVisibilityPass)
+		{
+			CORE3D_ERROR(_T("Device::BeginVisibilityPass() - The previous visibility pass hasn't been resolved.\n"));
+			return INVALID_STATE;
+		}
+
+		if(NULL != m_pkFrameCapture)
+		{
+			CORE3D_ERROR(_T("Device::BeginVisibilityPass() - Visibility passes can't be captured.\n"));
+			return INVALID_STATE;
+		}
+
+		if(NULL == m_pkRenderTarget)
+		{
+			CORE3D_ERROR(_T("Device::BeginVisibilityPass() - No render-target has been set.\n"));
+			return INVALID_STATE;
+		}
+
+		Surface* pkColorBuffer = m_pkRenderTarget->GetColorBuffer();
+		if(NULL == pkColorBuffer)
+		{
+			CORE3D_ERROR(_T("Device::BeginVisibilityPass() - Render-target doesn't have a color-buffer attached.\n"));
+			return INVALID_STATE;
+		}
+
+		// COMMENT : No pixel has a triangle yet. The records keep their memory from the previous pass.
+		m_uiVisibilityPitch = pkColorBuffer->GetWidth();
+		m_vecVisibilityIDs.assign(pkColorBuffer->GetWidth() * pkColorBuffer->GetHeight(), 0);
+		m_vecVisibilitySpans.resize(m_vecVisibilityIDs.size());
+		CORE3D_SAFE_RELEASE(pkColorBuffer);
+
+		m_pkVisibilityTarget = m_pkRenderTarget;
+		m_pkVisibilityTarget->AddRef();
+		m_bVisibilityPass = true;
+		return OK;
+	}
+
+	Result Device::ResolveVisibilityPass()
+	{
+		ProfileScope kProfileScope(&m_kProfiler, "Device::ResolveVisibilityPass");
+
+		if(false == m_bVisibilityPass)
+		{
+			CORE3D_ERROR(_T("Device::ResolveVisibilityPass() - No visibility pass has been begun.\n"));
+			return INVALID_STATE;
+		}
+
+		// COMMENT : The pass ends even if it can't be resolved
+		const Result eResult = ShadeVisibilityPass();
+		ReleaseVisibilityPass();
+		return eResult;
+	}
+
+	// COMMENT : Shades the visible pixels of the pass' draws so far and removes the draws, the pass goes on
+	Result Device::ShadeVisibilityPass()
+	{
+		if(true == m_vecVisibilityDraws.empty()) {return OK;}
+
+		Surface* pkColorBuffer = m_pkVisibilityTarget->GetColorBuffer();
+		if( (NULL == pkColorBuffer) || (pkColorBuffer->GetWidth() != m_uiVisibilityPitch) || 
+			(pkColorBuffer->GetWidth() * pkColorBuffer->GetHeight() != static_cast<UINT32>(m_vecVisibilityIDs.size())) )
+		{
+			CORE3D_SAFE_RELEASE(pkColorBuffer);
+			ClearVisibilityDraws();
+			CORE3D_ERROR(_T("Device::ShadeVisibilityPass() - Color-buffer has changed during the visibility pass.\n"));
+			return INVALID_STATE;
+		}
+
+		FLOAT32* pfFrameData	= NULL;
+		Result eResult			= pkColorBuffer->LockRect((void**)&pfFrameData, NULL);
+		if(CORE3D_FAILED(eResult))
+		{
+			CORE3D_SAFE_RELEASE(pkColorBuffer);
+			ClearVisibilityDraws();
+			CORE3D_ERROR(_T("Device::ShadeVisibilityPass() - Couldn't access color-buffer.\n"));
+			return eResult;
+		}
+
+		// COMMENT : Sort the visible pixels by their triangles(counting sort), so each triangle is set up once. The ids of a
+		// draw's triangles are consecutive, which makes its pixels a range; neighbouring triangles are mostly shaded together.
+		const UINT32 uiTriangles = static_cast<UINT32>(m_vecVisibilityTriangles.size());
+		std::vector<UINT32> vecOffsets(uiTriangles + 2, 0);
+		const UINT32* puiVisibilityData = (false == m_vecVisibilityIDs.empty()) ? &m_vecVisibilityIDs[0] : NULL;
+		const UINT32 uiNumPixels		= static_cast<UINT32>(m_vecVisibilityIDs.size());
+		for(UINT32 uiPixel = 0; uiPixel < uiNumPixels; ++uiPixel) {++vecOffsets[puiVisibilityData[uiPixel] + 1];}
+		vecOffsets[1] = 0;
+		for(UINT32 uiID = 1; uiID <= uiTriangles; ++uiID) {vecOffsets[uiID + 1] += vecOffsets[uiID];}
+
+		std::vector<UINT32> vecPixels(vecOffsets[uiTriangles + 1]);
+		for(UINT32 uiPixel = 0; uiPixel < uiNumPixels; ++uiPixel)
+		{
+			const UINT32 uiID = puiVisibilityData[uiPixel];
+			if(0 != uiID) {vecPixels[vecOffsets[uiID]++] = uiPixel;}
+		}
+
+		// COMMENT : The offsets have moved on to the ends of the triangles' pixels, those of the previous triangles are their starts
+		const UINT32 uiDraws = static_cast<UINT32>(m_vecVisibilityDraws.size());
+		std::vector<UINT32> vecDrawOffsets(uiDraws + 1, 0);
+		for(UINT32 uiID = 1; uiID <= uiTriangles; ++uiID) {vecDrawOffsets[m_vecVisibilityTriangles[uiID - 1].uiDraw + 1] = vecOffsets[uiID];}
+		for(UINT32 uiDraw = 1; uiDraw <= uiDraws; ++uiDraw) {vecDrawOffsets[uiDraw] = Max(vecDrawOffsets[uiDraw], vecDrawOffsets[uiDraw - 1]);}
+
+		// COMMENT : Each draw's pixels are binned by strip into vecStripPixels(counting sort), keeping their order by triangle
+		// within a strip. The draw's strips with pixels are listed in vecStrips.
+		const UINT32 uiStrips = (pkColorBuffer->GetHeight() + VISIBILITY_STRIP_ROWS - 1) / VISIBILITY_STRIP_ROWS;
+		std::vector<UINT32> vecStripPixels(vecPixels.size());
+		std::vector<UINT32> vecStripOffsets(uiStrips + 1);
+		std::vector<UINT32> vecStrips;
+
+		// COMMENT : The draws are shaded one after another with their textures in place of the device's and the constants
+		// they've been drawn with in their pixel shaders. Only the pixels of a draw are shaded in parallel.
+		TextureSampler akTextureSamplers[MAX_TEXTURE_SAMPLERS];
+		memcpy(akTextureSamplers, m_akTextureSamplers, sizeof(akTextureSamplers));
+		FLOAT32		afConstants[NUM_SHADER_CONSTANTS];
+		Vector4		akConstants[NUM_SHADER_CONSTANTS];
+		Matrix4x4	amatConstants[NUM_SHADER_CONSTANTS];
+
+		VisibilityResolve kResolve;
+		kResolve.pkDevice		= this;
+		kResolve.pkDraw			= NULL;
+		kResolve.puiPixels		= (false == vecStripPixels.empty()) ? &vecStripPixels[0] : NULL;
+		kResolve.puiStrips		= NULL;
+		kResolve.pfFrameData	= pfFrameData;
+		memset(&kResolve.kStatistics, 0, sizeof(kResolve.kStatistics));
+		for(UINT32 uiDraw = 0; uiDraw < uiDraws; ++uiDraw)
+		{
+			const UINT32 uiBegin	= vecDrawOffsets[uiDraw];
+			const UINT32 uiEnd		= vecDrawOffsets[uiDraw + 1];
+			if(uiBegin == uiEnd) {continue;}
+
+			vecStripOffsets.assign(uiStrips + 1, 0);
+			for(UINT32 uiIndex = uiBegin; uiIndex < uiEnd; ++uiIndex) {++vecStripOffsets[GetVisibilityStrip(vecPixels[uiIndex]) + 1];}
+			vecStripOffsets[0] = uiBegin;
+			vecStrips.clear();
+			for(UINT32 uiStrip = 0; uiStrip < uiStrips; ++uiStrip)
+			{
+				if(0 != vecStripOffsets[uiStrip + 1]) {vecStrips.push_back(vecStripOffsets[uiStrip]);}
+				vecStripOffsets[uiStrip + 1] += vecStripOffsets[uiStrip];
+			}
+			vecStrips.push_back(uiEnd);
+			for(UINT32 uiIndex = uiBegin; uiIndex < uiEnd; ++uiIndex)
+			{
+				vecStripPixels[vecStripOffsets[GetVisibilityStrip(vecPixels[uiIndex])]++] = vecPixels[uiIndex];
+			}
+
+			const VisibilityDraw& rkDraw	= m_vecVisibilityDraws[uiDraw];
+			PixelShader* pkPixelShader		= rkDraw.pkPixelShader;
+			const bool bConstants			= (0 != memcmp(pkPixelShader->m_afConstants, rkDraw.afConstants, sizeof(afConstants))) || 
+				(0 != memcmp(pkPixelShader->m_akConstants, rkDraw.akConstants, sizeof(akConstants))) || 
+				(0 != memcmp(pkPixelShader->m_amatConstants, rkDraw.amatConstants, sizeof(amatConstants)));
+			if(true == bConstants)
+			{
+				memcpy(afConstants, pkPixelShader->m_afConstants, sizeof(afConstants));
+				memcpy(akConstants, pkPixelShader->m_akConstants, sizeof(akConstants));
+				memcpy(amatConstants, pkPixelShader->m_amatConstants, sizeof(amatConstants));
+				memcpy(pkPixelShader->m_afConstants, rkDraw.afConstants, sizeof(afConstants));
+				memcpy(pkPixelShader->m_akConstants, rkDraw.akConstants, sizeof(akConstants));
+				memcpy(pkPixelShader->m_amatConstants, rkDraw.amatConstants, sizeof(amatConstants));
+			}
+			memcpy(m_akTextureSamplers, rkDraw.akTextureSamplers, sizeof(m_akTextureSamplers));
+
+			kResolve.pkDraw		= &rkDraw;
+			kResolve.puiStrips	= &vecStrips[0];
+			const Result eJobResult = m_kJobSystem.ParallelFor(&Device::ResolveVisibilityStrips, &kResolve, 
+				0, static_cast<UINT32>(vecStrips.size() - 1));
+			if(CORE3D_FAILED(eJobResult)) {eResult = eJobResult;}
+
+			if(true == bConstants)
+			{
+				memcpy(pkPixelShader->m_afConstants, afConstants, sizeof(afConstants));
+				memcpy(pkPixelShader->m_akConstants, akConstants, sizeof(akConstants));
+				memcpy(pkPixelShader->m_amatConstants, amatConstants, sizeof(amatConstants));
+			}
+		}
+		memcpy(m_akTextureSamplers, akTextureSamplers, sizeof(m_akTextureSamplers));
+
+		pkColorBuffer->UnlockRect();
+		CORE3D_SAFE_RELEASE(pkColorBuffer);
+		CORE3D_STATISTIC(AddPipelineStatistics(kResolve.kStatistics));
+		for(UINT32 uiContext = 0; uiContext < kResolve.vecContexts.size(); ++uiContext) {CORE3D_SAFE_DELETE(kResolve.vecContexts[uiContext]);}
+		ClearVisibilityDraws();
+		return eResult;
+	}
+
+	void Device::ResolveVisibilityStrips(void* pvResolve, UINT32 uiBeginStrip, UINT32 uiEndStrip)
+	{
+		VisibilityResolve* pkResolve	= reinterpret_cast<VisibilityResolve*>(pvResolve);
+		Device* pkDevice				= pkResolve->pkDevice;
+		PixelShader* pkPixelShader		= pkResolve->pkDraw->pkPixelShader;
+
+		// COMMENT : Every job shades with a context of its own, which the shaders find as their thread's current one. Jobs take
+		// the contexts of finished ones, so there are only as many as jobs have run at the same time.
+		RenderContext* pkContext = NULL;
+		pkResolve->kLock.Lock();
+		if(false == pkResolve->vecContexts.empty())
+		{
+			pkContext = pkResolve->vecContexts.back();
+			pkResolve->vecContexts.pop_back();
+		}
+		pkResolve->kLock.Unlock();
+		if(NULL == pkContext)
+		{
+			pkContext = new RenderContext;
+			if(NULL == pkContext)
+			{
+				CORE3D_ERROR(_T("Device::ResolveVisibilityStrips() - Out of memory, cannot create render context.\n"));
+				return;
+			}
+			memset(pkContext, 0, sizeof(RenderContext));
+		}
+		RenderContext& rkContext			= *pkContext;
+		CORE3D_STATISTIC(memset(&rkContext.kStatistics, 0, sizeof(rkContext.kStatistics)));
+		rkContext.pkDevice					= pkDevice;
+		rkContext.kRenderInfo				= pkResolve->pkDraw->kRenderInfo;
+		rkContext.kRenderInfo.pfFrameData	= pkResolve->pfFrameData;
+
+		RenderContext* pkEnclosingContext = GetCurrentRenderContext();
+		SetCurrentRenderContext(pkContext);
+		Core3D::FpuTruncate();
+
+		const UINT32 uiPitch						= rkContext.kRenderInfo.uiVisibilityPitch;
+		const UINT32* puiVisibilityData				= rkContext.kRenderInfo.puiVisibilityData;
+		const UINT32* puiVisibilitySpans			= rkContext.kRenderInfo.puiVisibilitySpans;
+		const VisibilityTriangle* pkTriangles		= &pkDevice->m_vecVisibilityTriangles[0];
+		const VertexShaderOutput* pkVertices		= &pkDevice->m_vecVisibilityVertices[0];
+		UINT32 uiID									= 0;
+		UINT32 uiSpan								= 0xFFFFFFFF;	// First pixel of the span kVSOutput steps along, none yet
+		UINT32 uiStepX								= 0;			// Pixel kVSOutput has been stepped to
+		VertexShaderOutput kVSOutput;
+		const UINT32 uiBegin						= pkResolve->puiStrips[uiBeginStrip];
+		const UINT32 uiEnd							= pkResolve->puiStrips[uiEndStrip];
+		for(UINT32 uiIndex = uiBegin; uiIndex < uiEnd; ++uiIndex)
+		{
+			const UINT32 uiPixel	= pkResolve->puiPixels[uiIndex];
+			const UINT32 uiX		= uiPixel % uiPitch;
+			const UINT32 uiY		= uiPixel / uiPitch;
+
+			// COMMENT : Set up the triangle whenever it changes
+			if(puiVisibilityData[uiPixel] != uiID)
+			{
+				uiID = puiVisibilityData[uiPixel];
+				const UINT32* puiVertices = pkTriangles[uiID - 1].auiVertices;
+				pkDevice->CalculateTriangleGradients(rkContext, &pkVertices[puiVertices[0]], &pkVertices[puiVertices[1]], &pkVertices[puiVertices[2]]);
+				if(true == rkContext.kRenderInfo.bFlatVSOutputs)
+				{
+					pkDevice->CopyVertexShaderOutputRegisters(&rkContext.kPixelShaderInput, &pkVertices[puiVertices[0]], rkContext.kRenderInfo.aeFlatVSOutputs);
+				}
+				uiSpan = 0xFFFFFFFF;
+			}
+
+			// COMMENT : The registers are evaluated at the start of the pixel's span and stepped to it like the rasterizer does, so
+			// they're bit-identical to those of a forward draw. A triangle's pixels come in scan-line order. They're divided by W per pixel.
+			if(uiY * uiPitch + puiVisibilitySpans[uiPixel] != uiSpan)
+			{
+				uiSpan	= uiY * uiPitch + puiVisibilitySpans[uiPixel];
+				uiStepX	= puiVisibilitySpans[uiPixel];
+				pkDevice->SetVSOutputFromGradient(rkContext, &kVSOutput, static_cast<FLOAT32>(uiStepX), static_cast<FLOAT32>(uiY));
+			}
+			for( ; uiStepX < uiX; ++uiStepX) {pkDevice->StepXVSOutputFromGradient(rkContext, &kVSOutput);}
+			rkContext.kTriangleInfo.uiCurrentPixelX = uiX;
+			rkContext.kTriangleInfo.uiCurrentPixelY = uiY;
+			pkDevice->SetPixelShaderInput(rkContext, &kVSOutput);
+
+			FLOAT32* pfFrameData = rkContext.kRenderInfo.pfFrameData + (uiY * rkContext.kRenderInfo.uiColorBufferPitch + uiX * rkContext.kRenderInfo.uiColorFloats);
+			Vector4 kPixelColor(0.0f, 0.0f, 0.0f, 1.0f);
+			switch(rkContext.kRenderInfo.uiColorFloats)
+			{
+			case 4: kPixelColor.a = pfFrameData[3];
+			case 3: kPixelColor.b = pfFrameData[2];
+			case 2: kPixelColor.g = pfFrameData[1];
+			case 1: kPixelColor.r = pfFrameData[0];
+			}
+
+			FLOAT32 fDepth = kVSOutput.kPosition.z;
+			pkPixelShader->Execute(rkContext.kPixelShaderInput.kShaderOutputs, kPixelColor, fDepth);
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiShadedPixels);
+
+			switch(rkContext.kRenderInfo.uiColorFloats)
+			{
+			case 4: pfFrameData[3] = kPixelColor.a;
+			case 3: pfFrameData[2] = kPixelColor.b;
+			case 2: pfFrameData[1] = kPixelColor.g;
+			case 1: pfFrameData[0] = kPixelColor.r;
+			}
+		}
+
+		Core3D::FpuReset();
+		SetCurrentRenderContext(pkEnclosingContext);
+
+		pkResolve->kLock.Lock();
+	#	if CORE3D_PIPELINE_STATISTICS
+		// COMMENT : The statistics consist of UINT32 counters only
+		const UINT32* puiSource	= reinterpret_cast<const UINT32*>(&rkContext.kStatistics);
+		UINT32* puiResolve		= reinterpret_cast<UINT32*>(&pkResolve->kStatistics);
+		for(UINT32 uiCounter = 0; uiCounter < sizeof(PipelineStatistics) / sizeof(UINT32); ++uiCounter) {puiResolve[uiCounter] += puiSource[uiCounter];}
+	#	endif
+		pkResolve->vecContexts.push_back(pkContext);
+		pkResolve->kLock.Unlock();
+	}
+
+	void Device::AddVisibilityDraw(RenderContext& rkContext)
+	{
+		// COMMENT : The pixel shader and the textures are referenced until the pass is resolved
+		m_vecVisibilityDraws.push_back(VisibilityDraw());
+		VisibilityDraw& rkDraw	= m_vecVisibilityDraws.back();
+		rkDraw.kRenderInfo		= rkContext.kRenderInfo;
+		rkDraw.pkPixelShader	= m_pkPixelShader;
+		rkDraw.pkPixelShader->AddRef();
+		memcpy(rkDraw.afConstants, m_pkPixelShader->m_afConstants, sizeof(rkDraw.afConstants));
+		memcpy(rkDraw.akConstants, m_pkPixelShader->m_akConstants, sizeof(rkDraw.akConstants));
+		memcpy(rkDraw.amatConstants, m_pkPixelShader->m_amatConstants, sizeof(rkDraw.amatConstants));
+
+		memcpy(rkDraw.akTextureSamplers, m_akTextureSamplers, sizeof(rkDraw.akTextureSamplers));
+		for(UINT32 uiSampler = 0; uiSampler < MAX_TEXTURE_SAMPLERS; ++uiSampler)
+		{
+			if(NULL != rkDraw.akTextureSamplers[uiSampler].pkTexture) {rkDraw.akTextureSamplers[uiSampler].pkTexture->AddRef();}
+		}
+	}
+
+	UINT32 Device::AddVisibilityPolygon(RenderContext& rkContext, VertexShaderOutput** ppkVertices, UINT32 uiNumVertices)
+	{
+		// COMMENT : The flat registers are those of the triangle's first vertex before clipping
+		const UINT32 uiFirstVertex = static_cast<UINT32>(m_vecVisibilityVertices.size());
+		for(UINT32 uiVertex = 0; uiVertex < uiNumVertices; ++uiVertex) {m_vecVisibilityVertices.push_back(*ppkVertices[uiVertex]);}
+		if(true == rkContext.kRenderInfo.bFlatVSOutputs)
+		{
+			CopyVertexShaderOutputRegisters(&m_vecVisibilityVertices[uiFirstVertex], &rkContext.kPixelShaderInput, rkContext.kRenderInfo.aeFlatVSOutputs);
+		}
+
+		// COMMENT : The polygon is rasterized as a fan around its first vertex
+		VisibilityTriangle kTriangle;
+		kTriangle.uiDraw			= static_cast<UINT32>(m_vecVisibilityDraws.size() - 1);
+		kTriangle.auiVertices[0]	= uiFirstVertex;
+		for(UINT32 uiVertex = 1; uiVertex < uiNumVertices - 1; ++uiVertex)
+		{
+			kTriangle.auiVertices[1] = uiFirstVertex + uiVertex;
+			kTriangle.auiVertices[2] = uiFirstVertex + uiVertex + 1;
+			m_vecVisibilityTriangles.push_back(kTriangle);
+		}
+		return static_cast<UINT32>(m_vecVisibilityTriangles.size() - (uiNumVertices - 2) + 1);
+	}
+
+	void Device::ReleaseVisibilityDraw(UINT32 uiDraw)
+	{
+		VisibilityDraw& rkDraw = m_vecVisibilityDraws[uiDraw];
+		CORE3D_SAFE_RELEASE(rkDraw.pkPixelShader);
+		for(UINT32 uiSampler = 0; uiSampler < MAX_TEXTURE_SAMPLERS; ++uiSampler)
+		{
+			CORE3D_SAFE_RELEASE(rkDraw.akTextureSamplers[uiSampler].pkTexture);
+		}
+	}
+
+	// COMMENT : Leaves the pass without draws, and without triangles in its pixels
+	void Device::ClearVisibilityDraws()
+	{
+		for(UINT32 uiDraw = 0; uiDraw < m_vecVisibilityDraws.size(); ++uiDraw) {ReleaseVisibilityDraw(uiDraw);}
+		m_vecVisibilityDraws.clear();
+		m_vecVisibilityTriangles.clear();
+		m_vecVisibilityVertices.clear();
+		std::fill(m_vecVisibilityIDs.begin(), m_vecVisibilityIDs.end(), 0);
+	}
+
+	void Device::ReleaseVisibilityPass()
+	{
+		ClearVisibilityDraws();
+		CORE3D_SAFE_RELEASE(m_pkVisibilityTarget);
+		m_bVisibilityPass = false;
+	}
+
+	void Device::InterpolateVertexShaderOutput(RenderContext& rkContext, VertexShaderOutput* pkVSOutput, const VertexShaderOutput* pkVSOutputA, const VertexShaderOutput* pkVSOutputB, FLOAT32 fInterpolation)
+	{
+		// COMMENT : Interpolate vertex position
+		Core3D::Vec4Lerp(pkVSOutput->kPosition, pkVSOutputA->kPosition, pkVSOutputB->kPosition, fInterpolation);
+
+		// COMMENT : Linear registers are interpolated by the new vertex's fraction of the projected edge, 
+		// flat ones are taken from the triangle's first vertex anyway
+		FLOAT32 fLinearInterpolation = fInterpolation;
+		if(true == rkContext.kRenderInfo.bLinearVSOutputs && pkVSOutput->kPosition.w > FLT_EPSILON)
+		{
+			fLinearInterpolation = fInterpolation * pkVSOutputB->kPosition.w / pkVSOutput->kPosition.w;
+		}
+
+		// COMMENT : Interpolate registers
+		ShaderReg* pkOutput			= pkVSOutput->kShaderOutputs;
+		const ShaderReg* pkOutputA	= pkVSOutputA->kShaderOutputs;
+		const ShaderReg* pkOutputB	= pkVSOutputB->kShaderOutputs;
+
+		for(UINT32 uiReg = 0; uiReg < PIXEL_SHADER_REGISTERS; ++uiReg, ++pkOutput, ++pkOutputA, ++pkOutputB)
+		{
+			const FLOAT32 fRegInterpolation = (SRI_LINEAR == rkContext.kRenderInfo.aeVSOutputInterpolations[uiReg]) ? fLinearInterpolation : fInterpolation;
+			switch(rkContext.kRenderInfo.aeInterpolatedVSOutputs[uiReg])
+			{
+			case SRT_VECTOR4: pkOutput->w = Core3D::Lerp(pkOutputA->w, pkOutputB->w, fRegInterpolation);
+			case SRT_VECTOR3: pkOutput->z = Core3D::Lerp(pkOutputA->z, pkOutputB->z, fRegInterpolation);
+			case SRT_VECTOR2: pkOutput->y = Core3D::Lerp(pkOutputA->y, pkOutputB->y, fRegInterpolation);
+			case SRT_FLOAT32: pkOutput->x = Core3D::Lerp(pkOutputA->x, pkOutputB->x, fRegInterpolation);
+			case SRT_UNUSED:  break;
+			}
+		}
+	}
+
+	void Device::MultiplyVertexShaderOutputRegisters(RenderContext& rkContext, VertexShaderOutput* pkDest, const VertexShaderOutput* pkSrc, FLOAT32 fVal)
+	{
+		ShaderReg* pkDestReg		= pkDest->kShaderOutputs;
+		const ShaderReg* pkSrcReg	= pkSrc->kShaderOutputs;
+		for(UINT32 uiReg = 0; uiReg < PIXEL_SHADER_REGISTERS; ++uiReg, ++pkDestReg, ++pkSrcReg)
+		{
+			switch(rkContext.kRenderInfo.aePerspectiveVSOutputs[uiReg])
+			{
+			case SRT_VECTOR4: pkDestReg->w = pkSrcReg->w * fVal;
+			case SRT_VECTOR3: pkDestReg->z = pkSrcReg->z * fVal;
+			case SRT_VECTOR2: pkDestReg->y = pkSrcReg->y * fVal;
+			case SRT_FLOAT32: pkDestReg->x = pkSrcReg->x * fVal;
+			case SRT_UNUSED:  break;
+			}
+		}
+	}
+
+	void Device::CopyVertexShaderOutputRegisters(VertexShaderOutput* pkDest, const VertexShaderOutput* pkSrc, const ShaderRegType* peRegisters)
+	{
+		ShaderReg* pkDestReg		= pkDest->kShaderOutputs;
+		const ShaderReg* pkSrcReg	= pkSrc->kShaderOutputs;
+		for(UINT32 uiReg = 0; uiReg < PIXEL_SHADER_REGISTERS; ++uiReg, ++pkDestReg, ++pkSrcReg)
+		{
+			switch(peRegisters[uiReg])
+			{
+			case SRT_VECTOR4: pkDestReg->w = pkSrcReg->w;
+			case SRT_VECTOR3: pkDestReg->z = pkSrcReg->z;
+			case SRT_VECTOR2: pkDestReg->y = pkSrcReg->y;
+			case SRT_FLOAT32: pkDestReg->x = pkSrcReg->x;
+			case SRT_UNUSED:  break;
+			}
+		}
+	}
+
+	void Device::SetPixelShaderInput(RenderContext& rkContext, const VertexShaderOutput* pkVSOutput)
+	{
+		// COMMENT : Only perspective correct registers need the division by W, their derivatives as well
+		if(true == rkContext.kRenderInfo.bPerspectiveVSOutputs)
+		{
+			// COMMENT : _mm_rcp_ss() with a Newton step instead of the division wasn't measurably faster(fill/flat), the
+			// division is a small part of a pixel's cost.
+			rkContext.kTriangleInfo.fCurrentPixelInvW = 1.0f / pkVSOutput->kPosition.w;
+			MultiplyVertexShaderOutputRegisters(rkContext, &rkContext.kPixelShaderInput, pkVSOutput, rkContext.kTriangleInfo.fCurrentPixelInvW);
+		}
+
+		if(true == rkContext.kRenderInfo.bLinearVSOutputs && &rkContext.kPixelShaderInput != pkVSOutput)
+		{
+			CopyVertexShaderOutputRegisters(&rkContext.kPixelShaderInput, pkVSOutput, rkContext.kRenderInfo.aeLinearVSOutputs);
+		}
+	}
+
+	void Device::InterpolateVertexShaderInput(RenderContext& rkContext, VertexShaderInput* pkVSInput, const VertexShaderInput* pkVSInputA, const VertexShaderInput* pkVSInputB, FLOAT32 fInterpolation)
+	{
+		// COMMENT : Interpolate registers
+		ShaderReg* pkOutput			= pkVSInput->kShaderInputs;
+		const ShaderReg* pkInputA	= pkVSInputA->kShaderInputs;
+		const ShaderReg* pkInputB	= pkVSInputB->kShaderInputs;
+		for(UINT32 uiReg = 0; uiReg < VERTEX_SHADER_REGISTERS; ++uiReg, ++pkOutput, ++pkInputA, ++pkInputB)
+		{
+			switch(rkContext.kRenderInfo.aeVSInputs[uiReg])
+			{
+			case SRT_FLOAT32:
+				pkOutput->x = Core3D::Lerp(pkInputA->x, pkInputB->x, fInterpolation);
+				pkOutput->y = 0.0f; pkOutput->z = 0.0f; pkOutput->w = 1.0f;
+				break;
+			case SRT_VECTOR2:
+				pkOutput->x = Core3D::Lerp(pkInputA->x, pkInputB->x, fInterpolation);
+				pkOutput->y = Core3D::Lerp(pkInputA->y, pkInputB->y, fInterpolation);
+				pkOutput->z = 0.0f; pkOutput->w = 1.0f;
+				break;
+			case SRT_VECTOR3:
+				pkOutput->x = Core3D::Lerp(pkInputA->x, pkInputB->x, fInterpolation);
+				pkOutput->y = Core3D::Lerp(pkInputA->y, pkInputB->y, fInterpolation);
+				pkOutput->z = Core3D::Lerp(pkInputA->z, pkInputB->z, fInterpolation);
+				pkOutput->w = 1.0f;
+				break;
+			case SRT_VECTOR4:
+				pkOutput->x = Core3D::Lerp(pkInputA->x, pkInputB->x, fInterpolation);
+				pkOutput->y = Core3D::Lerp(pkInputA->y, pkInputB->y, fInterpolation);
+				pkOutput->z = Core3D::Lerp(pkInputA->z, pkInputB->z, fInterpolation);
+				pkOutput->w = Core3D::Lerp(pkInputA->w, pkInputB->w, fInterpolation);
+				break;
+			case SRT_UNUSED:
+				break;
+			}
+		}
+	}
+
+	void Device::ProjectVertex(RenderContext& rkContext, VertexShaderOutput* pkVSOutput)
+	{
+		if(pkVSOutput->kPosition.w < FLT_EPSILON) {return;}
+
+		const FLOAT32 fInvW		= 1.0f / pkVSOutput->kPosition.w;
+		pkVSOutput->kPosition.Homogenize(fInvW);
+		pkVSOutput->kPosition	*= m_pkRenderTarget->GetViewportMatrix();
+
+		// COMMENT : Snap to the rasterizer's sub-pixel grid, so the gradients are set up for the triangle that's covered
+		pkVSOutput->kPosition.x	= static_cast<FLOAT32>(ToSubPixel(pkVSOutput->kPosition.x)) * (1.0f / SUBPIXEL_SCALE);
+		pkVSOutput->kPosition.y	= static_cast<FLOAT32>(ToSubPixel(pkVSOutput->kPosition.y)) * (1.0f / SUBPIXEL_SCALE);
+
+		// COMMENT : The shader output registers are divided by W once the polygon is known to cover pixels;
+		// this way we can interpolate them lineary while rasterizing
+		pkVSOutput->kPosition.w	= fInvW;
+	}
+
+	void Device::SubdivideTriangleSimple(RenderContext& rkContext, UINT32 uiSubdivisionLevel, const SubdivisionVertex* pkVertex0, const SubdivisionVertex* pkVertex1, const SubdivisionVertex* pkVertex2)
+	{
+		// COMMENT : In case the triangle has been subdivided to the requested level, draw it.
+		if(uiSubdivisionLevel >= m_auiRenderStates[RS_SUBDIVISIONLEVELS])
+		{
+			DrawTriangle(rkContext, &pkVertex0->kVertexOutput, &pkVertex1->kVertexOutput, &pkVertex2->kVertexOutput);
+			return;
+		}
+		++uiSubdivisionLevel;
+
+		// COMMENT : Generate three new vertices: in the middle of each edge
+		// Interpolate inputs for the new vertices(we're splitting the triangle's edges)
+		SubdivisionVertex akNewVertices[3];
+		InterpolateVertexShaderInput(rkContext, &akNewVertices[0].kSourceInput, &pkVertex0->kSourceInput, &pkVertex1->kSourceInput, 0.5f); // Edge between V0 and V1
+		InterpolateVertexShaderInput(rkContext, &akNewVertices[1].kSourceInput, &pkVertex1->kSourceInput, &pkVertex2->kSourceInput, 0.5f); // Edge between V1 and V2
+		InterpolateVertexShaderInput(rkContext, &akNewVertices[2].kSourceInput, &pkVertex2->kSourceInput, &pkVertex0->kSourceInput, 0.5f); // Edge between V2 and V0
+
+		// COMMENT : Calculate new vertex shader outputs
+		SubdivisionVertex* pkCurrentVertex = akNewVertices;
+		for(UINT32 i = 0; i < 3; ++i, ++pkCurrentVertex)
+		{
+			m_pkVertexShader->Execute(pkCurrentVertex->kSourceInput.kShaderInputs, pkCurrentVertex->kVertexOutput.kPosition, pkCurrentVertex->kVertexOutput.kShaderOutputs);
+		}
+		CORE3D_STATISTIC(rkContext.kStatistics.uiVertexShaderInvocations += 3; rkContext.kStatistics.uiSubdivisionVertices += 3);
+
+		SubdivideTriangleSimple(rkContext, uiSubdivisionLevel, pkVertex0, &akNewVertices[0], &akNewVertices[2]);
+		SubdivideTriangleSimple(rkContext, uiSubdivisionLevel, pkVertex1, &akNewVertices[1], &akNewVertices[0]);
+		SubdivideTriangleSimple(rkContext, uiSubdivisionLevel, pkVertex2, &akNewVertices[2], &akNewVertices[1]);
+		SubdivideTriangleSimple(rkContext, uiSubdivisionLevel, &akNewVertices[0], &akNewVertices[1], &akNewVertices[2]);
+	}
+
+	void Device::SubdivideTriangleSmooth(RenderContext& rkContext, UINT32 uiSubdivisionLevel, const SubdivisionVertex* pkVertex0, const SubdivisionVertex* pkVertex1, const SubdivisionVertex* pkVertex2)
+	{
+		static const FLOAT32 MULT_DEVIDE_BY_SIX = 1.0f / 6.0f;
+		// COMMENT : In case the triangle has been subdivided to the  requested level, draw it
+		if(uiSubdivisionLevel >= m_auiRenderStates[RS_SUBDIVISIONLEVELS])
+		{
+			DrawTriangle(rkContext, &pkVertex0->kVertexOutput, &pkVertex1->kVertexOutput, &pkVertex2->kVertexOutput);
+			return;
+		}
+		++uiSubdivisionLevel;
+
+		// COMMENT : Generate three new vertices: in the middle of each edge
+		// Interpolate inputs for the new vertices(we're splitting the triangle's edges)
+		SubdivisionVertex akNewVertices[3];
+		InterpolateVertexShaderInput(rkContext, &akNewVertices[0].kSourceInput, &pkVertex0->kSourceInput, &pkVertex1->kSourceInput, 0.5f); // Edge between V0 and V1
+		InterpolateVertexShaderInput(rkContext, &akNewVertices[1].kSourceInput, &pkVertex1->kSourceInput, &pkVertex2->kSourceInput, 0.5f); // Edge between V1 and V2
+		InterpolateVertexShaderInput(rkContext, &akNewVertices[2].kSourceInput, &pkVertex2->kSourceInput, &pkVertex0->kSourceInput, 0.5f); // Edge between V2 and V0
+
+		// COMMENT : Offset positions using normals as a base
+		const UINT32 uiPos		= m_auiRenderStates[RS_SUBDIVISIONPOSITIONREGISTER];
+		const UINT32 uiNormal	= m_auiRenderStates[RS_SUBDIVISIONNORMALREGISTER];
+
+		// COMMENT : Normal vectors should be re-normalized(they're not unit length anymore due
+		// to linear interpolation) for best results, but because the error is very small
+		// this step is skipped.
+		const ShaderReg* apkShaderInputs[3] = {pkVertex0->kSourceInput.kShaderInputs, pkVertex1->kSourceInput.kShaderInputs, pkVertex2->kSourceInput.kShaderInputs};
+
+		// COMMENT : Offset middle of edge between V0 and V1
+		{
+			const Vector3 kNormalA	= apkShaderInputs[0][uiNormal] * Core3D::Vec3Dot((Vector3)apkShaderInputs[1][uiPos] - (Vector3)apkShaderInputs[0][uiPos], apkShaderInputs[0][uiNormal]);
+			const Vector3 kNormalB	= apkShaderInputs[1][uiNormal] * Core3D::Vec3Dot((Vector3)apkShaderInputs[0][uiPos] - (Vector3)apkShaderInputs[1][uiPos], apkShaderInputs[1][uiNormal]);
+			Vector4& rkPosition		= akNewVertices[0].kSourceInput.kShaderInputs[uiPos];
+			rkPosition				-= (kNormalA + kNormalB) * MULT_DEVIDE_BY_SIX;
+		}
+
+		// COMMENT : Offset middle of edge between V1 and V2
+		{
+			const Vector3 kNormalA	= apkShaderInputs[1][uiNormal] * Core3D::Vec3Dot((Vector3)apkShaderInputs[2][uiPos] - (Vector3)apkShaderInputs[1][uiPos], apkShaderInputs[1][uiNormal]);
+			const Vector3 kNormalB	= apkShaderInputs[2][uiNormal] * Core3D::Vec3Dot((Vector3)apkShaderInputs[1][uiPos] - (Vector3)apkShaderInputs[2][uiPos], apkShaderInputs[2][uiNormal]);
+			Vector4& rkPosition		= akNewVertices[1].kSourceInput.kShaderInputs[uiPos];
+			rkPosition				-= (kNormalA + kNormalB) * MULT_DEVIDE_BY_SIX;
+		}
+
+		// COMMENT : Offset middle of edge between V2 and V0
+		{
+			const Vector3 kNormalA	= apkShaderInputs[2][uiNormal] * Core3D::Vec3Dot((Vector3)apkShaderInputs[0][uiPos] - (Vector3)apkShaderInputs[2][uiPos], apkShaderInputs[2][uiNormal]);
+			const Vector3 kNormalB	= apkShaderInputs[0][uiNormal] * Core3D::Vec3Dot((Vector3)apkShaderInputs[2][uiPos] - (Vector3)apkShaderInputs[0][uiPos], apkShaderInputs[0][uiNormal]);
+			Vector4& rkPosition		= akNewVertices[2].kSourceInput.kShaderInputs[uiPos];
+			rkPosition				-= (kNormalA + kNormalB) * MULT_DEVIDE_BY_SIX;
+		}
+
+		// COMMENT : Calculate new vertex shader outputs
+		SubdivisionVertex* pkCurrentVertex = akNewVertices;
+		for(UINT32 i = 0; i < 3; ++i, ++pkCurrentVertex)
+		{
+			m_pkVertexShader->Execute(pkCurrentVertex->kSourceInput.kShaderInputs, pkCurrentVertex->kVertexOutput.kPosition, pkCurrentVertex->kVertexOutput.kShaderOutputs);
+		}
+		CORE3D_STATISTIC(rkContext.kStatistics.uiVertexShaderInvocations += 3; rkContext.kStatistics.uiSubdivisionVertices += 3);
+
+		SubdivideTriangleSmooth(rkContext, uiSubdivisionLevel, pkVertex0, &akNewVertices[0], &akNewVertices[2]);
+		SubdivideTriangleSmooth(rkContext, uiSubdivisionLevel, pkVertex1, &akNewVertices[1], &akNewVertices[0]);
+		SubdivideTriangleSmooth(rkContext, uiSubdivisionLevel, pkVertex2, &akNewVertices[2], &akNewVertices[1]);
+		SubdivideTriangleSmooth(rkContext, uiSubdivisionLevel, &akNewVertices[0], &akNewVertices[1], &akNewVertices[2]);
+	}
+
+	void Device::SubdivideTriangleAdaptiveSubdivideInnerPart(RenderContext& rkContext, UINT32 uiSubdivisionLevel, const SubdivisionVertex* pkVertex0, const SubdivisionVertex* pkVertex1, const SubdivisionVertex* pkVertex2)
+	{
+		static const FLOAT32 MULT_DIVIDIE_BY_TREE1 = 1.0f / 3.0f;
+		// COMMENT : Information about subdivision level: here we are counting the maximum inner subdivisions
+		if(uiSubdivisionLevel >= m_auiRenderStates[RS_SUBDIVISIONMAXINNERLEVELS])
+		{
+			DrawTriangle(rkContext, &pkVertex0->kVertexOutput, &pkVertex1->kVertexOutput, &pkVertex2->kVertexOutput);
+			return;
+		}
+
+		// COMMENT : Check area of triangle in screen space
+		{
+			Vector4 akPos[3] = {pkVertex0->kVertexOutput.kPosition, pkVertex1->kVertexOutput.kPosition, pkVertex2->kVertexOutput.kPosition};
+			for(UINT32 uiVertex = 0; uiVertex < 3; ++uiVertex)
+			{
+				// TODO : Should actually be clipped to view frustum
+				// Project vertex position + Scale to render-target's viewport
+				akPos[uiVertex].Homogenize();
+				akPos[uiVertex] *= m_pkRenderTarget->GetViewportMatrix();
+			}
+
+			const Vector3 k0To1 = (Vector3)akPos[1] - (Vector3)akPos[0];
+			const Vector3 k0To2 = (Vector3)akPos[2] - (Vector3)akPos[0];
+			Vector3 kNormal;
+			Core3D::Vec3Cross(kNormal, k0To1, k0To2);
+			const FLOAT32 fArea = 0.5f * kNormal.Length();
+			if(fArea < *(FLOAT32*)&m_auiRenderStates[RS_SUBDIVISIONMAXSCREENAREA])
+			{
+				DrawTriangle(rkContext, &pkVertex0->kVertexOutput, &pkVertex1->kVertexOutput, &pkVertex2->kVertexOutput);
+				return;
+			}
+		}
+
+		// COMMENT : Continue splitting: find center vertex and call subdivide innter part for the three new vertices
+		++uiSubdivisionLevel;
+
+		// COMMENT : Average inputs for the center vertex
+		const Vector4* apkShaderInputs[3] = {pkVertex0->kSourceInput.kShaderInputs, pkVertex1->kSourceInput.kShaderInputs, pkVertex2->kSourceInput.kShaderInputs};
+		SubdivisionVertex kVertexCenter;
+		for(UINT32 i = 0; i < VERTEX_SHADER_REGISTERS; ++i)
+		{
+			kVertexCenter.kSourceInput.kShaderInputs[i] = (apkShaderInputs[0][i] + apkShaderInputs[1][i] + apkShaderInputs[2][i]) * MULT_DIVIDIE_BY_TREE1;
+		}
+
+		// COMMENT : Call vertex shader
+		m_pkVertexShader->Execute(kVertexCenter.kSourceInput.kShaderInputs, kVertexCenter.kVertexOutput.kPosition, kVertexCenter.kVertexOutput.kShaderOutputs);
+		CORE3D_STATISTIC(++rkContext.kStatistics.uiVertexShaderInvocations; ++rkContext.kStatistics.uiSubdivisionVertices);
+
+		// COMMENT : Split outer triangle edges
+		SubdivideTriangleAdaptiveSubdivideInnerPart(rkContext, uiSubdivisionLevel, pkVertex0, pkVertex1, &kVertexCenter);
+		SubdivideTriangleAdaptiveSubdivideInnerPart(rkContext, uiSubdivisionLevel, pkVertex1, pkVertex2, &kVertexCenter);
+		SubdivideTriangleAdaptiveSubdivideInnerPart(rkContext, uiSubdivisionLevel, pkVertex2, pkVertex0, &kVertexCenter);
+	}
+
+	void Device::SubdivideTriangleAdaptiveSubdivideEdges(RenderContext& rkContext, UINT32 uiSubdivisionLevel, const SubdivisionVertex* pkVertexEdge0, const SubdivisionVertex* pkVertexEdge1, const SubdivisionVertex* pkVertexCenter)
+	{
+		// COMMENT : In case the triangle edges have been subdivided to the requested level, begin adaptive subdivision of inner part
+		if(uiSubdivisionLevel >= m_auiRenderStates[RS_SUBDIVISIONLEVELS])
+		{
+			SubdivideTriangleAdaptiveSubdivideInnerPart(rkContext, 0, pkVertexEdge0, pkVertexEdge1, pkVertexCenter);
+			return;
+		}
+		++uiSubdivisionLevel;
+
+		// COMMENT : Split edge and call subdivide-edge recursively
+		SubdivisionVertex kVertexMiddleEdge;
+		InterpolateVertexShaderInput(rkContext, &kVertexMiddleEdge.kSourceInput, &pkVertexEdge0->kSourceInput, &pkVertexEdge1->kSourceInput, 0.5f);
+
+		// COMMENT : Call vertex shader
+		m_pkVertexShader->Execute(kVertexMiddleEdge.kSourceInput.kShaderInputs, kVertexMiddleEdge.kVertexOutput.kPosition, kVertexMiddleEdge.kVertexOutput.kShaderOutputs);
+		CORE3D_STATISTIC(++rkContext.kStatistics.uiVertexShaderInvocations; ++rkContext.kStatistics.uiSubdivisionVertices);
+
+		SubdivideTriangleAdaptiveSubdivideEdges(rkContext, uiSubdivisionLevel, pkVertexEdge0, &kVertexMiddleEdge, pkVertexCenter);
+		SubdivideTriangleAdaptiveSubdivideEdges(rkContext, uiSubdivisionLevel, &kVertexMiddleEdge, pkVertexEdge1, pkVertexCenter);
+	}
+
+	void Device::SubdivideTriangleAdaptive(RenderContext& rkContext, const SubdivisionVertex* pkVertex0, const SubdivisionVertex* pkVertex1, const SubdivisionVertex* pkVertex2)
+	{
+		static const FLOAT32 MUL_DIVIDE_BY_TREE2 = 1.0f / 3.0f;
+		// COMMENT : Average inputs for the center vertex
+		const ShaderReg* apkShaderInputs[3] = {pkVertex0->kSourceInput.kShaderInputs, pkVertex1->kSourceInput.kShaderInputs, pkVertex2->kSourceInput.kShaderInputs};
+
+		SubdivisionVertex kVertexCenter;
+		for(UINT32 i = 0; i < VERTEX_SHADER_REGISTERS; ++i)
+		{
+			kVertexCenter.kSourceInput.kShaderInputs[i] = (apkShaderInputs[0][i] + apkShaderInputs[1][i] + apkShaderInputs[2][i]) * MUL_DIVIDE_BY_TREE2;
+		}
+
+		// COMMENT : Call vertex shader
+		m_pkVertexShader->Execute(kVertexCenter.kSourceInput.kShaderInputs, kVertexCenter.kVertexOutput.kPosition, kVertexCenter.kVertexOutput.kShaderOutputs);
+		CORE3D_STATISTIC(++rkContext.kStatistics.uiVertexShaderInvocations; ++rkContext.kStatistics.uiSubdivisionVertices);
+
+		// COMMENT : Split outer triangle edge
+		SubdivideTriangleAdaptiveSubdivideEdges(rkContext, 0, pkVertex0, pkVertex1, &kVertexCenter);
+		SubdivideTriangleAdaptiveSubdivideEdges(rkContext, 0, pkVertex1, pkVertex2, &kVertexCenter);
+		SubdivideTriangleAdaptiveSubdivideEdges(rkContext, 0, pkVertex2, pkVertex0, &kVertexCenter);
+	}
+
+	bool Device::CullTriangle(const VertexShaderOutput* pkVSOutput0, const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2)
+	{
+		// COMMENT : Do back-face culling
+		if(CULL_NONE == m_auiRenderStates[RS_CULLMODE]) {return false;}
+
+		const FLOAT32 DIR_TEST = (pkVSOutput1->kPosition.x - pkVSOutput0->kPosition.x) * (pkVSOutput2->kPosition.y - pkVSOutput0->kPosition.y) - 
+			(pkVSOutput1->kPosition.y - pkVSOutput0->kPosition.y) * (pkVSOutput2->kPosition.x - pkVSOutput0->kPosition.x);
+		if(CULL_CCW == m_auiRenderStates[RS_CULLMODE])
+		{
+			if(DIR_TEST <= 0.0f) {return true;}
+		}
+		else
+		{
+			if(DIR_TEST >= 0.0f) {return true;}
+		}
+		return false;
+	}
+
+	UINT32 Device::ClipToPlane(RenderContext& rkContext, UINT32 uiNumVertices, UINT32 uiStage, const Plane& rkPlane, bool bHomogenous)
+	{
+		VertexShaderOutput** ppkSrcVertices		= rkContext.aapkClipVertices[uiStage];
+		VertexShaderOutput** ppkDestVertices	= rkContext.aapkClipVertices[(uiStage + 1) & 1];
+
+		UINT32 uiNumClippedVertices = 0;
+		for(UINT32 i = 0, j = 1; i < uiNumVertices; ++i, ++j)
+		{
+			// COMMENT : Wrap over
+			if(j == uiNumVertices) {j = 0;}
+			// COMMENT : Distances of current and next vertex to clipping plane.
+			FLOAT32 fDI, fDJ;
+			if(true == bHomogenous)
+			{
+				fDI = rkPlane * ppkSrcVertices[i]->kPosition;
+				fDJ = rkPlane * ppkSrcVertices[j]->kPosition;
+			}
+			else
+			{
+				fDI = rkPlane * (*(Vector3*)&ppkSrcVertices[i]->kPosition);
+				fDJ = rkPlane * (*(Vector3*)&ppkSrcVertices[j]->kPosition);
+			}
+
+			if(fDI >= 0.0f)
+			{
+				ppkDestVertices[uiNumClippedVertices++] = ppkSrcVertices[i];
+				if(fDJ < 0.0f)
+				{
+					InterpolateVertexShaderOutput(rkContext, &rkContext.akClipVertices[rkContext.uiNextFreeClipVertex], ppkSrcVertices[i], ppkSrcVertices[j], fDI / (fDI - fDJ));
+					ppkDestVertices[uiNumClippedVertices++] = &rkContext.akClipVertices[rkContext.uiNextFreeClipVertex];
+					rkContext.uiNextFreeClipVertex = (rkContext.uiNextFreeClipVertex + 1) % 20;
+				#	ifdef _DEBUG
+					if(0 == rkContext.uiNextFreeClipVertex) {CORE3D_NOTIFY(_T("Wrap over: vertex creation during clipping! array too small...?\n"));}
+				#	endif
+				}
+			}
+			else
+			{
+				if(fDJ >= 0.0f)
+				{
+					InterpolateVertexShaderOutput(rkContext, &rkContext.akClipVertices[rkContext.uiNextFreeClipVertex], ppkSrcVertices[j], ppkSrcVertices[i], fDJ / (fDJ - fDI));
+					ppkDestVertices[uiNumClippedVertices++] = &rkContext.akClipVertices[rkContext.uiNextFreeClipVertex];
+					rkContext.uiNextFreeClipVertex = (rkContext.uiNextFreeClipVertex + 1) % 20;
+				#	ifdef _DEBUG
+					if(0 == rkContext.uiNextFreeClipVertex) {CORE3D_NOTIFY(_T("Wrap over: vertex creation during clipping! array too small...?\n"));}
+				#	endif
+				}
+			}
+		}
+		return uiNumClippedVertices;
+	}
+
+	void Device::DrawTriangle(RenderContext& rkContext, const VertexShaderOutput* pkVSOutput0, const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2)
+	{
+		CORE3D_STATISTIC(++rkContext.kStatistics.uiSubdividedTriangles);
+		ProfileStageScope kProfileStage(rkContext, PST_CLIPPING);
+
+		// COMMENT : Classify the vertices against the enabled clipping planes(out-codes) and the guard-band
+		const VertexShaderOutput* VERTICES[3] = {pkVSOutput0, pkVSOutput1, pkVSOutput2};
+		UINT32 auiOutCodes[3]	= {0, 0, 0};
+		bool bInsideGuardBand	= true;
+		for(UINT32 uiVertex = 0; uiVertex < 3; ++uiVertex)
+		{
+			const Vector4& rkPosition = VERTICES[uiVertex]->kPosition;
+			for(UINT32 uiPlane = 0; uiPlane < CP_NUMPLANES; ++uiPlane)
+			{
+				if(true == rkContext.kRenderInfo.abClippingPlaneEnabled[uiPlane] && 
+					rkContext.kRenderInfo.akClippingPlanes[uiPlane] * rkPosition < 0.0f)
+				{
+					auiOutCodes[uiVertex] |= (1 << uiPlane);
+				}
+			}
+
+			const FLOAT32 fGuardBand = GUARD_BAND_SCALE * rkPosition.w;
+			if(!(fabsf(rkPosition.x) <= fGuardBand && fabsf(rkPosition.y) <= fGuardBand)) {bInsideGuardBand = false;}
+		}
+
+		// COMMENT : All vertices outside of the same plane: the triangle is invisible
+		const UINT32 uiOutsideCode = auiOutCodes[0] & auiOutCodes[1] & auiOutCodes[2];
+		if(0 != uiOutsideCode)
+		{
+		#	if CORE3D_PIPELINE_STATISTICS
+			UINT32 uiPlane = 0;
+			while(0 == (uiOutsideCode & (1 << uiPlane))) {++uiPlane;}
+			++rkContext.kStatistics.auiPlaneClippedTriangles[uiPlane];
+			++rkContext.kStatistics.uiClippedTriangles;
+			++rkContext.kStatistics.uiInvisibleTriangles;
+		#	endif
+			return;
+		}
+
+		// COMMENT : Only planes which have vertices outside can cut the triangle. The side planes can be left to
+		// the rasterizer as long as the triangle doesn't leave the guard-band.
+		UINT32 uiClipCode = auiOutCodes[0] | auiOutCodes[1] | auiOutCodes[2];
+		if(true == bInsideGuardBand)
+		{
+		#	if CORE3D_PIPELINE_STATISTICS
+			if(0 != (uiClipCode & rkContext.kRenderInfo.uiGuardBandPlanes)) {++rkContext.kStatistics.uiGuardBandTriangles;}
+		#	endif
+			uiClipCode &= ~rkContext.kRenderInfo.uiGuardBandPlanes;
+		}
+
+		// COMMENT : Prepare triangle for homogeneous clipping
+		UINT32 uiNumVertices	= 3;
+		memcpy(&rkContext.akClipVertices[0], pkVSOutput0, rkContext.kRenderInfo.uiVSOutputSize);
+		memcpy(&rkContext.akClipVertices[1], pkVSOutput1, rkContext.kRenderInfo.uiVSOutputSize);
+		memcpy(&rkContext.akClipVertices[2], pkVSOutput2, rkContext.kRenderInfo.uiVSOutputSize);
+		rkContext.uiNextFreeClipVertex	= 3;
+
+		UINT32 uiStage			= 0;
+		rkContext.aapkClipVertices[uiStage][0] = &rkContext.akClipVertices[0];
+		rkContext.aapkClipVertices[uiStage][1] = &rkContext.akClipVertices[1];
+		rkContext.aapkClipVertices[uiStage][2] = &rkContext.akClipVertices[2];
+
+		// COMMENT : Call the triangle shader
+		if(NULL != m_pkTriangleShader)
+		{
+			if(false == m_pkTriangleShader->Execute(rkContext.aapkClipVertices[0][0]->kShaderOutputs, 
+				rkContext.aapkClipVertices[0][1]->kShaderOutputs, rkContext.aapkClipVertices[0][2]->kShaderOutputs))
+			{
+				// COMMENT : Triangle got rejected.
+				CORE3D_STATISTIC(++rkContext.kStatistics.uiRejectedTriangles);
+				return;
+			}
+		}
+
+		// COMMENT : Flat registers of the pixel shader input are set once per triangle, from its first vertex
+		if(true == rkContext.kRenderInfo.bFlatVSOutputs)
+		{
+			CopyVertexShaderOutputRegisters(&rkContext.kPixelShaderInput, rkContext.aapkClipVertices[0][0], rkContext.kRenderInfo.aeFlatVSOutputs);
+		}
+
+		// COMMENT : Perform clipping to the frustum planes the triangle crosses
+	#	if CORE3D_PIPELINE_STATISTICS
+		bool bClipped = false;
+	#	endif
+		for(UINT32 uiPlane = 0; 0 != (uiClipCode >> uiPlane); ++uiPlane)
+		{
+			if(0 == (uiClipCode & (1 << uiPlane))) {continue;}
+
+		#	if CORE3D_PIPELINE_STATISTICS
+			// COMMENT : A plane cutting the polygon creates vertices, one which is entirely outside leaves none
+			const UINT32 uiNextFreeClipVertex = rkContext.uiNextFreeClipVertex;
+		#	endif
+			uiNumVertices	= ClipToPlane(rkContext, uiNumVertices, uiStage, rkContext.kRenderInfo.akClippingPlanes[uiPlane], true);
+		#	if CORE3D_PIPELINE_STATISTICS
+			if(uiNumVertices < 3 || uiNextFreeClipVertex != rkContext.uiNextFreeClipVertex)
+			{
+				++rkContext.kStatistics.auiPlaneClippedTriangles[uiPlane];
+				if(false == bClipped) {++rkContext.kStatistics.uiClippedTriangles;}
+				bClipped = true;
+			}
+		#	endif
+			if(uiNumVertices < 3)
+			{
+				CORE3D_STATISTIC(++rkContext.kStatistics.uiInvisibleTriangles);
+				return;
+			}
+			uiStage			= (uiStage + 1) & 1;
+		}
+
+		// COMMENT : Project and rasterize the clipped triangle
+		UINT32 uiVertex;
+		// COMMENT : Project the first three vertices for culling
+		VertexShaderOutput** ppkSrc = rkContext.aapkClipVertices[uiStage];
+		for(uiVertex = 0; uiVertex < 3; ++uiVertex)
+		{
+			ProjectVertex(rkContext, ppkSrc[uiVertex]);
+		}
+
+		// COMMENT : We do not have to check for culling for each sub-polygon of the triangle, as they
+		// are all in the same plane. If the first polygon is culled then all other polygons
+		// would be culled, too.
+		if(true == CullTriangle(ppkSrc[0], ppkSrc[1], ppkSrc[2]))
+		{
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiCulledTriangles);
+			return;
+		}
+
+		// COMMENT : Counter-clockwise triangles use their own stencil states in two-sided stencil mode
+		if(true == rkContext.kRenderInfo.bTwoSidedStencil)
+		{
+			const FLOAT32 fWinding = (ppkSrc[1]->kPosition.x - ppkSrc[0]->kPosition.x) * (ppkSrc[2]->kPosition.y - ppkSrc[0]->kPosition.y) - 
+				(ppkSrc[1]->kPosition.y - ppkSrc[0]->kPosition.y) * (ppkSrc[2]->kPosition.x - ppkSrc[0]->kPosition.x);
+			rkContext.pkStencilFace = &rkContext.kRenderInfo.akStencilFaces[(fWinding < 0.0f) ? 1 : 0];
+		}
+
+		// COMMENT : Project the remaining vertices
+		for(uiVertex = 3; uiVertex < uiNumVertices; ++uiVertex)
+		{
+			ProjectVertex(rkContext, ppkSrc[uiVertex]);
+		}
+
+		// COMMENT : Pixel centers are covered from ceil(min) up to, excluding, ceil(max) of the polygon's bounding box
+		INT32 aiMin[2] = {ToSubPixel(ppkSrc[0]->kPosition.x), ToSubPixel(ppkSrc[0]->kPosition.y)};
+		INT32 aiMax[2] = {aiMin[0], aiMin[1]};
+		for(uiVertex = 1; uiVertex < uiNumVertices; ++uiVertex)
+		{
+			const INT32 X = ToSubPixel(ppkSrc[uiVertex]->kPosition.x);
+			const INT32 Y = ToSubPixel(ppkSrc[uiVertex]->kPosition.y);
+			aiMin[0] = Min(aiMin[0], X); aiMax[0] = Max(aiMax[0], X);
+			aiMin[1] = Min(aiMin[1], Y); aiMax[1] = Max(aiMax[1], Y);
+		}
+		const INT32 SCAN_MIN[2] = {SubPixelCeil(aiMin[0]), SubPixelCeil(aiMin[1])};
+		const INT32 SCAN_MAX[2] = {SubPixelCeil(aiMax[0]), SubPixelCeil(aiMax[1])};
+
+		// COMMENT : The scissor rect is applied by the rasterizer, polygons entirely outside of it are skipped here
+		const Rect& rcRaster = rkContext.kRenderInfo.rcRasterRect;
+		if(BT_TRUE == m_auiRenderStates[RS_SCISSORTESTENABLE])
+		{
+			if( SCAN_MAX[0] <= static_cast<INT32>(rcRaster.uiLeft)	|| SCAN_MIN[0] >= static_cast<INT32>(rcRaster.uiRight) || 
+				SCAN_MAX[1] <= static_cast<INT32>(rcRaster.uiTop)	|| SCAN_MIN[1] >= static_cast<INT32>(rcRaster.uiBottom) )
+			{
+				CORE3D_STATISTIC(++rkContext.kStatistics.uiInvisibleTriangles);
+				return;
+			}
+		}
+
+		// COMMENT : Polygons without a pixel center inside of their bounding box cover none. They are discarded before
+		// their registers are projected and their triangles are set up; high subdivision levels generate lots of them.
+		// Wire-frame edges round their end points to pixels instead, so they're drawn even for those polygons.
+		if( (FILL_WIREFRAME != m_auiRenderStates[RS_FILLMODE]) && 
+			(Max(SCAN_MIN[0], static_cast<INT32>(rcRaster.uiLeft)) >= Min(SCAN_MAX[0], static_cast<INT32>(rcRaster.uiRight)) || 
+			Max(SCAN_MIN[1], static_cast<INT32>(rcRaster.uiTop)) >= Min(SCAN_MAX[1], static_cast<INT32>(rcRaster.uiBottom))) )
+		{
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiEmptyTriangles);
+			return;
+		}
+
+		// COMMENT : Divide shader output registers by W
+		for(uiVertex = 0; uiVertex < uiNumVertices; ++uiVertex)
+		{
+			MultiplyVertexShaderOutputRegisters(rkContext, ppkSrc[uiVertex], ppkSrc[uiVertex], ppkSrc[uiVertex]->kPosition.w);
+		}
+
+		// COMMENT : Deferred polygons are kept for the resolve, their triangles write consecutive ids.
+		// They're dropped again, if no pixel passes the depth test.
+		const UINT32 uiRenderedPixels = rkContext.kRenderInfo.uiRenderedPixels;
+		if(true == rkContext.kRenderInfo.bDeferred) {rkContext.uiVisibilityID = AddVisibilityPolygon(rkContext, ppkSrc, uiNumVertices);}
+
+		CORE3D_STATISTIC(rkContext.kStatistics.uiRasterizedTriangles += uiNumVertices - 2);
+		for(uiVertex = 1; uiVertex < uiNumVertices - 1; ++uiVertex, ++rkContext.uiVisibilityID)
+		{
+			RasterizeTriangle(rkContext, ppkSrc[0], ppkSrc[uiVertex], ppkSrc[uiVertex + 1]);
+		}
+
+		if(true == rkContext.kRenderInfo.bDeferred && uiRenderedPixels == rkContext.kRenderInfo.uiRenderedPixels)
+		{
+			m_vecVisibilityTriangles.resize(m_vecVisibilityTriangles.size() - (uiNumVertices - 2));
+			m_vecVisibilityVertices.resize(m_vecVisibilityVertices.size() - uiNumVertices);
+		}
+	}
+
+	void Device::CalculateTriangleGradients(RenderContext& rkContext, const VertexShaderOutput* pkVSOutput0, const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2)
+	{
+		const FLOAT32 DELTA_X[2]	= {pkVSOutput1->kPosition.x - pkVSOutput0->kPosition.x, pkVSOutput2->kPosition.x - pkVSOutput0->kPosition.x};
+		const FLOAT32 DELTA_Y[2]	= {pkVSOutput1->kPosition.y - pkVSOutput0->kPosition.y, pkVSOutput2->kPosition.y - pkVSOutput0->kPosition.y};
+		rkContext.kTriangleInfo.fCommonGradient = 1.0f / (DELTA_X[0] * DELTA_Y[1] - DELTA_X[1] * DELTA_Y[0]);
+		rkContext.kTriangleInfo.pkBaseVertex	= pkVSOutput0;
+
+		// COMMENT : The derivatives with respect to the Y-coordinate are negated, because in screen-space the Y-axis is reversed.
+		const FLOAT32 DELTA_Z[2]	= {pkVSOutput1->kPosition.z - pkVSOutput0->kPosition.z, pkVSOutput2->kPosition.z - pkVSOutput0->kPosition.z};
+		rkContext.kTriangleInfo.fZDdx		=  (DELTA_Z[0] * DELTA_Y[1] - DELTA_Z[1] * DELTA_Y[0]) * rkContext.kTriangleInfo.fCommonGradient;
+		rkContext.kTriangleInfo.fZDdy		= -(DELTA_Z[0] * DELTA_X[1] - DELTA_Z[1] * DELTA_X[0]) * rkContext.kTriangleInfo.fCommonGradient;
+
+		const FLOAT32 DELTA_W[2]	= {pkVSOutput1->kPosition.w - pkVSOutput0->kPosition.w, pkVSOutput2->kPosition.w - pkVSOutput0->kPosition.w};
+		rkContext.kTriangleInfo.fWDdx		=  (DELTA_W[0] * DELTA_Y[1] - DELTA_W[1] * DELTA_Y[0]) * rkContext.kTriangleInfo.fCommonGradient;
+		rkContext.kTriangleInfo.fWDdy		= -(DELTA_W[0] * DELTA_X[1] - DELTA_W[1] * DELTA_X[0]) * rkContext.kTriangleInfo.fCommonGradient;
+
+		ShaderReg* pkDestDdx = rkContext.kTriangleInfo.kShaderOutputsDdx;
+		ShaderReg* pkDestDdy = rkContext.kTriangleInfo.kShaderOutputsDdy;
+		for(UINT32 uiReg = 0; uiReg < PIXEL_SHADER_REGISTERS; ++uiReg, ++pkDestDdx, ++pkDestDdy)
+		{
+			switch(rkContext.kRenderInfo.aeInterpolatedVSOutputs[uiReg])
+			{
+			case SRT_VECTOR4:
+				{
+					const FLOAT32 DELTA_REG_VAL[2] = {pkVSOutput1->kShaderOutputs[uiReg].w - pkVSOutput0->kShaderOutputs[uiReg].w, 
+					pkVSOutput2->kShaderOutputs[uiReg].w - pkVSOutput0->kShaderOutputs[uiReg].w};
+					pkDestDdx->w =  (DELTA_REG_VAL[0] * DELTA_Y[1] - DELTA_REG_VAL[1] * DELTA_Y[0]) * rkContext.kTriangleInfo.fCommonGradient;
+					pkDestDdy->w = -(DELTA_REG_VAL[0] * DELTA_X[1] - DELTA_REG_VAL[1] * DELTA_X[0]) * rkContext.kTriangleInfo.fCommonGradient;
+				}
+			case SRT_VECTOR3:
+				{
+					const FLOAT32 DELTA_REG_VAL[2] = {pkVSOutput1->kShaderOutputs[uiReg].z - pkVSOutput0->kShaderOutputs[uiReg].z, 
+					pkVSOutput2->kShaderOutputs[uiReg].z - pkVSOutput0->kShaderOutputs[uiReg].z};
+					pkDestDdx->z =  (DELTA_REG_VAL[0] * DELTA_Y[1] - DELTA_REG_VAL[1] * DELTA_Y[0]) * rkContext.kTriangleInfo.fCommonGradient;
+					pkDestDdy->z = -(DELTA_REG_VAL[0] * DELTA_X[1] - DELTA_REG_VAL[1] * DELTA_X[0]) * rkContext.kTriangleInfo.fCommonGradient;
+				}
+			case SRT_VECTOR2:
+				{
+					const FLOAT32 DELTA_REG_VAL[2] = {pkVSOutput1->kShaderOutputs[uiReg].y - pkVSOutput0->kShaderOutputs[uiReg].y, 
+					pkVSOutput2->kShaderOutputs[uiReg].y - pkVSOutput0->kShaderOutputs[uiReg].y};
+					pkDestDdx->y =  (DELTA_REG_VAL[0] * DELTA_Y[1] - DELTA_REG_VAL[1] * DELTA_Y[0]) * rkContext.kTriangleInfo.fCommonGradient;
+					pkDestDdy->y = -(DELTA_REG_VAL[0] * DELTA_X[1] - DELTA_REG_VAL[1] * DELTA_X[0]) * rkContext.kTriangleInfo.fCommonGradient;
+				}
+			case SRT_FLOAT32:
+				{
+					const FLOAT32 DELTA_REG_VAL[2] = {pkVSOutput1->kShaderOutputs[uiReg].x - pkVSOutput0->kShaderOutputs[uiReg].x, 
+					pkVSOutput2->kShaderOutputs[uiReg].x - pkVSOutput0->kShaderOutputs[uiReg].x};
+					pkDestDdx->x =  (DELTA_REG_VAL[0] * DELTA_Y[1] - DELTA_REG_VAL[1] * DELTA_Y[0]) * rkContext.kTriangleInfo.fCommonGradient;
+					pkDestDdy->x = -(DELTA_REG_VAL[0] * DELTA_X[1] - DELTA_REG_VAL[1] * DELTA_X[0]) * rkContext.kTriangleInfo.fCommonGradient;
+				}
+			case SRT_UNUSED:
+			default: break;
+			}
+		}
+	}
+
+	void Device::SetVSOutputFromGradient(RenderContext& rkContext, VertexShaderOutput* pkVSOutput, FLOAT32 fX, FLOAT32 fY)
+	{
+		const FLOAT32 OFFSET_X	= (fX - rkContext.kTriangleInfo.pkBaseVertex->kPosition.x);
+		const FLOAT32 OFFSET_Y	= (fY - rkContext.kTriangleInfo.pkBaseVertex->kPosition.y);
+
+		pkVSOutput->kPosition.z = rkContext.kTriangleInfo.pkBaseVertex->kPosition.z + 
+			rkContext.kTriangleInfo.fZDdx * OFFSET_X + rkContext.kTriangleInfo.fZDdy * OFFSET_Y;
+		pkVSOutput->kPosition.w = rkContext.kTriangleInfo.pkBaseVertex->kPosition.w + 
+			rkContext.kTriangleInfo.fWDdx * OFFSET_X + rkContext.kTriangleInfo.fWDdy * OFFSET_Y;
+
+		ShaderReg* pkDest		= pkVSOutput->kShaderOutputs;
+		const ShaderReg* BASE	= rkContext.kTriangleInfo.pkBaseVertex->kShaderOutputs;
+		const ShaderReg* DDX	= rkContext.kTriangleInfo.kShaderOutputsDdx;
+		const ShaderReg* DDY	= rkContext.kTriangleInfo.kShaderOutputsDdy;
+		for(UINT32 uiReg = 0; uiReg < PIXEL_SHADER_REGISTERS; ++uiReg, ++pkDest, ++BASE, ++DDX, ++DDY)
+		{
+			// COMMENT : The following assignments to pkDest automatically zero out unused components
+			switch(rkContext.kRenderInfo.aeInterpolatedVSOutputs[uiReg])
+			{
+			case SRT_FLOAT32:
+				*pkDest = *(FLOAT32*)BASE + *(FLOAT32*)DDX * OFFSET_X + *(FLOAT32*)DDY * OFFSET_Y; break;
+			case SRT_VECTOR2:
+				*pkDest = *(Vector2*)BASE + *(Vector2*)DDX * OFFSET_X + *(Vector2*)DDY * OFFSET_Y; break;
+			case SRT_VECTOR3:
+				*pkDest = *(Vector3*)BASE + *(Vector3*)DDX * OFFSET_X + *(Vector3*)DDY * OFFSET_Y; break;
+			case SRT_VECTOR4:
+				*pkDest = *(Vector4*)BASE + *(Vector4*)DDX * OFFSET_X + *(Vector4*)DDY * OFFSET_Y; break;
+			case SRT_UNUSED:
+			default: break;
+			}
+		}
+	}
+
+	void Device::StepXVSOutputFromGradient(RenderContext& rkContext, VertexShaderOutput* pkVSOutput)
+	{
+		pkVSOutput->kPosition.z += rkContext.kTriangleInfo.fZDdx;
+		pkVSOutput->kPosition.w += rkContext.kTriangleInfo.fWDdx;
+
+		ShaderReg* pkDest		= pkVSOutput->kShaderOutputs;
+		const ShaderReg* DDX	= rkContext.kTriangleInfo.kShaderOutputsDdx;
+		for(UINT32 uiReg = 0; uiReg < PIXEL_SHADER_REGISTERS; ++uiReg, ++pkDest, ++DDX)
+		{
+			switch(rkContext.kRenderInfo.aeInterpolatedVSOutputs[uiReg])
+			{
+			case SRT_VECTOR4: pkDest->w += DDX->w;
+			case SRT_VECTOR3: pkDest->z += DDX->z;
+			case SRT_VECTOR2: pkDest->y += DDX->y;
+			case SRT_FLOAT32: pkDest->x += DDX->x;
+			case SRT_UNUSED:
+			default: break;
+			}
+		}
+	}
+
+	void Device::RasterizeTriangle(RenderContext& rkContext, const VertexShaderOutput* pkVSOutput0, const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2)
+	{
+		ProfileStageScope kProfileStage(rkContext, PST_TRIANGLESETUP);
+		// COMMENT : If in wire-frame mode draw triangle edges as lines
+		if(FILL_WIREFRAME == m_auiRenderStates[RS_FILLMODE])
+		{
+			CalculateTriangleGradients(rkContext, pkVSOutput0, pkVSOutput1, pkVSOutput2);
+			RasterizeLine(rkContext, pkVSOutput0, pkVSOutput1);
+			RasterizeLine(rkContext, pkVSOutput1, pkVSOutput2);
+			RasterizeLine(rkContext, pkVSOutput2, pkVSOutput0);
+			return;
+		}
+
+		// COMMENT : Sort vertices by Y-coordinate
+		const VertexShaderOutput* VERTICES[3] = {pkVSOutput0, pkVSOutput1, pkVSOutput2};
+		if(pkVSOutput1->kPosition.y < VERTICES[0]->kPosition.y) {VERTICES[1] = VERTICES[0]; VERTICES[0] = pkVSOutput1;}
+		if(pkVSOutput2->kPosition.y < VERTICES[0]->kPosition.y) {VERTICES[2] = VERTICES[1]; VERTICES[1] = VERTICES[0]; VERTICES[0] = pkVSOutput2;}
+		else 
+		if(pkVSOutput2->kPosition.y < VERTICES[1]->kPosition.y) {VERTICES[2] = VERTICES[1]; VERTICES[1] = pkVSOutput2;}
+
+		// COMMENT : Screen-space position references
+		const Vector4& vA = VERTICES[0]->kPosition;
+		const Vector4& vB = VERTICES[1]->kPosition;
+		const Vector4& vC = VERTICES[2]->kPosition;
+
+		// COMMENT : Fixed-point positions, exact since the vertices have been snapped
+		const INT64 X[3] = {ToSubPixel(vA.x), ToSubPixel(vB.x), ToSubPixel(vC.x)};
+		const INT64 Y[3] = {ToSubPixel(vA.y), ToSubPixel(vB.y), ToSubPixel(vC.y)};
+
+		// COMMENT : The long edge A-C is on the right if B is left of it; degenerate triangles cover no pixel
+		const INT64 iArea = (X[1] - X[0]) * (Y[2] - Y[0]) - (Y[1] - Y[0]) * (X[2] - X[0]);
+		if(0 == iArea)
+		{
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiEmptyTriangles);
+			return;
+		}
+		const bool bLongEdgeRight = (iArea < 0);
+
+		// COMMENT : Begin rasterization. Triangles inside of the guard-band haven't been clipped to the view-port's sides
+		// and none are clipped to the scissor rect, the scan-lines and spans are limited to them instead.
+		// Pixel centers are at integer coordinates; scan-lines on a top edge are included, on a bottom edge excluded.
+		const Rect& rcRaster	= rkContext.kRenderInfo.rcRasterRect;
+		const INT32 RASTER_X[2] = {static_cast<INT32>(rcRaster.uiLeft), static_cast<INT32>(rcRaster.uiRight)};
+		const INT32 RASTER_Y[2] = {static_cast<INT32>(rcRaster.uiTop), static_cast<INT32>(rcRaster.uiBottom)};
+		const INT32 SCAN_Y[3]	= {SubPixelCeil(Y[0]), SubPixelCeil(Y[1]), SubPixelCeil(Y[2])};
+		const INT32 SCAN_X[2]	= {SubPixelCeil(Min(Min(X[0], X[1]), X[2])), SubPixelCeil(Max(Max(X[0], X[1]), X[2]))};
+
+		// COMMENT : Triangles of clipped polygons without a pixel center inside of their bounding box are discarded
+		const INT32 START_Y = Max(SCAN_Y[0], RASTER_Y[0]);
+		INT32 aiY[2]		= {START_Y, Min(SCAN_Y[2], RASTER_Y[1])};
+		const INT32 aiX[2]	= {Max(SCAN_X[0], RASTER_X[0]), Min(SCAN_X[1], RASTER_X[1])};
+		if(aiY[0] >= aiY[1] || aiX[0] >= aiX[1])
+		{
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiEmptyTriangles);
+			return;
+		}
+
+		// COMMENT : Small triangles test the pixel centers of their bounding box against the edge functions.
+		// Those are positive or zero inside, so pixels on a right edge have been shifted out; horizontal edges are left
+		// to the scan-line range. This covers exactly the pixels the stepped edges below do.
+		if((aiY[1] - aiY[0]) <= SMALL_TRIANGLE_SIZE && (aiX[1] - aiX[0]) <= SMALL_TRIANGLE_SIZE)
+		{
+			INT64 aiEdge[3], aiEdgeStepX[3], aiEdgeStepY[3];
+			for(UINT32 uiEdge = 0; uiEdge < 3; ++uiEdge)
+			{
+				// COMMENT : Edges A-C, A-B and B-C, with A-C on the opposite side of the other two
+				const UINT32 uiStart		= (2 == uiEdge) ? 1 : 0;
+				const UINT32 uiEnd			= (1 == uiEdge) ? 1 : 2;
+				const bool bRightEdge		= ((0 == uiEdge) == bLongEdgeRight);
+				const INT64 iSign			= bRightEdge ? -1 : 1;
+				const INT64 iDeltaX			= X[uiEnd] - X[uiStart];
+				const INT64 iDeltaY			= Y[uiEnd] - Y[uiStart];
+				if(0 == iDeltaY) {aiEdge[uiEdge] = 0; aiEdgeStepX[uiEdge] = 0; aiEdgeStepY[uiEdge] = 0; continue;}
+
+				aiEdgeStepX[uiEdge]			=  iSign * (iDeltaY << SUBPIXEL_BITS);
+				aiEdgeStepY[uiEdge]			= -iSign * (iDeltaX << SUBPIXEL_BITS);
+				aiEdge[uiEdge]				= iSign * (((static_cast<INT64>(aiX[0]) << SUBPIXEL_BITS) - X[uiStart]) * iDeltaY - 
+					((static_cast<INT64>(aiY[0]) << SUBPIXEL_BITS) - Y[uiStart]) * iDeltaX) - (bRightEdge ? 1 : 0);
+			}
+
+			INT32 aaiSpans[SMALL_TRIANGLE_SIZE][2];
+			bool bCovered = false;
+			for(INT32 iRow = 0; iRow < aiY[1] - aiY[0]; ++iRow)
+			{
+				aaiSpans[iRow][0] = aaiSpans[iRow][1] = aiX[0];
+				INT64 aiEdgeX[3] = {aiEdge[0], aiEdge[1], aiEdge[2]};
+				for(INT32 iX = aiX[0]; iX < aiX[1]; ++iX)
+				{
+					if((aiEdgeX[0] | aiEdgeX[1] | aiEdgeX[2]) >= 0)
+					{
+						if(aaiSpans[iRow][0] == aaiSpans[iRow][1]) {aaiSpans[iRow][0] = iX;}
+						aaiSpans[iRow][1] = iX + 1;
+						bCovered = true;
+					}
+					aiEdgeX[0] += aiEdgeStepX[0]; aiEdgeX[1] += aiEdgeStepX[1]; aiEdgeX[2] += aiEdgeStepX[2];
+				}
+				aiEdge[0] += aiEdgeStepY[0]; aiEdge[1] += aiEdgeStepY[1]; aiEdge[2] += aiEdgeStepY[2];
+			}
+
+			if(false == bCovered)
+			{
+				CORE3D_STATISTIC(++rkContext.kStatistics.uiEmptyTriangles);
+				return;
+			}
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiSmallTriangles);
+
+			CalculateTriangleGradients(rkContext, pkVSOutput0, pkVSOutput1, pkVSOutput2);
+				for(INT32 iRow = 0; iRow < aiY[1] - aiY[0]; ++iRow)
+			{
+				if(aaiSpans[iRow][0] < aaiSpans[iRow][1]) {RasterizeTriangleScanline(rkContext, aiY[0] + iRow, aaiSpans[iRow][0], aaiSpans[iRow][1]);}
+			}
+			return;
+		}
+
+		CalculateTriangleGradients(rkContext, pkVSOutput0, pkVSOutput1, pkVSOutput2);
+
+		// COMMENT : Edges are set up at the first scan-line directly, skipped ones needn't be stepped
+		RasterEdge kLongEdge, kShortEdge;
+		kLongEdge.Setup(X[0], Y[0], X[2], Y[2], START_Y);
+		if(START_Y < SCAN_Y[1])	{kShortEdge.Setup(X[0], Y[0], X[1], Y[1], START_Y);}
+		else					{kShortEdge.Setup(X[1], Y[1], X[2], Y[2], START_Y);}
+		const RasterEdge& rkLeftEdge	= bLongEdgeRight ? kShortEdge : kLongEdge;
+		const RasterEdge& rkRightEdge	= bLongEdgeRight ? kLongEdge : kShortEdge;
+
+		for( ; aiY[0] < aiY[1]; ++aiY[0], kLongEdge.Step(), kShortEdge.Step())
+		{
+			// COMMENT : Switch to the lower triangle part
+			if(aiY[0] == SCAN_Y[1] && aiY[0] != START_Y) {kShortEdge.Setup(X[1], Y[1], X[2], Y[2], aiY[0]);}
+
+			const INT32 SPAN_X[2] = {Max(rkLeftEdge.iX, RASTER_X[0]), Min(rkRightEdge.iX, RASTER_X[1])};
+			if(SPAN_X[0] < SPAN_X[1]) {RasterizeTriangleScanline(rkContext, aiY[0], SPAN_X[0], SPAN_X[1]);}
+		}
+	}
+
+	void Device::RasterizeTriangleScanline(RenderContext& rkContext, INT32 iY, INT32 iX, INT32 iX2)
+	{
+		rkContext.kTriangleInfo.uiCurrentPixelY = static_cast<UINT32>(iY);
+		if(NULL != rkContext.pkStencilFace)
+		{
+			RasterizeStencilScanline(rkContext, static_cast<UINT32>(iY), static_cast<UINT32>(iX), static_cast<UINT32>(iX2));
+			return;
+		}
+
+		VertexShaderOutput kVSOutput;
+		SetVSOutputFromGradient(rkContext, &kVSOutput, static_cast<FLOAT32>(iX), static_cast<FLOAT32>(iY));
+		ProfileStageScope kProfileScanline(rkContext, PST_RASTERIZATION);
+		(this->*rkContext.kRenderInfo.pfnRasterizeScanLine)(rkContext, static_cast<UINT32>(iY), static_cast<UINT32>(iX), static_cast<UINT32>(iX2), &kVSOutput);
+	}
+
+	// COMMENT : Tests the stencil of a scan-line's pixels four at a time, before any register is interpolated. Failing pixels only
+	// get the fail operation, each run of passing ones is interpolated from its first pixel and rasterized by the draw's
+	// scan-line function.
+	void Device::RasterizeStencilScanline(RenderContext& rkContext, UINT32 uiY, UINT32 uiX, UINT32 uiX2)
+	{
+		static const UINT32 PASSED_PIXELS[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+		ProfileStageScope kProfileScanline(rkContext, PST_RASTERIZATION);
+		const RenderInfo& rkRenderInfo	= rkContext.kRenderInfo;
+		const StencilFace& rkFace		= *rkContext.pkStencilFace;
+		const UINT32* puiStencilRow		= rkRenderInfo.puiStencilData + uiY * rkRenderInfo.uiStencilBufferPitch;
+		const UINT32 uiRef				= rkRenderInfo.uiStencilRef & rkRenderInfo.uiStencilMask;
+		CORE3D_STATISTIC(rkContext.kStatistics.uiStencilTestedPixels += uiX2 - uiX);
+
+		// COMMENT : Stencil values are small enough to be compared signed. The negated comparisons invert the passed mask.
+		const __m128i REF		= _mm_set1_epi32(static_cast<INT32>(uiRef));
+		const __m128i MASK		= _mm_set1_epi32(static_cast<INT32>(rkRenderInfo.uiStencilMask));
+		const INT32 iInvert		= (CMP_NOTEQUAL == rkFace.eCompare || CMP_LESSEQUAL == rkFace.eCompare || 
+			CMP_GREATEREQUAL == rkFace.eCompare || CMP_ALWAYS == rkFace.eCompare) ? 15 : 0;
+
+		UINT32 uiPassedPixels	= 0;
+		UINT32 uiRunX			= uiX2;		// First pixel of the current run of passing pixels, uiX2 while there is none
+		while(uiX < uiX2)
+		{
+			INT32 iPassedMask;
+			UINT32 uiPixels;
+			if(uiX + 4 <= uiX2)
+			{
+				const __m128i STENCIL = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(puiStencilRow + uiX)), MASK);
+				__m128i PASSED;
+				switch(rkFace.eCompare)
+				{
+				case CMP_EQUAL:
+				case CMP_NOTEQUAL:		PASSED = _mm_cmpeq_epi32(REF, STENCIL); break;
+				case CMP_LESS:
+				case CMP_GREATEREQUAL:	PASSED = _mm_cmplt_epi32(REF, STENCIL); break;
+				case CMP_GREATER:
+				case CMP_LESSEQUAL:		PASSED = _mm_cmpgt_epi32(REF, STENCIL); break;
+				case CMP_NEVER:
+				case CMP_ALWAYS:
+				default:				PASSED = _mm_setzero_si128(); break;
+				}
+				iPassedMask	= _mm_movemask_ps(_mm_castsi128_ps(PASSED)) ^ iInvert;
+				uiPixels	= 4;
+			}
+			else
+			{
+				iPassedMask	= StencilTest(rkFace.eCompare, uiRef, puiStencilRow[uiX] & rkRenderInfo.uiStencilMask) ? 1 : 0;
+				uiPixels	= 1;
+			}
+			uiPassedPixels += PASSED_PIXELS[iPassedMask];
+
+			if(iPassedMask == (1 << uiPixels) - 1)
+			{
+				if(uiX2 == uiRunX) {uiRunX = uiX;}
+			}
+			else if(0 == iPassedMask && uiX2 == uiRunX && SOP_KEEP == rkFace.eFail)
+			{
+				// COMMENT : Masked out pixels, nothing to do
+			}
+			else
+			{
+				for(UINT32 uiPixel = 0; uiPixel < uiPixels; ++uiPixel)
+				{
+					if(0 != (iPassedMask & (1 << uiPixel)))
+					{
+						if(uiX2 == uiRunX) {uiRunX = uiX + uiPixel;}
+						continue;
+					}
+
+					if(uiX2 != uiRunX)
+					{
+						RasterizeScanlineRun(rkContext, uiY, uiRunX, uiX + uiPixel);
+						uiRunX = uiX2;
+					}
+					UpdateStencil(rkContext, rkFace.eFail, uiX + uiPixel, uiY);
+				}
+			}
+			uiX += uiPixels;
+		}
+		if(uiX2 != uiRunX) {RasterizeScanlineRun(rkContext, uiY, uiRunX, uiX2);}
+		CORE3D_STATISTIC(rkContext.kStatistics.uiStencilPassedPixels += uiPassedPixels);
+	}
+
+	void Device::RasterizeScanlineRun(RenderContext& rkContext, UINT32 uiY, UINT32 uiX, UINT32 uiX2)
+	{
+		VertexShaderOutput kVSOutput;
+		SetVSOutputFromGradient(rkContext, &kVSOutput, static_cast<FLOAT32>(uiX), static_cast<FLOAT32>(uiY));
+		(this->*rkContext.kRenderInfo.pfnRasterizeScanLine)(rkContext, uiY, uiX, uiX2, &kVSOutput);
+	}
+
+	void Device::RasterizeScanlineColorOnly(RenderContext& rkContext, UINT32 uiY, UINT32 uiX, UINT32 uiX2, VertexShaderOutput* pkVSOutput)
+	{
+		FLOAT32* pfFrameData = rkContext.kRenderInfo.pfFrameData + (uiY * rkContext.kRenderInfo.uiColorBufferPitch + uiX * rkContext.kRenderInfo.uiColorFloats);
+		FLOAT32* pfDepthData = rkContext.kRenderInfo.pfDepthData + (uiY * rkContext.kRenderInfo.uiDepthBufferPitch + uiX);
+
+		for( ; uiX < uiX2; ++uiX, pfFrameData += rkContext.kRenderInfo.uiColorFloats, ++pfDepthData, StepXVSOutputFromGradient(rkContext, pkVSOutput))
+		{
+			// COMMENT : Get depth of current pixel
+			FLOAT32 fDepth = pkVSOutput->kPosition.z;
+			
+			// COMMENT : Perform depth test
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiDepthTestedPixels);
+			if(false == DepthTest(rkContext.kRenderInfo.eDepthCompare, fDepth, pfDepthData))
+			{
+				StencilDepthFail(rkContext, uiX, uiY);
+				continue;
+			}
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiDepthPassedPixels);
+
+			// COMMENT : Passed depth test - update depth buffer
+			if(true == rkContext.kRenderInfo.bDepthWrite)
+			{
+				*pfDepthData = fDepth;
+			}
+
+			if(true == rkContext.kRenderInfo.bColorWrite)
+			{
+				SetPixelShaderInput(rkContext, pkVSOutput);
+
+				// NOTE: The pixel shader input only contains valid register data, position etc. are not initialized
+				// Read in current pixel's color in the color-buffer
+				Vector4 kPixelColor(0.0f, 0.0f, 0.0f, 1.0f);
+				switch(rkContext.kRenderInfo.uiColorFloats)
+				{
+				case 4: kPixelColor.a = pfFrameData[3];
+				case 3: kPixelColor.b = pfFrameData[2];
+				case 2: kPixelColor.g = pfFrameData[1];
+				case 1: kPixelColor.r = pfFrameData[0];
+				}
+
+				// COMMENT : Execute the pixel shader
+				rkContext.kTriangleInfo.uiCurrentPixelX = uiX;
+				{
+					ProfileStageScope kProfileStage(rkContext, PST_PIXELSHADING);
+					m_pkPixelShader->Execute(rkContext.kPixelShaderInput.kShaderOutputs, kPixelColor, fDepth);
+				}
+				CORE3D_STATISTIC(++rkContext.kStatistics.uiShadedPixels);
+
+				// COMMENT : Write the new color to the color-buffer
+				switch(rkContext.kRenderInfo.uiColorFloats)
+				{
+				case 4: pfFrameData[3] = kPixelColor.a;
+				case 3: pfFrameData[2] = kPixelColor.b;
+				case 2: pfFrameData[1] = kPixelColor.g;
+				case 1: pfFrameData[0] = kPixelColor.r;
+				}
+			}
+			StencilPass(rkContext, uiX, uiY);
+			++rkContext.kRenderInfo.uiRenderedPixels;
+		}
+	}
+
+	void Device::RasterizeScanlineColorOnlyMightKillPixels(RenderContext& rkContext, UINT32 uiY, UINT32 uiX, UINT32 uiX2, VertexShaderOutput* pkVSOutput)
+	{
+		FLOAT32* pfFrameData = rkContext.kRenderInfo.pfFrameData + (uiY * rkContext.kRenderInfo.uiColorBufferPitch + uiX * rkContext.kRenderInfo.uiColorFloats);
+		FLOAT32* pfDepthData = rkContext.kRenderInfo.pfDepthData + (uiY * rkContext.kRenderInfo.uiDepthBufferPitch + uiX);
+
+		for( ; uiX < uiX2; ++uiX, pfFrameData += rkContext.kRenderInfo.uiColorFloats, ++pfDepthData, StepXVSOutputFromGradient(rkContext, pkVSOutput))
+		{
+			// COMMENT : Get depth of current pixel
+			FLOAT32 fDepth = pkVSOutput->kPosition.z;
+
+			// COMMENT : Perform depth test
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiDepthTestedPixels);
+			if(false == DepthTest(rkContext.kRenderInfo.eDepthCompare, fDepth, pfDepthData))
+			{
+				StencilDepthFail(rkContext, uiX, uiY);
+				continue;
+			}
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiDepthPassedPixels);
+
+			if(true == rkContext.kRenderInfo.bColorWrite || true == rkContext.kRenderInfo.bDepthWrite)
+			{
+				SetPixelShaderInput(rkContext, pkVSOutput);
+
+				// NOTE: The pixel shader input only contains valid register data, position etc. are not initialized
+				// Read in current pixel's color in the color-buffer
+				Vector4 kPixelColor(0.0f, 0.0f, 0.0f, 1.0f);
+				switch(rkContext.kRenderInfo.uiColorFloats)
+				{
+				case 4: kPixelColor.a = pfFrameData[3];
+				case 3: kPixelColor.b = pfFrameData[2];
+				case 2: kPixelColor.g = pfFrameData[1];
+				case 1: kPixelColor.r = pfFrameData[0];
+				}
+
+				// COMMENT : Execute the pixel shader
+				rkContext.kTriangleInfo.uiCurrentPixelX = uiX;
+				CORE3D_STATISTIC(++rkContext.kStatistics.uiShadedPixels);
+				bool bPixelShaded;
+				{
+					ProfileStageScope kProfileStage(rkContext, PST_PIXELSHADING);
+					bPixelShaded = m_pkPixelShader->Execute(rkContext.kPixelShaderInput.kShaderOutputs, kPixelColor, fDepth);
+				}
+				if(false == bPixelShaded)
+				{
+					// COMMENT : Pixel got killed
+					CORE3D_STATISTIC(++rkContext.kStatistics.uiKilledPixels);
+					continue;
+				}
+
+				// COMMENT : Passed depth test and pixel was not killed, so update depth-buffer
+				if(true == rkContext.kRenderInfo.bDepthWrite)
+				{
+					*pfDepthData = fDepth;
+				}
+
+				// COMMENT : Write the new color to the color-buffer
+				if(true == rkContext.kRenderInfo.bColorWrite)
+				{
+					switch(rkContext.kRenderInfo.uiColorFloats)
+					{
+					case 4: pfFrameData[3] = kPixelColor.a;
+					case 3: pfFrameData[2] = kPixelColor.b;
+					case 2: pfFrameData[1] = kPixelColor.g;
+					case 1: pfFrameData[0] = kPixelColor.r;
+					}
+				}
+			}
+			StencilPass(rkContext, uiX, uiY);
+			++rkContext.kRenderInfo.uiRenderedPixels;
+		}
+	}
+
+	void Device::RasterizeScanlineColorDepth(RenderContext& rkContext, UINT32 uiY, UINT32 uiX, UINT32 uiX2, VertexShaderOutput* pkVSOutput)
+	{
+		FLOAT32* pfFrameData = rkContext.kRenderInfo.pfFrameData + (uiY * rkContext.kRenderInfo.uiColorBufferPitch + uiX * rkContext.kRenderInfo.uiColorFloats);
+		FLOAT32* pfDepthData = rkContext.kRenderInfo.pfDepthData + (uiY * rkContext.kRenderInfo.uiDepthBufferPitch + uiX);
+
+		for( ; uiX < uiX2; ++uiX, pfFrameData += rkContext.kRenderInfo.uiColorFloats, ++ pfDepthData, StepXVSOutputFromGradient(rkContext, pkVSOutput))
+		{
+			SetPixelShaderInput(rkContext, pkVSOutput);
+
+			// NOTE: The pixel shader input only contains valid register data, position etc. are not initialized
+			// Read in current color-buffer color
+			Vector4 kPixelColor(0.0f, 0.0f, 0.0f, 1.0f);
+			switch(rkContext.kRenderInfo.uiColorFloats)
+			{
+			case 4: kPixelColor.a = pfFrameData[3];
+			case 3: kPixelColor.b = pfFrameData[2];
+			case 2: kPixelColor.g = pfFrameData[1];
+			case 1: kPixelColor.r = pfFrameData[0];
+			}
+
+			// COMMENT : Get depth of current pixel
+			FLOAT32 fDepth = pkVSOutput->kPosition.z;
+
+			// COMMENT : Execute pixel shader
+			rkContext.kTriangleInfo.uiCurrentPixelX = uiX;
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiShadedPixels);
+			bool bPixelShaded;
+			{
+				ProfileStageScope kProfileStage(rkContext, PST_PIXELSHADING);
+				bPixelShaded = m_pkPixelShader->Execute(rkContext.kPixelShaderInput.kShaderOutputs, kPixelColor, fDepth);
+			}
+			if(false == bPixelShaded)
+			{
+				// COMMENT : Pixel got killed
+				CORE3D_STATISTIC(++rkContext.kStatistics.uiKilledPixels);
+				continue;
+			}
+
+			// COMMENT : Perform depth test
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiDepthTestedPixels);
+			if(false == DepthTest(rkContext.kRenderInfo.eDepthCompare, fDepth, pfDepthData))
+			{
+				StencilDepthFail(rkContext, uiX, uiY);
+				continue;
+			}
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiDepthPassedPixels);
+
+			// COMMENT : Passed depth test, so update depth buffer
+			if(true == rkContext.kRenderInfo.bDepthWrite)
+			{
+				*pfDepthData = fDepth;
+			}
+
+			// COMMENT : Write new color to color buffer
+			if(true == rkContext.kRenderInfo.bColorWrite)
+			{
+				switch(rkContext.kRenderInfo.uiColorFloats)
+				{
+				case 4: pfFrameData[3] = kPixelColor.a;
+				case 3: pfFrameData[2] = kPixelColor.b;
+				case 2: pfFrameData[1] = kPixelColor.g;
+				case 1: pfFrameData[0] = kPixelColor.r;
+				}
+			}
+			StencilPass(rkContext, uiX, uiY);
+			++rkContext.kRenderInfo.uiRenderedPixels;
+		}
+	}
+
+	// COMMENT : Tests and writes four pixels at a time. The depths are still stepped one after another, so they're identical
+	// to those of the other scan-line functions and a later pass can test against them for equality.
+	void Device::RasterizeScanlineDepthOnly(RenderContext& rkContext, UINT32 uiY, UINT32 uiX, UINT32 uiX2, VertexShaderOutput* pkVSOutput)
+	{
+		static const UINT32 PASSED_PIXELS[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+		FLOAT32* pfDepthData	= rkContext.kRenderInfo.pfDepthData + (uiY * rkContext.kRenderInfo.uiDepthBufferPitch + uiX);
+		const CmpFunc eCompare	= rkContext.kRenderInfo.eDepthCompare;
+		if(CMP_NEVER == eCompare)
+		{
+			for( ; uiX < uiX2; ++uiX) {StencilDepthFail(rkContext, uiX, uiY);}
+			return;
+		}
+		CORE3D_STATISTIC(rkContext.kStatistics.uiDepthTestedPixels += uiX2 - uiX);
+
+		// COMMENT : Stencil operations are applied per pixel
+		const StencilFace* pkStencilFace = rkContext.pkStencilFace;
+		const bool bStencilWrite	= (NULL != pkStencilFace) && (SOP_KEEP != pkStencilFace->eDepthFail || SOP_KEEP != pkStencilFace->ePass);
+
+		const FLOAT32 fDepthStep	= rkContext.kTriangleInfo.fZDdx;
+		FLOAT32 fDepth				= pkVSOutput->kPosition.z;
+		const __m128 EPSILON		= _mm_set1_ps(FLT_EPSILON);
+		const __m128 SIGN_MASK		= _mm_set1_ps(-0.0f);
+		UINT32 uiPassedPixels		= 0;
+
+		// COMMENT : Deferred draws write their triangle's id where the depth test passes, and where the scan-line starts
+		UINT32* puiVisibilityRow	= (NULL != rkContext.kRenderInfo.puiVisibilityData) ? 
+			rkContext.kRenderInfo.puiVisibilityData + uiY * rkContext.kRenderInfo.uiVisibilityPitch : NULL;
+		UINT32* puiSpanRow			= (NULL != puiVisibilityRow) ? 
+			rkContext.kRenderInfo.puiVisibilitySpans + uiY * rkContext.kRenderInfo.uiVisibilityPitch : NULL;
+		const __m128i VISIBILITY_ID	= _mm_set1_epi32(static_cast<INT32>(rkContext.uiVisibilityID));
+		const UINT32 uiSpanX		= uiX;
+		const __m128i SPAN			= _mm_set1_epi32(static_cast<INT32>(uiSpanX));
+		for( ; uiX + 4 <= uiX2; uiX += 4, pfDepthData += 4)
+		{
+			FLOAT32 afDepths[4];
+			afDepths[0] = fDepth; fDepth += fDepthStep;
+			afDepths[1] = fDepth; fDepth += fDepthStep;
+			afDepths[2] = fDepth; fDepth += fDepthStep;
+			afDepths[3] = fDepth; fDepth += fDepthStep;
+			const __m128 DEPTH		= _mm_loadu_ps(afDepths);
+			const __m128 BUFFER		= (CMP_ALWAYS != eCompare) ? _mm_loadu_ps(pfDepthData) : DEPTH;
+
+			__m128 PASSED = DEPTH;
+			switch(eCompare)
+			{
+			case CMP_EQUAL:			PASSED = _mm_cmplt_ps(_mm_andnot_ps(SIGN_MASK, _mm_sub_ps(DEPTH, BUFFER)), EPSILON); break;
+			case CMP_NOTEQUAL:		PASSED = _mm_cmpge_ps(_mm_andnot_ps(SIGN_MASK, _mm_sub_ps(DEPTH, BUFFER)), EPSILON); break;
+			case CMP_LESS:			PASSED = _mm_cmplt_ps(DEPTH, BUFFER); break;
+			case CMP_LESSEQUAL:		PASSED = _mm_cmple_ps(DEPTH, BUFFER); break;
+			case CMP_GREATEREQUAL:	PASSED = _mm_cmpge_ps(DEPTH, BUFFER); break;
+			case CMP_GREATER:		PASSED = _mm_cmpgt_ps(DEPTH, BUFFER); break;
+			case CMP_ALWAYS:
+			default:				break;
+			}
+
+			const INT32 iPassedMask = (CMP_ALWAYS != eCompare) ? _mm_movemask_ps(PASSED) : 15;
+			if(true == bStencilWrite)
+			{
+				for(UINT32 uiPixel = 0; uiPixel < 4; ++uiPixel)
+				{
+					UpdateStencil(rkContext, (0 != (iPassedMask & (1 << uiPixel))) ? pkStencilFace->ePass : pkStencilFace->eDepthFail, uiX + uiPixel, uiY);
+				}
+			}
+			if(0 == iPassedMask) {continue;}
+			uiPassedPixels += PASSED_PIXELS[iPassedMask];
+
+			if(true == rkContext.kRenderInfo.bDepthWrite)
+			{
+				_mm_storeu_ps(pfDepthData, (15 == iPassedMask) ? DEPTH : _mm_or_ps(_mm_and_ps(PASSED, DEPTH), _mm_andnot_ps(PASSED, BUFFER)));
+			}
+
+			if(NULL != puiVisibilityRow)
+			{
+				__m128i* pkIDs			= reinterpret_cast<__m128i*>(puiVisibilityRow + uiX);
+				const __m128i PASSED_ID	= _mm_castps_si128(PASSED);
+				__m128i* pkSpans		= reinterpret_cast<__m128i*>(puiSpanRow + uiX);
+				_mm_storeu_si128(pkIDs, (15 == iPassedMask) ? VISIBILITY_ID : 
+					_mm_or_si128(_mm_and_si128(PASSED_ID, VISIBILITY_ID), _mm_andnot_si128(PASSED_ID, _mm_loadu_si128(pkIDs))));
+				_mm_storeu_si128(pkSpans, (15 == iPassedMask) ? SPAN : 
+					_mm_or_si128(_mm_and_si128(PASSED_ID, SPAN), _mm_andnot_si128(PASSED_ID, _mm_loadu_si128(pkSpans))));
+			}
+		}
+
+		// COMMENT : Remaining pixels of the scan-line
+		for( ; uiX < uiX2; ++uiX, ++pfDepthData, fDepth += fDepthStep)
+		{
+			if(false == DepthTest(eCompare, fDepth, pfDepthData))
+			{
+				StencilDepthFail(rkContext, uiX, uiY);
+				continue;
+			}
+			StencilPass(rkContext, uiX, uiY);
+			++uiPassedPixels;
+
+			if(true == rkContext.kRenderInfo.bDepthWrite)
+			{
+				*pfDepthData = fDepth;
+			}
+			if(NULL != puiVisibilityRow)
+			{
+				puiVisibilityRow[uiX]	= rkContext.uiVisibilityID;
+				puiSpanRow[uiX]			= uiSpanX;
+			}
+		}
+
+		CORE3D_STATISTIC(rkContext.kStatistics.uiDepthPassedPixels += uiPassedPixels);
+		rkContext.kRenderInfo.uiRenderedPixels += uiPassedPixels;
+	}
+
+	void Device::RasterizeLine(RenderContext& rkContext, const VertexShaderOutput* pkVSOutput0, const VertexShaderOutput* pkVSOutput1)
+	{
+		ProfileStageScope kProfileStage(rkContext, PST_RASTERIZATION);
+		const Vector4& vA = pkVSOutput0->kPosition;
+		const Vector4& vB = pkVSOutput1->kPosition;
+
+		const UINT32 INT_COORDS_A[2]	= {static_cast<UINT32>(Core3D::FtoL(vA.x)), static_cast<UINT32>(Core3D::FtoL(vA.y))};
+		const FLOAT32 DELTA_X			= vB.x - vA.x;
+		const FLOAT32 DELTA_Y			= vB.y - vA.y;
+
+		const INT32 LINE_THICKNESS_HALF	= -(static_cast<INT32>(m_auiRenderStates[RS_LINETHICKNESS] / 2));
+		const INT32 POS_OFFSET			= (m_auiRenderStates[RS_LINETHICKNESS] & 1) ? 0 : 1;
+
+		if(fabsf(DELTA_X) > fabsf(DELTA_Y))
+		{
+			// COMMENT : Drawing a line which is more horizontal than vertical
+			const INT32 PIXELS_X		= Core3D::FtoL((FLOAT32)DELTA_X);
+			if(0 == PIXELS_X) {return;}
+
+			const INT32 SIGN_X			= PIXELS_X > 0 ? 1 : -1;
+			const FLOAT32 SLOPE			= DELTA_Y / DELTA_X;
+
+			FLOAT32 fInterpolation		= SIGN_X > 0 ? 0.0f : 1.0f;
+			const FLOAT32 INTERPOLATION_STEP = static_cast<const FLOAT32>(SIGN_X) / static_cast<const FLOAT32>(abs(PIXELS_X) - 1);
+
+			for(INT32 i = 0; i != PIXELS_X; i += SIGN_X, fInterpolation += INTERPOLATION_STEP)
+			{
+				UINT32 uiPixelX			= INT_COORDS_A[0] + i;
+				UINT32 uiPixelY			= INT_COORDS_A[1] + Core3D::FtoL((FLOAT32)(SLOPE * i));
+				if(uiPixelX < rkContext.kRenderInfo.rcRasterRect.uiLeft || uiPixelX >= rkContext.kRenderInfo.rcRasterRect.uiRight) {continue;}
+
+				VertexShaderOutput& kPSInput = rkContext.kPixelShaderInput;
+				SetVSOutputFromGradient(rkContext, &kPSInput, static_cast<FLOAT32>(uiPixelX), static_cast<FLOAT32>(uiPixelY));
+				SetPixelShaderInput(rkContext, &kPSInput);
+
+				if(uiPixelY >= rkContext.kRenderInfo.rcRasterRect.uiBottom) {continue;} // uiPixelY의 값이 Color Buffer의 크기 보다 클 수 있어 그 범위를 제한 함.
+				if(0 == LINE_THICKNESS_HALF) {if(uiPixelY >= rkContext.kRenderInfo.rcRasterRect.uiTop) {DrawLinePixel(rkContext, uiPixelX, uiPixelY, &kPSInput);}}
+				else
+				{
+					for(INT32 j = LINE_THICKNESS_HALF + POS_OFFSET; j <= -LINE_THICKNESS_HALF; ++j)
+					{
+						INT32 iNewPixelY = uiPixelY + j;
+						if( (iNewPixelY < static_cast<INT32>(rkContext.kRenderInfo.rcRasterRect.uiTop))	|| 
+							(iNewPixelY >= static_cast<INT32>(rkContext.kRenderInfo.rcRasterRect.uiBottom)) )
+						{
+							continue;
+						}
+						DrawLinePixel(rkContext, uiPixelX, static_cast<UINT32>(iNewPixelY), &kPSInput);
+					}
+				}
+			}
+		}
+		else
+		{
+			const INT32 PIXELS_Y		= Core3D::FtoL((FLOAT32)DELTA_Y);
+			if(0 == PIXELS_Y) {return;}
+
+			const INT32 SIGN_Y			= PIXELS_Y > 0 ? 1 : -1;
+			const FLOAT32 SLOPE			= DELTA_X / DELTA_Y;
+
+			FLOAT32 fInterpolation		= SIGN_Y > 0 ? 0.0f : 1.0f;
+			const FLOAT32 INTERPOLATION_STEP = static_cast<const FLOAT32>(SIGN_Y) / static_cast<const FLOAT32>(abs(PIXELS_Y) - 1);
+
+			for(INT32 i = 0; i != PIXELS_Y; i += SIGN_Y, fInterpolation += INTERPOLATION_STEP)
+			{
+				UINT32 uiPixelX			= INT_COORDS_A[0] + Core3D::FtoL((FLOAT32)(SLOPE * i));
+				UINT32 uiPixelY			= INT_COORDS_A[1] + i;
+				if(uiPixelY < rkContext.kRenderInfo.rcRasterRect.uiTop || uiPixelY >= rkContext.kRenderInfo.rcRasterRect.uiBottom) {continue;}
+
+				VertexShaderOutput& kPSInput = rkContext.kPixelShaderInput;
+				SetVSOutputFromGradient(rkContext, &kPSInput, static_cast<FLOAT32>(uiPixelX), static_cast<FLOAT32>(uiPixelY));
+				SetPixelShaderInput(rkContext, &kPSInput);
+
+				if(0 == LINE_THICKNESS_HALF) {if(uiPixelX >= rkContext.kRenderInfo.rcRasterRect.uiLeft && uiPixelX < rkContext.kRenderInfo.rcRasterRect.uiRight) {DrawLinePixel(rkContext, uiPixelX, uiPixelY, &kPSInput);}}
+				else
+				{
+					for(INT32 j = LINE_THICKNESS_HALF + POS_OFFSET; j <= -LINE_THICKNESS_HALF; ++j)
+					{
+						INT32 iNewPixelX = uiPixelX + j;
+						if( (iNewPixelX < static_cast<INT32>(rkContext.kRenderInfo.rcRasterRect.uiLeft)) || 
+							(iNewPixelX >= static_cast<INT32>(rkContext.kRenderInfo.rcRasterRect.uiRight)) )
+						{
+							continue;
+						}
+						DrawLinePixel(rkContext, static_cast<UINT32>(iNewPixelX), uiPixelY, &kPSInput);
+					}
+				}
+			}
+		}
+	}
+
+	// COMMENT : Stencil tests a pixel of a line and draws it with the draw's pixel function
+	void Device::DrawLinePixel(RenderContext& rkContext, UINT32 uiX, UINT32 uiY, const VertexShaderOutput* pkVSOutput)
+	{
+		if(NULL != rkContext.pkStencilFace)
+		{
+			const RenderInfo& rkRenderInfo	= rkContext.kRenderInfo;
+			const UINT32 uiStencil			= rkRenderInfo.puiStencilData[uiY * rkRenderInfo.uiStencilBufferPitch + uiX];
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiStencilTestedPixels);
+			if(false == StencilTest(rkContext.pkStencilFace->eCompare, rkRenderInfo.uiStencilRef & rkRenderInfo.uiStencilMask, uiStencil & rkRenderInfo.uiStencilMask))
+			{
+				UpdateStencil(rkContext, rkContext.pkStencilFace->eFail, uiX, uiY);
+				return;
+			}
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiStencilPassedPixels);
+		}
+		(this->*rkContext.kRenderInfo.pfnDrawPixel)(rkContext, uiX, uiY, pkVSOutput);
+	}
+
+	void Device::DrawPixelColorOnly(RenderContext& rkContext, UINT32 uiX, UINT32 uiY, const VertexShaderOutput* pkVSOutput)
+	{
+		FLOAT32* pfFrameData = rkContext.kRenderInfo.pfFrameData + (uiY * rkContext.kRenderInfo.uiColorBufferPitch + uiX * rkContext.kRenderInfo.uiColorFloats);
+		FLOAT32* pfDepthData = rkContext.kRenderInfo.pfDepthData + (uiY * rkContext.kRenderInfo.uiDepthBufferPitch + uiX);
+
+		// COMMENT : Perform depth test
+		CORE3D_STATISTIC(++rkContext.kStatistics.uiDepthTestedPixels);
+		if(false == DepthTest(rkContext.kRenderInfo.eDepthCompare, pkVSOutput->kPosition.z, pfDepthData))
+		{
+			StencilDepthFail(rkContext, uiX, uiY);
+			return;
+		}
+		CORE3D_STATISTIC(++rkContext.kStatistics.uiDepthPassedPixels);
+
+		if(true == rkContext.kRenderInfo.bColorWrite || true == rkContext.kRenderInfo.bDepthWrite)
+		{
+			// COMMENT : Read in current pixel's color in the color-buffer
+			Vector4 kPixelColor(0.0f, 0.0f, 0.0f, 1.0f);
+			switch(rkContext.kRenderInfo.uiColorFloats)
+			{
+			case 4: kPixelColor.a = pfFrameData[3];
+			case 3: kPixelColor.b = pfFrameData[2];
+			case 2: kPixelColor.g = pfFrameData[1];
+			case 1: kPixelColor.r = pfFrameData[0];
+			}
+
+			// COMMENT : Execute the pixel shader
+			FLOAT32 fPSDepth = pkVSOutput->kPosition.z; // If we passed pkVSOutput->kPosition.z directly to the pixel shader,
+														// It might modify it, which is not allowed in this function.
+			rkContext.kTriangleInfo.uiCurrentPixelX = uiX;
+			rkContext.kTriangleInfo.uiCurrentPixelY = uiY;
+
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiShadedPixels);
+			bool bPixelShaded;
+			{
+				ProfileStageScope kProfileStage(rkContext, PST_PIXELSHADING);
+				bPixelShaded = m_pkPixelShader->Execute(pkVSOutput->kShaderOutputs, kPixelColor, fPSDepth);
+			}
+			if(false == bPixelShaded)
+			{
+				// COMMENT : Pixel got killed
+				CORE3D_STATISTIC(++rkContext.kStatistics.uiKilledPixels);
+				return;
+			}
+
+			// COMMENT : Passed depth test and pixel was not killed, so update depth buffer
+			if(true == rkContext.kRenderInfo.bDepthWrite)
+			{
+				*pfDepthData = pkVSOutput->kPosition.z;
+			}
+
+			// COMMENT : Write the new color to the color buffer
+			if(true == rkContext.kRenderInfo.bColorWrite)
+			{
+				switch(rkContext.kRenderInfo.uiColorFloats)
+				{
+				case 4: pfFrameData[3] = kPixelColor.a;
+				case 3: pfFrameData[2] = kPixelColor.b;
+				case 2: pfFrameData[1] = kPixelColor.g;
+				case 1: pfFrameData[0] = kPixelColor.r;
+				}
+			}
+		}
+		StencilPass(rkContext, uiX, uiY);
+		++rkContext.kRenderInfo.uiRenderedPixels;
+	}
+
+	void Device::DrawPixelColorDepth(RenderContext& rkContext, UINT32 uiX, UINT32 uiY, const VertexShaderOutput* pkVSOutput)
+	{
+		FLOAT32* pfFrameData = rkContext.kRenderInfo.pfFrameData + (uiY * rkContext.kRenderInfo.uiColorBufferPitch + uiX * rkContext.kRenderInfo.uiColorFloats);
+		FLOAT32* pfDepthData = rkContext.kRenderInfo.pfDepthData + (uiY * rkContext.kRenderInfo.uiDepthBufferPitch + uiX);
+
+		// COMMENT : Read in current pixel's color in the color buffer
+		Vector4 kPixelColor(0.0f, 0.0f, 0.0f, 1.0f);
+		switch(rkContext.kRenderInfo.uiColorFloats)
+		{
+		case 4: kPixelColor.a = pfFrameData[3];
+		case 3: kPixelColor.b = pfFrameData[2];
+		case 2: kPixelColor.g = pfFrameData[1];
+		case 1: kPixelColor.r = pfFrameData[0];
+		}
+
+		// COMMENT : Execute the pixel shader
+		FLOAT32 fPSDepth = pkVSOutput->kPosition.z; // If we passed pkVSOutput->kPosition.z directly to the pixel shader,
+													// It might modify it, which is not allowed in this function.
+		rkContext.kTriangleInfo.uiCurrentPixelX = uiX;
+		rkContext.kTriangleInfo.uiCurrentPixelY = uiY;
+
+		CORE3D_STATISTIC(++rkContext.kStatistics.uiShadedPixels);
+		bool bPixelShaded;
+		{
+			ProfileStageScope kProfileStage(rkContext, PST_PIXELSHADING);
+			bPixelShaded = m_pkPixelShader->Execute(pkVSOutput->kShaderOutputs, kPixelColor, fPSDepth);
+		}
+		if(false == bPixelShaded)
+		{
+			// COMMENT : Pixel got killed
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiKilledPixels);
+			return;
+		}
+
+		// COMMENT : Perform depth test
+		CORE3D_STATISTIC(++rkContext.kStatistics.uiDepthTestedPixels);
+		if(false == DepthTest(rkContext.kRenderInfo.eDepthCompare, fPSDepth, pfDepthData))
+		{
+			StencilDepthFail(rkContext, uiX, uiY);
+			return;
+		}
+		CORE3D_STATISTIC(++rkContext.kStatistics.uiDepthPassedPixels);
+
+		// COMMENT : Passed depth test and pixel was not killed, so update depth buffer
+		if(true == rkContext.kRenderInfo.bDepthWrite)
+		{
+			*pfDepthData = fPSDepth;
+		}
+
+		// COMMENT : Write the new color to the color buffer
+		if(true == rkContext.kRenderInfo.bColorWrite)
+		{
+			switch(rkContext.kRenderInfo.uiColorFloats)
+			{
+			case 4: pfFrameData[3] = kPixelColor.a;
+			case 3: pfFrameData[2] = kPixelColor.b;
+			case 2: pfFrameData[1] = kPixelColor.g;
+			case 1: pfFrameData[0] = kPixelColor.r;
+			}
+		}
+		StencilPass(rkContext, uiX, uiY);
+		++rkContext.kRenderInfo.uiRenderedPixels;
+	}
+
+	void Device::DrawPixelDepthOnly(RenderContext& rkContext, UINT32 uiX, UINT32 uiY, const VertexShaderOutput* pkVSOutput)
+	{
+		FLOAT32* pfDepthData = rkContext.kRenderInfo.pfDepthData + (uiY * rkContext.kRenderInfo.uiDepthBufferPitch + uiX);
+
+		// COMMENT : Perform depth test
+		CORE3D_STATISTIC(++rkContext.kStatistics.uiDepthTestedPixels);
+		if(false == DepthTest(rkContext.kRenderInfo.eDepthCompare, pkVSOutput->kPosition.z, pfDepthData))
+		{
+			StencilDepthFail(rkContext, uiX, uiY);
+			return;
+		}
+		CORE3D_STATISTIC(++rkContext.kStatistics.uiDepthPassedPixels);
+
+		// COMMENT : Passed depth test - update depth buffer
+		if(true == rkContext.kRenderInfo.bDepthWrite)
+		{
+			*pfDepthData = pkVSOutput->kPosition.z;
+		}
+
+		if(NULL != rkContext.kRenderInfo.puiVisibilityData)
+		{
+			// COMMENT : Single pixels are interpolated at their position, their span starts there
+			rkContext.kRenderInfo.puiVisibilityData[uiY * rkContext.kRenderInfo.uiVisibilityPitch + uiX]	= rkContext.uiVisibilityID;
+			rkContext.kRenderInfo.puiVisibilitySpans[uiY * rkContext.kRenderInfo.uiVisibilityPitch + uiX]	= uiX;
+		}
+		StencilPass(rkContext, uiX, uiY);
+		++rkContext.kRenderInfo.uiRenderedPixels;
+	}
+
+	// COMMENT : Pixel shaders which output colors only are executed for the pixels passing the depth test, others
+	// before their depth is tested.
+	void Device::RasterizeScanlineColors(RenderContext& rkContext, UINT32 uiY, UINT32 uiX, UINT32 uiX2, VertexShaderOutput* pkVSOutput)
+	{
+		FLOAT32* pfDepthData		= rkContext.kRenderInfo.pfDepthData + (uiY * rkContext.kRenderInfo.uiDepthBufferPitch + uiX);
+		const bool bDepthTested		= (PSO_COLORONLY == m_pkPixelShader->GetShaderOutput());
+
+		for( ; uiX < uiX2; ++uiX, ++pfDepthData, StepXVSOutputFromGradient(rkContext, pkVSOutput))
+		{
+			// COMMENT : Get depth of current pixel
+			const FLOAT32 fDepth = pkVSOutput->kPosition.z;
+			if(true == bDepthTested)
+			{
+				CORE3D_STATISTIC(++rkContext.kStatistics.uiDepthTestedPixels);
+				if(false == DepthTest(rkContext.kRenderInfo.eDepthCompare, fDepth, pfDepthData)) {StencilDepthFail(rkContext, uiX, uiY); continue;}
+				CORE3D_STATISTIC(++rkContext.kStatistics.uiDepthPassedPixels);
+			}
+
+			SetPixelShaderInput(rkContext, pkVSOutput);
+			ShadePixelColors(rkContext, uiX, uiY, rkContext.kPixelShaderInput.kShaderOutputs, fDepth, pfDepthData, bDepthTested);
+		}
+	}
+
+	void Device::DrawPixelColors(RenderContext& rkContext, UINT32 uiX, UINT32 uiY, const VertexShaderOutput* pkVSOutput)
+	{
+		FLOAT32* pfDepthData	= rkContext.kRenderInfo.pfDepthData + (uiY * rkContext.kRenderInfo.uiDepthBufferPitch + uiX);
+		const bool bDepthTested	= (PSO_COLORONLY == m_pkPixelShader->GetShaderOutput());
+		if(true == bDepthTested)
+		{
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiDepthTestedPixels);
+			if(false == DepthTest(rkContext.kRenderInfo.eDepthCompare, pkVSOutput->kPosition.z, pfDepthData)) {StencilDepthFail(rkContext, uiX, uiY); return;}
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiDepthPassedPixels);
+		}
+
+		rkContext.kTriangleInfo.uiCurrentPixelY = uiY;
+		ShadePixelColors(rkContext, uiX, uiY, pkVSOutput->kShaderOutputs, pkVSOutput->kPosition.z, pfDepthData, bDepthTested);
+	}
+
+	// COMMENT : Executes the pixel shader with the pixel's colors of all color-buffers and writes the ones it returns.
+	// The depth the pixel shader returns is tested unless the pixel's depth has been tested already.
+	void Device::ShadePixelColors(RenderContext& rkContext, UINT32 uiX, UINT32 uiY, const ShaderReg* pkInput, FLOAT32 fDepth, 
+		FLOAT32* pfDepthData, bool bDepthTested)
+	{
+		const RenderInfo& rkRenderInfo = rkContext.kRenderInfo;
+
+		// NOTE: The pixel shader input only contains valid register data, position etc. are not initialized
+		// Read in current pixel's colors in the color-buffers
+		Vector4 akPixelColors[MAX_COLOR_BUFFERS];
+		for(UINT32 uiIndex = 0; uiIndex < rkRenderInfo.uiColorBuffers; ++uiIndex)
+		{
+			const FLOAT32* pfFrameData = rkRenderInfo.apfColorData[uiIndex] + (uiY * rkRenderInfo.auiColorBufferPitches[uiIndex] + uiX * rkRenderInfo.auiColorFloats[uiIndex]);
+			Vector4& rkPixelColor = akPixelColors[uiIndex];
+			rkPixelColor = Vector4(0.0f, 0.0f, 0.0f, 1.0f);
+			switch(rkRenderInfo.auiColorFloats[uiIndex])
+			{
+			case 4: rkPixelColor.a = pfFrameData[3];
+			case 3: rkPixelColor.b = pfFrameData[2];
+			case 2: rkPixelColor.g = pfFrameData[1];
+			case 1: rkPixelColor.r = pfFrameData[0];
+			}
+		}
+
+		// COMMENT : Execute the pixel shader
+		rkContext.kTriangleInfo.uiCurrentPixelX = uiX;
+		CORE3D_STATISTIC(++rkContext.kStatistics.uiShadedPixels);
+		bool bPixelShaded;
+		{
+			ProfileStageScope kProfileStage(rkContext, PST_PIXELSHADING);
+			bPixelShaded = m_pkPixelShader->ExecuteColors(pkInput, akPixelColors, fDepth);
+		}
+		if(false == bPixelShaded)
+		{
+			// COMMENT : Pixel got killed
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiKilledPixels);
+			return;
+		}
+
+		// COMMENT : Perform depth test with the pixel shader's depth
+		if(false == bDepthTested)
+		{
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiDepthTestedPixels);
+			if(false == DepthTest(rkRenderInfo.eDepthCompare, fDepth, pfDepthData)) {StencilDepthFail(rkContext, uiX, uiY); return;}
+			CORE3D_STATISTIC(++rkContext.kStatistics.uiDepthPassedPixels);
+		}
+
+		// COMMENT : Passed depth test and pixel was not killed, so update depth buffer
+		if(true == rkRenderInfo.bDepthWrite)
+		{
+			*pfDepthData = fDepth;
+		}
+
+		// COMMENT : Write the new colors to the color-buffers
+		if(true == rkRenderInfo.bColorWrite)
+		{
+			for(UINT32 uiIndex = 0; uiIndex < rkRenderInfo.uiColorBuffers; ++uiIndex)
+			{
+				FLOAT32* pfFrameData = rkRenderInfo.apfColorData[uiIndex] + (uiY * rkRenderInfo.auiColorBufferPitches[uiIndex] + uiX * rkRenderInfo.auiColorFloats[uiIndex]);
+				const Vector4& rkPixelColor = akPixelColors[uiIndex];
+				switch(rkRenderInfo.auiColorFloats[uiIndex])
+				{
+				case 4: pfFrameData[3] = rkPixelColor.a;
+				case 3: pfFrameData[2] = rkPixelColor.b;
+				case 2: pfFrameData[1] = rkPixelColor.g;
+				case 1: pfFrameData[0] = rkPixelColor.r;
+				}
+			}
+		}
+		StencilPass(rkContext, uiX, uiY);
+		++rkContext.kRenderInfo.uiRenderedPixels;
+	}
+
+	// COMMENT : Unlocks the first uiColorBuffers color-buffers of the render-target, which are locked for drawing
+	void Device::UnlockColorBuffers(UINT32 uiColorBuffers)
+	{
+		for(UINT32 uiIndex = 0; uiIndex < uiColorBuffers; ++uiIndex)
+		{
+			Surface* pkColorBuffer = m_pkRenderTarget->GetColorBuffer(uiIndex);
+			if(NULL != pkColorBuffer) {pkColorBuffer->UnlockRect();}
+			CORE3D_SAFE_RELEASE(pkColorBuffer);
+		}
+	}
 }
\ No newline at end of file
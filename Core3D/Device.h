@@ -1,231 +1,317 @@
-#pragma once
-//////////////////////////////////////////////////////////////////////////
-// Core3D : Software Graphic API
-// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
-//////////////////////////////////////////////////////////////////////////
-
-#include "Core3DTypes.h"
-
-namespace Core3D
-{
-	class Object;
-	class PresentTarget;
-	class VertexFormat;
-	class PrimitiveAssembler;
-	class VertexShader;
-	class TriangleShader;
-	class PixelShader;
-	class IndexBuffer;
-	class RenderTarget;
-	class VertexBuffer;
-	class BaseTexture;
-	class Surface;
-	class Texture;
-	class CubeTexture;
-	class Volume;
-	class VolumeTexture;
-	class Device : public RefObject
-	{
-	public:
-		Object* GetObject();
-		const DeviceParameters& GetDeviceParameters();
-		Result	Present(RenderTarget* pkRenderTarget);
-		
-		Result	DrawPrimitive(PrimitiveType ePrimitiveType, UINT32 uiStartVertex, UINT32 uiPrimitiveCount);
-		Result	DrawIndexedPrimitive(PrimitiveType ePrimitiveType, UINT32 uiBaseVertexIndex, UINT32 uiMinIndex, 
-			UINT32 uiNumVertices, UINT32 uiStartIndex, UINT32 uiPrimitiveCount);
-		Result	DrawDynamicPrimitive(UINT uiStartVertex, UINT32 uiNumVertices);
-		
-		Result	CreateVertexFormat(VertexFormat** ppkVertexFormat, const VertexElement* pkVertexDeclaration, UINT32 uiVertexDeclSize);
-		Result	CreateIndexBuffer(IndexBuffer** ppkIndexBuffer, UINT32 uiLength, Format eFormat);
-		Result	CreateVertexBuffer(VertexBuffer** ppkVertexBuffer, UINT32 uiLength);
-		Result	CreateSurface(Surface** ppkSurface, UINT32 uiWidth, UINT32 uiHeight, Format eFormat);
-		Result	CreateTexture(Texture** ppkTexture, UINT32 uiWidth, UINT32 uiHeight, UINT32 uiMipLevels, Format eFormat);
-		Result	CreateCubeTexture(CubeTexture** ppkCubeTexture, UINT32 uiEdgeLength, UINT32 uiMipLevels, Format eFormat);
-		Result	CreateVolume(Volume** ppkVolume, UINT32 uiWidth, UINT32 uiHeight, UINT32 uiDepth, Format eFormat);
-		Result	CreateVolumeTexture(VolumeTexture** ppkVolumeTexture, UINT32 uiWidth, UINT32 uiHeight, UINT32 uiDepth, 
-			UINT32 uiMipLevels, Format eFormat);
-		Result	CreateRenderTarget(RenderTarget** ppkRenderTarget);
-		
-		Result	SetRenderState(RenderState eRenderState, UINT32 uiValue);
-		Result	GetRenderState(RenderState eRenderState, UINT32& ruiValue);
-		
-		Result	SetVertexFormat(VertexFormat* pkVertexFormat);
-		VertexFormat* GetVertexFormat();
-
-		void	SetPrimitiveAssembler(PrimitiveAssembler* pkPrimitiveAsembler);
-		PrimitiveAssembler* GetPrimitiveAssembler();
-
-		Result SetVertexShader(VertexShader* pkVertexShader);
-		VertexShader* GetVertexShader();
-
-		void	SetTriangleShader(TriangleShader* pkTriangleShader);
-		TriangleShader* GetTriangleShader();
-
-		Result	SetPixelShader(PixelShader* pkPixelShader);
-		PixelShader* GetPixelShader();
-
-		Result	SetIndexBuffer(IndexBuffer* pkIndexBuffer);
-		IndexBuffer* GetIndexBuffer();
-
-		Result	SetVertexStream(UINT32 uiStreamNumber, VertexBuffer* pkVertexBuffer, UINT32 uiOffset, UINT32 uiStride);
-		Result	GetVertexStream(UINT32 uiStreamNumber, VertexBuffer** ppkVertexBuffer, UINT32& ruiOffset, UINT32& ruiStride);
-
-		Result	SetTexture(UINT32 uiSamplerNumber, BaseTexture* pkTexture);
-		Result	GetTexture(UINT32 uiSamplerNumber, BaseTexture** ppkTexture);
-
-		Result	SetTextureSamplerState(UINT32 uiSamplerNumber, TextureSamplerState eTextureSamplerState, UINT32 uiState);
-		Result	GetTextureSamplerState(UINT32 uiSamplerNumber, TextureSamplerState eTextureSamplerState, UINT32& ruiState);
-
-		Result	SampleTexture(Vector4& rkColor, UINT32 uiSamplerNumber, FLOAT32 fU, FLOAT32 fV, FLOAT32 fW, 
-			const Vector4* pkXGradient, const Vector4* pkYGradient);
-
-		void	SetRenderTarget(RenderTarget* pkRenderTarget);
-		RenderTarget* GetRenderTarget();
-
-		Result	SetScissorRect(const Rect& rcScissorRect);
-		Rect	GetScissorRect();
-
-		Result	SetDepthBounds(FLOAT32 fMinZ, FLOAT32 fMaxZ);
-		void	GetDepthBounds(FLOAT32& rfMinZ, FLOAT32& rfMaxZ);
-
-		Result	SetClippingPlane(ClippingPlanes eIndex, const Plane* pkPlane);
-		Result	GetClippingPlane(ClippingPlanes eIndex, Plane& rkPlane);
-
-		UINT32	GetRenderedPixels();
-	private:
-		void	SetDefaultRenderStates();
-		void	SetDefaultTextureSamplerStates();
-		void	SetDefaultClippingPlanes();
-
-		Result	PreRender();
-		void	PostRender();
-
-		Result	DecodeVertexStream(VertexShaderInput& rkVertexShaderInput, UINT32 uiVertex);
-		Result	FetchVertex(VertexCacheEntry** ppkVertex, UINT32 uiVertex);
-
-		void	ProcessTriangle(const VertexShaderOutput* pkVSOutput0, 
-			const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2);
-
-		void	InterpolateVertexShaderInput(VertexShaderInput* pkVSInput, const VertexShaderInput* pkVSInputA, 
-			const VertexShaderInput* pkVSInputB, FLOAT32 fInterpolation);
-		void	InterpolateVertexShaderOutput(VertexShaderOutput* pkVSOutput, const VertexShaderOutput* pkVSOutputA, 
-			const VertexShaderOutput* pkVSOutputB, FLOAT32 fInterpolation);
-
-		void	MultiplyVertexShaderOutputRegisters(VertexShaderOutput* pkDest, const VertexShaderOutput* pkSrc, FLOAT32 fVal);
-
-		void	SubdivideTriangleSimple(UINT32 uiSubdivisionLevel, const VertexShaderOutput* pkVSOutput0, 
-			const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2);
-		void	SubdivideTriangleSmooth(UINT32 uiSubdivisionLevel, const VertexShaderOutput* pkVSOutput0, 
-			const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2);
-		void	SubdivideTriangleAdaptive(const VertexShaderOutput* pkVSOutput0, const VertexShaderOutput* pkVSOutput1, 
-			const VertexShaderOutput* pkVSOutput2);
-
-		void	SubdivideTriangleAdaptiveSubdivideEdges(UINT32 uiSubdivisionLevel, 
-			const VertexShaderOutput* pkVSOutputEdge0, const VertexShaderOutput* pkVSOutputEdge1, 
-			const VertexShaderOutput* pkVSOutputCenter);
-		void	SubdivideTriangleAdaptiveSubdivideInnerPart(UINT32 uiSubdivisionLevel, 
-			const VertexShaderOutput* pkVSOutput0, const VertexShaderOutput* pkVSOutput1, 
-			const VertexShaderOutput* pkVSOutput2);
-
-		UINT32	ClipToPlane(UINT32 uiNumVertices, UINT32 uiStage, const Plane& rkPlane, bool bHomogenous);
-
-		void	DrawTriangle(const VertexShaderOutput* pkVSOutput0, const VertexShaderOutput* pkVSOutput1, 
-			const VertexShaderOutput* pkVSOutput2);
-
-		bool	CullTriangle(const VertexShaderOutput* pkVSOutput0, 
-			const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2);
-
-		void	ProjectVertex(VertexShaderOutput* pkVSOutput);
-
-		void	CalculateTriangleGradients(const VertexShaderOutput* pkVSOutput0, 
-			const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2);
-		void	SetVSOutputFromGradient(VertexShaderOutput* pkVSOutput, FLOAT32 fX, FLOAT32 fY);
-		void	StepXVSOutputFromGradient(VertexShaderOutput* pkVSOutput);
-
-		void	RasterizeTriangle(const VertexShaderOutput* pkVSOutput0, 
-			const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2);
-		void	RasterizeLine(const VertexShaderOutput* pkVSOutput0, const VertexShaderOutput* pkVSOutput1);
-		void	RasterizeScanlineColorOnly(UINT32 uiY, UINT32 uiX, UINT32 uiX2, VertexShaderOutput* pkVSOutput);
-		void	RasterizeScanlineColorOnlyMightKillPixels(UINT32 uiY, UINT32 uiX, UINT32 uiX2, 
-			VertexShaderOutput* pkVSOutput);
-		void	RasterizeScanlineColorDepth(UINT32 uiY, UINT32 uiX, UINT32 uiX2, VertexShaderOutput* pkVSOutput);
-
-		void	DrawPixelColorOnly(UINT32 uiX, UINT32 uiY, const VertexShaderOutput* pkVSOutput);
-		void	DrawPixelColorDepth(UINT32 uiX, UINT32 uiY, const VertexShaderOutput* pkVSOutput);
-	protected:
-		friend class Object;
-
-		Device(Object* pkParent, const DeviceParameters* pkDeviceParameters);
-		~Device();
-
-		Result Create();
-	private:
-		struct VertexStream
-		{
-			VertexBuffer*	pkVertexBuffer;
-			UINT32			uiOffset;
-			UINT32			uiStride;
-		};
-
-		struct TextureSampler
-		{
-			BaseTexture*		pkTexture;
-			UINT32				auiTexureSamplerStates[TSS_NUMTEXTURESAMPLERSTATES];
-			TextureSampleInput	eTextureSampleInput;
-		};
-
-		struct RenderInfo
-		{
-			ShaderRegType	aeVSInputs[VERTEX_SHADER_REGISTERS];
-			ShaderRegType	aeVSOutputs[PIXEL_SHADER_REGISTERS];
-
-			FLOAT32*		pfFrameData;
-			UINT32			uiColorFloats;
-			UINT32			uiColorBufferPitch;
-			bool			bColorWrite;
-
-			FLOAT32*		pfDepthData;
-			UINT32			uiDepthBufferPitch;
-			CmpFunc			eDepthCompare;
-			bool			bDepthWrite;
-
-			void (Device::*pfnRasterizeScanLine)(UINT32, UINT32, UINT32, VertexShaderOutput*);
-			void (Device::*pfnDrawPixel)(UINT32, UINT32, const VertexShaderOutput*);
-
-			UINT32			uiRenderedPixels;
-			Rect			rcViewportRect;
-			Plane			akClippingPlanes[CP_NUMPLANES];
-			bool			abClippingPlaneEnabled[CP_NUMPLANES];
-			Plane			akScissorPlanes[4];
-		};
-	private:
-		Object*				m_pkParent;
-		DeviceParameters	m_kDeviceParameters;
-		PresentTarget*		m_pkPresentTarget;
-		UINT32				m_auiRenderStates[RS_NUMRENDERSTATES];
-
-		VertexFormat*		m_pkVertexFormat;
-		PrimitiveAssembler*	m_pkPrimitiveAssembler;
-		VertexShader*		m_pkVertexShader;
-		TriangleShader*		m_pkTriangleShader;
-		PixelShader*		m_pkPixelShader;
-		IndexBuffer*		m_pkIndexBuffer;
-
-		VertexStream		m_akVertexStreams[MAX_VERTEX_STREAMS];
-		TextureSampler		m_akTextureSamplers[MAX_TEXTURE_SAMPLERS];
-
-		RenderTarget*		m_pkRenderTarget;
-		Rect				m_rcScissorRect;
-
-		RenderInfo			m_kRenderInfo;
-		TriangleInfo		m_kTriangleInfo;
-		UINT32				m_uiNumValidCacheEntries;
-		UINT32				m_uiFetchedVertices;
-		VertexCacheEntry	m_akVertexCache[VERTEX_CACH_SIZE];
-
-		VertexShaderOutput	m_akClipVertices[20];
-		UINT32				m_uiNextFreeClipVertex;
-		VertexShaderOutput*	m_aapkClipVertices[2][20];
-	};
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+#include "RenderContext.h"
+#include "JobSystem.h"
+#include "Profiler.h"
+#include <vector>
+
+namespace Core3D
+{
+	class Object;
+	class PresentTarget;
+	class SwapChain;
+	class VertexFormat;
+	class PrimitiveAssembler;
+	class VertexShader;
+	class TriangleShader;
+	class PixelShader;
+	class IndexBuffer;
+	class RenderTarget;
+	class VertexBuffer;
+	class BaseTexture;
+	class Surface;
+	class Texture;
+	class CubeTexture;
+	class Volume;
+	class VolumeTexture;
+	class CommandList;
+	class FrameCapture;
+	class Device : public RefObject
+	{
+	public:
+		Object* GetObject();
+		const DeviceParameters& GetDeviceParameters();
+		Result	Present(RenderTarget* pkRenderTarget);
+		Result	SetPresentConversion(const PresentConversion& rkConversion);
+		const PresentConversion& GetPresentConversion();
+		Surface* GetBackBuffer();
+		UINT32	GetPresentedFrames();
+		Result	WaitForPresent();
+
+		JobSystem* GetJobSystem();
+		Profiler* GetProfiler();
+
+		// COMMENT : Writes all draws until the next Present() to a file together with the states and resource contents
+		// they use, for replaying them with FrameReplay. Draws are considerably slower while capturing.
+		Result	CaptureNextFrame(const char* szFileName);
+		
+		Result	DrawPrimitive(PrimitiveType ePrimitiveType, UINT32 uiStartVertex, UINT32 uiPrimitiveCount);
+		Result	DrawIndexedPrimitive(PrimitiveType ePrimitiveType, UINT32 uiBaseVertexIndex, UINT32 uiMinIndex, 
+			UINT32 uiNumVertices, UINT32 uiStartIndex, UINT32 uiPrimitiveCount);
+		Result	DrawDynamicPrimitive(UINT32 uiStartVertex, UINT32 uiNumVertices);
+
+		// COMMENT : Applies the list's states and draws in recorded order, the states stay set afterwards.
+		// Consecutive draws without state changes in between are validated once.
+		Result	ExecuteCommandList(CommandList* pkCommandList);
+
+		// COMMENT : Until the pass is resolved, draws writing colors into the current render-target only write depth and
+		// the ids of their visible triangles. Their pixel shaders run once per visible pixel in the resolve, which shades
+		// each draw's pixels in parallel, one strip of rows per job. Those shaders have to output colors only and mustn't kill pixels; they are
+		// handed the colors from before the pass. Depth-only draws and draws into other render-targets render as usual, so do draws
+		// whose shaders might blend(PixelShader::MightBlendColors()) once the draws before them have been shaded.
+		Result	BeginVisibilityPass();
+		Result	ResolveVisibilityPass();
+		
+		Result	CreateVertexFormat(VertexFormat** ppkVertexFormat, const VertexElement* pkVertexDeclaration, UINT32 uiVertexDeclSize);
+		Result	CreateIndexBuffer(IndexBuffer** ppkIndexBuffer, UINT32 uiLength, Format eFormat);
+		Result	CreateVertexBuffer(VertexBuffer** ppkVertexBuffer, UINT32 uiLength);
+		Result	CreateSurface(Surface** ppkSurface, UINT32 uiWidth, UINT32 uiHeight, Format eFormat);
+		Result	CreateTexture(Texture** ppkTexture, UINT32 uiWidth, UINT32 uiHeight, UINT32 uiMipLevels, Format eFormat);
+		Result	CreateCubeTexture(CubeTexture** ppkCubeTexture, UINT32 uiEdgeLength, UINT32 uiMipLevels, Format eFormat);
+		Result	CreateVolume(Volume** ppkVolume, UINT32 uiWidth, UINT32 uiHeight, UINT32 uiDepth, Format eFormat);
+		Result	CreateVolumeTexture(VolumeTexture** ppkVolumeTexture, UINT32 uiWidth, UINT32 uiHeight, UINT32 uiDepth, 
+			UINT32 uiMipLevels, Format eFormat);
+		Result	CreateRenderTarget(RenderTarget** ppkRenderTarget);
+		Result	CreateCommandList(CommandList** ppkCommandList);
+		
+		Result	SetRenderState(RenderState eRenderState, UINT32 uiValue);
+		Result	GetRenderState(RenderState eRenderState, UINT32& ruiValue);
+		
+		Result	SetVertexFormat(VertexFormat* pkVertexFormat);
+		VertexFormat* GetVertexFormat();
+
+		void	SetPrimitiveAssembler(PrimitiveAssembler* pkPrimitiveAsembler);
+		PrimitiveAssembler* GetPrimitiveAssembler();
+
+		Result SetVertexShader(VertexShader* pkVertexShader);
+		VertexShader* GetVertexShader();
+
+		void	SetTriangleShader(TriangleShader* pkTriangleShader);
+		TriangleShader* GetTriangleShader();
+
+		Result	SetPixelShader(PixelShader* pkPixelShader);
+		PixelShader* GetPixelShader();
+
+		Result	SetIndexBuffer(IndexBuffer* pkIndexBuffer);
+		IndexBuffer* GetIndexBuffer();
+
+		Result	SetVertexStream(UINT32 uiStreamNumber, VertexBuffer* pkVertexBuffer, UINT32 uiOffset, UINT32 uiStride);
+		Result	GetVertexStream(UINT32 uiStreamNumber, VertexBuffer** ppkVertexBuffer, UINT32& ruiOffset, UINT32& ruiStride);
+
+		Result	SetTexture(UINT32 uiSamplerNumber, BaseTexture* pkTexture);
+		Result	GetTexture(UINT32 uiSamplerNumber, BaseTexture** ppkTexture);
+
+		Result	SetTextureSamplerState(UINT32 uiSamplerNumber, TextureSamplerState eTextureSamplerState, UINT32 uiState);
+		Result	GetTextureSamplerState(UINT32 uiSamplerNumber, TextureSamplerState eTextureSamplerState, UINT32& ruiState);
+
+		Result	SampleTexture(Vector4& rkColor, UINT32 uiSamplerNumber, FLOAT32 fU, FLOAT32 fV, FLOAT32 fW, 
+			const Vector4* pkXGradient, const Vector4* pkYGradient);
+
+		void	SetRenderTarget(RenderTarget* pkRenderTarget);
+		RenderTarget* GetRenderTarget();
+
+		Result	SetScissorRect(const Rect& rcScissorRect);
+		Rect	GetScissorRect();
+
+		Result	SetDepthBounds(FLOAT32 fMinZ, FLOAT32 fMaxZ);
+		void	GetDepthBounds(FLOAT32& rfMinZ, FLOAT32& rfMaxZ);
+
+		Result	SetClippingPlane(ClippingPlanes eIndex, const Plane* pkPlane);
+		Result	GetClippingPlane(ClippingPlanes eIndex, Plane& rkPlane);
+
+		UINT32	GetRenderedPixels();
+
+		// COMMENT : Counters of the pipeline stages, INVALID_STATE if they aren't compiled in(see CORE3D_PIPELINE_STATISTICS).
+		Result	GetPipelineStatistics(PipelineStatistics& rkStatistics, PipelineStatisticsRange eRange);
+		void	ResetPipelineStatistics();
+	private:
+		void	SetDefaultRenderStates();
+		void	SetDefaultTextureSamplerStates();
+		void	SetDefaultClippingPlanes();
+
+		Result	PreRender(RenderContext& rkContext);
+		void	PostRender(RenderContext& rkContext);
+		void	AddPipelineStatistics(const PipelineStatistics& rkStatistics);
+
+		void	AddVisibilityDraw(RenderContext& rkContext);
+		UINT32	AddVisibilityPolygon(RenderContext& rkContext, VertexShaderOutput** ppkVertices, UINT32 uiNumVertices);
+		void	ReleaseVisibilityDraw(UINT32 uiDraw);
+		void	ClearVisibilityDraws();
+		void	ReleaseVisibilityPass();
+		Result	ShadeVisibilityPass();
+		static void ResolveVisibilityStrips(void* pvResolve, UINT32 uiBeginStrip, UINT32 uiEndStrip);
+		inline UINT32 GetVisibilityStrip(UINT32 uiPixel) const
+		{
+			return uiPixel / m_uiVisibilityPitch / VISIBILITY_STRIP_ROWS;
+		}
+
+		Result	DecodeVertexStream(VertexShaderInput& rkVertexShaderInput, UINT32 uiVertex);
+		Result	FetchVertex(RenderContext& rkContext, VertexCacheEntry** ppkVertex, UINT32 uiVertex);
+
+		Result	ProcessPrimitives(RenderContext& rkContext, PrimitiveType ePrimitiveType, UINT32 uiStartVertex, UINT32 uiPrimitiveCount);
+		Result	ProcessIndexedPrimitives(RenderContext& rkContext, PrimitiveType ePrimitiveType, UINT32 uiBaseVertexIndex, 
+			UINT32 uiStartIndex, UINT32 uiPrimitiveCount);
+		Result	ProcessDynamicPrimitives(RenderContext& rkContext, UINT32 uiNumVertices);
+
+		void	ProcessTriangle(RenderContext& rkContext, const VertexCacheEntry* pkVertex0, 
+			const VertexCacheEntry* pkVertex1, const VertexCacheEntry* pkVertex2);
+
+		void	InterpolateVertexShaderInput(RenderContext& rkContext, VertexShaderInput* pkVSInput, const VertexShaderInput* pkVSInputA, 
+			const VertexShaderInput* pkVSInputB, FLOAT32 fInterpolation);
+		void	InterpolateVertexShaderOutput(RenderContext& rkContext, VertexShaderOutput* pkVSOutput, const VertexShaderOutput* pkVSOutputA, 
+			const VertexShaderOutput* pkVSOutputB, FLOAT32 fInterpolation);
+
+		void	MultiplyVertexShaderOutputRegisters(RenderContext& rkContext, VertexShaderOutput* pkDest, const VertexShaderOutput* pkSrc, FLOAT32 fVal);
+		void	CopyVertexShaderOutputRegisters(VertexShaderOutput* pkDest, const VertexShaderOutput* pkSrc, const ShaderRegType* peRegisters);
+		void	SetPixelShaderInput(RenderContext& rkContext, const VertexShaderOutput* pkVSOutput);
+
+		void	SubdivideTriangleSimple(RenderContext& rkContext, UINT32 uiSubdivisionLevel, const SubdivisionVertex* pkVertex0, 
+			const SubdivisionVertex* pkVertex1, const SubdivisionVertex* pkVertex2);
+		void	SubdivideTriangleSmooth(RenderContext& rkContext, UINT32 uiSubdivisionLevel, const SubdivisionVertex* pkVertex0, 
+			const SubdivisionVertex* pkVertex1, const SubdivisionVertex* pkVertex2);
+		void	SubdivideTriangleAdaptive(RenderContext& rkContext, const SubdivisionVertex* pkVertex0, const SubdivisionVertex* pkVertex1, 
+			const SubdivisionVertex* pkVertex2);
+
+		void	SubdivideTriangleAdaptiveSubdivideEdges(RenderContext& rkContext, UINT32 uiSubdivisionLevel, 
+			const SubdivisionVertex* pkVertexEdge0, const SubdivisionVertex* pkVertexEdge1, 
+			const SubdivisionVertex* pkVertexCenter);
+		void	SubdivideTriangleAdaptiveSubdivideInnerPart(RenderContext& rkContext, UINT32 uiSubdivisionLevel, 
+			const SubdivisionVertex* pkVertex0, const SubdivisionVertex* pkVertex1, 
+			const SubdivisionVertex* pkVertex2);
+
+		UINT32	ClipToPlane(RenderContext& rkContext, UINT32 uiNumVertices, UINT32 uiStage, const Plane& rkPlane, bool bHomogenous);
+
+		void	DrawTriangle(RenderContext& rkContext, const VertexShaderOutput* pkVSOutput0, const VertexShaderOutput* pkVSOutput1, 
+			const VertexShaderOutput* pkVSOutput2);
+
+		bool	CullTriangle(const VertexShaderOutput* pkVSOutput0, 
+			const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2);
+
+		void	ProjectVertex(RenderContext& rkContext, VertexShaderOutput* pkVSOutput);
+
+		void	CalculateTriangleGradients(RenderContext& rkContext, const VertexShaderOutput* pkVSOutput0, 
+			const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2);
+		void	SetVSOutputFromGradient(RenderContext& rkContext, VertexShaderOutput* pkVSOutput, FLOAT32 fX, FLOAT32 fY);
+		void	StepXVSOutputFromGradient(RenderContext& rkContext, VertexShaderOutput* pkVSOutput);
+
+		void	RasterizeTriangle(RenderContext& rkContext, const VertexShaderOutput* pkVSOutput0, 
+			const VertexShaderOutput* pkVSOutput1, const VertexShaderOutput* pkVSOutput2);
+		void	RasterizeTriangleScanline(RenderContext& rkContext, INT32 iY, INT32 iX, INT32 iX2);
+		void	RasterizeStencilScanline(RenderContext& rkContext, UINT32 uiY, UINT32 uiX, UINT32 uiX2);
+		void	RasterizeScanlineRun(RenderContext& rkContext, UINT32 uiY, UINT32 uiX, UINT32 uiX2);
+		void	RasterizeLine(RenderContext& rkContext, const VertexShaderOutput* pkVSOutput0, const VertexShaderOutput* pkVSOutput1);
+		void	RasterizeScanlineColorOnly(RenderContext& rkContext, UINT32 uiY, UINT32 uiX, UINT32 uiX2, VertexShaderOutput* pkVSOutput);
+		void	RasterizeScanlineColorOnlyMightKillPixels(RenderContext& rkContext, UINT32 uiY, UINT32 uiX, UINT32 uiX2, 
+			VertexShaderOutput* pkVSOutput);
+		void	RasterizeScanlineColorDepth(RenderContext& rkContext, UINT32 uiY, UINT32 uiX, UINT32 uiX2, VertexShaderOutput* pkVSOutput);
+		void	RasterizeScanlineDepthOnly(RenderContext& rkContext, UINT32 uiY, UINT32 uiX, UINT32 uiX2, VertexShaderOutput* pkVSOutput);
+
+		void	DrawLinePixel(RenderContext& rkContext, UINT32 uiX, UINT32 uiY, const VertexShaderOutput* pkVSOutput);
+		void	DrawPixelColorOnly(RenderContext& rkContext, UINT32 uiX, UINT32 uiY, const VertexShaderOutput* pkVSOutput);
+		void	DrawPixelColorDepth(RenderContext& rkContext, UINT32 uiX, UINT32 uiY, const VertexShaderOutput* pkVSOutput);
+		void	DrawPixelDepthOnly(RenderContext& rkContext, UINT32 uiX, UINT32 uiY, const VertexShaderOutput* pkVSOutput);
+
+		void	RasterizeScanlineColors(RenderContext& rkContext, UINT32 uiY, UINT32 uiX, UINT32 uiX2, VertexShaderOutput* pkVSOutput);
+		void	DrawPixelColors(RenderContext& rkContext, UINT32 uiX, UINT32 uiY, const VertexShaderOutput* pkVSOutput);
+		void	ShadePixelColors(RenderContext& rkContext, UINT32 uiX, UINT32 uiY, const ShaderReg* pkInput, FLOAT32 fDepth, 
+			FLOAT32* pfDepthData, bool bDepthTested);
+		void	UnlockColorBuffers(UINT32 uiColorBuffers);
+	protected:
+		friend class Object;
+		friend class FrameCapture;
+
+		Device(Object* pkParent, const DeviceParameters* pkDeviceParameters);
+		~Device();
+
+		Result Create();
+	private:
+		struct VertexStream
+		{
+			VertexBuffer*	pkVertexBuffer;
+			UINT32			uiOffset;
+			UINT32			uiStride;
+		};
+
+		struct TextureSampler
+		{
+			BaseTexture*		pkTexture;
+			UINT32				auiTexureSamplerStates[TSS_NUMTEXTURESAMPLERSTATES];
+			TextureSampleInput	eTextureSampleInput;
+		};
+
+		// COMMENT : Draw of a visibility pass together with the states its pixels are shaded with
+		struct VisibilityDraw
+		{
+			RenderInfo		kRenderInfo;
+			PixelShader*	pkPixelShader;
+			FLOAT32			afConstants[NUM_SHADER_CONSTANTS];		// The pixel shader's constants at the time of the draw
+			Vector4			akConstants[NUM_SHADER_CONSTANTS];
+			Matrix4x4		amatConstants[NUM_SHADER_CONSTANTS];
+			TextureSampler	akTextureSamplers[MAX_TEXTURE_SAMPLERS];
+		};
+
+		// COMMENT : The vertices index the recorded ones, which are projected and have their perspective registers multiplied by 1 / W
+		struct VisibilityTriangle
+		{
+			UINT32			uiDraw;
+			UINT32			auiVertices[3];
+		};
+
+		// COMMENT : Shades the pixels of one draw in the resolve. The contexts are kept for the draws after it.
+		struct VisibilityResolve
+		{
+			Device*						pkDevice;
+			const VisibilityDraw*		pkDraw;
+			const UINT32*				puiPixels;			// Visible pixels of the draw, by strip and triangle
+			const UINT32*				puiStrips;			// Starts of the draw's strips with visible pixels, followed by their end
+			FLOAT32*					pfFrameData;
+			PipelineStatistics			kStatistics;
+			std::vector<RenderContext*>	vecContexts;		// Contexts no job is shading with
+			Mutex						kLock;				// Guards the statistics and the contexts
+		};
+
+	private:
+		Object*				m_pkParent;
+		DeviceParameters	m_kDeviceParameters;
+		JobSystem			m_kJobSystem;
+		Profiler			m_kProfiler;
+		PresentTarget*		m_pkPresentTarget;
+		SwapChain*			m_pkSwapChain;
+		PresentConversion	m_kPresentConversion;
+		UINT32				m_auiRenderStates[RS_NUMRENDERSTATES];
+
+		VertexFormat*		m_pkVertexFormat;
+		PrimitiveAssembler*	m_pkPrimitiveAssembler;
+		VertexShader*		m_pkVertexShader;
+		TriangleShader*		m_pkTriangleShader;
+		PixelShader*		m_pkPixelShader;
+		IndexBuffer*		m_pkIndexBuffer;
+
+		VertexStream		m_akVertexStreams[MAX_VERTEX_STREAMS];
+		TextureSampler		m_akTextureSamplers[MAX_TEXTURE_SAMPLERS];
+
+		RenderTarget*		m_pkRenderTarget;
+		Rect				m_rcScissorRect;
+
+		RenderInfo			m_kRenderInfo;			// States set through the device, copied into the context when drawing
+		RenderContext		m_kRenderContext;
+
+		FrameCapture*		m_pkFrameCapture;		// Frame which is currently captured
+
+		bool				m_bVisibilityPass;
+		RenderTarget*		m_pkVisibilityTarget;
+		UINT32				m_uiVisibilityPitch;
+		std::vector<UINT32>				m_vecVisibilityIDs;			// Per pixel of the color-buffer, 0 where no triangle is visible
+		std::vector<UINT32>				m_vecVisibilitySpans;		// Per pixel with a triangle, see RenderInfo::puiVisibilitySpans
+		std::vector<VisibilityDraw>		m_vecVisibilityDraws;
+		std::vector<VisibilityTriangle>	m_vecVisibilityTriangles;	// The triangle with id N is at N - 1
+		std::vector<VertexShaderOutput>	m_vecVisibilityVertices;
+
+		PipelineStatistics	m_akPipelineStatistics[PSR_NUMRANGES];
+		PipelineStatistics	m_kFrameStatistics;		// Draws since the last Present()
+	};
 }
\ No newline at end of file
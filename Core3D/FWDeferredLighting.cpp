@@ -0,0 +1,372 @@
+#include "FWDeferredLighting.h"
+#include "FWApplication.h"
+#include "FWGraphics.h"
+#include "FWCamera.h"
+#include "FWScene.h"
+#include "FWLight.h"
+#include <float.h>
+
+namespace Core3D
+{
+	FWDeferredLighting::FWDeferredLighting(FWScene* pkScene)
+	{
+		m_pkScene			= pkScene;
+		m_uiNumLights		= 0;
+		m_uiLightStride		= 0;
+
+		for(UINT32 uiLayer = 0; uiLayer < GBUFFER_LAYERS; ++uiLayer) {m_apfGBuffer[uiLayer] = NULL;}
+		m_pfColorData		= NULL;
+		m_uiColorFloats		= 0;
+		m_uiWidth			= 0;
+		m_uiHeight			= 0;
+		m_uiTilesX			= 0;
+
+		m_uiNumTiles		= 0;
+		m_iNumTileLights	= 0;
+	}
+
+	FWDeferredLighting::~FWDeferredLighting()
+	{
+
+	}
+
+	Result FWDeferredLighting::Render(FWCamera* pkCamera)
+	{
+		RenderTarget* pkGBuffer = (NULL != pkCamera) ? pkCamera->GetGBuffer() : NULL;
+		if(NULL == pkGBuffer)
+		{
+			CORE3D_ERROR(_T("FWDeferredLighting::Render() - Camera doesn't have a G-buffer.\n"));
+			return INVALID_STATE;
+		}
+
+		Device* pkDevice = m_pkScene->GetApplication()->GetGraphics()->GetDevice();
+		ProfileScope kProfileScope(pkDevice->GetProfiler(), "FWDeferredLighting::Render");
+
+		// COMMENT : Lock the G-buffer and the camera's color-buffer, which is the last one
+		Surface* apkSurfaces[GBUFFER_LAYERS + 1];
+		for(UINT32 uiLayer = 0; uiLayer < GBUFFER_LAYERS; ++uiLayer) {apkSurfaces[uiLayer] = pkGBuffer->GetColorBuffer(uiLayer);}
+		apkSurfaces[GBUFFER_LAYERS] = pkCamera->GetRenderTarget()->GetColorBuffer();
+
+		// COMMENT : The tiles read four floats per pixel of every layer, at the offsets of the color-buffer's pixels
+		Result eResult = OK;
+		if(NULL == apkSurfaces[GBUFFER_LAYERS] || apkSurfaces[GBUFFER_LAYERS]->GetFormatFloats() < 3)
+		{
+			CORE3D_ERROR(_T("FWDeferredLighting::Render() - Invalid color-buffer format (Only FMT_R32G32B32F and FMT_R32G32B32A32F are supported).\n"));
+			eResult = INVALID_FORMAT;
+		}
+
+		for(UINT32 uiLayer = 0; OK == eResult && uiLayer < GBUFFER_LAYERS; ++uiLayer)
+		{
+			if(NULL == apkSurfaces[uiLayer])
+			{
+				CORE3D_ERROR(_T("FWDeferredLighting::Render() - G-buffer doesn't have all layers attached.\n"));
+				eResult = INVALID_STATE;
+			}
+			else if(FMT_R32G32B32A32F != apkSurfaces[uiLayer]->GetFormat())
+			{
+				CORE3D_ERROR(_T("FWDeferredLighting::Render() - Invalid G-buffer format (Only FMT_R32G32B32A32F is supported).\n"));
+				eResult = INVALID_FORMAT;
+			}
+			else if( (apkSurfaces[uiLayer]->GetWidth() != apkSurfaces[GBUFFER_LAYERS]->GetWidth()) ||
+				(apkSurfaces[uiLayer]->GetHeight() != apkSurfaces[GBUFFER_LAYERS]->GetHeight()) )
+			{
+				CORE3D_ERROR(_T("FWDeferredLighting::Render() - G-buffer's dimensions don't match color-buffer.\n"));
+				eResult = INVALID_STATE;
+			}
+		}
+
+		UINT32 uiLocked		= 0;
+		for(; OK == eResult && uiLocked <= GBUFFER_LAYERS; ++uiLocked)
+		{
+			FLOAT32* pfData = NULL;
+			if(CORE3D_FAILED(apkSurfaces[uiLocked]->LockRect((void**)&pfData, NULL)))
+			{
+				CORE3D_ERROR(_T("FWDeferredLighting::Render() - Couldn't access G-buffer or color-buffer.\n"));
+				eResult = UNKNOWN;
+				break;
+			}
+
+			if(GBUFFER_LAYERS == uiLocked)	{m_pfColorData = pfData;}
+			else							{m_apfGBuffer[uiLocked] = pfData;}
+		}
+
+		if(OK == eResult)
+		{
+			Surface* pkColorBuffer	= apkSurfaces[GBUFFER_LAYERS];
+			m_uiColorFloats			= pkColorBuffer->GetFormatFloats();
+			m_uiWidth				= pkColorBuffer->GetWidth();
+			m_uiHeight				= pkColorBuffer->GetHeight();
+			m_uiTilesX				= (m_uiWidth + TILE_SIZE - 1) / TILE_SIZE;
+			m_uiNumTiles			= m_uiTilesX * ((m_uiHeight + TILE_SIZE - 1) / TILE_SIZE);
+			m_iNumTileLights		= 0;
+
+			m_kMatView				= pkCamera->GetViewMatrix();
+			m_kMatProjection		= pkCamera->GetProjectionMatrix();
+			m_kMatViewport			= pkCamera->GetRenderTarget()->GetViewportMatrix();
+			m_kCameraPosition		= pkCamera->GetPosition();
+			m_kAmbientLightColor	= m_pkScene->GetAmbientLightColor();
+
+			PrepareLights(pkCamera);
+
+			JobSystem* pkJobSystem = pkDevice->GetJobSystem();
+			if(NULL != pkJobSystem)	{pkJobSystem->ParallelFor(LightTilesJob, this, 0, m_uiNumTiles);}
+			else					{LightTilesJob(this, 0, m_uiNumTiles);}
+		}
+
+		for(UINT32 uiSurface = 0; uiSurface < uiLocked; ++uiSurface) {apkSurfaces[uiSurface]->UnlockRect();}
+		for(UINT32 uiSurface = 0; uiSurface <= GBUFFER_LAYERS; ++uiSurface) {CORE3D_SAFE_RELEASE(apkSurfaces[uiSurface]);}
+
+		for(UINT32 uiLayer = 0; uiLayer < GBUFFER_LAYERS; ++uiLayer) {m_apfGBuffer[uiLayer] = NULL;}
+		m_pfColorData = NULL;
+		return eResult;
+	}
+
+	void FWDeferredLighting::PrepareLights(FWCamera* pkCamera)
+	{
+		const UINT32 uiSceneLights	= m_pkScene->GetNumLights();
+		m_uiLightStride				= (uiSceneLights + 3) & ~3;
+		m_uiNumLights				= 0;
+		m_vecLights.assign(LIGHT_STREAMS * m_uiLightStride, 0.0f);
+		if(0 == m_uiLightStride) {return;}
+
+		// COMMENT : Padding lights have a negative range, which fails every culling test
+		FLOAT32* pfLights = &m_vecLights[0];
+		for(UINT32 uiLight = 0; uiLight < m_uiLightStride; ++uiLight) {pfLights[LIGHT_RANGE * m_uiLightStride + uiLight] = -FLT_MAX;}
+
+		// COMMENT : Keep the lights whose range reaches into the view-distance
+		for(UINT32 uiSceneLight = 0; uiSceneLight < uiSceneLights; ++uiSceneLight)
+		{
+			const FWLight* pkLight		= m_pkScene->GetLightFromNum(uiSceneLight);
+			const FLOAT32 fRange		= pkLight->GetRange();
+			if(fRange <= 0.0f) {continue;}
+
+			const Vector3& rkPosition	= pkLight->GetPosition();
+			const Vector3 kViewPosition	= rkPosition * m_kMatView;
+			if( (kViewPosition.z + fRange < pkCamera->GetNearClippingPlane()) ||
+				(kViewPosition.z - fRange > pkCamera->GetViewDistance()) )
+			{
+				continue;
+			}
+
+			const Vector4& rkColor		= pkLight->GetColor();
+			FLOAT32* pfLight			= &pfLights[m_uiNumLights++];
+			pfLight[LIGHT_VIEWX * m_uiLightStride]		= kViewPosition.x;
+			pfLight[LIGHT_VIEWY * m_uiLightStride]		= kViewPosition.y;
+			pfLight[LIGHT_VIEWZ * m_uiLightStride]		= kViewPosition.z;
+			pfLight[LIGHT_RANGE * m_uiLightStride]		= fRange;
+			pfLight[LIGHT_X * m_uiLightStride]			= rkPosition.x;
+			pfLight[LIGHT_Y * m_uiLightStride]			= rkPosition.y;
+			pfLight[LIGHT_Z * m_uiLightStride]			= rkPosition.z;
+			pfLight[LIGHT_INVRANGESQ * m_uiLightStride]	= 1.0f / (fRange * fRange);
+			pfLight[LIGHT_R * m_uiLightStride]			= rkColor.r;
+			pfLight[LIGHT_G * m_uiLightStride]			= rkColor.g;
+			pfLight[LIGHT_B * m_uiLightStride]			= rkColor.b;
+		}
+	}
+
+	void FWDeferredLighting::LightTilesJob(void* pvDeferredLighting, UINT32 uiFirstTile, UINT32 uiEndTile)
+	{
+		FWDeferredLighting* pkDeferredLighting = (FWDeferredLighting*)pvDeferredLighting;
+		for(UINT32 uiTile = uiFirstTile; uiTile < uiEndTile; ++uiTile) {pkDeferredLighting->LightTile(uiTile);}
+	}
+
+	void FWDeferredLighting::LightTile(UINT32 uiTile)
+	{
+		// COMMENT : The tile's pixels in streams, four pixels of a row per group. Rows have TILE_SIZE pixels,
+		// those outside of the surface or not written by the geometry pass are masked out.
+		enum PixelStream
+		{
+			PIXEL_X = 0, PIXEL_Y, PIXEL_Z,					// World-space position
+			PIXEL_NX, PIXEL_NY, PIXEL_NZ,					// Normal
+			PIXEL_VX, PIXEL_VY, PIXEL_VZ,					// Direction to the camera
+			PIXEL_ALBEDOR, PIXEL_ALBEDOG, PIXEL_ALBEDOB,
+			PIXEL_SPECULAR, PIXEL_POWER,
+			PIXEL_R, PIXEL_G, PIXEL_B,						// Accumulated light
+			PIXEL_STREAMS
+		};
+		const UINT32 GROUPS = TILE_SIZE * TILE_SIZE / 4;
+		__m128 akPixels[PIXEL_STREAMS][GROUPS];
+		INT32 aiCovered[GROUPS];
+
+		const UINT32 uiLeft		= (uiTile % m_uiTilesX) * TILE_SIZE;
+		const UINT32 uiTop		= (uiTile / m_uiTilesX) * TILE_SIZE;
+		const UINT32 uiRight	= (uiLeft + TILE_SIZE < m_uiWidth) ? (uiLeft + TILE_SIZE) : m_uiWidth;
+		const UINT32 uiBottom	= (uiTop + TILE_SIZE < m_uiHeight) ? (uiTop + TILE_SIZE) : m_uiHeight;
+
+		// COMMENT : Gather the pixels, finding the depth bounds of the tile in view-space
+		FLOAT32 fMinDepth = FLT_MAX, fMaxDepth = -FLT_MAX;
+		for(UINT32 uiGroup = 0; uiGroup < GROUPS; ++uiGroup)
+		{
+			aiCovered[uiGroup]		= 0;
+			const UINT32 uiY		= uiTop + (uiGroup * 4) / TILE_SIZE;
+			if(uiY >= uiBottom) {continue;}
+
+			for(UINT32 uiLane = 0; uiLane < 4; ++uiLane)
+			{
+				const UINT32 uiX	= uiLeft + (uiGroup * 4) % TILE_SIZE + uiLane;
+				const UINT32 uiOffset = (uiY * m_uiWidth + uiX) * 4;
+				FLOAT32 afPixel[PIXEL_STREAMS] = {0.0f};
+				if(uiX < uiRight && m_apfGBuffer[GBUFFER_POSITION][uiOffset + 3] > 0.0f)
+				{
+					const FLOAT32* pfAlbedo		= &m_apfGBuffer[GBUFFER_ALBEDO][uiOffset];
+					const FLOAT32* pfNormal		= &m_apfGBuffer[GBUFFER_NORMAL][uiOffset];
+					const FLOAT32* pfPosition	= &m_apfGBuffer[GBUFFER_POSITION][uiOffset];
+					const Vector3 kPosition(pfPosition[0], pfPosition[1], pfPosition[2]);
+					Vector3 kNormal(pfNormal[0], pfNormal[1], pfNormal[2]);
+					Vector3 kView = m_kCameraPosition - kPosition;
+					kNormal.Normalize();
+					kView.Normalize();
+
+					afPixel[PIXEL_X]		= kPosition.x;	afPixel[PIXEL_Y]		= kPosition.y;	afPixel[PIXEL_Z]		= kPosition.z;
+					afPixel[PIXEL_NX]		= kNormal.x;	afPixel[PIXEL_NY]		= kNormal.y;	afPixel[PIXEL_NZ]		= kNormal.z;
+					afPixel[PIXEL_VX]		= kView.x;		afPixel[PIXEL_VY]		= kView.y;		afPixel[PIXEL_VZ]		= kView.z;
+					afPixel[PIXEL_ALBEDOR]	= pfAlbedo[0];	afPixel[PIXEL_ALBEDOG]	= pfAlbedo[1];	afPixel[PIXEL_ALBEDOB]	= pfAlbedo[2];
+					afPixel[PIXEL_SPECULAR]	= pfAlbedo[3];
+					afPixel[PIXEL_POWER]	= pfNormal[3];
+
+					// COMMENT : Start with the ambient light
+					afPixel[PIXEL_R]		= pfAlbedo[0] * m_kAmbientLightColor.r;
+					afPixel[PIXEL_G]		= pfAlbedo[1] * m_kAmbientLightColor.g;
+					afPixel[PIXEL_B]		= pfAlbedo[2] * m_kAmbientLightColor.b;
+
+					const FLOAT32 fDepth	= kPosition.x * m_kMatView._13 + kPosition.y * m_kMatView._23 + kPosition.z * m_kMatView._33 + m_kMatView._43;
+					if(fDepth < fMinDepth) {fMinDepth = fDepth;}
+					if(fDepth > fMaxDepth) {fMaxDepth = fDepth;}
+					aiCovered[uiGroup] |= 1 << uiLane;
+				}
+
+				for(UINT32 uiStream = 0; uiStream < PIXEL_STREAMS; ++uiStream)
+				{
+					reinterpret_cast<FLOAT32*>(&akPixels[uiStream][uiGroup])[uiLane] = afPixel[uiStream];
+				}
+			}
+		}
+		if(fMinDepth > fMaxDepth) {return;}
+
+		// COMMENT : Side planes of the tile's frustum in view-space. The projection maps view-space to clip-space,
+		// a pixel's x is inside of the left plane if x(clip) - left * w(clip) >= 0 with left in normalized device coordinates.
+		const FLOAT32 fLeft		= (static_cast<FLOAT32>(uiLeft) - m_kMatViewport._41) / m_kMatViewport._11;
+		const FLOAT32 fRight	= (static_cast<FLOAT32>(uiRight) - m_kMatViewport._41) / m_kMatViewport._11;
+		const FLOAT32 fTop		= (static_cast<FLOAT32>(uiTop) - m_kMatViewport._42) / m_kMatViewport._22;
+		const FLOAT32 fBottom	= (static_cast<FLOAT32>(uiBottom) - m_kMatViewport._42) / m_kMatViewport._22;
+		const Matrix4x4& rkProj	= m_kMatProjection;
+		Vector4 akPlanes[4] =
+		{
+			Vector4(rkProj._11 - fLeft * rkProj._14, rkProj._21 - fLeft * rkProj._24, rkProj._31 - fLeft * rkProj._34, rkProj._41 - fLeft * rkProj._44),
+			Vector4(fRight * rkProj._14 - rkProj._11, fRight * rkProj._24 - rkProj._21, fRight * rkProj._34 - rkProj._31, fRight * rkProj._44 - rkProj._41),
+			Vector4(rkProj._12 - fBottom * rkProj._14, rkProj._22 - fBottom * rkProj._24, rkProj._32 - fBottom * rkProj._34, rkProj._42 - fBottom * rkProj._44),
+			Vector4(fTop * rkProj._14 - rkProj._12, fTop * rkProj._24 - rkProj._22, fTop * rkProj._34 - rkProj._32, fTop * rkProj._44 - rkProj._42)
+		};
+		for(UINT32 uiPlane = 0; uiPlane < 4; ++uiPlane)
+		{
+			Vector4& rkPlane = akPlanes[uiPlane];
+			rkPlane *= 1.0f / sqrtf(rkPlane.x * rkPlane.x + rkPlane.y * rkPlane.y + rkPlane.z * rkPlane.z);
+		}
+
+		const __m128 ZERO		= _mm_setzero_ps();
+		const __m128 ONE		= _mm_set1_ps(1.0f);
+		const __m128 EPSILON	= _mm_set1_ps(1e-12f);
+		const __m128 MIN_DEPTH	= _mm_set1_ps(fMinDepth);
+		const __m128 MAX_DEPTH	= _mm_set1_ps(fMaxDepth);
+
+		const FLOAT32* pfLights	= m_vecLights.empty() ? NULL : &m_vecLights[0];
+		UINT32 uiTileLights		= 0;
+		for(UINT32 uiFirstLight = 0; uiFirstLight < m_uiNumLights; uiFirstLight += 4)
+		{
+			// COMMENT : Test four range spheres at once against the tile's depth bounds and side planes
+			const __m128 VIEWX	= _mm_loadu_ps(&pfLights[LIGHT_VIEWX * m_uiLightStride + uiFirstLight]);
+			const __m128 VIEWY	= _mm_loadu_ps(&pfLights[LIGHT_VIEWY * m_uiLightStride + uiFirstLight]);
+			const __m128 VIEWZ	= _mm_loadu_ps(&pfLights[LIGHT_VIEWZ * m_uiLightStride + uiFirstLight]);
+			const __m128 RANGE	= _mm_loadu_ps(&pfLights[LIGHT_RANGE * m_uiLightStride + uiFirstLight]);
+			const __m128 NEG_RANGE = _mm_sub_ps(ZERO, RANGE);
+
+			__m128 VISIBLE = _mm_and_ps(_mm_cmpge_ps(_mm_add_ps(VIEWZ, RANGE), MIN_DEPTH), _mm_cmple_ps(_mm_sub_ps(VIEWZ, RANGE), MAX_DEPTH));
+			for(UINT32 uiPlane = 0; uiPlane < 4; ++uiPlane)
+			{
+				const Vector4& rkPlane	= akPlanes[uiPlane];
+				const __m128 DISTANCE	= _mm_add_ps(_mm_add_ps(_mm_mul_ps(VIEWX, _mm_set1_ps(rkPlane.x)), _mm_mul_ps(VIEWY, _mm_set1_ps(rkPlane.y))),
+					_mm_add_ps(_mm_mul_ps(VIEWZ, _mm_set1_ps(rkPlane.z)), _mm_set1_ps(rkPlane.w)));
+				VISIBLE = _mm_and_ps(VISIBLE, _mm_cmpge_ps(DISTANCE, NEG_RANGE));
+			}
+
+			const INT32 iVisible = _mm_movemask_ps(VISIBLE);
+			if(0 == iVisible) {continue;}
+
+			for(UINT32 uiLight = uiFirstLight; uiLight < uiFirstLight + 4; ++uiLight)
+			{
+				if(0 == (iVisible & (1 << (uiLight - uiFirstLight)))) {continue;}
+				++uiTileLights;
+
+				const __m128 LIGHTX		= _mm_set1_ps(pfLights[LIGHT_X * m_uiLightStride + uiLight]);
+				const __m128 LIGHTY		= _mm_set1_ps(pfLights[LIGHT_Y * m_uiLightStride + uiLight]);
+				const __m128 LIGHTZ		= _mm_set1_ps(pfLights[LIGHT_Z * m_uiLightStride + uiLight]);
+				const __m128 INVRANGESQ	= _mm_set1_ps(pfLights[LIGHT_INVRANGESQ * m_uiLightStride + uiLight]);
+				const __m128 LIGHTR		= _mm_set1_ps(pfLights[LIGHT_R * m_uiLightStride + uiLight]);
+				const __m128 LIGHTG		= _mm_set1_ps(pfLights[LIGHT_G * m_uiLightStride + uiLight]);
+				const __m128 LIGHTB		= _mm_set1_ps(pfLights[LIGHT_B * m_uiLightStride + uiLight]);
+
+				for(UINT32 uiGroup = 0; uiGroup < GROUPS; ++uiGroup)
+				{
+					if(0 == aiCovered[uiGroup]) {continue;}
+
+					// COMMENT : Attenuation falls off smoothly to 0 at the light's range
+					const __m128 DX			= _mm_sub_ps(LIGHTX, akPixels[PIXEL_X][uiGroup]);
+					const __m128 DY			= _mm_sub_ps(LIGHTY, akPixels[PIXEL_Y][uiGroup]);
+					const __m128 DZ			= _mm_sub_ps(LIGHTZ, akPixels[PIXEL_Z][uiGroup]);
+					const __m128 DISTSQ		= _mm_add_ps(_mm_add_ps(_mm_mul_ps(DX, DX), _mm_mul_ps(DY, DY)), _mm_mul_ps(DZ, DZ));
+					__m128 ATTENUATION		= _mm_max_ps(_mm_sub_ps(ONE, _mm_mul_ps(DISTSQ, INVRANGESQ)), ZERO);
+					ATTENUATION				= _mm_mul_ps(ATTENUATION, ATTENUATION);
+
+					const __m128 NX			= akPixels[PIXEL_NX][uiGroup];
+					const __m128 NY			= akPixels[PIXEL_NY][uiGroup];
+					const __m128 NZ			= akPixels[PIXEL_NZ][uiGroup];
+					const __m128 INVDIST	= _mm_rsqrt_ps(_mm_max_ps(DISTSQ, EPSILON));
+					const __m128 NDOTL		= _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(NX, DX), _mm_mul_ps(NY, DY)), _mm_mul_ps(NZ, DZ)), INVDIST);
+					const __m128 LIT		= _mm_and_ps(_mm_cmpgt_ps(NDOTL, ZERO), _mm_cmpgt_ps(ATTENUATION, ZERO));
+					if(0 == _mm_movemask_ps(LIT)) {continue;}
+
+					// COMMENT : Blinn-Phong specular, using Schlick's approximation t / (n - n * t + t) of pow(t, n)
+					const __m128 HX			= _mm_add_ps(_mm_mul_ps(DX, INVDIST), akPixels[PIXEL_VX][uiGroup]);
+					const __m128 HY			= _mm_add_ps(_mm_mul_ps(DY, INVDIST), akPixels[PIXEL_VY][uiGroup]);
+					const __m128 HZ			= _mm_add_ps(_mm_mul_ps(DZ, INVDIST), akPixels[PIXEL_VZ][uiGroup]);
+					const __m128 HALFSQ		= _mm_add_ps(_mm_add_ps(_mm_mul_ps(HX, HX), _mm_mul_ps(HY, HY)), _mm_mul_ps(HZ, HZ));
+					const __m128 NDOTH		= _mm_max_ps(_mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(NX, HX), _mm_mul_ps(NY, HY)), _mm_mul_ps(NZ, HZ)),
+						_mm_rsqrt_ps(_mm_max_ps(HALFSQ, EPSILON))), ZERO);
+					const __m128 POWER		= akPixels[PIXEL_POWER][uiGroup];
+					const __m128 SPECULAR	= _mm_div_ps(NDOTH, _mm_max_ps(_mm_add_ps(_mm_sub_ps(POWER, _mm_mul_ps(POWER, NDOTH)), NDOTH), EPSILON));
+
+					const __m128 SCALE		= _mm_and_ps(LIT, ATTENUATION);
+					const __m128 DIFFUSE	= _mm_mul_ps(NDOTL, SCALE);
+					const __m128 SHINE		= _mm_mul_ps(_mm_mul_ps(SPECULAR, akPixels[PIXEL_SPECULAR][uiGroup]), SCALE);
+
+					akPixels[PIXEL_R][uiGroup] = _mm_add_ps(akPixels[PIXEL_R][uiGroup], _mm_mul_ps(LIGHTR, _mm_add_ps(_mm_mul_ps(akPixels[PIXEL_ALBEDOR][uiGroup], DIFFUSE), SHINE)));
+					akPixels[PIXEL_G][uiGroup] = _mm_add_ps(akPixels[PIXEL_G][uiGroup], _mm_mul_ps(LIGHTG, _mm_add_ps(_mm_mul_ps(akPixels[PIXEL_ALBEDOG][uiGroup], DIFFUSE), SHINE)));
+					akPixels[PIXEL_B][uiGroup] = _mm_add_ps(akPixels[PIXEL_B][uiGroup], _mm_mul_ps(LIGHTB, _mm_add_ps(_mm_mul_ps(akPixels[PIXEL_ALBEDOB][uiGroup], DIFFUSE), SHINE)));
+				}
+			}
+		}
+		AtomicAdd(&m_iNumTileLights, static_cast<INT32>(uiTileLights));
+
+		// COMMENT : Write the lit pixels, the others keep the color the camera has been cleared to
+		for(UINT32 uiGroup = 0; uiGroup < GROUPS; ++uiGroup)
+		{
+			if(0 == aiCovered[uiGroup]) {continue;}
+
+			const UINT32 uiY		= uiTop + (uiGroup * 4) / TILE_SIZE;
+			const UINT32 uiX		= uiLeft + (uiGroup * 4) % TILE_SIZE;
+			const FLOAT32* pfR		= reinterpret_cast<const FLOAT32*>(&akPixels[PIXEL_R][uiGroup]);
+			const FLOAT32* pfG		= reinterpret_cast<const FLOAT32*>(&akPixels[PIXEL_G][uiGroup]);
+			const FLOAT32* pfB		= reinterpret_cast<const FLOAT32*>(&akPixels[PIXEL_B][uiGroup]);
+			FLOAT32* pfColor		= &m_pfColorData[(uiY * m_uiWidth + uiX) * m_uiColorFloats];
+			for(UINT32 uiLane = 0; uiLane < 4; ++uiLane, pfColor += m_uiColorFloats)
+			{
+				if(0 == (aiCovered[uiGroup] & (1 << uiLane))) {continue;}
+
+				pfColor[0] = pfR[uiLane];
+				pfColor[1] = pfG[uiLane];
+				pfColor[2] = pfB[uiLane];
+				if(4 == m_uiColorFloats) {pfColor[3] = 1.0f;}
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Framework Library for Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+#include "FWType.h"
+#include <vector>
+
+namespace Core3D
+{
+	class FWScene;
+	class FWCamera;
+
+	// COMMENT : Color-buffers of a camera's G-buffer(see FWCamera::CreateGBuffer()). The pixel shaders of the geometry
+	// pass write all of them with ExecuteColors(), the buffers are cleared to 0 before.
+	enum GBufferLayer
+	{
+		GBUFFER_ALBEDO = 0,		// rgb : Diffuse color, a : Specular intensity
+		GBUFFER_NORMAL,			// xyz : World-space normal, w : Specular power
+		GBUFFER_POSITION,		// xyz : World-space position, w : 1 where the geometry pass wrote the pixel
+		GBUFFER_LAYERS
+	};
+
+	// COMMENT : Lights a camera's G-buffer with the point-lights of the scene, writing into the camera's color-buffer.
+	// The screen is split into tiles, every tile tests the lights' range spheres against its frustum, bounded by the
+	// nearest and farthest pixel it contains. Tiles are lit in parallel, four pixels at a time, by the lights they see.
+	class FWDeferredLighting
+	{
+	protected:
+		friend class FWScene;
+
+		FWDeferredLighting(FWScene* pkScene);
+		~FWDeferredLighting();
+	public:
+		enum {TILE_SIZE = 16};	// Multiple of 4
+
+		// COMMENT : The G-buffer's layers have to be FMT_R32G32B32A32F and as large as the camera's color-buffer
+		Result		Render(FWCamera* pkCamera);
+
+		// COMMENT : Statistics of the last Render()
+		inline UINT32	GetNumTiles()					const	{return m_uiNumTiles;}
+		inline UINT32	GetNumTileLights()				const	{return static_cast<UINT32>(m_iNumTileLights);}
+	private:
+		// COMMENT : Lights are stored in streams of m_uiLightStride floats each, padded with lights no tile sees
+		enum LightStream
+		{
+			LIGHT_VIEWX = 0,	// View-space position for the culling
+			LIGHT_VIEWY,
+			LIGHT_VIEWZ,
+			LIGHT_RANGE,
+			LIGHT_X,			// World-space position for the lighting
+			LIGHT_Y,
+			LIGHT_Z,
+			LIGHT_INVRANGESQ,
+			LIGHT_R,
+			LIGHT_G,
+			LIGHT_B,
+			LIGHT_STREAMS
+		};
+
+		void		PrepareLights(FWCamera* pkCamera);
+		void		LightTile(UINT32 uiTile);
+		static void	LightTilesJob(void* pvDeferredLighting, UINT32 uiFirstTile, UINT32 uiEndTile);
+	private:
+		FWScene*				m_pkScene;
+
+		std::vector<FLOAT32>	m_vecLights;
+		UINT32					m_uiNumLights;
+		UINT32					m_uiLightStride;
+
+		// COMMENT : State of the current Render()
+		const FLOAT32*			m_apfGBuffer[GBUFFER_LAYERS];
+		FLOAT32*				m_pfColorData;
+		UINT32					m_uiColorFloats;
+		UINT32					m_uiWidth;
+		UINT32					m_uiHeight;
+		UINT32					m_uiTilesX;
+		Matrix4x4				m_kMatView;
+		Matrix4x4				m_kMatProjection;
+		Matrix4x4				m_kMatViewport;
+		Vector3					m_kCameraPosition;
+		Vector4					m_kAmbientLightColor;
+
+		UINT32					m_uiNumTiles;
+		volatile INT32			m_iNumTileLights;
+	};
+}
\ No newline at end of file
@@ -1,10 +1,10 @@
-#include "FWEntity.h"
-#include "FWScene.h"
-
-namespace Core3D
-{
-	FWScene* FWEntity::GetScene()
-	{
-		return m_pkScene;
-	}
+#include "FWEntity.h"
+#include "FWScene.h"
+
+namespace Core3D
+{
+	FWScene* FWEntity::GetScene()
+	{
+		return m_pkScene;
+	}
 }
\ No newline at end of file
@@ -1,25 +1,37 @@
-#pragma once
-//////////////////////////////////////////////////////////////////////////
-// Core3D : Framework Library for Software Graphic API
-// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
-//////////////////////////////////////////////////////////////////////////
-#include "FWType.h"
-
-namespace Core3D
-{
-	class FWScene;
-	class FWEntity
-	{
-	protected:
-		friend class FWScene;
-	public:
-		virtual ~FWEntity() {}
-
-		virtual bool	FrameMove()				= 0;
-		virtual void	Render(UINT32 uiPass)	= 0;
-		
-		FWScene*		GetScene();
-	protected:
-		FWScene* m_pkScene;
-	};
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Framework Library for Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+#include "FWType.h"
+
+namespace Core3D
+{
+	class FWScene;
+	class FWEntity
+	{
+	protected:
+		friend class FWScene;
+	public:
+		FWEntity() : m_bDepthPrepass(true) {}
+		virtual ~FWEntity() {}
+
+		virtual bool	FrameMove()				= 0;
+		virtual void	Render(UINT32 uiPass)	= 0;
+
+		// COMMENT : Entities may record their rendering into the command-list instead, returning true if they did.
+		// Recording runs on worker threads in parallel with other entities, so it must not change shared
+		// state(cameras, lights, shader constants). Render() is called for entities which don't record.
+		virtual bool	Record(UINT32 uiPass, CommandList* pkCommandList) {return false;}
+		
+		FWScene*		GetScene();
+
+		// COMMENT : Opaque entities take part in the depth pre-pass of cameras which render one(see FWCamera).
+		// Entities which blend, or set the depth and color-write states themselves, should leave it.
+		inline void		SetDepthPrepass(bool bDepthPrepass)				{m_bDepthPrepass = bDepthPrepass;}
+		inline bool		GetDepthPrepass()						const	{return m_bDepthPrepass;}
+	protected:
+		FWScene* m_pkScene;
+		bool	 m_bDepthPrepass;
+	};
 }
\ No newline at end of file
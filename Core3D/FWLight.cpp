@@ -1,15 +1,15 @@
-#include "FWLight.h"
-#include "FWScene.h"
-
-namespace Core3D
-{
-	FWLight::FWLight(FWScene* pkScene)
-	{
-		m_pkScene = pkScene;
-	}
-
-	FWScene* FWLight::GetScene()
-	{
-		return m_pkScene;
-	}
+#include "FWLight.h"
+#include "FWScene.h"
+
+namespace Core3D
+{
+	FWLight::FWLight(FWScene* pkScene)
+	{
+		m_pkScene = pkScene;
+	}
+
+	FWScene* FWLight::GetScene()
+	{
+		return m_pkScene;
+	}
 }
\ No newline at end of file
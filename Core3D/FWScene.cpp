@@ -1,166 +1,266 @@
-#include "FWScene.h"
-#include "FWGraphics.h"
-#include "FWApplication.h"
-#include "FWEntity.h"
-#include "FWLight.h"
-
-namespace Core3D
-{
-	FWScene::FWScene(FWApplication* pkApp)
-	{
-		m_pkApplication			= pkApp;
-		m_uiNumCreatedEntities	= 0;
-		m_uiNumCreatedLights	= 0;
-		m_uiCurrentLight		= 0;
-		SetClearColor(Vector4(0.30f, 0.25f, 0.35f, 1.0f));
-		SetAmbientLightColor(Vector4(0.0f, 0.0f, 0.0f, 1.0f));
-	}
-
-	FWScene::~FWScene()
-	{
-		while(m_vecSceneEntities.size())	{ReleaseEntity(m_vecSceneEntities.begin()->hEntity);}
-		while(m_vecSceneLights.size())		{ReleaseLight(m_vecSceneLights.begin()->hLight);}
-	}
-
-	bool FWScene::Initialize()
-	{
-		return true;
-	}
-
-	void FWScene::RegisterEntityType(tstring strTypeName, PFN_CREATEFUNCTION pfnCreateFunction)
-	{
-		m_mapRegEntityTypes[strTypeName] = pfnCreateFunction;
-	}
-
-	HENTITY FWScene::CreateEntity(tstring strTypeName, bool bSceneProcess /* = true */)
-	{
-		PFN_CREATEFUNCTION pfnCreateFunction = m_mapRegEntityTypes[strTypeName];
-		if(NULL == pfnCreateFunction)	{return 0;}
-		
-		FWEntity* pkEntity = pfnCreateFunction(this);
-		if(NULL == pkEntity)			{return 0;}
-
-		SceneEntity kNewEntity = {++m_uiNumCreatedEntities, pkEntity, bSceneProcess};
-		m_vecSceneEntities.push_back(kNewEntity);
-		return kNewEntity.hEntity;
-	}
-
-	std::vector<FWScene::SceneEntity>::iterator 
-	FWScene::GetSceneEntityIterator(HENTITY hEntity)
-	{
-		if(0 == hEntity) {return m_vecSceneEntities.end();}
-		for(std::vector<SceneEntity>::iterator iterSceneEntity = m_vecSceneEntities.begin(); 
-			iterSceneEntity != m_vecSceneEntities.end(); ++iterSceneEntity)
-		{
-			if(iterSceneEntity->hEntity == hEntity) {return iterSceneEntity;}
-		}
-		return m_vecSceneEntities.end();
-	}
-
-	void FWScene::ReleaseEntity(HENTITY hEntity)
-	{
-		std::vector<SceneEntity>::iterator iterSceneEntity = GetSceneEntityIterator(hEntity);
-		if(iterSceneEntity != m_vecSceneEntities.end())
-		{
-			UINT32 uiOldSize = static_cast<UINT32>(m_vecSceneEntities.size());
-			if(NULL != iterSceneEntity->pkEntity)
-			{
-				CORE3D_SAFE_DELETE(iterSceneEntity->pkEntity);
-			}
-			if(uiOldSize != static_cast<UINT32>(m_vecSceneEntities.size()))
-			{
-				iterSceneEntity = GetSceneEntityIterator(hEntity);
-			}
-			m_vecSceneEntities.erase(iterSceneEntity);
-		}
-	}
-
-	FWEntity* FWScene::GetEntity(HENTITY hEntity)
-	{
-		std::vector<SceneEntity>::iterator iterSceneEntity = GetSceneEntityIterator(hEntity);
-		if(iterSceneEntity != m_vecSceneEntities.end()) {return iterSceneEntity->pkEntity;}
-		return NULL;
-	}
-
-	HLIGHT FWScene::CreateLight()
-	{
-		SceneLight kNewLight = {++m_uiNumCreatedLights, new FWLight(this)};
-		m_vecSceneLights.push_back(kNewLight);
-		return kNewLight.hLight;
-	}
-
-	std::vector<FWScene::SceneLight>::iterator 
-	FWScene::GetSceneLightIterator(HLIGHT hLight)
-	{
-		if(0 == hLight) {return m_vecSceneLights.end();}
-		for(std::vector<SceneLight>::iterator iterSceneLight = m_vecSceneLights.begin(); 
-			iterSceneLight != m_vecSceneLights.end(); ++iterSceneLight)
-		{
-			if(iterSceneLight->hLight == hLight) {return iterSceneLight;}
-		}
-		return m_vecSceneLights.end();
-	}
-
-	void FWScene::ReleaseLight(HLIGHT hLight)
-	{
-		std::vector<SceneLight>::iterator iterSceneLight = GetSceneLightIterator(hLight);
-		if(iterSceneLight != m_vecSceneLights.end())
-		{
-			UINT32 uiOldSize = static_cast<UINT32>(m_vecSceneLights.size());
-			if(NULL != iterSceneLight->pkLight)
-			{
-				CORE3D_SAFE_DELETE(iterSceneLight->pkLight);
-			}
-			if(uiOldSize != static_cast<UINT32>(m_vecSceneLights.size()))
-			{
-				iterSceneLight = GetSceneLightIterator(hLight);
-			}
-			m_vecSceneLights.erase(iterSceneLight);
-		}
-	}
-
-	FWLight* FWScene::GetLight(HLIGHT hLight)
-	{
-		std::vector<SceneLight>::iterator iterSceneLight = GetSceneLightIterator(hLight);
-		if(iterSceneLight != m_vecSceneLights.end()) {return iterSceneLight->pkLight;}
-		return NULL;
-	}
-
-	void FWScene::FrameMove()
-	{
-		for(std::vector<SceneEntity>::iterator iterSceneEntity = m_vecSceneEntities.begin(); 
-			iterSceneEntity != m_vecSceneEntities.end(); ++iterSceneEntity)
-		{
-			if(false == iterSceneEntity->bSceneProcess) {continue;}
-			iterSceneEntity->pkEntity->FrameMove();
-		}
-	}
-
-	void FWScene::Render(UINT32 uiPass)
-	{
-		FWGraphics* pkGraphics = m_pkApplication->GetGraphics();
-		for(std::vector<SceneEntity>::iterator iterSceneEntity = m_vecSceneEntities.begin(); 
-			iterSceneEntity != m_vecSceneEntities.end(); ++iterSceneEntity)
-		{
-			if(false == iterSceneEntity->bSceneProcess) {continue;}
-			pkGraphics->PushStateBlock();
-			iterSceneEntity->pkEntity->Render(uiPass);
-			pkGraphics->PopStateBlock();
-		}
-	}
-
-	FWApplication* FWScene::GetApplication()
-	{
-		return m_pkApplication;
-	}
-
-	FWLight* FWScene::GetLightFromNum(UINT32 uiNum)
-	{
-		return m_vecSceneLights[uiNum].pkLight;
-	}
-
-	FWLight* FWScene::GetCurrentLight()
-	{
-		return GetLightFromNum(m_uiCurrentLight);
-	}
+#include "FWScene.h"
+#include "FWGraphics.h"
+#include "FWApplication.h"
+#include "FWCamera.h"
+#include "FWEntity.h"
+#include "FWLight.h"
+#include "FWDeferredLighting.h"
+#include <typeinfo>
+
+namespace Core3D
+{
+	FWScene::FWScene(FWApplication* pkApp)
+	{
+		m_pkApplication			= pkApp;
+		m_uiNumCreatedEntities	= 0;
+		m_uiNumCreatedLights	= 0;
+		m_uiCurrentLight		= 0;
+		m_pkDeferredLighting	= NULL;
+		m_bCommandLists			= true;
+		m_uiNumRecordedEntities	= 0;
+		SetClearColor(Vector4(0.30f, 0.25f, 0.35f, 1.0f));
+		SetAmbientLightColor(Vector4(0.0f, 0.0f, 0.0f, 1.0f));
+	}
+
+	FWScene::~FWScene()
+	{
+		while(m_vecSceneEntities.size())	{ReleaseEntity(m_vecSceneEntities.begin()->hEntity);}
+		while(m_vecSceneLights.size())		{ReleaseLight(m_vecSceneLights.begin()->hLight);}
+		CORE3D_SAFE_DELETE(m_pkDeferredLighting);
+	}
+
+	bool FWScene::Initialize()
+	{
+		m_pkDeferredLighting = new FWDeferredLighting(this);
+		return true;
+	}
+
+	void FWScene::RegisterEntityType(tstring strTypeName, PFN_CREATEFUNCTION pfnCreateFunction)
+	{
+		m_mapRegEntityTypes[strTypeName] = pfnCreateFunction;
+	}
+
+	HENTITY FWScene::CreateEntity(tstring strTypeName, bool bSceneProcess /* = true */)
+	{
+		PFN_CREATEFUNCTION pfnCreateFunction = m_mapRegEntityTypes[strTypeName];
+		if(NULL == pfnCreateFunction)	{return 0;}
+		
+		FWEntity* pkEntity = pfnCreateFunction(this);
+		if(NULL == pkEntity)			{return 0;}
+
+		SceneEntity kNewEntity = {++m_uiNumCreatedEntities, pkEntity, bSceneProcess, NULL, false};
+		m_vecSceneEntities.push_back(kNewEntity);
+		return kNewEntity.hEntity;
+	}
+
+	std::vector<FWScene::SceneEntity>::iterator 
+	FWScene::GetSceneEntityIterator(HENTITY hEntity)
+	{
+		if(0 == hEntity) {return m_vecSceneEntities.end();}
+		for(std::vector<SceneEntity>::iterator iterSceneEntity = m_vecSceneEntities.begin(); 
+			iterSceneEntity != m_vecSceneEntities.end(); ++iterSceneEntity)
+		{
+			if(iterSceneEntity->hEntity == hEntity) {return iterSceneEntity;}
+		}
+		return m_vecSceneEntities.end();
+	}
+
+	void FWScene::ReleaseEntity(HENTITY hEntity)
+	{
+		std::vector<SceneEntity>::iterator iterSceneEntity = GetSceneEntityIterator(hEntity);
+		if(iterSceneEntity != m_vecSceneEntities.end())
+		{
+			CORE3D_SAFE_RELEASE(iterSceneEntity->pkCommandList);
+			UINT32 uiOldSize = static_cast<UINT32>(m_vecSceneEntities.size());
+			if(NULL != iterSceneEntity->pkEntity)
+			{
+				CORE3D_SAFE_DELETE(iterSceneEntity->pkEntity);
+			}
+			if(uiOldSize != static_cast<UINT32>(m_vecSceneEntities.size()))
+			{
+				iterSceneEntity = GetSceneEntityIterator(hEntity);
+			}
+			m_vecSceneEntities.erase(iterSceneEntity);
+		}
+	}
+
+	FWEntity* FWScene::GetEntity(HENTITY hEntity)
+	{
+		std::vector<SceneEntity>::iterator iterSceneEntity = GetSceneEntityIterator(hEntity);
+		if(iterSceneEntity != m_vecSceneEntities.end()) {return iterSceneEntity->pkEntity;}
+		return NULL;
+	}
+
+	HLIGHT FWScene::CreateLight()
+	{
+		SceneLight kNewLight = {++m_uiNumCreatedLights, new FWLight(this)};
+		m_vecSceneLights.push_back(kNewLight);
+		return kNewLight.hLight;
+	}
+
+	std::vector<FWScene::SceneLight>::iterator 
+	FWScene::GetSceneLightIterator(HLIGHT hLight)
+	{
+		if(0 == hLight) {return m_vecSceneLights.end();}
+		for(std::vector<SceneLight>::iterator iterSceneLight = m_vecSceneLights.begin(); 
+			iterSceneLight != m_vecSceneLights.end(); ++iterSceneLight)
+		{
+			if(iterSceneLight->hLight == hLight) {return iterSceneLight;}
+		}
+		return m_vecSceneLights.end();
+	}
+
+	void FWScene::ReleaseLight(HLIGHT hLight)
+	{
+		std::vector<SceneLight>::iterator iterSceneLight = GetSceneLightIterator(hLight);
+		if(iterSceneLight != m_vecSceneLights.end())
+		{
+			UINT32 uiOldSize = static_cast<UINT32>(m_vecSceneLights.size());
+			if(NULL != iterSceneLight->pkLight)
+			{
+				CORE3D_SAFE_DELETE(iterSceneLight->pkLight);
+			}
+			if(uiOldSize != static_cast<UINT32>(m_vecSceneLights.size()))
+			{
+				iterSceneLight = GetSceneLightIterator(hLight);
+			}
+			m_vecSceneLights.erase(iterSceneLight);
+		}
+	}
+
+	FWLight* FWScene::GetLight(HLIGHT hLight)
+	{
+		std::vector<SceneLight>::iterator iterSceneLight = GetSceneLightIterator(hLight);
+		if(iterSceneLight != m_vecSceneLights.end()) {return iterSceneLight->pkLight;}
+		return NULL;
+	}
+
+	void FWScene::FrameMove()
+	{
+		for(std::vector<SceneEntity>::iterator iterSceneEntity = m_vecSceneEntities.begin(); 
+			iterSceneEntity != m_vecSceneEntities.end(); ++iterSceneEntity)
+		{
+			if(false == iterSceneEntity->bSceneProcess) {continue;}
+			iterSceneEntity->pkEntity->FrameMove();
+		}
+	}
+
+	void FWScene::RecordEntitiesJob(void* pvRecordData, UINT32 uiFirstEntity, UINT32 uiEndEntity)
+	{
+		RecordData* pkRecordData = (RecordData*)pvRecordData;
+		for(UINT32 uiEntity = uiFirstEntity; uiEntity < uiEndEntity; ++uiEntity)
+		{
+			SceneEntity& rkSceneEntity = (*pkRecordData->pvecSceneEntities)[uiEntity];
+			if(false == rkSceneEntity.bSceneProcess || NULL == rkSceneEntity.pkCommandList) {continue;}
+			ProfileScope kProfileScope(pkRecordData->pkProfiler, "FWEntity::Record", typeid(*rkSceneEntity.pkEntity).name());
+			rkSceneEntity.bRecorded = rkSceneEntity.pkEntity->Record(pkRecordData->uiPass, rkSceneEntity.pkCommandList);
+		}
+	}
+
+	void FWScene::Render(UINT32 uiPass)
+	{
+		FWGraphics* pkGraphics	= m_pkApplication->GetGraphics();
+		Device* pkDevice		= pkGraphics->GetDevice();
+
+		// COMMENT : Prepare command-lists on this thread, entities record into them in parallel
+		for(std::vector<SceneEntity>::iterator iterSceneEntity = m_vecSceneEntities.begin(); 
+			iterSceneEntity != m_vecSceneEntities.end(); ++iterSceneEntity)
+		{
+			iterSceneEntity->bRecorded = false;
+			if(false == m_bCommandLists || false == iterSceneEntity->bSceneProcess) {continue;}
+			if(NULL == iterSceneEntity->pkCommandList)	{pkDevice->CreateCommandList(&iterSceneEntity->pkCommandList);}
+			else										{iterSceneEntity->pkCommandList->Reset();}
+		}
+
+		m_uiNumRecordedEntities = 0;
+		if(true == m_bCommandLists)
+		{
+			RecordData kRecordData = {&m_vecSceneEntities, uiPass, pkDevice->GetProfiler()};
+			JobSystem* pkJobSystem = pkDevice->GetJobSystem();
+			if(NULL != pkJobSystem)	{pkJobSystem->ParallelFor(RecordEntitiesJob, &kRecordData, 0, static_cast<UINT32>(m_vecSceneEntities.size()));}
+			else					{RecordEntitiesJob(&kRecordData, 0, static_cast<UINT32>(m_vecSceneEntities.size()));}
+
+			for(std::vector<SceneEntity>::iterator iterSceneEntity = m_vecSceneEntities.begin(); 
+				iterSceneEntity != m_vecSceneEntities.end(); ++iterSceneEntity)
+			{
+				if(true == iterSceneEntity->bRecorded) {++m_uiNumRecordedEntities;}
+			}
+		}
+
+		// COMMENT : Lay down the depth of the opaque entities first. Without color-writes the device skips their pixel
+		// shaders(unless these may kill pixels), the following pass then shades only the pixels which remain visible.
+		FWCamera* pkCamera		= pkGraphics->GetCurrentCamera();
+		const bool bDepthPrepass = (NULL != pkCamera) && (true == pkCamera->GetDepthPrepass());
+		if(true == bDepthPrepass)
+		{
+			pkGraphics->PushStateBlock();
+			pkGraphics->SetRenderState(RS_COLORWRITEENABLE, false);
+			for(std::vector<SceneEntity>::iterator iterSceneEntity = m_vecSceneEntities.begin(); 
+				iterSceneEntity != m_vecSceneEntities.end(); ++iterSceneEntity)
+			{
+				if(false == iterSceneEntity->bSceneProcess || false == iterSceneEntity->pkEntity->GetDepthPrepass()) {continue;}
+				ProfileScope kProfileScope(pkDevice->GetProfiler(), "FWScene::RenderDepth", typeid(*iterSceneEntity->pkEntity).name());
+				pkGraphics->PushStateBlock();
+				RenderEntity(*iterSceneEntity, uiPass);
+				pkGraphics->PopStateBlock();
+			}
+			pkGraphics->PopStateBlock();
+		}
+
+		// COMMENT : Execute in scene order
+		for(std::vector<SceneEntity>::iterator iterSceneEntity = m_vecSceneEntities.begin(); 
+			iterSceneEntity != m_vecSceneEntities.end(); ++iterSceneEntity)
+		{
+			if(false == iterSceneEntity->bSceneProcess) {continue;}
+			ProfileScope kProfileScope(pkDevice->GetProfiler(), "FWScene::Render", typeid(*iterSceneEntity->pkEntity).name());
+			pkGraphics->PushStateBlock();
+			if(true == bDepthPrepass && true == iterSceneEntity->pkEntity->GetDepthPrepass())
+			{
+				// COMMENT : Both passes compute identical depths, only the nearest surface passes
+				pkGraphics->SetRenderState(RS_ZWRITEENABLE, false);
+				pkGraphics->SetRenderState(RS_ZFUNC, CMP_LESSEQUAL);
+			}
+			RenderEntity(*iterSceneEntity, uiPass);
+			pkGraphics->PopStateBlock();
+		}
+	}
+
+	bool FWScene::RenderDeferred(UINT32 uiGeometryPass)
+	{
+		FWGraphics* pkGraphics	= m_pkApplication->GetGraphics();
+		FWCamera* pkCamera		= pkGraphics->GetCurrentCamera();
+		if(NULL == pkCamera || NULL == pkCamera->GetGBuffer()) {return false;}
+
+		// COMMENT : Geometry pass. The depth-buffer is the camera's, which has been cleared with its color-buffer.
+		RenderTarget* pkGBuffer	= pkCamera->GetGBuffer();
+		pkGBuffer->ClearColorBuffer(Vector4(0.0f, 0.0f, 0.0f, 0.0f), NULL);
+		pkGraphics->PushStateBlock();
+		pkGraphics->SetRenderTarget(pkGBuffer);
+		Render(uiGeometryPass);
+		pkGraphics->PopStateBlock();
+
+		// COMMENT : Lighting pass
+		return CORE3D_SUCCESSFUL(m_pkDeferredLighting->Render(pkCamera));
+	}
+
+	void FWScene::RenderEntity(SceneEntity& rkSceneEntity, UINT32 uiPass)
+	{
+		if(true == rkSceneEntity.bRecorded)	{m_pkApplication->GetGraphics()->ExecuteCommandList(rkSceneEntity.pkCommandList);}
+		else								{rkSceneEntity.pkEntity->Render(uiPass);}
+	}
+
+	FWApplication* FWScene::GetApplication()
+	{
+		return m_pkApplication;
+	}
+
+	FWLight* FWScene::GetLightFromNum(UINT32 uiNum)
+	{
+		return m_vecSceneLights[uiNum].pkLight;
+	}
+
+	FWLight* FWScene::GetCurrentLight()
+	{
+		return GetLightFromNum(m_uiCurrentLight);
+	}
 }
\ No newline at end of file
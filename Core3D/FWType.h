@@ -1,15 +1,35 @@
-#pragma once
-//////////////////////////////////////////////////////////////////////////
-// Core3D : Framework Library for Software Graphic API
-// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
-//////////////////////////////////////////////////////////////////////////
-#include <string>
-#include "Core3D.h"
-
-#ifdef _UNICODE
-	typedef std::wstring	tstring;
-	typedef wchar_t			tchar;
-#else
-	typedef std::string		tstring;
-	typedef char			tchar;
-#endif
\ No newline at end of file
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Framework Library for Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+#include <string>
+#include "Core3D.h"
+
+#ifdef _UNICODE
+	typedef std::wstring	tstring;
+	typedef wchar_t			tchar;
+#else
+	typedef std::string		tstring;
+	typedef char			tchar;
+#endif
+
+//------------------------------------------------------------------------
+// COMMENT : Generic-text and secure CRT functions used by the framework(non-WIN32 Version)
+#ifndef WIN32
+#include <stdio.h>
+#include <string.h>
+
+inline int _tfopen_s(FILE** ppFile, const char* lpszName, const char* lpszMode)
+{
+	*ppFile = ::fopen(lpszName, lpszMode);
+	return (NULL == *ppFile) ? -1 : 0;
+}
+
+#define _stprintf_s								::snprintf
+#define _stscanf_s								::sscanf
+#define sscanf_s								::sscanf
+#define _tcschr									::strchr
+#define _tcslen									::strlen
+#endif
+//------------------------------------------------------------------------
\ No newline at end of file
@@ -0,0 +1,594 @@
+#include "FrameCapture.h"
+#include "Device.h"
+#include "BaseTexture.h"
+#include "CubeTexture.h"
+#include "IndexBuffer.h"
+#include "PrimitiveAssembler.h"
+#include "RenderTarget.h"
+#include "Shaders.h"
+#include "Surface.h"
+#include "Texture.h"
+#include "VertexBuffer.h"
+#include "VertexFormat.h"
+#include "Volume.h"
+#include "VolumeTexture.h"
+#include <typeinfo>
+
+namespace Core3D
+{
+	UINT64 HashCaptureData(const void* pvData, UINT32 uiSize, UINT64 uiHash /* = 14695981039346656037ULL */)
+	{
+		const BYTE8* pData = (const BYTE8*)pvData;
+		for(UINT32 uiByte = 0; uiByte < uiSize; ++uiByte)
+		{
+			uiHash ^= pData[uiByte];
+			uiHash *= 1099511628211ULL;
+		}
+		return uiHash;
+	}
+
+	UINT64 HashCaptureSurface(Surface* pkSurface)
+	{
+		void* pvData = NULL;
+		if(CORE3D_FAILED(pkSurface->LockRect(&pvData, NULL))) {return HashCaptureData(NULL, 0);}
+
+		const UINT32 uiSize	= pkSurface->GetWidth() * pkSurface->GetHeight() * pkSurface->GetFormatFloats() * sizeof(FLOAT32);
+		const UINT64 uiHash	= HashCaptureData(pvData, uiSize);
+		pkSurface->UnlockRect();
+		return uiHash;
+	}
+
+	FrameCapture::FrameCapture(Device* pkDevice)
+		: m_pkDevice(pkDevice)
+		, m_pkFile(NULL)
+		, m_eRecordType(CRT_DATA)
+		, m_bStatesWritten(false)
+		, m_kStates()
+		, m_eDrawType(CDT_PRIMITIVE)
+		, m_pkDrawRenderTarget(NULL)
+		, m_bWriteFailed(false)
+	{
+		memset(m_auiDrawParameters, 0, sizeof(m_auiDrawParameters));
+	}
+
+	FrameCapture::~FrameCapture()
+	{
+		if(NULL != m_pkFile) {fclose(m_pkFile);}
+
+		for(std::map<RefObject*, UINT32>::iterator iterObject = m_mapObjectIds.begin();
+			iterObject != m_mapObjectIds.end(); ++iterObject)
+		{
+			iterObject->first->Release();
+		}
+	}
+
+	Result FrameCapture::Create(const char* szFileName)
+	{
+		if(NULL == szFileName)
+		{
+			CORE3D_ERROR(_T("FrameCapture::Create() - Parameter file name pointers to NULL.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		m_pkFile = fopen(szFileName, "wb");
+		if(NULL == m_pkFile)
+		{
+			CORE3D_ERROR(_T("FrameCapture::Create() - Couldn't create capture file.\n"));
+			return UNKNOWN;
+		}
+
+		CaptureFileHeader kHeader;
+		memcpy(kHeader.acMagic, "C3DFRAME", sizeof(kHeader.acMagic));
+		kHeader.uiVersion	= CAPTURE_FILE_VERSION;
+		kHeader.uiReserved	= 0;
+		if(1 != fwrite(&kHeader, sizeof(kHeader), 1, m_pkFile)) {m_bWriteFailed = true;}
+		return OK;
+	}
+
+	void FrameCapture::BeginRecord(CaptureRecordType eType)
+	{
+		m_eRecordType = eType;
+		m_vecRecord.clear();
+	}
+
+	void FrameCapture::Write(const void* pvData, UINT32 uiSize)
+	{
+		if(0 == uiSize) {return;}
+		const BYTE8* pData = (const BYTE8*)pvData;
+		m_vecRecord.insert(m_vecRecord.end(), pData, pData + uiSize);
+	}
+
+	void FrameCapture::WriteUINT32(UINT32 uiValue)
+	{
+		Write(&uiValue, sizeof(uiValue));
+	}
+
+	void FrameCapture::WriteUINT64(UINT64 uiValue)
+	{
+		Write(&uiValue, sizeof(uiValue));
+	}
+
+	void FrameCapture::EndRecord()
+	{
+		CaptureRecordHeader kHeader;
+		kHeader.uiType	= m_eRecordType;
+		kHeader.uiSize	= static_cast<UINT32>(m_vecRecord.size());
+		if(1 != fwrite(&kHeader, sizeof(kHeader), 1, m_pkFile)) {m_bWriteFailed = true;}
+		if(0 != kHeader.uiSize && 1 != fwrite(&m_vecRecord[0], kHeader.uiSize, 1, m_pkFile)) {m_bWriteFailed = true;}
+	}
+
+	UINT32 FrameCapture::GetObjectId(RefObject* pkObject, bool& rbNew)
+	{
+		rbNew = false;
+		if(NULL == pkObject) {return 0;}
+
+		std::map<RefObject*, UINT32>::iterator iterObject = m_mapObjectIds.find(pkObject);
+		if(iterObject != m_mapObjectIds.end()) {return iterObject->second;}
+
+		// COMMENT : Referenced, so the address isn't reused by another object during the capture
+		pkObject->AddRef();
+		const UINT32 uiId		= static_cast<UINT32>(m_mapObjectIds.size()) + 1;
+		m_mapObjectIds[pkObject] = uiId;
+		rbNew					= true;
+		return uiId;
+	}
+
+	void FrameCapture::WriteData(UINT64 uiHash, const void* pvData, UINT32 uiSize)
+	{
+		if(m_setWrittenData.find(uiHash) != m_setWrittenData.end()) {return;}
+		m_setWrittenData.insert(uiHash);
+
+		BeginRecord(CRT_DATA);
+		WriteUINT64(uiHash);
+		Write(pvData, uiSize);
+		EndRecord();
+	}
+
+	bool FrameCapture::UpdateContentsHash(UINT32 uiId, UINT64 uiHash)
+	{
+		std::map<UINT32, UINT64>::iterator iterHash = m_mapContentsHashes.find(uiId);
+		if(iterHash != m_mapContentsHashes.end() && iterHash->second == uiHash) {return false;}
+		m_mapContentsHashes[uiId] = uiHash;
+		return true;
+	}
+
+	UINT32 FrameCapture::CaptureVertexBuffer(VertexBuffer* pkVertexBuffer)
+	{
+		bool bNew;
+		const UINT32 uiId = GetObjectId(pkVertexBuffer, bNew);
+		if(0 == uiId) {return 0;}
+
+		void* pvData = NULL;
+		if(CORE3D_FAILED(pkVertexBuffer->GetPointer(0, &pvData))) {return uiId;}
+
+		const UINT32 uiLength	= pkVertexBuffer->GetLength();
+		const UINT64 uiHash		= HashCaptureData(pvData, uiLength);
+		if(true == UpdateContentsHash(uiId, uiHash))
+		{
+			WriteData(uiHash, pvData, uiLength);
+			BeginRecord(CRT_VERTEXBUFFER);
+			WriteUINT32(uiId);
+			WriteUINT32(uiLength);
+			WriteUINT64(uiHash);
+			EndRecord();
+		}
+		return uiId;
+	}
+
+	UINT32 FrameCapture::CaptureIndexBuffer(IndexBuffer* pkIndexBuffer)
+	{
+		bool bNew;
+		const UINT32 uiId = GetObjectId(pkIndexBuffer, bNew);
+		if(0 == uiId) {return 0;}
+
+		void* pvData = NULL;
+		if(CORE3D_FAILED(pkIndexBuffer->GetPointer(0, &pvData))) {return uiId;}
+
+		const UINT32 uiLength	= pkIndexBuffer->GetLength();
+		const UINT64 uiHash		= HashCaptureData(pvData, uiLength);
+		if(true == UpdateContentsHash(uiId, uiHash))
+		{
+			WriteData(uiHash, pvData, uiLength);
+			BeginRecord(CRT_INDEXBUFFER);
+			WriteUINT32(uiId);
+			WriteUINT32(uiLength);
+			WriteUINT32(pkIndexBuffer->GetFormat());
+			WriteUINT64(uiHash);
+			EndRecord();
+		}
+		return uiId;
+	}
+
+	UINT32 FrameCapture::CaptureVertexFormat(VertexFormat* pkVertexFormat)
+	{
+		bool bNew;
+		const UINT32 uiId = GetObjectId(pkVertexFormat, bNew);
+		if(true == bNew)
+		{
+			// COMMENT : Vertex-formats can't be changed after creation
+			BeginRecord(CRT_VERTEXFORMAT);
+			WriteUINT32(uiId);
+			WriteUINT32(pkVertexFormat->GetNumVertexElements());
+			Write(pkVertexFormat->GetElements(), pkVertexFormat->GetNumVertexElements() * sizeof(VertexElement));
+			EndRecord();
+		}
+		return uiId;
+	}
+
+	UINT32 FrameCapture::CaptureTexture(BaseTexture* pkTexture)
+	{
+		bool bNew;
+		const UINT32 uiId = GetObjectId(pkTexture, bNew);
+		if(0 == uiId) {return 0;}
+
+		// COMMENT : Gather all faces and mip-levels
+		UINT32 uiType = 0, uiWidth = 0, uiHeight = 0, uiDepth = 1, uiMipLevels = 0;
+		Format eFormat = FMT_R32F;
+		m_vecContents.clear();
+
+		Texture* apkTextures[6]	= {NULL, NULL, NULL, NULL, NULL, NULL};
+		UINT32 uiNumTextures	= 0;
+		if(NULL != dynamic_cast<Texture*>(pkTexture))
+		{
+			uiType			= CTT_TEXTURE;
+			apkTextures[0]	= static_cast<Texture*>(pkTexture);
+			apkTextures[0]->AddRef();
+			uiNumTextures	= 1;
+		}
+		else if(NULL != dynamic_cast<CubeTexture*>(pkTexture))
+		{
+			uiType = CTT_CUBETEXTURE;
+			CubeTexture* pkCubeTexture = static_cast<CubeTexture*>(pkTexture);
+			for(UINT32 uiFace = 0; uiFace < 6; ++uiFace) {apkTextures[uiFace] = pkCubeTexture->GetCubeFace((CubeFaces)uiFace);}
+			uiNumTextures	= 6;
+		}
+
+		if(uiNumTextures > 0)
+		{
+			eFormat		= apkTextures[0]->GetFormat();
+			uiWidth		= apkTextures[0]->GetWidth();
+			uiHeight	= apkTextures[0]->GetHeight();
+			uiMipLevels	= apkTextures[0]->GetMipLevels();
+			for(UINT32 uiTexture = 0; uiTexture < uiNumTextures; ++uiTexture)
+			{
+				for(UINT32 uiLevel = 0; uiLevel < uiMipLevels; ++uiLevel)
+				{
+					const UINT32 uiSize	= apkTextures[uiTexture]->GetWidth(uiLevel) * apkTextures[uiTexture]->GetHeight(uiLevel) *
+						apkTextures[uiTexture]->GetFormatFloats() * sizeof(FLOAT32);
+					const size_t uiStart = m_vecContents.size();
+					m_vecContents.resize(uiStart + uiSize, 0);
+
+					void* pvData = NULL;
+					if(CORE3D_SUCCESSFUL(apkTextures[uiTexture]->LockRect(uiLevel, &pvData, NULL)))
+					{
+						memcpy(&m_vecContents[uiStart], pvData, uiSize);
+						apkTextures[uiTexture]->UnlockRect(uiLevel);
+					}
+				}
+				CORE3D_SAFE_RELEASE(apkTextures[uiTexture]);
+			}
+		}
+		else if(NULL != dynamic_cast<VolumeTexture*>(pkTexture))
+		{
+			uiType = CTT_VOLUMETEXTURE;
+			VolumeTexture* pkVolumeTexture = static_cast<VolumeTexture*>(pkTexture);
+			eFormat		= pkVolumeTexture->GetFormat();
+			uiWidth		= pkVolumeTexture->GetWidth();
+			uiHeight	= pkVolumeTexture->GetHeight();
+			uiDepth		= pkVolumeTexture->GetDepth();
+			uiMipLevels	= pkVolumeTexture->GetMipLevels();
+			for(UINT32 uiLevel = 0; uiLevel < uiMipLevels; ++uiLevel)
+			{
+				const UINT32 uiSize	= pkVolumeTexture->GetWidth(uiLevel) * pkVolumeTexture->GetHeight(uiLevel) *
+					pkVolumeTexture->GetDepth(uiLevel) * pkVolumeTexture->GetFormatFloats() * sizeof(FLOAT32);
+				const size_t uiStart = m_vecContents.size();
+				m_vecContents.resize(uiStart + uiSize, 0);
+
+				void* pvData = NULL;
+				if(CORE3D_SUCCESSFUL(pkVolumeTexture->LockBox(uiLevel, &pvData, NULL)))
+				{
+					memcpy(&m_vecContents[uiStart], pvData, uiSize);
+					pkVolumeTexture->UnlockBox(uiLevel);
+				}
+			}
+		}
+		else
+		{
+			CORE3D_ERROR(_T("FrameCapture::CaptureTexture() - Unknown texture type.\n"));
+			return uiId;
+		}
+
+		const UINT32 uiSize		= static_cast<UINT32>(m_vecContents.size());
+		const UINT64 uiHash		= HashCaptureData(uiSize ? &m_vecContents[0] : NULL, uiSize);
+		if(true == UpdateContentsHash(uiId, uiHash))
+		{
+			WriteData(uiHash, uiSize ? &m_vecContents[0] : NULL, uiSize);
+			BeginRecord(CRT_TEXTURE);
+			WriteUINT32(uiId);
+			WriteUINT32(uiType);
+			WriteUINT32(eFormat);
+			WriteUINT32(uiWidth);
+			WriteUINT32(uiHeight);
+			WriteUINT32(uiDepth);
+			WriteUINT32(uiMipLevels);
+			WriteUINT64(uiHash);
+			EndRecord();
+		}
+		return uiId;
+	}
+
+	UINT32 FrameCapture::CaptureSurface(Surface* pkSurface)
+	{
+		bool bNew;
+		const UINT32 uiId = GetObjectId(pkSurface, bNew);
+		if(0 == uiId) {return 0;}
+
+		void* pvData = NULL;
+		if(CORE3D_FAILED(pkSurface->LockRect(&pvData, NULL))) {return uiId;}
+
+		const UINT32 uiSize		= pkSurface->GetWidth() * pkSurface->GetHeight() * pkSurface->GetFormatFloats() * sizeof(FLOAT32);
+		const UINT64 uiHash		= HashCaptureData(pvData, uiSize);
+		if(true == UpdateContentsHash(uiId, uiHash))
+		{
+			WriteData(uiHash, pvData, uiSize);
+			BeginRecord(CRT_SURFACE);
+			WriteUINT32(uiId);
+			WriteUINT32(pkSurface->GetFormat());
+			WriteUINT32(pkSurface->GetWidth());
+			WriteUINT32(pkSurface->GetHeight());
+			WriteUINT64(uiHash);
+			EndRecord();
+		}
+		pkSurface->UnlockRect();
+		return uiId;
+	}
+
+	UINT32 FrameCapture::CaptureRenderTarget(RenderTarget* pkRenderTarget)
+	{
+		bool bNew;
+		const UINT32 uiId = GetObjectId(pkRenderTarget, bNew);
+		if(0 == uiId) {return 0;}
+
+		// COMMENT : Buffers are compared with the contents left by the previous draw, changes(e.g. clears) are written
+		RenderTargetInfo kInfo;
+		for(UINT32 uiIndex = 0; uiIndex < MAX_COLOR_BUFFERS; ++uiIndex)
+		{
+			Surface* pkColorBuffer			= pkRenderTarget->GetColorBuffer(uiIndex);
+			kInfo.auiColorBuffers[uiIndex]	= CaptureSurface(pkColorBuffer);
+			CORE3D_SAFE_RELEASE(pkColorBuffer);
+		}
+		Surface* pkDepthBuffer		= pkRenderTarget->GetDepthBuffer();
+		Surface* pkStencilBuffer	= pkRenderTarget->GetStencilBuffer();
+		kInfo.uiDepthBuffer			= CaptureSurface(pkDepthBuffer);
+		kInfo.uiStencilBuffer		= CaptureSurface(pkStencilBuffer);
+		kInfo.matViewport			= pkRenderTarget->GetViewportMatrix();
+		CORE3D_SAFE_RELEASE(pkDepthBuffer);
+		CORE3D_SAFE_RELEASE(pkStencilBuffer);
+
+		std::map<UINT32, RenderTargetInfo>::iterator iterInfo = m_mapRenderTargets.find(uiId);
+		if(iterInfo == m_mapRenderTargets.end() || 0 != memcmp(&iterInfo->second, &kInfo, sizeof(kInfo)))
+		{
+			m_mapRenderTargets[uiId] = kInfo;
+			BeginRecord(CRT_RENDERTARGET);
+			WriteUINT32(uiId);
+			for(UINT32 uiIndex = 0; uiIndex < MAX_COLOR_BUFFERS; ++uiIndex) {WriteUINT32(kInfo.auiColorBuffers[uiIndex]);}
+			WriteUINT32(kInfo.uiDepthBuffer);
+			WriteUINT32(kInfo.uiStencilBuffer);
+			Write(&kInfo.matViewport, sizeof(kInfo.matViewport));
+			EndRecord();
+		}
+		return uiId;
+	}
+
+	UINT32 FrameCapture::CaptureShader(RefObject* pkShader, CaptureShaderType eShaderType)
+	{
+		bool bNew;
+		const UINT32 uiId = GetObjectId(pkShader, bNew);
+		if(true == bNew)
+		{
+			// COMMENT : Output registers of the vertex shader let replays substitute unknown vertex shaders.
+			// The interpolation is kept in the upper half of each register's type.
+			UINT32 auiOutputs[PIXEL_SHADER_REGISTERS];
+			for(UINT32 uiRegister = 0; uiRegister < PIXEL_SHADER_REGISTERS; ++uiRegister)
+			{
+				auiOutputs[uiRegister] = SRT_UNUSED;
+				if(CST_VERTEXSHADER == eShaderType)
+				{
+					VertexShader* pkVertexShader = static_cast<VertexShader*>(pkShader);
+					auiOutputs[uiRegister] = pkVertexShader->GetOutputRegisters(uiRegister) | (pkVertexShader->GetOutputInterpolation(uiRegister) << 16);
+				}
+			}
+
+			const char* szName = typeid(*pkShader).name();
+			BeginRecord(CRT_SHADER);
+			WriteUINT32(uiId);
+			WriteUINT32(eShaderType);
+			Write(auiOutputs, sizeof(auiOutputs));
+			Write(szName, static_cast<UINT32>(strlen(szName)) + 1);
+			EndRecord();
+		}
+
+		if(0 != uiId && CST_PRIMITIVEASSEMBLER != eShaderType) {CaptureShaderConstants(static_cast<BaseShader*>(pkShader), uiId);}
+		return uiId;
+	}
+
+	void FrameCapture::CaptureShaderConstants(BaseShader* pkShader, UINT32 uiId)
+	{
+		ShaderConstants kConstants;
+		for(UINT32 uiIndex = 0; uiIndex < NUM_SHADER_CONSTANTS; ++uiIndex)
+		{
+			kConstants.afConstants[uiIndex]		= pkShader->GetFloat(uiIndex);
+			kConstants.akConstants[uiIndex]		= pkShader->GetVector(uiIndex);
+			kConstants.amatConstants[uiIndex]	= pkShader->GetMatrix(uiIndex);
+		}
+
+		std::map<UINT32, ShaderConstants>::iterator iterConstants = m_mapShaderConstants.find(uiId);
+		if(iterConstants != m_mapShaderConstants.end() && 0 == memcmp(&iterConstants->second, &kConstants, sizeof(kConstants))) {return;}
+		m_mapShaderConstants[uiId] = kConstants;
+
+		BeginRecord(CRT_SHADERCONSTANTS);
+		WriteUINT32(uiId);
+		Write(kConstants.afConstants, sizeof(kConstants.afConstants));
+		Write(kConstants.akConstants, sizeof(kConstants.akConstants));
+		Write(kConstants.amatConstants, sizeof(kConstants.amatConstants));
+		EndRecord();
+	}
+
+	UINT64 FrameCapture::HashRenderTarget(RenderTarget* pkRenderTarget)
+	{
+		UINT64 uiHash = HashCaptureData(NULL, 0);
+		if(NULL == pkRenderTarget) {return uiHash;}
+
+		Surface* apkBuffers[MAX_COLOR_BUFFERS + 2];
+		for(UINT32 uiIndex = 0; uiIndex < MAX_COLOR_BUFFERS; ++uiIndex) {apkBuffers[uiIndex] = pkRenderTarget->GetColorBuffer(uiIndex);}
+		apkBuffers[MAX_COLOR_BUFFERS]		= pkRenderTarget->GetDepthBuffer();
+		apkBuffers[MAX_COLOR_BUFFERS + 1]	= pkRenderTarget->GetStencilBuffer();
+		for(UINT32 uiBuffer = 0; uiBuffer < MAX_COLOR_BUFFERS + 2; ++uiBuffer)
+		{
+			Surface* pkBuffer = apkBuffers[uiBuffer];
+			if(NULL == pkBuffer) {continue;}
+
+			const UINT64 uiBufferHash = HashCaptureSurface(pkBuffer);
+			uiHash = HashCaptureData(&uiBufferHash, sizeof(uiBufferHash), uiHash);
+
+			// COMMENT : Rendered contents are known to a replay, they don't have to be written before the next draw
+			std::map<RefObject*, UINT32>::iterator iterObject = m_mapObjectIds.find(pkBuffer);
+			if(iterObject != m_mapObjectIds.end()) {m_mapContentsHashes[iterObject->second] = uiBufferHash;}
+			CORE3D_SAFE_RELEASE(pkBuffer);
+		}
+		return uiHash;
+	}
+
+	void FrameCapture::CaptureDraw(CaptureDrawType eDrawType, const UINT32* puiParameters)
+	{
+		Device* pkDevice = m_pkDevice;
+
+		// COMMENT : Resources are written before the states referencing them
+		CapturedStates kStates = CapturedStates();
+		memcpy(kStates.auiRenderStates, pkDevice->m_auiRenderStates, sizeof(kStates.auiRenderStates));
+
+		for(UINT32 uiSampler = 0; uiSampler < MAX_TEXTURE_SAMPLERS; ++uiSampler)
+		{
+			kStates.akSamplers[uiSampler].uiTexture = CaptureTexture(pkDevice->m_akTextureSamplers[uiSampler].pkTexture);
+			memcpy(kStates.akSamplers[uiSampler].auiStates, pkDevice->m_akTextureSamplers[uiSampler].auiTexureSamplerStates,
+				sizeof(kStates.akSamplers[uiSampler].auiStates));
+		}
+
+		for(UINT32 uiStream = 0; uiStream < MAX_VERTEX_STREAMS; ++uiStream)
+		{
+			kStates.akVertexStreams[uiStream].uiVertexBuffer	= CaptureVertexBuffer(pkDevice->m_akVertexStreams[uiStream].pkVertexBuffer);
+			kStates.akVertexStreams[uiStream].uiOffset			= pkDevice->m_akVertexStreams[uiStream].uiOffset;
+			kStates.akVertexStreams[uiStream].uiStride			= pkDevice->m_akVertexStreams[uiStream].uiStride;
+		}
+
+		kStates.auiBindings[0]	= CaptureVertexFormat(pkDevice->m_pkVertexFormat);
+		kStates.auiBindings[1]	= CaptureShader(pkDevice->m_pkPrimitiveAssembler, CST_PRIMITIVEASSEMBLER);
+		kStates.auiBindings[2]	= CaptureShader(pkDevice->m_pkVertexShader, CST_VERTEXSHADER);
+		kStates.auiBindings[3]	= CaptureShader(pkDevice->m_pkTriangleShader, CST_TRIANGLESHADER);
+		kStates.auiBindings[4]	= CaptureShader(pkDevice->m_pkPixelShader, CST_PIXELSHADER);
+		kStates.auiBindings[5]	= CaptureIndexBuffer(pkDevice->m_pkIndexBuffer);
+		kStates.auiBindings[6]	= CaptureRenderTarget(pkDevice->m_pkRenderTarget);
+
+		kStates.rcScissorRect	= pkDevice->m_rcScissorRect;
+		for(UINT32 uiPlane = 0; uiPlane < CP_NUMPLANES; ++uiPlane)
+		{
+			kStates.akClippingPlanes[uiPlane]			= pkDevice->m_kRenderInfo.akClippingPlanes[uiPlane];
+			kStates.auiClippingPlaneEnabled[uiPlane]	= pkDevice->m_kRenderInfo.abClippingPlaneEnabled[uiPlane] ? 1 : 0;
+		}
+
+		// COMMENT : States which changed since the previous draw
+		const bool bAll = !m_bStatesWritten;
+		if(bAll || 0 != memcmp(kStates.auiRenderStates, m_kStates.auiRenderStates, sizeof(kStates.auiRenderStates)))
+		{
+			BeginRecord(CRT_RENDERSTATES);
+			Write(kStates.auiRenderStates, sizeof(kStates.auiRenderStates));
+			EndRecord();
+		}
+
+		for(UINT32 uiSampler = 0; uiSampler < MAX_TEXTURE_SAMPLERS; ++uiSampler)
+		{
+			if(bAll || 0 != memcmp(&kStates.akSamplers[uiSampler], &m_kStates.akSamplers[uiSampler], sizeof(SamplerInfo)))
+			{
+				BeginRecord(CRT_SAMPLER);
+				WriteUINT32(uiSampler);
+				WriteUINT32(kStates.akSamplers[uiSampler].uiTexture);
+				Write(kStates.akSamplers[uiSampler].auiStates, sizeof(kStates.akSamplers[uiSampler].auiStates));
+				EndRecord();
+			}
+		}
+
+		for(UINT32 uiStream = 0; uiStream < MAX_VERTEX_STREAMS; ++uiStream)
+		{
+			if(bAll || 0 != memcmp(&kStates.akVertexStreams[uiStream], &m_kStates.akVertexStreams[uiStream], sizeof(VertexStreamInfo)))
+			{
+				BeginRecord(CRT_VERTEXSTREAM);
+				WriteUINT32(uiStream);
+				WriteUINT32(kStates.akVertexStreams[uiStream].uiVertexBuffer);
+				WriteUINT32(kStates.akVertexStreams[uiStream].uiOffset);
+				WriteUINT32(kStates.akVertexStreams[uiStream].uiStride);
+				EndRecord();
+			}
+		}
+
+		if(bAll || 0 != memcmp(kStates.auiBindings, m_kStates.auiBindings, sizeof(kStates.auiBindings)))
+		{
+			BeginRecord(CRT_BINDINGS);
+			Write(kStates.auiBindings, sizeof(kStates.auiBindings));
+			EndRecord();
+		}
+
+		if(bAll || 0 != memcmp(&kStates.rcScissorRect, &m_kStates.rcScissorRect, sizeof(kStates.rcScissorRect)))
+		{
+			BeginRecord(CRT_SCISSORRECT);
+			Write(&kStates.rcScissorRect, sizeof(kStates.rcScissorRect));
+			EndRecord();
+		}
+
+		if( bAll ||
+			0 != memcmp(kStates.akClippingPlanes, m_kStates.akClippingPlanes, sizeof(kStates.akClippingPlanes)) ||
+			0 != memcmp(kStates.auiClippingPlaneEnabled, m_kStates.auiClippingPlaneEnabled, sizeof(kStates.auiClippingPlaneEnabled)) )
+		{
+			BeginRecord(CRT_CLIPPINGPLANES);
+			Write(kStates.akClippingPlanes, sizeof(kStates.akClippingPlanes));
+			Write(kStates.auiClippingPlaneEnabled, sizeof(kStates.auiClippingPlaneEnabled));
+			EndRecord();
+		}
+
+		m_kStates			= kStates;
+		m_bStatesWritten	= true;
+
+		m_eDrawType			= eDrawType;
+		memcpy(m_auiDrawParameters, puiParameters, sizeof(m_auiDrawParameters));
+		m_pkDrawRenderTarget = pkDevice->m_pkRenderTarget;
+	}
+
+	void FrameCapture::CaptureDrawResult()
+	{
+		BeginRecord(CRT_DRAW);
+		WriteUINT32(m_eDrawType);
+		Write(m_auiDrawParameters, sizeof(m_auiDrawParameters));
+		const UINT64 uiHash = HashRenderTarget(m_pkDrawRenderTarget);
+		WriteUINT64(uiHash);
+		EndRecord();
+	}
+
+	Result FrameCapture::Finish(RenderTarget* pkRenderTarget)
+	{
+		const UINT32 uiId = CaptureRenderTarget(pkRenderTarget);
+		const UINT64 uiHash = HashRenderTarget(pkRenderTarget);
+		BeginRecord(CRT_PRESENT);
+		WriteUINT32(uiId);
+		WriteUINT64(uiHash);
+		EndRecord();
+
+		if(0 != fclose(m_pkFile)) {m_bWriteFailed = true;}
+		m_pkFile = NULL;
+
+		if(true == m_bWriteFailed)
+		{
+			CORE3D_ERROR(_T("FrameCapture::Finish() - Couldn't write capture file.\n"));
+			return UNKNOWN;
+		}
+		return OK;
+	}
+}
@@ -0,0 +1,195 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+#include "Core3DTypes.h"
+#include <stdio.h>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace Core3D
+{
+	class Device;
+	class BaseShader;
+	class BaseTexture;
+	class IndexBuffer;
+	class RenderTarget;
+	class Surface;
+	class VertexBuffer;
+	class VertexFormat;
+
+	//////////////////////////////////////////////////////////////////////////
+	// Capture file format
+	//////////////////////////////////////////////////////////////////////////
+	// COMMENT : A capture file starts with a CaptureFileHeader, followed by records. Each record is a
+	// CaptureRecordHeader followed by uiSize bytes. Objects are identified by ids assigned per file(0 : no object),
+	// their contents are referenced by a 64-bit hash and stored once per file in a CRT_DATA record.
+	const UINT32 CAPTURE_FILE_VERSION = 3;
+
+	enum CaptureRecordType
+	{
+		CRT_DATA = 0,			// UINT64 hash, contents
+		CRT_VERTEXBUFFER,		// id, length, UINT64 contents hash
+		CRT_INDEXBUFFER,		// id, length, format, UINT64 contents hash
+		CRT_VERTEXFORMAT,		// id, number of elements, VertexElement[]
+		CRT_TEXTURE,			// id, CaptureTextureType, format, width, height, depth, mip-levels, UINT64 hash of all faces and levels
+		CRT_SURFACE,			// id, format, width, height, UINT64 contents hash
+		CRT_RENDERTARGET,		// id, MAX_COLOR_BUFFERS color-buffer ids, depth-buffer id, stencil-buffer id, viewport matrix
+		CRT_SHADER,				// id, CaptureShaderType, ShaderRegType[PIXEL_SHADER_REGISTERS] vertex shader outputs, name(null-terminated)
+		CRT_SHADERCONSTANTS,	// id, FLOAT32[NUM_SHADER_CONSTANTS], Vector4[NUM_SHADER_CONSTANTS], Matrix4x4[NUM_SHADER_CONSTANTS]
+		CRT_RENDERSTATES,		// UINT32[RS_NUMRENDERSTATES]
+		CRT_SAMPLER,			// sampler, texture id, UINT32[TSS_NUMTEXTURESAMPLERSTATES]
+		CRT_VERTEXSTREAM,		// stream, vertex-buffer id, offset, stride
+		CRT_BINDINGS,			// vertex-format, primitive-assembler, vertex-shader, triangle-shader, pixel-shader, index-buffer, render-target ids
+		CRT_SCISSORRECT,		// Rect
+		CRT_CLIPPINGPLANES,		// Plane[CP_NUMPLANES], UINT32[CP_NUMPLANES] enabled
+		CRT_DRAW,				// CaptureDrawType, UINT32[6] parameters, UINT64 hash of the render-target's buffers after the draw
+		CRT_PRESENT				// render-target id, UINT64 hash of its buffers
+	};
+
+	enum CaptureTextureType
+	{
+		CTT_TEXTURE = 0,		// Mip-levels one after another
+		CTT_CUBETEXTURE,		// Faces one after another, each with all of its mip-levels
+		CTT_VOLUMETEXTURE		// Mip-levels one after another
+	};
+
+	enum CaptureShaderType
+	{
+		CST_VERTEXSHADER = 0,
+		CST_TRIANGLESHADER,
+		CST_PIXELSHADER,
+		CST_PRIMITIVEASSEMBLER
+	};
+
+	enum CaptureDrawType
+	{
+		CDT_PRIMITIVE = 0,		// Primitive type, start vertex, primitive count
+		CDT_INDEXEDPRIMITIVE,	// Primitive type, base vertex index, min index, number of vertices, start index, primitive count
+		CDT_DYNAMICPRIMITIVE	// Start vertex, number of vertices
+	};
+
+	struct CaptureFileHeader
+	{
+		char		acMagic[8];		// "C3DFRAME"
+		UINT32		uiVersion;
+		UINT32		uiReserved;
+	};
+
+	struct CaptureRecordHeader
+	{
+		UINT32		uiType;
+		UINT32		uiSize;
+	};
+
+	// COMMENT : 64-bit FNV-1a hash, used for contents and render-target comparisons
+	UINT64 HashCaptureData(const void* pvData, UINT32 uiSize, UINT64 uiHash = 14695981039346656037ULL);
+	// COMMENT : Hash of a surface's contents(the hash of no data if it can't be locked)
+	UINT64 HashCaptureSurface(Surface* pkSurface);
+
+	// COMMENT : Writes the draws of one frame to a capture file, used by Device::CaptureNextFrame().
+	// Before each draw the device states which changed since the previous draw are written and the bound
+	// resources are hashed, their contents are written whenever they changed. Shaders and primitive-assemblers
+	// can't be serialized, they are identified by their class name and their constants.
+	// Objects used by the frame are kept alive until the capture is finished.
+	class FrameCapture
+	{
+	public:
+		FrameCapture(Device* pkDevice);
+		~FrameCapture();
+
+		Result	Create(const char* szFileName);
+
+		// COMMENT : Called by the device around each draw, while the render-target isn't locked
+		void	CaptureDraw(CaptureDrawType eDrawType, const UINT32* puiParameters);
+		void	CaptureDrawResult();
+		Result	Finish(RenderTarget* pkRenderTarget);
+	private:
+		FrameCapture(const FrameCapture&);
+		FrameCapture& operator=(const FrameCapture&);
+
+		void	BeginRecord(CaptureRecordType eType);
+		void	Write(const void* pvData, UINT32 uiSize);
+		void	WriteUINT32(UINT32 uiValue);
+		void	WriteUINT64(UINT64 uiValue);
+		void	EndRecord();
+
+		UINT32	GetObjectId(RefObject* pkObject, bool& rbNew);
+		void	WriteData(UINT64 uiHash, const void* pvData, UINT32 uiSize);
+		bool	UpdateContentsHash(UINT32 uiId, UINT64 uiHash);
+		UINT64	HashRenderTarget(RenderTarget* pkRenderTarget);
+
+		UINT32	CaptureVertexBuffer(VertexBuffer* pkVertexBuffer);
+		UINT32	CaptureIndexBuffer(IndexBuffer* pkIndexBuffer);
+		UINT32	CaptureVertexFormat(VertexFormat* pkVertexFormat);
+		UINT32	CaptureTexture(BaseTexture* pkTexture);
+		UINT32	CaptureSurface(Surface* pkSurface);
+		UINT32	CaptureRenderTarget(RenderTarget* pkRenderTarget);
+		UINT32	CaptureShader(RefObject* pkShader, CaptureShaderType eShaderType);
+		void	CaptureShaderConstants(BaseShader* pkShader, UINT32 uiId);
+	private:
+		struct ShaderConstants
+		{
+			FLOAT32		afConstants[NUM_SHADER_CONSTANTS];
+			Vector4		akConstants[NUM_SHADER_CONSTANTS];
+			Matrix4x4	amatConstants[NUM_SHADER_CONSTANTS];
+		};
+
+		struct SamplerInfo
+		{
+			UINT32		uiTexture;
+			UINT32		auiStates[TSS_NUMTEXTURESAMPLERSTATES];
+		};
+
+		struct RenderTargetInfo
+		{
+			UINT32		auiColorBuffers[MAX_COLOR_BUFFERS];
+			UINT32		uiDepthBuffer;
+			UINT32		uiStencilBuffer;
+			Matrix4x4	matViewport;
+		};
+
+		struct VertexStreamInfo
+		{
+			UINT32		uiVertexBuffer;
+			UINT32		uiOffset;
+			UINT32		uiStride;
+		};
+
+		// COMMENT : States written last, compared before each draw
+		struct CapturedStates
+		{
+			UINT32				auiRenderStates[RS_NUMRENDERSTATES];
+			SamplerInfo			akSamplers[MAX_TEXTURE_SAMPLERS];
+			VertexStreamInfo	akVertexStreams[MAX_VERTEX_STREAMS];
+			UINT32				auiBindings[7];
+			Rect				rcScissorRect;
+			Plane				akClippingPlanes[CP_NUMPLANES];
+			UINT32				auiClippingPlaneEnabled[CP_NUMPLANES];
+		};
+	private:
+		Device*							m_pkDevice;
+		FILE*							m_pkFile;
+		std::vector<BYTE8>				m_vecRecord;
+		CaptureRecordType				m_eRecordType;
+
+		std::map<RefObject*, UINT32>	m_mapObjectIds;
+		std::map<UINT32, UINT64>		m_mapContentsHashes;
+		std::map<UINT32, ShaderConstants> m_mapShaderConstants;
+		std::map<UINT32, RenderTargetInfo> m_mapRenderTargets;
+		std::set<UINT64>				m_setWrittenData;
+		std::vector<BYTE8>				m_vecContents;
+
+		bool							m_bStatesWritten;
+		CapturedStates					m_kStates;
+
+		// COMMENT : Draw which is written with its result by CaptureDrawResult()
+		CaptureDrawType					m_eDrawType;
+		UINT32							m_auiDrawParameters[6];
+		RenderTarget*					m_pkDrawRenderTarget;
+		bool							m_bWriteFailed;
+	};
+}
@@ -0,0 +1,869 @@
+#include "FrameReplay.h"
+#include "Core3DThread.h"
+#include "Device.h"
+#include "BaseTexture.h"
+#include "CubeTexture.h"
+#include "IndexBuffer.h"
+#include "PrimitiveAssembler.h"
+#include "RenderTarget.h"
+#include "Shaders.h"
+#include "Surface.h"
+#include "Texture.h"
+#include "VertexBuffer.h"
+#include "VertexFormat.h"
+#include "Volume.h"
+#include "VolumeTexture.h"
+
+namespace Core3D
+{
+	// COMMENT : Substitutes an unknown vertex shader, transforms register 0 by the world-view-projection constant
+	// and passes all registers on with the captured output types.
+	class ReplayVertexShader : public VertexShader
+	{
+	public:
+		ReplayVertexShader(const UINT32* puiOutputs)
+		{
+			for(UINT32 uiRegister = 0; uiRegister < PIXEL_SHADER_REGISTERS; ++uiRegister)
+			{
+				const UINT32 uiType				= puiOutputs[uiRegister] & 0xffff;
+				const UINT32 uiInterpolation	= puiOutputs[uiRegister] >> 16;
+				m_aeOutputs[uiRegister]			= (uiType <= SRT_VECTOR4) ? (ShaderRegType)uiType : SRT_UNUSED;
+				m_aeInterpolations[uiRegister]	= (uiInterpolation <= SRI_FLAT) ? (ShaderRegInterpolation)uiInterpolation : SRI_PERSPECTIVE;
+			}
+		}
+	protected:
+		void Execute(const ShaderReg* pkInput, Vector4& rkPosition, ShaderReg* pkOutput)
+		{
+			rkPosition = pkInput[0] * GetMatrix(SC_WVPMATRIX);
+			for(UINT32 uiRegister = 0; uiRegister < PIXEL_SHADER_REGISTERS && uiRegister < VERTEX_SHADER_REGISTERS; ++uiRegister)
+			{
+				pkOutput[uiRegister] = pkInput[uiRegister];
+			}
+		}
+
+		ShaderRegType GetOutputRegisters(UINT32 uiRegister)
+		{
+			return (uiRegister < PIXEL_SHADER_REGISTERS) ? m_aeOutputs[uiRegister] : SRT_UNUSED;
+		}
+
+		ShaderRegInterpolation GetOutputInterpolation(UINT32 uiRegister)
+		{
+			return (uiRegister < PIXEL_SHADER_REGISTERS) ? m_aeInterpolations[uiRegister] : SRI_PERSPECTIVE;
+		}
+	private:
+		ShaderRegType			m_aeOutputs[PIXEL_SHADER_REGISTERS];
+		ShaderRegInterpolation	m_aeInterpolations[PIXEL_SHADER_REGISTERS];
+	};
+
+	// COMMENT : Substitutes an unknown pixel shader, outputs the first register as color
+	class ReplayPixelShader : public PixelShader
+	{
+	protected:
+		bool Execute(const ShaderReg* pkInput, Vector4& rkColor, FLOAT32& rfDepth)
+		{
+			rkColor = pkInput[0];
+			return true;
+		}
+	};
+
+	void FrameReplay::RecordReader::Read(void* pvData, UINT32 uiSize)
+	{
+		if(true == m_bFailed || uiSize > m_uiSize - m_uiPosition)
+		{
+			m_bFailed = true;
+			memset(pvData, 0, uiSize);
+			return;
+		}
+
+		memcpy(pvData, m_pData + m_uiPosition, uiSize);
+		m_uiPosition += uiSize;
+	}
+
+	UINT32 FrameReplay::RecordReader::ReadUINT32()
+	{
+		UINT32 uiValue;
+		Read(&uiValue, sizeof(uiValue));
+		return uiValue;
+	}
+
+	UINT64 FrameReplay::RecordReader::ReadUINT64()
+	{
+		UINT64 uiValue;
+		Read(&uiValue, sizeof(uiValue));
+		return uiValue;
+	}
+
+	const char* FrameReplay::RecordReader::ReadString()
+	{
+		if(true == m_bFailed) {return "";}
+
+		const char* szString = (const char*)m_pData + m_uiPosition;
+		const void* pvEnd = memchr(szString, 0, m_uiSize - m_uiPosition);
+		if(NULL == pvEnd)
+		{
+			m_bFailed = true;
+			return "";
+		}
+
+		m_uiPosition += static_cast<UINT32>((const char*)pvEnd - szString) + 1;
+		return szString;
+	}
+
+	FrameReplay::FrameReplay()
+		: m_pkDevice(NULL)
+		, m_uiNumSubstitutedShaders(0)
+		, m_fUploadSeconds(0.0)
+		, m_uiCapturedFrameHash(0)
+		, m_uiReplayedFrameHash(0)
+		, m_pkPresentedRenderTarget(NULL)
+	{
+	}
+
+	FrameReplay::~FrameReplay()
+	{
+		ReleaseObjects();
+	}
+
+	void FrameReplay::RegisterShader(const char* szName, PFN_CREATESHADER pfnCreateShader)
+	{
+		m_mapShaderFunctions[szName] = pfnCreateShader;
+	}
+
+	void FrameReplay::RegisterPrimitiveAssembler(const char* szName, PFN_CREATEPRIMITIVEASSEMBLER pfnCreatePrimitiveAssembler)
+	{
+		m_mapPrimitiveAssemblerFunctions[szName] = pfnCreatePrimitiveAssembler;
+	}
+
+	Result FrameReplay::Load(const char* szFileName)
+	{
+		if(NULL == szFileName)
+		{
+			CORE3D_ERROR(_T("FrameReplay::Load() - Parameter file name pointers to NULL.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		ReleaseObjects();
+		m_vecFile.clear();
+		m_vecRecords.clear();
+		m_mapData.clear();
+		m_vecDraws.clear();
+
+		FILE* pkFile = fopen(szFileName, "rb");
+		if(NULL == pkFile)
+		{
+			CORE3D_ERROR(_T("FrameReplay::Load() - Couldn't open capture file.\n"));
+			return UNKNOWN;
+		}
+
+		BYTE8 aBuffer[65536];
+		size_t uiRead;
+		while(0 != (uiRead = fread(aBuffer, 1, sizeof(aBuffer), pkFile)))
+		{
+			m_vecFile.insert(m_vecFile.end(), aBuffer, aBuffer + uiRead);
+		}
+		fclose(pkFile);
+
+		CaptureFileHeader kHeader;
+		if( (m_vecFile.size() < sizeof(kHeader)) ||
+			(0 != memcmp(&m_vecFile[0], "C3DFRAME", sizeof(kHeader.acMagic))) )
+		{
+			CORE3D_ERROR(_T("FrameReplay::Load() - File isn't a frame capture.\n"));
+			return INVALID_FORMAT;
+		}
+
+		memcpy(&kHeader, &m_vecFile[0], sizeof(kHeader));
+		if(CAPTURE_FILE_VERSION != kHeader.uiVersion)
+		{
+			CORE3D_ERROR(_T("FrameReplay::Load() - Unsupported capture file version.\n"));
+			return INVALID_FORMAT;
+		}
+
+		// COMMENT : Index the records, contents are looked up by their hash
+		const UINT32 uiFileSize = static_cast<UINT32>(m_vecFile.size());
+		UINT32 uiOffset = sizeof(kHeader);
+		while(uiOffset < uiFileSize)
+		{
+			CaptureRecordHeader kRecordHeader;
+			if(uiFileSize - uiOffset < sizeof(kRecordHeader))
+			{
+				CORE3D_ERROR(_T("FrameReplay::Load() - Capture file is truncated.\n"));
+				return INVALID_FORMAT;
+			}
+
+			memcpy(&kRecordHeader, &m_vecFile[uiOffset], sizeof(kRecordHeader));
+			uiOffset += sizeof(kRecordHeader);
+			if(uiFileSize - uiOffset < kRecordHeader.uiSize)
+			{
+				CORE3D_ERROR(_T("FrameReplay::Load() - Capture file is truncated.\n"));
+				return INVALID_FORMAT;
+			}
+
+			if(CRT_DATA == kRecordHeader.uiType)
+			{
+				if(kRecordHeader.uiSize < sizeof(UINT64))
+				{
+					CORE3D_ERROR(_T("FrameReplay::Load() - Invalid data record.\n"));
+					return INVALID_FORMAT;
+				}
+
+				UINT64 uiHash;
+				memcpy(&uiHash, &m_vecFile[uiOffset], sizeof(uiHash));
+				DataBlock kBlock = {uiOffset + static_cast<UINT32>(sizeof(uiHash)), kRecordHeader.uiSize - static_cast<UINT32>(sizeof(uiHash))};
+				m_mapData[uiHash] = kBlock;
+			}
+			else
+			{
+				Record kRecord = {kRecordHeader.uiType, uiOffset, kRecordHeader.uiSize};
+				m_vecRecords.push_back(kRecord);
+			}
+			uiOffset += kRecordHeader.uiSize;
+		}
+
+		return OK;
+	}
+
+	void FrameReplay::ReleaseObjects()
+	{
+		// COMMENT : The device doesn't reference bound objects, unbind them before they are released
+		if(NULL != m_pkDevice)
+		{
+			m_pkDevice->SetVertexFormat(NULL);
+			m_pkDevice->SetPrimitiveAssembler(NULL);
+			m_pkDevice->SetVertexShader(NULL);
+			m_pkDevice->SetTriangleShader(NULL);
+			m_pkDevice->SetPixelShader(NULL);
+			m_pkDevice->SetIndexBuffer(NULL);
+			m_pkDevice->SetRenderTarget(NULL);
+			for(UINT32 uiSampler = 0; uiSampler < MAX_TEXTURE_SAMPLERS; ++uiSampler) {m_pkDevice->SetTexture(uiSampler, NULL);}
+			for(UINT32 uiStream = 0; uiStream < MAX_VERTEX_STREAMS; ++uiStream) {m_pkDevice->SetVertexStream(uiStream, NULL, 0, 1);}
+		}
+
+		for(std::vector<ReplayObject>::iterator iterObject = m_vecObjects.begin(); iterObject != m_vecObjects.end(); ++iterObject)
+		{
+			CORE3D_SAFE_RELEASE(iterObject->pkObject);
+		}
+		m_vecObjects.clear();
+
+		m_pkDevice					= NULL;
+		m_pkPresentedRenderTarget	= NULL;
+		m_uiNumSubstitutedShaders	= 0;
+	}
+
+	RefObject* FrameReplay::FindObject(UINT32 uiId, UINT32 uiType)
+	{
+		if(0 == uiId || uiId >= m_vecObjects.size())	{return NULL;}
+		if(uiType != m_vecObjects[uiId].uiType)			{return NULL;}
+		return m_vecObjects[uiId].pkObject;
+	}
+
+	Result FrameReplay::SetObject(UINT32 uiId, UINT32 uiType, RefObject* pkObject)
+	{
+		if(0 == uiId)
+		{
+			CORE3D_SAFE_RELEASE(pkObject);
+			return INVALID_FORMAT;
+		}
+
+		if(uiId >= m_vecObjects.size())
+		{
+			ReplayObject kEmpty = {CRT_DATA, NULL};
+			m_vecObjects.resize(uiId + 1, kEmpty);
+		}
+
+		CORE3D_SAFE_RELEASE(m_vecObjects[uiId].pkObject);
+		m_vecObjects[uiId].uiType	= uiType;
+		m_vecObjects[uiId].pkObject	= pkObject;
+		return OK;
+	}
+
+	const BYTE8* FrameReplay::GetData(UINT64 uiHash, UINT32 uiSize)
+	{
+		std::map<UINT64, DataBlock>::iterator iterData = m_mapData.find(uiHash);
+		if(iterData == m_mapData.end() || iterData->second.uiSize != uiSize)
+		{
+			CORE3D_ERROR(_T("FrameReplay::GetData() - Contents are missing from the capture file.\n"));
+			return NULL;
+		}
+		return uiSize ? &m_vecFile[iterData->second.uiOffset] : NULL;
+	}
+
+	UINT64 FrameReplay::HashRenderTarget(RenderTarget* pkRenderTarget)
+	{
+		// COMMENT : Same as FrameCapture::HashRenderTarget()
+		UINT64 uiHash = HashCaptureData(NULL, 0);
+		if(NULL == pkRenderTarget) {return uiHash;}
+
+		Surface* apkBuffers[MAX_COLOR_BUFFERS + 2];
+		for(UINT32 uiIndex = 0; uiIndex < MAX_COLOR_BUFFERS; ++uiIndex) {apkBuffers[uiIndex] = pkRenderTarget->GetColorBuffer(uiIndex);}
+		apkBuffers[MAX_COLOR_BUFFERS]		= pkRenderTarget->GetDepthBuffer();
+		apkBuffers[MAX_COLOR_BUFFERS + 1]	= pkRenderTarget->GetStencilBuffer();
+		for(UINT32 uiBuffer = 0; uiBuffer < MAX_COLOR_BUFFERS + 2; ++uiBuffer)
+		{
+			if(NULL == apkBuffers[uiBuffer]) {continue;}
+
+			const UINT64 uiBufferHash = HashCaptureSurface(apkBuffers[uiBuffer]);
+			uiHash = HashCaptureData(&uiBufferHash, sizeof(uiBufferHash), uiHash);
+			CORE3D_SAFE_RELEASE(apkBuffers[uiBuffer]);
+		}
+		return uiHash;
+	}
+
+	Result FrameReplay::Execute(Device* pkDevice, bool bVerify)
+	{
+		if(NULL == pkDevice)
+		{
+			CORE3D_ERROR(_T("FrameReplay::Execute() - Parameter device pointers to NULL.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if(true == m_vecRecords.empty())
+		{
+			CORE3D_ERROR(_T("FrameReplay::Execute() - No frame loaded.\n"));
+			return INVALID_STATE;
+		}
+
+		if(pkDevice != m_pkDevice)
+		{
+			ReleaseObjects();
+			m_pkDevice = pkDevice;
+		}
+
+		m_vecDraws.clear();
+		m_fUploadSeconds		= 0.0;
+		m_uiCapturedFrameHash	= 0;
+		m_uiReplayedFrameHash	= 0;
+
+		for(std::vector<Record>::iterator iterRecord = m_vecRecords.begin(); iterRecord != m_vecRecords.end(); ++iterRecord)
+		{
+			const Result eResult = ExecuteRecord(*iterRecord, bVerify);
+			if(CORE3D_FAILED(eResult)) {return eResult;}
+		}
+
+		return OK;
+	}
+
+	Result FrameReplay::UploadBuffer(RecordReader& rkReader, bool bIndexBuffer)
+	{
+		const UINT32 uiId		= rkReader.ReadUINT32();
+		const UINT32 uiLength	= rkReader.ReadUINT32();
+		const Format eFormat	= bIndexBuffer ? (Format)rkReader.ReadUINT32() : FMT_R32F;
+		const UINT64 uiHash		= rkReader.ReadUINT64();
+		if(true == rkReader.Failed()) {return INVALID_FORMAT;}
+
+		const BYTE8* pData = GetData(uiHash, uiLength);
+		if(NULL == pData && 0 != uiLength) {return INVALID_FORMAT;}
+
+		const UINT32 uiType = bIndexBuffer ? CRT_INDEXBUFFER : CRT_VERTEXBUFFER;
+		RefObject* pkObject = FindObject(uiId, uiType);
+		if(NULL == pkObject)
+		{
+			Result eResult;
+			if(true == bIndexBuffer)
+			{
+				IndexBuffer* pkIndexBuffer = NULL;
+				eResult		= m_pkDevice->CreateIndexBuffer(&pkIndexBuffer, uiLength, eFormat);
+				pkObject	= pkIndexBuffer;
+			}
+			else
+			{
+				VertexBuffer* pkVertexBuffer = NULL;
+				eResult		= m_pkDevice->CreateVertexBuffer(&pkVertexBuffer, uiLength);
+				pkObject	= pkVertexBuffer;
+			}
+
+			if(CORE3D_FAILED(eResult)) {return eResult;}
+			SetObject(uiId, uiType, pkObject);
+		}
+
+		const FLOAT64 fStart = GetSeconds();
+		void* pvData = NULL;
+		const Result eResult = bIndexBuffer ? static_cast<IndexBuffer*>(pkObject)->GetPointer(0, &pvData) :
+			static_cast<VertexBuffer*>(pkObject)->GetPointer(0, &pvData);
+		if(CORE3D_FAILED(eResult)) {return eResult;}
+		memcpy(pvData, pData, uiLength);
+		m_fUploadSeconds += GetSeconds() - fStart;
+
+		return OK;
+	}
+
+	Result FrameReplay::UploadTexture(RecordReader& rkReader)
+	{
+		const UINT32 uiId			= rkReader.ReadUINT32();
+		const UINT32 uiTextureType	= rkReader.ReadUINT32();
+		const Format eFormat		= (Format)rkReader.ReadUINT32();
+		const UINT32 uiWidth		= rkReader.ReadUINT32();
+		const UINT32 uiHeight		= rkReader.ReadUINT32();
+		const UINT32 uiDepth		= rkReader.ReadUINT32();
+		const UINT32 uiMipLevels	= rkReader.ReadUINT32();
+		const UINT64 uiHash			= rkReader.ReadUINT64();
+		if(true == rkReader.Failed()) {return INVALID_FORMAT;}
+
+		RefObject* pkObject = FindObject(uiId, CRT_TEXTURE);
+		if(NULL == pkObject)
+		{
+			Result eResult = INVALID_FORMAT;
+			switch(uiTextureType)
+			{
+			case CTT_TEXTURE:
+				{
+					Texture* pkTexture = NULL;
+					eResult		= m_pkDevice->CreateTexture(&pkTexture, uiWidth, uiHeight, uiMipLevels, eFormat);
+					pkObject	= pkTexture;
+				}
+				break;
+			case CTT_CUBETEXTURE:
+				{
+					CubeTexture* pkCubeTexture = NULL;
+					eResult		= m_pkDevice->CreateCubeTexture(&pkCubeTexture, uiWidth, uiMipLevels, eFormat);
+					pkObject	= pkCubeTexture;
+				}
+				break;
+			case CTT_VOLUMETEXTURE:
+				{
+					VolumeTexture* pkVolumeTexture = NULL;
+					eResult		= m_pkDevice->CreateVolumeTexture(&pkVolumeTexture, uiWidth, uiHeight, uiDepth, uiMipLevels, eFormat);
+					pkObject	= pkVolumeTexture;
+				}
+				break;
+			}
+
+			if(CORE3D_FAILED(eResult)) {return eResult;}
+			SetObject(uiId, CRT_TEXTURE, pkObject);
+		}
+
+		// COMMENT : Collect the faces and levels in the order they were captured
+		const FLOAT64 fStart = GetSeconds();
+		std::vector<Texture*> vecTextures;
+		if(CTT_TEXTURE == uiTextureType)
+		{
+			Texture* pkTexture = static_cast<Texture*>(pkObject);
+			pkTexture->AddRef();
+			vecTextures.push_back(pkTexture);
+		}
+		else if(CTT_CUBETEXTURE == uiTextureType)
+		{
+			for(UINT32 uiFace = 0; uiFace < 6; ++uiFace) {vecTextures.push_back(static_cast<CubeTexture*>(pkObject)->GetCubeFace((CubeFaces)uiFace));}
+		}
+
+		UINT32 uiSize = 0;
+		for(std::vector<Texture*>::iterator iterTexture = vecTextures.begin(); iterTexture != vecTextures.end(); ++iterTexture)
+		{
+			for(UINT32 uiLevel = 0; uiLevel < uiMipLevels; ++uiLevel)
+			{
+				uiSize += (*iterTexture)->GetWidth(uiLevel) * (*iterTexture)->GetHeight(uiLevel) * (*iterTexture)->GetFormatFloats() * sizeof(FLOAT32);
+			}
+		}
+
+		VolumeTexture* pkVolumeTexture = (CTT_VOLUMETEXTURE == uiTextureType) ? static_cast<VolumeTexture*>(pkObject) : NULL;
+		if(NULL != pkVolumeTexture)
+		{
+			for(UINT32 uiLevel = 0; uiLevel < uiMipLevels; ++uiLevel)
+			{
+				uiSize += pkVolumeTexture->GetWidth(uiLevel) * pkVolumeTexture->GetHeight(uiLevel) *
+					pkVolumeTexture->GetDepth(uiLevel) * pkVolumeTexture->GetFormatFloats() * sizeof(FLOAT32);
+			}
+		}
+
+		const BYTE8* pData = GetData(uiHash, uiSize);
+		Result eResult = (NULL != pData || 0 == uiSize) ? OK : INVALID_FORMAT;
+		for(std::vector<Texture*>::iterator iterTexture = vecTextures.begin(); iterTexture != vecTextures.end(); ++iterTexture)
+		{
+			for(UINT32 uiLevel = 0; uiLevel < uiMipLevels && CORE3D_SUCCESSFUL(eResult); ++uiLevel)
+			{
+				const UINT32 uiLevelSize = (*iterTexture)->GetWidth(uiLevel) * (*iterTexture)->GetHeight(uiLevel) * (*iterTexture)->GetFormatFloats() * sizeof(FLOAT32);
+				void* pvData = NULL;
+				eResult = (*iterTexture)->LockRect(uiLevel, &pvData, NULL);
+				if(CORE3D_FAILED(eResult)) {break;}
+
+				memcpy(pvData, pData, uiLevelSize);
+				(*iterTexture)->UnlockRect(uiLevel);
+				pData += uiLevelSize;
+			}
+			CORE3D_SAFE_RELEASE(*iterTexture);
+		}
+
+		if(NULL != pkVolumeTexture)
+		{
+			for(UINT32 uiLevel = 0; uiLevel < uiMipLevels && CORE3D_SUCCESSFUL(eResult); ++uiLevel)
+			{
+				const UINT32 uiLevelSize = pkVolumeTexture->GetWidth(uiLevel) * pkVolumeTexture->GetHeight(uiLevel) *
+					pkVolumeTexture->GetDepth(uiLevel) * pkVolumeTexture->GetFormatFloats() * sizeof(FLOAT32);
+				void* pvData = NULL;
+				eResult = pkVolumeTexture->LockBox(uiLevel, &pvData, NULL);
+				if(CORE3D_FAILED(eResult)) {break;}
+
+				memcpy(pvData, pData, uiLevelSize);
+				pkVolumeTexture->UnlockBox(uiLevel);
+				pData += uiLevelSize;
+			}
+		}
+		m_fUploadSeconds += GetSeconds() - fStart;
+
+		return eResult;
+	}
+
+	Result FrameReplay::UploadSurface(RecordReader& rkReader)
+	{
+		const UINT32 uiId		= rkReader.ReadUINT32();
+		const Format eFormat	= (Format)rkReader.ReadUINT32();
+		const UINT32 uiWidth	= rkReader.ReadUINT32();
+		const UINT32 uiHeight	= rkReader.ReadUINT32();
+		const UINT64 uiHash		= rkReader.ReadUINT64();
+		if(true == rkReader.Failed()) {return INVALID_FORMAT;}
+
+		Surface* pkSurface = static_cast<Surface*>(FindObject(uiId, CRT_SURFACE));
+		if(NULL == pkSurface)
+		{
+			const Result eResult = m_pkDevice->CreateSurface(&pkSurface, uiWidth, uiHeight, eFormat);
+			if(CORE3D_FAILED(eResult)) {return eResult;}
+			SetObject(uiId, CRT_SURFACE, pkSurface);
+		}
+
+		const UINT32 uiSize		= pkSurface->GetWidth() * pkSurface->GetHeight() * pkSurface->GetFormatFloats() * sizeof(FLOAT32);
+		const BYTE8* pData		= GetData(uiHash, uiSize);
+		if(NULL == pData) {return INVALID_FORMAT;}
+
+		const FLOAT64 fStart = GetSeconds();
+		void* pvData = NULL;
+		const Result eResult = pkSurface->LockRect(&pvData, NULL);
+		if(CORE3D_FAILED(eResult)) {return eResult;}
+		memcpy(pvData, pData, uiSize);
+		pkSurface->UnlockRect();
+		m_fUploadSeconds += GetSeconds() - fStart;
+
+		return OK;
+	}
+
+	Result FrameReplay::CreateShader(RecordReader& rkReader)
+	{
+		const UINT32 uiId			= rkReader.ReadUINT32();
+		const UINT32 uiShaderType	= rkReader.ReadUINT32();
+		UINT32 auiOutputs[PIXEL_SHADER_REGISTERS];
+		rkReader.Read(auiOutputs, sizeof(auiOutputs));
+		const char* szName			= rkReader.ReadString();
+		if(true == rkReader.Failed()) {return INVALID_FORMAT;}
+
+		// COMMENT : Created once per device, only the constants change between executions
+		if(0 == uiId) {return INVALID_FORMAT;}
+		if(uiId < m_vecObjects.size() && CRT_SHADER == m_vecObjects[uiId].uiType) {return OK;}
+
+		RefObject* pkObject = NULL;
+		if(CST_PRIMITIVEASSEMBLER == uiShaderType)
+		{
+			std::map<std::string, PFN_CREATEPRIMITIVEASSEMBLER>::iterator iterFunction = m_mapPrimitiveAssemblerFunctions.find(szName);
+			if(iterFunction != m_mapPrimitiveAssemblerFunctions.end()) {pkObject = iterFunction->second();}
+		}
+		else
+		{
+			std::map<std::string, PFN_CREATESHADER>::iterator iterFunction = m_mapShaderFunctions.find(szName);
+			if(iterFunction != m_mapShaderFunctions.end())
+			{
+				// COMMENT : The registered function has to create a shader of the captured kind
+				BaseShader* pkShader = iterFunction->second();
+				bool bValid = false;
+				switch(uiShaderType)
+				{
+				case CST_VERTEXSHADER:		bValid = (NULL != dynamic_cast<VertexShader*>(pkShader));	break;
+				case CST_TRIANGLESHADER:	bValid = (NULL != dynamic_cast<TriangleShader*>(pkShader));	break;
+				case CST_PIXELSHADER:		bValid = (NULL != dynamic_cast<PixelShader*>(pkShader));	break;
+				}
+
+				if(false == bValid)
+				{
+					CORE3D_ERROR(_T("FrameReplay::CreateShader() - Registered function created a shader of another kind.\n"));
+					CORE3D_SAFE_RELEASE(pkShader);
+				}
+				pkObject = pkShader;
+			}
+		}
+
+		if(NULL == pkObject)
+		{
+			switch(uiShaderType)
+			{
+			case CST_VERTEXSHADER:	pkObject = new ReplayVertexShader(auiOutputs);	break;
+			case CST_PIXELSHADER:	pkObject = new ReplayPixelShader();				break;
+			}
+			++m_uiNumSubstitutedShaders;
+		}
+
+		// COMMENT : Unknown triangle shaders and primitive-assemblers keep a NULL entry, which is bound as NULL
+		if(NULL == pkObject)
+		{
+			if(uiId >= m_vecObjects.size())
+			{
+				ReplayObject kEmpty = {CRT_DATA, NULL};
+				m_vecObjects.resize(uiId + 1, kEmpty);
+			}
+			m_vecObjects[uiId].uiType = CRT_SHADER;
+			return OK;
+		}
+
+		return SetObject(uiId, CRT_SHADER, pkObject);
+	}
+
+	Result FrameReplay::ExecuteRecord(const Record& rkRecord, bool bVerify)
+	{
+		RecordReader kReader(rkRecord.uiSize ? &m_vecFile[rkRecord.uiOffset] : NULL, rkRecord.uiSize);
+		Device* pkDevice = m_pkDevice;
+
+		switch(rkRecord.uiType)
+		{
+		case CRT_VERTEXBUFFER:	return UploadBuffer(kReader, false);
+		case CRT_INDEXBUFFER:	return UploadBuffer(kReader, true);
+		case CRT_TEXTURE:		return UploadTexture(kReader);
+		case CRT_SURFACE:		return UploadSurface(kReader);
+		case CRT_SHADER:		return CreateShader(kReader);
+		case CRT_VERTEXFORMAT:
+			{
+				const UINT32 uiId			= kReader.ReadUINT32();
+				const UINT32 uiNumElements	= kReader.ReadUINT32();
+				if(true == kReader.Failed() || uiNumElements > rkRecord.uiSize / sizeof(VertexElement)) {return INVALID_FORMAT;}
+				if(NULL != FindObject(uiId, CRT_VERTEXFORMAT)) {return OK;}
+
+				std::vector<VertexElement> vecElements(uiNumElements);
+				if(0 != uiNumElements) {kReader.Read(&vecElements[0], uiNumElements * sizeof(VertexElement));}
+				if(true == kReader.Failed() || 0 == uiNumElements) {return INVALID_FORMAT;}
+
+				VertexFormat* pkVertexFormat = NULL;
+				const Result eResult = pkDevice->CreateVertexFormat(&pkVertexFormat, &vecElements[0], uiNumElements * sizeof(VertexElement));
+				if(CORE3D_FAILED(eResult)) {return eResult;}
+				return SetObject(uiId, CRT_VERTEXFORMAT, pkVertexFormat);
+			}
+		case CRT_RENDERTARGET:
+			{
+				const UINT32 uiId				= kReader.ReadUINT32();
+				UINT32 auiColorBuffers[MAX_COLOR_BUFFERS];
+				for(UINT32 uiIndex = 0; uiIndex < MAX_COLOR_BUFFERS; ++uiIndex) {auiColorBuffers[uiIndex] = kReader.ReadUINT32();}
+				const UINT32 uiDepthBuffer		= kReader.ReadUINT32();
+				const UINT32 uiStencilBuffer	= kReader.ReadUINT32();
+				Matrix4x4 matViewport;
+				kReader.Read(&matViewport, sizeof(matViewport));
+				if(true == kReader.Failed()) {return INVALID_FORMAT;}
+
+				RenderTarget* pkRenderTarget = static_cast<RenderTarget*>(FindObject(uiId, CRT_RENDERTARGET));
+				if(NULL == pkRenderTarget)
+				{
+					const Result eResult = pkDevice->CreateRenderTarget(&pkRenderTarget);
+					if(CORE3D_FAILED(eResult)) {return eResult;}
+					SetObject(uiId, CRT_RENDERTARGET, pkRenderTarget);
+				}
+
+				// COMMENT : Buffers are unbound first, so surfaces can move between the color-buffer indices
+				for(UINT32 uiIndex = 0; uiIndex < MAX_COLOR_BUFFERS; ++uiIndex) {pkRenderTarget->SetColorBuffer(uiIndex, NULL);}
+				pkRenderTarget->SetStencilBuffer(NULL);
+				Result eResult = OK;
+				for(UINT32 uiIndex = 0; uiIndex < MAX_COLOR_BUFFERS; ++uiIndex)
+				{
+					eResult = pkRenderTarget->SetColorBuffer(uiIndex, static_cast<Surface*>(FindObject(auiColorBuffers[uiIndex], CRT_SURFACE)));
+					if(CORE3D_FAILED(eResult)) {return eResult;}
+				}
+				eResult = pkRenderTarget->SetDepthBuffer(static_cast<Surface*>(FindObject(uiDepthBuffer, CRT_SURFACE)));
+				if(CORE3D_FAILED(eResult)) {return eResult;}
+				eResult = pkRenderTarget->SetStencilBuffer(static_cast<Surface*>(FindObject(uiStencilBuffer, CRT_SURFACE)));
+				if(CORE3D_FAILED(eResult)) {return eResult;}
+				pkRenderTarget->SetViewportMatrix(matViewport);
+				return OK;
+			}
+		case CRT_SHADERCONSTANTS:
+			{
+				const UINT32 uiId = kReader.ReadUINT32();
+				FLOAT32 afConstants[NUM_SHADER_CONSTANTS];
+				Vector4 akConstants[NUM_SHADER_CONSTANTS];
+				Matrix4x4 amatConstants[NUM_SHADER_CONSTANTS];
+				kReader.Read(afConstants, sizeof(afConstants));
+				kReader.Read(akConstants, sizeof(akConstants));
+				kReader.Read(amatConstants, sizeof(amatConstants));
+				if(true == kReader.Failed()) {return INVALID_FORMAT;}
+
+				// COMMENT : Ids of left out shaders have no object
+				BaseShader* pkShader = dynamic_cast<BaseShader*>(FindObject(uiId, CRT_SHADER));
+				if(NULL == pkShader) {return OK;}
+
+				for(UINT32 uiIndex = 0; uiIndex < NUM_SHADER_CONSTANTS; ++uiIndex)
+				{
+					pkShader->SetFloat(uiIndex, afConstants[uiIndex]);
+					pkShader->SetVector(uiIndex, akConstants[uiIndex]);
+					pkShader->SetMatrix(uiIndex, amatConstants[uiIndex]);
+				}
+				return OK;
+			}
+		case CRT_RENDERSTATES:
+			{
+				// COMMENT : Captures made before render-states were added leave the new ones at their current values
+				UINT32 auiRenderStates[RS_NUMRENDERSTATES];
+				const UINT32 uiStates = Min(rkRecord.uiSize / static_cast<UINT32>(sizeof(UINT32)), static_cast<UINT32>(RS_NUMRENDERSTATES));
+				kReader.Read(auiRenderStates, uiStates * sizeof(UINT32));
+				if(true == kReader.Failed()) {return INVALID_FORMAT;}
+
+				for(UINT32 uiState = 0; uiState < uiStates; ++uiState)
+				{
+					pkDevice->SetRenderState((RenderState)uiState, auiRenderStates[uiState]);
+				}
+				return OK;
+			}
+		case CRT_SAMPLER:
+			{
+				const UINT32 uiSampler	= kReader.ReadUINT32();
+				const UINT32 uiTexture	= kReader.ReadUINT32();
+				UINT32 auiStates[TSS_NUMTEXTURESAMPLERSTATES];
+				kReader.Read(auiStates, sizeof(auiStates));
+				if(true == kReader.Failed()) {return INVALID_FORMAT;}
+
+				Result eResult = pkDevice->SetTexture(uiSampler, static_cast<BaseTexture*>(FindObject(uiTexture, CRT_TEXTURE)));
+				if(CORE3D_FAILED(eResult)) {return eResult;}
+				for(UINT32 uiState = 0; uiState < TSS_NUMTEXTURESAMPLERSTATES; ++uiState)
+				{
+					pkDevice->SetTextureSamplerState(uiSampler, (TextureSamplerState)uiState, auiStates[uiState]);
+				}
+				return OK;
+			}
+		case CRT_VERTEXSTREAM:
+			{
+				const UINT32 uiStream		= kReader.ReadUINT32();
+				const UINT32 uiVertexBuffer	= kReader.ReadUINT32();
+				const UINT32 uiOffset		= kReader.ReadUINT32();
+				const UINT32 uiStride		= kReader.ReadUINT32();
+				if(true == kReader.Failed()) {return INVALID_FORMAT;}
+
+				// COMMENT : Streams which were never set have a stride of 0
+				if(0 == uiStride) {return OK;}
+				return pkDevice->SetVertexStream(uiStream, static_cast<VertexBuffer*>(FindObject(uiVertexBuffer, CRT_VERTEXBUFFER)), uiOffset, uiStride);
+			}
+		case CRT_BINDINGS:
+			{
+				UINT32 auiBindings[7];
+				kReader.Read(auiBindings, sizeof(auiBindings));
+				if(true == kReader.Failed()) {return INVALID_FORMAT;}
+
+				Result eResult = pkDevice->SetVertexFormat(static_cast<VertexFormat*>(FindObject(auiBindings[0], CRT_VERTEXFORMAT)));
+				if(CORE3D_FAILED(eResult)) {return eResult;}
+				pkDevice->SetPrimitiveAssembler(dynamic_cast<PrimitiveAssembler*>(FindObject(auiBindings[1], CRT_SHADER)));
+				eResult = pkDevice->SetVertexShader(dynamic_cast<VertexShader*>(FindObject(auiBindings[2], CRT_SHADER)));
+				if(CORE3D_FAILED(eResult)) {return eResult;}
+				pkDevice->SetTriangleShader(dynamic_cast<TriangleShader*>(FindObject(auiBindings[3], CRT_SHADER)));
+				pkDevice->SetPixelShader(dynamic_cast<PixelShader*>(FindObject(auiBindings[4], CRT_SHADER)));
+				pkDevice->SetIndexBuffer(static_cast<IndexBuffer*>(FindObject(auiBindings[5], CRT_INDEXBUFFER)));
+				pkDevice->SetRenderTarget(static_cast<RenderTarget*>(FindObject(auiBindings[6], CRT_RENDERTARGET)));
+				return OK;
+			}
+		case CRT_SCISSORRECT:
+			{
+				Rect rcScissorRect;
+				kReader.Read(&rcScissorRect, sizeof(rcScissorRect));
+				if(true == kReader.Failed()) {return INVALID_FORMAT;}
+
+				// COMMENT : The scissor rect is empty until it's set
+				if(rcScissorRect.uiLeft < rcScissorRect.uiRight && rcScissorRect.uiTop < rcScissorRect.uiBottom)
+				{
+					pkDevice->SetScissorRect(rcScissorRect);
+				}
+				return OK;
+			}
+		case CRT_CLIPPINGPLANES:
+			{
+				Plane akClippingPlanes[CP_NUMPLANES];
+				UINT32 auiEnabled[CP_NUMPLANES];
+				kReader.Read(akClippingPlanes, sizeof(akClippingPlanes));
+				kReader.Read(auiEnabled, sizeof(auiEnabled));
+				if(true == kReader.Failed()) {return INVALID_FORMAT;}
+
+				const FLOAT32 fMinZ = akClippingPlanes[CP_NEAR].d, fMaxZ = akClippingPlanes[CP_FAR].d;
+				if(fMinZ >= 0.0f && fMinZ < fMaxZ && fMaxZ <= 1.0f) {pkDevice->SetDepthBounds(fMinZ, fMaxZ);}
+				for(UINT32 uiPlane = CP_USER0; uiPlane < CP_NUMPLANES; ++uiPlane)
+				{
+					pkDevice->SetClippingPlane((ClippingPlanes)uiPlane, auiEnabled[uiPlane] ? &akClippingPlanes[uiPlane] : NULL);
+				}
+				return OK;
+			}
+		case CRT_DRAW:
+			{
+				ReplayDrawInfo kDraw;
+				kDraw.eDrawType = (CaptureDrawType)kReader.ReadUINT32();
+				kReader.Read(kDraw.auiParameters, sizeof(kDraw.auiParameters));
+				kDraw.uiCapturedHash = kReader.ReadUINT64();
+				if(true == kReader.Failed()) {return INVALID_FORMAT;}
+
+				const UINT32* puiParameters = kDraw.auiParameters;
+				const FLOAT64 fStart = GetSeconds();
+				switch(kDraw.eDrawType)
+				{
+				case CDT_PRIMITIVE:
+					kDraw.eResult = pkDevice->DrawPrimitive((PrimitiveType)puiParameters[0], puiParameters[1], puiParameters[2]);
+					break;
+				case CDT_INDEXEDPRIMITIVE:
+					kDraw.eResult = pkDevice->DrawIndexedPrimitive((PrimitiveType)puiParameters[0], puiParameters[1], puiParameters[2],
+						puiParameters[3], puiParameters[4], puiParameters[5]);
+					break;
+				case CDT_DYNAMICPRIMITIVE:
+					kDraw.eResult = pkDevice->DrawDynamicPrimitive(puiParameters[0], puiParameters[1]);
+					break;
+				default:
+					return INVALID_FORMAT;
+				}
+				kDraw.fSeconds			= GetSeconds() - fStart;
+				kDraw.uiRenderedPixels	= pkDevice->GetRenderedPixels();
+				kDraw.uiReplayedHash	= 0;
+
+				if(true == bVerify)
+				{
+					RenderTarget* pkRenderTarget = pkDevice->GetRenderTarget();
+					kDraw.uiReplayedHash = HashRenderTarget(pkRenderTarget);
+					CORE3D_SAFE_RELEASE(pkRenderTarget);
+				}
+
+				// COMMENT : Failed draws are reported per draw, the frame goes on like the captured one did
+				m_vecDraws.push_back(kDraw);
+				return OK;
+			}
+		case CRT_PRESENT:
+			{
+				const UINT32 uiId		= kReader.ReadUINT32();
+				m_uiCapturedFrameHash	= kReader.ReadUINT64();
+				if(true == kReader.Failed()) {return INVALID_FORMAT;}
+
+				m_pkPresentedRenderTarget	= static_cast<RenderTarget*>(FindObject(uiId, CRT_RENDERTARGET));
+				m_uiReplayedFrameHash		= HashRenderTarget(m_pkPresentedRenderTarget);
+				return OK;
+			}
+		}
+
+		// COMMENT : Unknown records are skipped, newer captures may add them
+		return OK;
+	}
+
+	UINT32 FrameReplay::GetNumDraws()
+	{
+		return static_cast<UINT32>(m_vecDraws.size());
+	}
+
+	const ReplayDrawInfo& FrameReplay::GetDrawInfo(UINT32 uiDraw)
+	{
+		return m_vecDraws[uiDraw];
+	}
+
+	UINT32 FrameReplay::GetNumSubstitutedShaders()
+	{
+		return m_uiNumSubstitutedShaders;
+	}
+
+	FLOAT64 FrameReplay::GetUploadSeconds()
+	{
+		return m_fUploadSeconds;
+	}
+
+	UINT64 FrameReplay::GetCapturedFrameHash()
+	{
+		return m_uiCapturedFrameHash;
+	}
+
+	UINT64 FrameReplay::GetReplayedFrameHash()
+	{
+		return m_uiReplayedFrameHash;
+	}
+
+	RenderTarget* FrameReplay::GetPresentedRenderTarget()
+	{
+		return m_pkPresentedRenderTarget;
+	}
+}
@@ -0,0 +1,126 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+#include "FrameCapture.h"
+#include <string>
+
+namespace Core3D
+{
+	class PrimitiveAssembler;
+
+	typedef BaseShader* (*PFN_CREATESHADER)();
+	typedef PrimitiveAssembler* (*PFN_CREATEPRIMITIVEASSEMBLER)();
+
+	// COMMENT : Describes a replayed draw.
+	struct ReplayDrawInfo
+	{
+		CaptureDrawType	eDrawType;
+		UINT32			auiParameters[6];		// Draw parameters, see CaptureDrawType
+		Result			eResult;				// Result of the device's draw call
+		FLOAT64			fSeconds;				// Time spent in the device's draw call
+		UINT32			uiRenderedPixels;
+		UINT64			uiCapturedHash;			// Hash of the render-target's buffers after the captured draw
+		UINT64			uiReplayedHash;			// Hash of the render-target's buffers after the replayed draw(0 unless verified)
+	};
+
+	// COMMENT : Loads a frame written by Device::CaptureNextFrame() and executes it on a device.
+	// Shaders and primitive-assemblers are created by the functions registered for their captured class names,
+	// which are the typeid(...).name() of the capturing build. Unknown vertex and pixel shaders are replaced by
+	// pass-through shaders, which keep the frame's geometry and pixel load but not its colors. Unknown triangle
+	// shaders are left out and draws with an unknown primitive-assembler fail.
+	class FrameReplay
+	{
+	public:
+		FrameReplay();
+		~FrameReplay();
+
+		void	RegisterShader(const char* szName, PFN_CREATESHADER pfnCreateShader);
+		void	RegisterPrimitiveAssembler(const char* szName, PFN_CREATEPRIMITIVEASSEMBLER pfnCreatePrimitiveAssembler);
+
+		Result	Load(const char* szFileName);
+
+		// COMMENT : Executes the frame from its first record, which uploads the captured contents of all resources,
+		// so every execution renders the same frame. Objects are created on the first execution with a device.
+		// With bVerify set, the render-target is hashed after each draw for comparison with the capture.
+		Result	Execute(Device* pkDevice, bool bVerify);
+
+		UINT32	GetNumDraws();
+		const ReplayDrawInfo& GetDrawInfo(UINT32 uiDraw);
+		UINT32	GetNumSubstitutedShaders();
+		FLOAT64	GetUploadSeconds();					// Time spent uploading resource contents in the last execution
+		UINT64	GetCapturedFrameHash();
+		UINT64	GetReplayedFrameHash();
+		RenderTarget* GetPresentedRenderTarget();
+	private:
+		FrameReplay(const FrameReplay&);
+		FrameReplay& operator=(const FrameReplay&);
+
+		struct Record
+		{
+			UINT32		uiType;
+			UINT32		uiOffset;
+			UINT32		uiSize;
+		};
+
+		struct DataBlock
+		{
+			UINT32		uiOffset;
+			UINT32		uiSize;
+		};
+
+		struct ReplayObject
+		{
+			UINT32		uiType;					// CaptureRecordType which created the object
+			RefObject*	pkObject;
+		};
+
+		// COMMENT : Reads a record's fields with bounds checking
+		class RecordReader
+		{
+		public:
+			RecordReader(const BYTE8* pData, UINT32 uiSize) : m_pData(pData), m_uiSize(uiSize), m_uiPosition(0), m_bFailed(false) {}
+
+			void	Read(void* pvData, UINT32 uiSize);
+			UINT32	ReadUINT32();
+			UINT64	ReadUINT64();
+			const char* ReadString();
+			bool	Failed() const {return m_bFailed;}
+		private:
+			const BYTE8*	m_pData;
+			UINT32			m_uiSize;
+			UINT32			m_uiPosition;
+			bool			m_bFailed;
+		};
+	private:
+		void	ReleaseObjects();
+		RefObject* FindObject(UINT32 uiId, UINT32 uiType);
+		Result	SetObject(UINT32 uiId, UINT32 uiType, RefObject* pkObject);
+		const BYTE8* GetData(UINT64 uiHash, UINT32 uiSize);
+		UINT64	HashRenderTarget(RenderTarget* pkRenderTarget);
+
+		Result	ExecuteRecord(const Record& rkRecord, bool bVerify);
+		Result	UploadBuffer(RecordReader& rkReader, bool bIndexBuffer);
+		Result	UploadTexture(RecordReader& rkReader);
+		Result	UploadSurface(RecordReader& rkReader);
+		Result	CreateShader(RecordReader& rkReader);
+	private:
+		std::map<std::string, PFN_CREATESHADER>				m_mapShaderFunctions;
+		std::map<std::string, PFN_CREATEPRIMITIVEASSEMBLER>	m_mapPrimitiveAssemblerFunctions;
+
+		std::vector<BYTE8>				m_vecFile;
+		std::vector<Record>				m_vecRecords;
+		std::map<UINT64, DataBlock>		m_mapData;
+
+		Device*							m_pkDevice;
+		std::vector<ReplayObject>		m_vecObjects;			// Indexed by captured object id
+		std::vector<ReplayDrawInfo>		m_vecDraws;
+		UINT32							m_uiNumSubstitutedShaders;
+		FLOAT64							m_fUploadSeconds;
+		UINT64							m_uiCapturedFrameHash;
+		UINT64							m_uiReplayedFrameHash;
+		RenderTarget*					m_pkPresentedRenderTarget;
+	};
+}
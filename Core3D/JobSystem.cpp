@@ -0,0 +1,344 @@
+#include "JobSystem.h"
+
+namespace Core3D
+{
+	// COMMENT : Jobs which don't fit into a full deque are executed immediately by the submitting thread
+	static const UINT32 JOB_QUEUE_SIZE = 1024;
+
+	// COMMENT : Job system and deque of the calling thread, if it is a worker
+	static CORE3D_THREAD_LOCAL JobSystem*	s_pkWorkerJobSystem	= NULL;
+	static CORE3D_THREAD_LOCAL UINT32		s_uiWorkerQueue		= 0;
+
+	struct JobSystem::JobQueue
+	{
+		Mutex	kLock;
+		Job		akJobs[JOB_QUEUE_SIZE];
+		UINT32	uiTop;		// Jobs are stolen from the top
+		UINT32	uiBottom;	// and pushed and popped by the owner at the bottom
+	};
+
+	//---------------------------------------------------------------------------------------
+	// COMMENT : JobCounter
+	JobCounter::JobCounter()
+		: m_iPendingJobs(0)
+		, m_pkDependentJobs(NULL)
+	{
+
+	}
+
+	JobCounter::~JobCounter()
+	{
+		// COMMENT : Dependent jobs are only left if the counter was never finished
+		while(NULL != m_pkDependentJobs)
+		{
+			Job* pkJob			= m_pkDependentJobs;
+			m_pkDependentJobs	= pkJob->pkNext;
+			delete pkJob;
+		}
+	}
+
+	bool JobCounter::IsDone()
+	{
+		// COMMENT : Locking waits for the thread finishing the last job, so the counter may be destroyed afterwards
+		m_kLock.Lock();
+		const bool bDone = (0 == m_iPendingJobs);
+		m_kLock.Unlock();
+		return bDone;
+	}
+
+	//---------------------------------------------------------------------------------------
+	// COMMENT : JobSystem
+	JobSystem::JobSystem()
+		: m_pkQueues(NULL)
+		, m_pkWorkers(NULL)
+		, m_uiNumWorkers(0)
+		, m_iSleepingWorkers(0)
+		, m_iQuit(0)
+	{
+
+	}
+
+	JobSystem::~JobSystem()
+	{
+		AtomicExchange(&m_iQuit, 1);
+		m_kWakeUp.Post(m_uiNumWorkers);
+		for(UINT32 uiWorker = 0; uiWorker < m_uiNumWorkers; ++uiWorker) {m_pkWorkers[uiWorker].kThread.Join();}
+
+		CORE3D_SAFE_DELETEARRAY(m_pkWorkers);
+		CORE3D_SAFE_DELETEARRAY(m_pkQueues);
+	}
+
+	Result JobSystem::Create(UINT32 uiNumThreads)
+	{
+		if(NULL != m_pkQueues)
+		{
+			CORE3D_ERROR(_T("JobSystem::Create() - Job system has already been created.\n"));
+			return INVALID_STATE;
+		}
+
+		if(0 == uiNumThreads) {uiNumThreads = GetNumProcessors();}
+		if(uiNumThreads > MAX_WORKER_THREADS) {uiNumThreads = MAX_WORKER_THREADS;}
+
+		// COMMENT : The thread waiting for jobs executes them as well
+		const UINT32 NUM_WORKERS = uiNumThreads - 1;
+		m_pkQueues = new JobQueue[NUM_WORKERS + 1];
+		if(NULL == m_pkQueues)
+		{
+			CORE3D_ERROR(_T("JobSystem::Create() - Out of memory, cannot create job queues.\n"));
+			return OUT_OF_MEMORY;
+		}
+
+		for(UINT32 uiQueue = 0; uiQueue <= NUM_WORKERS; ++uiQueue)
+		{
+			m_pkQueues[uiQueue].uiTop		= 0;
+			m_pkQueues[uiQueue].uiBottom	= 0;
+		}
+
+		if(0 == NUM_WORKERS) {return OK;}
+
+		m_pkWorkers = new Worker[NUM_WORKERS];
+		if(NULL == m_pkWorkers)
+		{
+			CORE3D_ERROR(_T("JobSystem::Create() - Out of memory, cannot create worker threads.\n"));
+			return OUT_OF_MEMORY;
+		}
+
+		// COMMENT : Workers read the number of queues, so it has to be set before they are started.
+		// Queues of workers which couldn't be started are simply never used.
+		m_uiNumWorkers = NUM_WORKERS;
+		for(UINT32 uiWorker = 0; uiWorker < NUM_WORKERS; ++uiWorker)
+		{
+			m_pkWorkers[uiWorker].pkJobSystem	= this;
+			m_pkWorkers[uiWorker].uiQueue		= uiWorker;
+			if(CORE3D_FAILED(m_pkWorkers[uiWorker].kThread.Start(WorkerThread, &m_pkWorkers[uiWorker])))
+			{
+				CORE3D_NOTIFY(_T("JobSystem::Create() - Couldn't start all worker threads.\n"));
+				break;
+			}
+		}
+		return OK;
+	}
+
+	UINT32 JobSystem::GetNumWorkers()
+	{
+		return m_uiNumWorkers;
+	}
+
+	Result JobSystem::Submit(JobCounter* pkCounter, PFN_JOBFUNCTION pfnJob, void* pvData, UINT32 uiBegin /* = 0 */, 
+		UINT32 uiEnd /* = 1 */, UINT32 uiGrainSize /* = 1 */, JobCounter* pkDependency /* = NULL */)
+	{
+		if((NULL == pkCounter) || (NULL == pfnJob))
+		{
+			CORE3D_ERROR(_T("JobSystem::Submit() - Parameter counter or job function pointers to NULL.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if(NULL == m_pkQueues)
+		{
+			CORE3D_ERROR(_T("JobSystem::Submit() - Job system hasn't been created.\n"));
+			return INVALID_STATE;
+		}
+
+		if(uiBegin >= uiEnd) {return OK;}
+
+		Job kJob;
+		kJob.pfnJob			= pfnJob;
+		kJob.pvData			= pvData;
+		kJob.uiBegin		= uiBegin;
+		kJob.uiEnd			= uiEnd;
+		kJob.uiGrainSize	= (0 != uiGrainSize) ? uiGrainSize : 1;
+		kJob.pkCounter		= pkCounter;
+		kJob.pkNext			= NULL;
+		AtomicIncrement(&pkCounter->m_iPendingJobs);
+
+		if(NULL != pkDependency)
+		{
+			pkDependency->m_kLock.Lock();
+			if(0 != pkDependency->m_iPendingJobs)
+			{
+				// COMMENT : Started by the thread finishing the dependency's last job
+				Job* pkDependentJob = new Job(kJob);
+				if(NULL == pkDependentJob)
+				{
+					pkDependency->m_kLock.Unlock();
+					AtomicDecrement(&pkCounter->m_iPendingJobs);
+					CORE3D_ERROR(_T("JobSystem::Submit() - Out of memory, cannot create job.\n"));
+					return OUT_OF_MEMORY;
+				}
+				pkDependentJob->pkNext				= pkDependency->m_pkDependentJobs;
+				pkDependency->m_pkDependentJobs		= pkDependentJob;
+				pkDependency->m_kLock.Unlock();
+				return OK;
+			}
+			pkDependency->m_kLock.Unlock();
+		}
+
+		const UINT32 uiQueue = GetCurrentQueue();
+		if(false == PushJob(uiQueue, kJob)) {ExecuteJob(uiQueue, kJob);}
+		return OK;
+	}
+
+	void JobSystem::Wait(JobCounter* pkCounter)
+	{
+		if((NULL == pkCounter) || (NULL == m_pkQueues)) {return;}
+
+		// COMMENT : Help executing jobs instead of sleeping, the awaited ones may be waiting in a deque
+		const UINT32 uiQueue = GetCurrentQueue();
+		while(0 != AtomicAdd(&pkCounter->m_iPendingJobs, 0))
+		{
+			Job kJob;
+			if(true == GetJob(uiQueue, kJob))	{ExecuteJob(uiQueue, kJob);}
+			else								{YieldThread();}
+		}
+
+		// COMMENT : The thread which finished the last job may still hold the lock
+		pkCounter->m_kLock.Lock();
+		pkCounter->m_kLock.Unlock();
+	}
+
+	Result JobSystem::ParallelFor(PFN_JOBFUNCTION pfnJob, void* pvData, UINT32 uiBegin, UINT32 uiEnd, UINT32 uiGrainSize /* = 1 */)
+	{
+		JobCounter kCounter;
+		Result eResult = Submit(&kCounter, pfnJob, pvData, uiBegin, uiEnd, uiGrainSize);
+		if(CORE3D_FAILED(eResult)) {return eResult;}
+
+		Wait(&kCounter);
+		return OK;
+	}
+
+	void JobSystem::WorkerThread(void* pvWorker)
+	{
+		Worker* pkWorker		= reinterpret_cast<Worker*>(pvWorker);
+		JobSystem* pkJobSystem	= pkWorker->pkJobSystem;
+		const UINT32 uiQueue	= pkWorker->uiQueue;
+
+		s_pkWorkerJobSystem		= pkJobSystem;
+		s_uiWorkerQueue			= uiQueue;
+
+		for(;;)
+		{
+			Job kJob;
+			if(true == pkJobSystem->GetJob(uiQueue, kJob))
+			{
+				pkJobSystem->ExecuteJob(uiQueue, kJob);
+				continue;
+			}
+
+			// COMMENT : Announce going to sleep before looking for jobs a last time.
+			// Threads pushing a job afterwards see the sleeping worker and wake it up.
+			AtomicIncrement(&pkJobSystem->m_iSleepingWorkers);
+			if(true == pkJobSystem->GetJob(uiQueue, kJob))
+			{
+				AtomicDecrement(&pkJobSystem->m_iSleepingWorkers);
+				pkJobSystem->ExecuteJob(uiQueue, kJob);
+				continue;
+			}
+
+			if(0 != AtomicAdd(&pkJobSystem->m_iQuit, 0))
+			{
+				AtomicDecrement(&pkJobSystem->m_iSleepingWorkers);
+				break;
+			}
+
+			pkJobSystem->m_kWakeUp.Wait();
+			AtomicDecrement(&pkJobSystem->m_iSleepingWorkers);
+		}
+	}
+
+	UINT32 JobSystem::GetCurrentQueue()
+	{
+		return (this == s_pkWorkerJobSystem) ? s_uiWorkerQueue : m_uiNumWorkers;
+	}
+
+	bool JobSystem::PushJob(UINT32 uiQueue, const Job& rkJob)
+	{
+		JobQueue& rkQueue = m_pkQueues[uiQueue];
+		rkQueue.kLock.Lock();
+		if(JOB_QUEUE_SIZE == rkQueue.uiBottom - rkQueue.uiTop)
+		{
+			rkQueue.kLock.Unlock();
+			return false;
+		}
+		rkQueue.akJobs[rkQueue.uiBottom % JOB_QUEUE_SIZE] = rkJob;
+		++rkQueue.uiBottom;
+		rkQueue.kLock.Unlock();
+
+		if(0 != AtomicAdd(&m_iSleepingWorkers, 0)) {m_kWakeUp.Post();}
+		return true;
+	}
+
+	bool JobSystem::GetJob(UINT32 uiQueue, Job& rkJob)
+	{
+		// COMMENT : Newest job of the own deque first, it most likely works on data which is still cached
+		JobQueue& rkOwnQueue = m_pkQueues[uiQueue];
+		rkOwnQueue.kLock.Lock();
+		if(rkOwnQueue.uiBottom != rkOwnQueue.uiTop)
+		{
+			--rkOwnQueue.uiBottom;
+			rkJob = rkOwnQueue.akJobs[rkOwnQueue.uiBottom % JOB_QUEUE_SIZE];
+			rkOwnQueue.kLock.Unlock();
+			return true;
+		}
+		rkOwnQueue.kLock.Unlock();
+
+		// COMMENT : Steal the oldest job of another deque, which usually is the largest piece of a range
+		for(UINT32 uiVictim = 1; uiVictim <= m_uiNumWorkers; ++uiVictim)
+		{
+			JobQueue& rkQueue = m_pkQueues[(uiQueue + uiVictim) % (m_uiNumWorkers + 1)];
+			rkQueue.kLock.Lock();
+			if(rkQueue.uiBottom != rkQueue.uiTop)
+			{
+				rkJob = rkQueue.akJobs[rkQueue.uiTop % JOB_QUEUE_SIZE];
+				++rkQueue.uiTop;
+				rkQueue.kLock.Unlock();
+				return true;
+			}
+			rkQueue.kLock.Unlock();
+		}
+		return false;
+	}
+
+	void JobSystem::ExecuteJob(UINT32 uiQueue, Job& rkJob)
+	{
+		// COMMENT : Split off upper halves for other workers until the range is small enough
+		while(rkJob.uiEnd - rkJob.uiBegin > rkJob.uiGrainSize)
+		{
+			Job kUpperHalf		= rkJob;
+			kUpperHalf.uiBegin	= rkJob.uiBegin + (rkJob.uiEnd - rkJob.uiBegin) / 2;
+
+			AtomicIncrement(&rkJob.pkCounter->m_iPendingJobs);
+			if(false == PushJob(uiQueue, kUpperHalf))
+			{
+				AtomicDecrement(&rkJob.pkCounter->m_iPendingJobs);
+				break;
+			}
+			rkJob.uiEnd = kUpperHalf.uiBegin;
+		}
+
+		rkJob.pfnJob(rkJob.pvData, rkJob.uiBegin, rkJob.uiEnd);
+		FinishJob(uiQueue, rkJob.pkCounter);
+	}
+
+	void JobSystem::FinishJob(UINT32 uiQueue, JobCounter* pkCounter)
+	{
+		pkCounter->m_kLock.Lock();
+		if(0 != AtomicDecrement(&pkCounter->m_iPendingJobs))
+		{
+			pkCounter->m_kLock.Unlock();
+			return;
+		}
+		Job* pkDependentJobs			= pkCounter->m_pkDependentJobs;
+		pkCounter->m_pkDependentJobs	= NULL;
+		pkCounter->m_kLock.Unlock();
+
+		// COMMENT : The counter may already be destroyed, only the detached dependent jobs are left
+		while(NULL != pkDependentJobs)
+		{
+			Job* pkJob		= pkDependentJobs;
+			pkDependentJobs	= pkJob->pkNext;
+			pkJob->pkNext	= NULL;
+			if(false == PushJob(uiQueue, *pkJob)) {ExecuteJob(uiQueue, *pkJob);}
+			delete pkJob;
+		}
+	}
+}
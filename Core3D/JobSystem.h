@@ -0,0 +1,94 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+#include "Core3DThread.h"
+
+namespace Core3D
+{
+	class JobSystem;
+	class JobCounter;
+
+	// COMMENT : Function executed by a job for the indices [uiBegin, uiEnd) of its range.
+	typedef void (*PFN_JOBFUNCTION)(void* pvData, UINT32 uiBegin, UINT32 uiEnd);
+
+	struct Job
+	{
+		PFN_JOBFUNCTION	pfnJob;
+		void*			pvData;
+		UINT32			uiBegin, uiEnd;
+		UINT32			uiGrainSize;	// Larger ranges are split in halves, which idle workers can steal
+		JobCounter*		pkCounter;
+		Job*			pkNext;			// Next job waiting for the same dependency
+	};
+
+	// COMMENT : Counts the unfinished jobs submitted with it.
+	// Jobs may depend on a counter, they are started as soon as it reaches 0.
+	class JobCounter
+	{
+	public:
+		JobCounter();
+		~JobCounter();
+
+		bool	IsDone();
+	private:
+		friend class JobSystem;
+
+		JobCounter(const JobCounter&);
+		JobCounter& operator=(const JobCounter&);
+	private:
+		volatile INT32	m_iPendingJobs;
+		Mutex			m_kLock;
+		Job*			m_pkDependentJobs;
+	};
+
+	// COMMENT : Work-stealing scheduler. Every worker thread owns a deque of jobs, it pushes and pops jobs
+	// at the bottom while idle workers steal from the top of the others. Threads which aren't workers share
+	// one more deque. Threads waiting for a counter execute jobs meanwhile, so jobs may wait for other jobs.
+	class JobSystem
+	{
+	public:
+		JobSystem();
+		~JobSystem();
+
+		Result	Create(UINT32 uiNumThreads);
+		UINT32	GetNumWorkers();
+
+		// COMMENT : Runs pfnJob for the range [uiBegin, uiEnd) in pieces of at most uiGrainSize indices.
+		// The job starts once pkDependency(optional) is done, pkCounter is done after all pieces have finished.
+		Result	Submit(JobCounter* pkCounter, PFN_JOBFUNCTION pfnJob, void* pvData, UINT32 uiBegin = 0, UINT32 uiEnd = 1, 
+			UINT32 uiGrainSize = 1, JobCounter* pkDependency = NULL);
+		void	Wait(JobCounter* pkCounter);
+
+		// COMMENT : Submit() and Wait() in one call.
+		Result	ParallelFor(PFN_JOBFUNCTION pfnJob, void* pvData, UINT32 uiBegin, UINT32 uiEnd, UINT32 uiGrainSize = 1);
+	private:
+		JobSystem(const JobSystem&);
+		JobSystem& operator=(const JobSystem&);
+
+		struct JobQueue;
+		struct Worker
+		{
+			JobSystem*	pkJobSystem;
+			UINT32		uiQueue;
+			Thread		kThread;
+		};
+		static void WorkerThread(void* pvWorker);
+
+		UINT32	GetCurrentQueue();
+		bool	PushJob(UINT32 uiQueue, const Job& rkJob);
+		bool	GetJob(UINT32 uiQueue, Job& rkJob);
+		void	ExecuteJob(UINT32 uiQueue, Job& rkJob);
+		void	FinishJob(UINT32 uiQueue, JobCounter* pkCounter);
+	private:
+		JobQueue*		m_pkQueues;				// One per worker and a shared one for all other threads
+		Worker*			m_pkWorkers;
+		UINT32			m_uiNumWorkers;
+
+		Semaphore		m_kWakeUp;
+		volatile INT32	m_iSleepingWorkers;
+		volatile INT32	m_iQuit;
+	};
+}
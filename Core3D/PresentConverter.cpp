@@ -0,0 +1,456 @@
+#include "PresentConverter.h"
+
+#include <emmintrin.h>
+
+//---------------------------------------------------------------------------------------
+// COMMENT : AVX kernels are compiled per function and selected at run-time
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#	include <immintrin.h>
+#	define CORE3D_AVX_SUPPORT
+#	define CORE3D_AVX_FUNCTION __attribute__((target("avx")))
+#elif defined(_MSC_VER) && (_MSC_FULL_VER >= 160040219)
+#	include <immintrin.h>
+#	include <intrin.h>
+#	define CORE3D_AVX_SUPPORT
+#	define CORE3D_AVX_FUNCTION
+#endif
+//---------------------------------------------------------------------------------------
+
+namespace Core3D
+{
+	// COMMENT : Number of rows converted by one job at least
+	static const UINT32 MIN_ROWS_PER_JOB	= 16;
+
+	static const FLOAT32 NO_DITHER[4]		= {0.0f, 0.0f, 0.0f, 0.0f};
+
+	static bool SupportsAVX()
+	{
+	#	if defined(CORE3D_AVX_SUPPORT) && defined(__GNUC__)
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx") ? true : false;
+	#	elif defined(CORE3D_AVX_SUPPORT)
+		INT32 aiInfo[4];
+		__cpuid(aiInfo, 1);
+		// COMMENT : Requires OSXSAVE and AVX bits as well as OS support for saving YMM registers
+		if((0 == (aiInfo[2] & (1 << 27))) || (0 == (aiInfo[2] & (1 << 28)))) {return false;}
+		return (6 == (_xgetbv(0) & 6));
+	#	else
+		return false;
+	#	endif
+	}
+
+	PresentConverter::PresentConverter()
+		: m_pkJobSystem(NULL)
+		, m_bBusy(false)
+		, m_bAVX(false)
+		, m_pDestination(NULL)
+		, m_uiDestPitch(0)
+		, m_eFormat(PF_R8G8B8A8)
+		, m_pfSource(NULL)
+		, m_uiFloats(0)
+		, m_uiWidth(0)
+		, m_uiHeight(0)
+	{
+		m_kConversion.eToneMapping	= TM_NONE;
+		m_kConversion.fExposure		= 1.0f;
+		m_kConversion.bDither		= false;
+
+		const UINT16 DEFAULT_SHIFT[3]	= {11, 5, 0};
+		const UINT16 DEFAULT_MAXVAL[3]	= {31, 63, 31};
+		SetCustom16BitLayout(DEFAULT_SHIFT, DEFAULT_MAXVAL);
+
+		// COMMENT : 4x4 Bayer matrix, thresholds are in units of the destination's least significant bit
+		const UINT32 BAYER_MATRIX[4][4] =
+		{
+			{ 0,  8,  2, 10},
+			{12,  4, 14,  6},
+			{ 3, 11,  1,  9},
+			{15,  7, 13,  5}
+		};
+		for(UINT32 uiY = 0; uiY < 4; ++uiY)
+		{
+			for(UINT32 uiX = 0; uiX < 4; ++uiX)
+			{
+				m_afDitherLUT[uiY][uiX] = (static_cast<FLOAT32>(BAYER_MATRIX[uiY][uiX]) + 0.5f) / 16.0f;
+			}
+		}
+	}
+
+	PresentConverter::~PresentConverter()
+	{
+		Wait();
+	}
+
+	Result PresentConverter::Create(JobSystem* pkJobSystem)
+	{
+		// COMMENT : Without a job system frames are converted by the thread calling Wait()
+		m_pkJobSystem	= pkJobSystem;
+		m_bAVX			= SupportsAVX();
+		return OK;
+	}
+
+	void PresentConverter::SetConversion(const PresentConversion& rkConversion)
+	{
+		Wait();
+		m_kConversion = rkConversion;
+	}
+
+	void PresentConverter::SetCustom16BitLayout(const UINT16* puiShift, const UINT16* puiMaxValue)
+	{
+		Wait();
+		for(UINT32 uiChannel = 0; uiChannel < 3; ++uiChannel)
+		{
+			m_aui16BitShift[uiChannel]	= puiShift[uiChannel];
+			m_aui16BitMaxVal[uiChannel]	= puiMaxValue[uiChannel];
+		}
+	}
+
+	UINT32 PresentConverter::GetFormatBytes(PresentFormat eFormat)
+	{
+		switch(eFormat)
+		{
+		case PF_R8G8B8A8:
+		case PF_B8G8R8A8:	return 4;
+		case PF_B8G8R8:		return 3;
+		case PF_R5G6B5:
+		case PF_CUSTOM16:	return 2;
+		default:			return 0;
+		}
+	}
+
+	Result PresentConverter::Begin(BYTE8* pDestination, UINT32 uiDestPitch, PresentFormat eFormat,
+		const FLOAT32* pfSource, UINT32 uiFloats, UINT32 uiWidth, UINT32 uiHeight)
+	{
+		Wait();
+
+		if((NULL == pDestination) || (NULL == pfSource))
+		{
+			CORE3D_ERROR(_T("PresentConverter::Begin() - Parameter source or destination pointers to NULL.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if((uiFloats < 3) || (uiFloats > 4) || (0 == GetFormatBytes(eFormat)))
+		{
+			CORE3D_ERROR(_T("PresentConverter::Begin() - Invalid source or destination format.\n"));
+			return INVALID_FORMAT;
+		}
+
+		m_pDestination	= pDestination;
+		m_uiDestPitch	= uiDestPitch;
+		m_eFormat		= eFormat;
+		m_pfSource		= pfSource;
+		m_uiFloats		= uiFloats;
+		m_uiWidth		= uiWidth;
+		m_uiHeight		= uiHeight;
+
+		m_bBusy			= true;
+
+		if(NULL != m_pkJobSystem)
+		{
+			// COMMENT : Split the frame for all threads, but not into pieces smaller than MIN_ROWS_PER_JOB
+			const UINT32 NUM_THREADS	= m_pkJobSystem->GetNumWorkers() + 1;
+			UINT32 uiRowsPerJob			= (uiHeight + NUM_THREADS - 1) / NUM_THREADS;
+			if(uiRowsPerJob < MIN_ROWS_PER_JOB) {uiRowsPerJob = MIN_ROWS_PER_JOB;}
+
+			Result eResult = m_pkJobSystem->Submit(&m_kRowsConverted, ConvertRowsJob, this, 0, uiHeight, uiRowsPerJob);
+			if(CORE3D_FAILED(eResult)) {m_bBusy = false; return eResult;}
+		}
+		return OK;
+	}
+
+	void PresentConverter::Wait()
+	{
+		if(false == m_bBusy) {return;}
+
+		if(NULL != m_pkJobSystem)	{m_pkJobSystem->Wait(&m_kRowsConverted);}
+		else						{ConvertRowsJob(this, 0, m_uiHeight);}
+		m_bBusy = false;
+	}
+
+	Result PresentConverter::Convert(BYTE8* pDestination, UINT32 uiDestPitch, PresentFormat eFormat,
+		const FLOAT32* pfSource, UINT32 uiFloats, UINT32 uiWidth, UINT32 uiHeight)
+	{
+		Result eResult = Begin(pDestination, uiDestPitch, eFormat, pfSource, uiFloats, uiWidth, uiHeight);
+		if(CORE3D_FAILED(eResult)) {return eResult;}
+
+		Wait();
+		return OK;
+	}
+
+	void PresentConverter::ConvertRowsJob(void* pvConverter, UINT32 uiFirstRow, UINT32 uiEndRow)
+	{
+		PresentConverter* pkConverter = reinterpret_cast<PresentConverter*>(pvConverter);
+		for(UINT32 uiY = uiFirstRow; uiY < uiEndRow; ++uiY) {pkConverter->ConvertRow(uiY);}
+	}
+
+	void PresentConverter::ConvertRow(UINT32 uiY)
+	{
+		const FLOAT32* pfSource	= m_pfSource + uiY * m_uiWidth * m_uiFloats;
+		BYTE8* pDestination		= m_pDestination + uiY * m_uiDestPitch;
+		const FLOAT32* pfDither	= m_kConversion.bDither ? m_afDitherLUT[uiY & 3] : NO_DITHER;
+
+		// COMMENT : SIMD kernels load 4 floats per pixel, so the very last pixel of a 3-float frame is left to the scalar path
+		UINT32 uiSIMDPixels		= m_uiWidth;
+		if((3 == m_uiFloats) && (uiY + 1 == m_uiHeight) && (0 != uiSIMDPixels)) {--uiSIMDPixels;}
+
+		UINT32 uiX = 0;
+		switch(m_eFormat)
+		{
+		case PF_R8G8B8A8:
+		case PF_B8G8R8A8:
+			if((true == m_bAVX) && (4 == m_uiFloats))
+			{
+				uiX = uiSIMDPixels & ~7;
+				ConvertPixels8BitAVX(pDestination, pfSource, uiX, pfDither);
+				break;
+			}
+			// COMMENT : Falls through to the SSE kernel
+		case PF_B8G8R8:
+			uiX = uiSIMDPixels & ~3;
+			ConvertPixels8BitSSE(pDestination, pfSource, uiX, pfDither);
+			break;
+		case PF_R5G6B5:
+			uiX = uiSIMDPixels & ~3;
+			ConvertPixels565SSE(pDestination, pfSource, uiX, pfDither);
+			break;
+		default:
+			break;
+		}
+
+		ConvertPixelsScalar(pDestination + uiX * GetFormatBytes(m_eFormat), pfSource + uiX * m_uiFloats, uiX, m_uiWidth, pfDither);
+	}
+
+	//---------------------------------------------------------------------------------------
+	// COMMENT : Kernels. All of them perform the same floating-point operations in the same order
+	// (exposure, tone-mapping, scale, dither, clamp, truncation), so their results are identical.
+	void PresentConverter::ConvertPixelsScalar(BYTE8* pDestination, const FLOAT32* pfSource, UINT32 uiX, UINT32 uiEndX, const FLOAT32* pfDither)
+	{
+		const UINT32 DEST_BYTES		= GetFormatBytes(m_eFormat);
+		const bool bToneMapping		= (TM_NONE != m_kConversion.eToneMapping) || (1.0f != m_kConversion.fExposure);
+		const bool bReinhard		= (TM_REINHARD == m_kConversion.eToneMapping);
+
+		FLOAT32 afScale[3]			= {255.0f, 255.0f, 255.0f};
+		switch(m_eFormat)
+		{
+		case PF_R5G6B5:		afScale[0] = 31.0f; afScale[1] = 63.0f; afScale[2] = 31.0f; break;
+		case PF_CUSTOM16:
+			for(UINT32 uiChannel = 0; uiChannel < 3; ++uiChannel) {afScale[uiChannel] = static_cast<FLOAT32>(m_aui16BitMaxVal[uiChannel]);}
+			break;
+		default: break;
+		}
+
+		for(; uiX < uiEndX; ++uiX)
+		{
+			const FLOAT32 fDither	= pfDither[uiX & 3];
+			INT32 aiColor[4];
+			for(UINT32 uiChannel = 0; uiChannel < 3; ++uiChannel)
+			{
+				FLOAT32 fValue = pfSource[uiChannel];
+				if(true == bToneMapping)
+				{
+					fValue *= m_kConversion.fExposure;
+					if(true == bReinhard) {fValue = fValue / (1.0f + fValue);}
+				}
+				fValue = fValue * afScale[uiChannel] + fDither;
+				fValue = (fValue > 0.0f) ? fValue : 0.0f;
+				fValue = (fValue < afScale[uiChannel]) ? fValue : afScale[uiChannel];
+				aiColor[uiChannel] = static_cast<INT32>(fValue);
+			}
+
+			if(m_uiFloats > 3)
+			{
+				FLOAT32 fAlpha	= pfSource[3] * 255.0f;
+				fAlpha			= (fAlpha > 0.0f) ? fAlpha : 0.0f;
+				fAlpha			= (fAlpha < 255.0f) ? fAlpha : 255.0f;
+				aiColor[3]		= static_cast<INT32>(fAlpha);
+			}
+			else {aiColor[3] = 255;}
+
+			switch(m_eFormat)
+			{
+			case PF_R8G8B8A8:
+				pDestination[0] = static_cast<BYTE8>(aiColor[0]);
+				pDestination[1] = static_cast<BYTE8>(aiColor[1]);
+				pDestination[2] = static_cast<BYTE8>(aiColor[2]);
+				pDestination[3] = static_cast<BYTE8>(aiColor[3]);
+				break;
+			case PF_B8G8R8A8:
+				pDestination[3] = static_cast<BYTE8>(aiColor[3]);
+				// COMMENT : Falls through to write blue, green and red
+			case PF_B8G8R8:
+				pDestination[0] = static_cast<BYTE8>(aiColor[2]);
+				pDestination[1] = static_cast<BYTE8>(aiColor[1]);
+				pDestination[2] = static_cast<BYTE8>(aiColor[0]);
+				break;
+			case PF_R5G6B5:
+				*reinterpret_cast<UINT16*>(pDestination) = static_cast<UINT16>((aiColor[0] << 11) | (aiColor[1] << 5) | aiColor[2]);
+				break;
+			case PF_CUSTOM16:
+				*reinterpret_cast<UINT16*>(pDestination) = static_cast<UINT16>((aiColor[0] << m_aui16BitShift[0]) |
+					(aiColor[1] << m_aui16BitShift[1]) | (aiColor[2] << m_aui16BitShift[2]));
+				break;
+			}
+
+			pfSource		+= m_uiFloats;
+			pDestination	+= DEST_BYTES;
+		}
+	}
+
+	void PresentConverter::ConvertPixels8BitSSE(BYTE8* pDestination, const FLOAT32* pfSource, UINT32 uiPixels, const FLOAT32* pfDither)
+	{
+		const bool bToneMapping		= (TM_NONE != m_kConversion.eToneMapping) || (1.0f != m_kConversion.fExposure);
+		const bool bReinhard		= (TM_REINHARD == m_kConversion.eToneMapping);
+		const bool bSwapRedBlue		= (PF_R8G8B8A8 != m_eFormat);
+		const bool bAlpha			= (m_uiFloats > 3);
+		const FLOAT32 EXPOSURE		= m_kConversion.fExposure;
+
+		const __m128 ZERO			= _mm_setzero_ps();
+		const __m128 ONE			= _mm_set1_ps(1.0f);
+		const __m128 SCALE			= _mm_set1_ps(255.0f);
+		const __m128 EXPOSURE_RGB	= _mm_setr_ps(EXPOSURE, EXPOSURE, EXPOSURE, 1.0f);
+		const __m128 MASK_RGB		= _mm_setr_ps(1.0f, 1.0f, 1.0f, 0.0f);
+		const __m128 SELECT_RGB		= _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+		const __m128 ALPHA_ONE		= _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+		const __m128 DITHER[4]		=
+		{
+			_mm_setr_ps(pfDither[0], pfDither[0], pfDither[0], 0.0f),
+			_mm_setr_ps(pfDither[1], pfDither[1], pfDither[1], 0.0f),
+			_mm_setr_ps(pfDither[2], pfDither[2], pfDither[2], 0.0f),
+			_mm_setr_ps(pfDither[3], pfDither[3], pfDither[3], 0.0f)
+		};
+
+		for(UINT32 uiPixel = 0; uiPixel < uiPixels; uiPixel += 4)
+		{
+			__m128i aiPixels[4];
+			for(UINT32 i = 0; i < 4; ++i)
+			{
+				__m128 kColor = _mm_loadu_ps(pfSource);
+				if(false == bAlpha) {kColor = _mm_or_ps(_mm_and_ps(kColor, SELECT_RGB), ALPHA_ONE);}
+				if(true == bToneMapping)
+				{
+					kColor = _mm_mul_ps(kColor, EXPOSURE_RGB);
+					if(true == bReinhard) {kColor = _mm_div_ps(kColor, _mm_add_ps(ONE, _mm_mul_ps(kColor, MASK_RGB)));}
+				}
+				kColor = _mm_add_ps(_mm_mul_ps(kColor, SCALE), DITHER[i]);
+				kColor = _mm_min_ps(_mm_max_ps(kColor, ZERO), SCALE);
+				if(true == bSwapRedBlue) {kColor = _mm_shuffle_ps(kColor, kColor, _MM_SHUFFLE(3, 0, 1, 2));}
+				aiPixels[i] = _mm_cvttps_epi32(kColor);
+				pfSource += m_uiFloats;
+			}
+
+			const __m128i BYTES = _mm_packus_epi16(_mm_packs_epi32(aiPixels[0], aiPixels[1]), _mm_packs_epi32(aiPixels[2], aiPixels[3]));
+			if(PF_B8G8R8 != m_eFormat)
+			{
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(pDestination), BYTES);
+				pDestination += 16;
+			}
+			else
+			{
+				BYTE8 aPixels[16];
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(aPixels), BYTES);
+				for(UINT32 i = 0; i < 4; ++i, pDestination += 3) {memcpy(pDestination, &aPixels[i * 4], 3);}
+			}
+		}
+	}
+
+	void PresentConverter::ConvertPixels565SSE(BYTE8* pDestination, const FLOAT32* pfSource, UINT32 uiPixels, const FLOAT32* pfDither)
+	{
+		const bool bToneMapping		= (TM_NONE != m_kConversion.eToneMapping) || (1.0f != m_kConversion.fExposure);
+		const bool bReinhard		= (TM_REINHARD == m_kConversion.eToneMapping);
+		const FLOAT32 EXPOSURE		= m_kConversion.fExposure;
+
+		const __m128 ZERO			= _mm_setzero_ps();
+		const __m128 ONE			= _mm_set1_ps(1.0f);
+		const __m128 SCALE			= _mm_setr_ps(31.0f, 63.0f, 31.0f, 0.0f);
+		const __m128 EXPOSURE_RGB	= _mm_set1_ps(EXPOSURE);
+		const __m128i BIAS			= _mm_set1_epi32(0x8000);
+		const __m128i BIAS16		= _mm_set1_epi16(static_cast<INT16>(0x8000));
+
+		for(UINT32 uiPixel = 0; uiPixel < uiPixels; uiPixel += 4)
+		{
+			__m128 akPixels[4];
+			for(UINT32 i = 0; i < 4; ++i)
+			{
+				__m128 kColor = _mm_loadu_ps(pfSource);
+				if(true == bToneMapping)
+				{
+					kColor = _mm_mul_ps(kColor, EXPOSURE_RGB);
+					if(true == bReinhard) {kColor = _mm_div_ps(kColor, _mm_add_ps(ONE, kColor));}
+				}
+				kColor = _mm_add_ps(_mm_mul_ps(kColor, SCALE), _mm_set1_ps(pfDither[i]));
+				kColor = _mm_min_ps(_mm_max_ps(kColor, ZERO), SCALE);
+				akPixels[i] = _mm_castsi128_ps(_mm_cvttps_epi32(kColor));
+				pfSource += m_uiFloats;
+			}
+
+			// COMMENT : Transpose to one register per channel and combine the channels
+			_MM_TRANSPOSE4_PS(akPixels[0], akPixels[1], akPixels[2], akPixels[3]);
+			__m128i kPixels = _mm_or_si128(_mm_or_si128(
+				_mm_slli_epi32(_mm_castps_si128(akPixels[0]), 11),
+				_mm_slli_epi32(_mm_castps_si128(akPixels[1]), 5)),
+				_mm_castps_si128(akPixels[2]));
+
+			// COMMENT : Unsigned 32 to 16 bit pack using the signed pack instruction
+			kPixels = _mm_packs_epi32(_mm_sub_epi32(kPixels, BIAS), _mm_sub_epi32(kPixels, BIAS));
+			kPixels = _mm_xor_si128(kPixels, BIAS16);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(pDestination), kPixels);
+			pDestination += 8;
+		}
+	}
+
+	#ifdef CORE3D_AVX_SUPPORT
+	CORE3D_AVX_FUNCTION void PresentConverter::ConvertPixels8BitAVX(BYTE8* pDestination, const FLOAT32* pfSource, UINT32 uiPixels, const FLOAT32* pfDither)
+	{
+		// COMMENT : Only used for 4-float sources, each register holds two pixels
+		const bool bToneMapping		= (TM_NONE != m_kConversion.eToneMapping) || (1.0f != m_kConversion.fExposure);
+		const bool bReinhard		= (TM_REINHARD == m_kConversion.eToneMapping);
+		const bool bSwapRedBlue		= (PF_R8G8B8A8 != m_eFormat);
+		const FLOAT32 EXPOSURE		= m_kConversion.fExposure;
+
+		const __m256 ZERO			= _mm256_setzero_ps();
+		const __m256 ONE			= _mm256_set1_ps(1.0f);
+		const __m256 SCALE			= _mm256_set1_ps(255.0f);
+		const __m256 EXPOSURE_RGB	= _mm256_setr_ps(EXPOSURE, EXPOSURE, EXPOSURE, 1.0f, EXPOSURE, EXPOSURE, EXPOSURE, 1.0f);
+		const __m256 MASK_RGB		= _mm256_setr_ps(1.0f, 1.0f, 1.0f, 0.0f, 1.0f, 1.0f, 1.0f, 0.0f);
+		const __m256 DITHER[2]		=
+		{
+			_mm256_setr_ps(pfDither[0], pfDither[0], pfDither[0], 0.0f, pfDither[1], pfDither[1], pfDither[1], 0.0f),
+			_mm256_setr_ps(pfDither[2], pfDither[2], pfDither[2], 0.0f, pfDither[3], pfDither[3], pfDither[3], 0.0f)
+		};
+
+		for(UINT32 uiPixel = 0; uiPixel < uiPixels; uiPixel += 8)
+		{
+			__m128i aiPixels[8];
+			for(UINT32 i = 0; i < 4; ++i)
+			{
+				__m256 kColor = _mm256_loadu_ps(pfSource);
+				if(true == bToneMapping)
+				{
+					kColor = _mm256_mul_ps(kColor, EXPOSURE_RGB);
+					if(true == bReinhard) {kColor = _mm256_div_ps(kColor, _mm256_add_ps(ONE, _mm256_mul_ps(kColor, MASK_RGB)));}
+				}
+				kColor = _mm256_add_ps(_mm256_mul_ps(kColor, SCALE), DITHER[i & 1]);
+				kColor = _mm256_min_ps(_mm256_max_ps(kColor, ZERO), SCALE);
+				if(true == bSwapRedBlue) {kColor = _mm256_permute_ps(kColor, _MM_SHUFFLE(3, 0, 1, 2));}
+
+				const __m256i INTEGERS	= _mm256_cvttps_epi32(kColor);
+				aiPixels[i * 2 + 0]		= _mm256_castsi256_si128(INTEGERS);
+				aiPixels[i * 2 + 1]		= _mm256_extractf128_si256(INTEGERS, 1);
+				pfSource += 8;
+			}
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pDestination),
+				_mm_packus_epi16(_mm_packs_epi32(aiPixels[0], aiPixels[1]), _mm_packs_epi32(aiPixels[2], aiPixels[3])));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pDestination + 16),
+				_mm_packus_epi16(_mm_packs_epi32(aiPixels[4], aiPixels[5]), _mm_packs_epi32(aiPixels[6], aiPixels[7])));
+			pDestination += 32;
+		}
+		_mm256_zeroupper();
+	}
+	#else
+	void PresentConverter::ConvertPixels8BitAVX(BYTE8* pDestination, const FLOAT32* pfSource, UINT32 uiPixels, const FLOAT32* pfDither)
+	{
+		ConvertPixels8BitSSE(pDestination, pfSource, uiPixels, pfDither);
+	}
+	#endif
+}
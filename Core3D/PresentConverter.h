@@ -0,0 +1,63 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+#include "JobSystem.h"
+
+namespace Core3D
+{
+	// COMMENT : Converts floating-point color-buffers to display formats.
+	// Rows are converted by jobs, the calling thread helps converting in Wait().
+	class PresentConverter
+	{
+	public:
+		PresentConverter();
+		~PresentConverter();
+
+		Result	Create(JobSystem* pkJobSystem);
+
+		void	SetConversion(const PresentConversion& rkConversion);
+		void	SetCustom16BitLayout(const UINT16* puiShift, const UINT16* puiMaxValue);
+
+		// COMMENT : Starts the conversion of a frame and returns immediately.
+		// Source and destination have to stay valid and untouched until Wait() returns.
+		Result	Begin(BYTE8* pDestination, UINT32 uiDestPitch, PresentFormat eFormat,
+			const FLOAT32* pfSource, UINT32 uiFloats, UINT32 uiWidth, UINT32 uiHeight);
+		void	Wait();
+		Result	Convert(BYTE8* pDestination, UINT32 uiDestPitch, PresentFormat eFormat,
+			const FLOAT32* pfSource, UINT32 uiFloats, UINT32 uiWidth, UINT32 uiHeight);
+
+		static UINT32 GetFormatBytes(PresentFormat eFormat);
+	private:
+		PresentConverter(const PresentConverter&);
+		PresentConverter& operator=(const PresentConverter&);
+
+		static void ConvertRowsJob(void* pvConverter, UINT32 uiFirstRow, UINT32 uiEndRow);
+
+		void	ConvertRow(UINT32 uiY);
+		void	ConvertPixelsScalar(BYTE8* pDestination, const FLOAT32* pfSource, UINT32 uiX, UINT32 uiEndX, const FLOAT32* pfDither);
+		void	ConvertPixels8BitSSE(BYTE8* pDestination, const FLOAT32* pfSource, UINT32 uiPixels, const FLOAT32* pfDither);
+		void	ConvertPixels565SSE(BYTE8* pDestination, const FLOAT32* pfSource, UINT32 uiPixels, const FLOAT32* pfDither);
+		void	ConvertPixels8BitAVX(BYTE8* pDestination, const FLOAT32* pfSource, UINT32 uiPixels, const FLOAT32* pfDither);
+	private:
+		JobSystem*			m_pkJobSystem;
+		JobCounter			m_kRowsConverted;
+		bool				m_bBusy;
+		bool				m_bAVX;
+
+		PresentConversion	m_kConversion;
+		UINT16				m_aui16BitShift[3];
+		UINT16				m_aui16BitMaxVal[3];
+		FLOAT32				m_afDitherLUT[4][4];
+
+		// COMMENT : Frame which is currently converted
+		BYTE8*				m_pDestination;
+		UINT32				m_uiDestPitch;
+		PresentFormat		m_eFormat;
+		const FLOAT32*		m_pfSource;
+		UINT32				m_uiFloats;
+		UINT32				m_uiWidth, m_uiHeight;
+	};
+}
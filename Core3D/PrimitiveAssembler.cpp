@@ -1,6 +1,6 @@
-#include "PrimitiveAssembler.h"
-
-namespace Core3D
-{
-
+#include "PrimitiveAssembler.h"
+
+namespace Core3D
+{
+
 }
\ No newline at end of file
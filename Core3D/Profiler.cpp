@@ -0,0 +1,208 @@
+#include "Profiler.h"
+#include <stdio.h>
+
+namespace Core3D
+{
+	static const char* const PROFILE_STAGE_NAMES[PST_NUMSTAGES] =
+	{
+		"Setup", "Vertex fetch", "Subdivision", "Clipping", "Triangle setup", "Rasterization", "Pixel shading", "Texture sampling"
+	};
+
+	// COMMENT : Threads are numbered in the order they first record an event
+	static volatile INT32				s_iNumProfiledThreads	= 0;
+	static CORE3D_THREAD_LOCAL UINT32	s_uiProfiledThread		= 0;
+
+	static UINT32 GetProfiledThread()
+	{
+		if(0 == s_uiProfiledThread) {s_uiProfiledThread = static_cast<UINT32>(AtomicIncrement(&s_iNumProfiledThreads));}
+		return s_uiProfiledThread;
+	}
+
+	// COMMENT : Writes a string as a JSON string literal
+	static void WriteJSONString(FILE* pkFile, const char* szString)
+	{
+		fputc('"', pkFile);
+		for( ; 0 != *szString; ++szString)
+		{
+			const unsigned char ucChar = static_cast<unsigned char>(*szString);
+			if('"' == ucChar || '\\' == ucChar)	{fputc('\\', pkFile); fputc(ucChar, pkFile);}
+			else if(ucChar < 0x20)				{fprintf(pkFile, "\\u%04x", ucChar);}
+			else								{fputc(ucChar, pkFile);}
+		}
+		fputc('"', pkFile);
+	}
+
+	Profiler::Profiler()
+		: m_bEnabled(false)
+		, m_uiNextEvent(0)
+		, m_uiNumEvents(0)
+		, m_uiLostEvents(0)
+	{
+		m_uiCalibrationTimeStamp	= ReadTimeStamp();
+		m_fCalibrationSeconds		= GetSeconds();
+	}
+
+	Profiler::~Profiler()
+	{
+
+	}
+
+	void Profiler::SetEnabled(bool bEnabled)
+	{
+		m_kLock.Lock();
+		// COMMENT : The ring buffer is only allocated for profilers which are used
+		if(true == bEnabled && true == m_vecEvents.empty()) {m_vecEvents.resize(PROFILER_MAX_EVENTS);}
+		m_bEnabled = bEnabled;
+		m_kLock.Unlock();
+	}
+
+	void Profiler::Clear()
+	{
+		m_kLock.Lock();
+		m_uiNextEvent	= 0;
+		m_uiNumEvents	= 0;
+		m_uiLostEvents	= 0;
+		m_kLock.Unlock();
+	}
+
+	void Profiler::AddEvent(const char* szName, const char* szDetail, UINT64 uiBegin, UINT64 uiEnd, const UINT64* puiStageTicks /* = NULL */)
+	{
+		const UINT32 uiThread = GetProfiledThread();
+
+		m_kLock.Lock();
+		if(true == m_vecEvents.empty()) {m_kLock.Unlock(); return;}
+
+		ProfileEvent& rkEvent = m_vecEvents[m_uiNextEvent];
+		m_uiNextEvent = (m_uiNextEvent + 1) % static_cast<UINT32>(m_vecEvents.size());
+		if(m_uiNumEvents < m_vecEvents.size())	{++m_uiNumEvents;}
+		else									{++m_uiLostEvents;}
+
+		rkEvent.szName		= szName;
+		rkEvent.uiThread	= uiThread;
+		rkEvent.uiBegin		= uiBegin;
+		rkEvent.uiEnd		= uiEnd;
+		rkEvent.acDetail[0]	= 0;
+		if(NULL != szDetail)
+		{
+			strncpy(rkEvent.acDetail, szDetail, sizeof(rkEvent.acDetail) - 1);
+			rkEvent.acDetail[sizeof(rkEvent.acDetail) - 1] = 0;
+		}
+
+		rkEvent.bStages = (NULL != puiStageTicks);
+		if(true == rkEvent.bStages) {memcpy(rkEvent.auiStageTicks, puiStageTicks, sizeof(rkEvent.auiStageTicks));}
+		m_kLock.Unlock();
+	}
+
+	UINT32 Profiler::GetNumEvents()
+	{
+		return m_uiNumEvents;
+	}
+
+	UINT32 Profiler::GetLostEvents()
+	{
+		return m_uiLostEvents;
+	}
+
+	FLOAT64 Profiler::GetTimeStampFrequency()
+	{
+		// COMMENT : Measure for at least 10ms since the profiler was created
+		UINT64 uiTimeStamp	= ReadTimeStamp();
+		FLOAT64 fSeconds	= GetSeconds() - m_fCalibrationSeconds;
+		while(fSeconds < 0.01)
+		{
+			YieldThread();
+			uiTimeStamp	= ReadTimeStamp();
+			fSeconds	= GetSeconds() - m_fCalibrationSeconds;
+		}
+		return static_cast<FLOAT64>(uiTimeStamp - m_uiCalibrationTimeStamp) / fSeconds;
+	}
+
+	Result Profiler::ExportChromeTrace(const char* szFileName)
+	{
+		if(NULL == szFileName)
+		{
+			CORE3D_ERROR(_T("Profiler::ExportChromeTrace() - Parameter file name pointers to NULL.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		FILE* pkFile = fopen(szFileName, "w");
+		if(NULL == pkFile)
+		{
+			CORE3D_ERROR(_T("Profiler::ExportChromeTrace() - Couldn't create trace file.\n"));
+			return UNKNOWN;
+		}
+
+		const FLOAT64 fMicroSecondsPerTick = 1e6 / GetTimeStampFrequency();
+
+		m_kLock.Lock();
+		const UINT32 uiCapacity		= static_cast<UINT32>(m_vecEvents.size());
+		const UINT32 uiFirstEvent	= (0 != uiCapacity) ? (m_uiNextEvent + uiCapacity - m_uiNumEvents) % uiCapacity : 0;
+
+		// COMMENT : Times are written relative to the earliest event
+		UINT64 uiOrigin = 0;
+		for(UINT32 uiEvent = 0; uiEvent < m_uiNumEvents; ++uiEvent)
+		{
+			const ProfileEvent& rkEvent = m_vecEvents[(uiFirstEvent + uiEvent) % uiCapacity];
+			if(0 == uiEvent || rkEvent.uiBegin < uiOrigin) {uiOrigin = rkEvent.uiBegin;}
+		}
+
+		fprintf(pkFile, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+		bool bFirst = true;
+		for(UINT32 uiEvent = 0; uiEvent < m_uiNumEvents; ++uiEvent)
+		{
+			const ProfileEvent& rkEvent = m_vecEvents[(uiFirstEvent + uiEvent) % uiCapacity];
+			const FLOAT64 fBegin		= static_cast<FLOAT64>(rkEvent.uiBegin - uiOrigin) * fMicroSecondsPerTick;
+			const FLOAT64 fDuration		= static_cast<FLOAT64>(rkEvent.uiEnd - rkEvent.uiBegin) * fMicroSecondsPerTick;
+
+			fprintf(pkFile, "%s{\"name\":", (true == bFirst) ? "" : ",\n");
+			WriteJSONString(pkFile, rkEvent.szName);
+			fprintf(pkFile, ",\"cat\":\"Core3D\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{",
+				rkEvent.uiThread, fBegin, fDuration);
+			bFirst = false;
+
+			bool bFirstArgument = true;
+			if(0 != rkEvent.acDetail[0])
+			{
+				fprintf(pkFile, "\"detail\":");
+				WriteJSONString(pkFile, rkEvent.acDetail);
+				bFirstArgument = false;
+			}
+
+			if(true == rkEvent.bStages)
+			{
+				for(UINT32 uiStage = 0; uiStage < PST_NUMSTAGES; ++uiStage)
+				{
+					fprintf(pkFile, "%s\"%s(us)\":%.3f", (true == bFirstArgument) ? "" : ",", PROFILE_STAGE_NAMES[uiStage],
+						static_cast<FLOAT64>(rkEvent.auiStageTicks[uiStage]) * fMicroSecondsPerTick);
+					bFirstArgument = false;
+				}
+			}
+			fprintf(pkFile, "}}");
+
+			if(false == rkEvent.bStages) {continue;}
+
+			// COMMENT : Stages are interleaved per triangle, so they are laid out one after another within the draw
+			FLOAT64 fStageBegin = fBegin;
+			for(UINT32 uiStage = 0; uiStage < PST_NUMSTAGES; ++uiStage)
+			{
+				if(0 == rkEvent.auiStageTicks[uiStage]) {continue;}
+
+				const FLOAT64 fStageDuration = static_cast<FLOAT64>(rkEvent.auiStageTicks[uiStage]) * fMicroSecondsPerTick;
+				fprintf(pkFile, ",\n{\"name\":\"%s\",\"cat\":\"Core3D stage\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}",
+					PROFILE_STAGE_NAMES[uiStage], rkEvent.uiThread, fStageBegin, fStageDuration);
+				fStageBegin += fStageDuration;
+			}
+		}
+		m_kLock.Unlock();
+
+		fprintf(pkFile, "\n]}\n");
+		const bool bFailed = (0 != ferror(pkFile));
+		fclose(pkFile);
+		if(true == bFailed)
+		{
+			CORE3D_ERROR(_T("Profiler::ExportChromeTrace() - Couldn't write trace file.\n"));
+			return UNKNOWN;
+		}
+		return OK;
+	}
+}
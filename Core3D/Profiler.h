@@ -0,0 +1,89 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+#include "Core3DThread.h"
+#include <vector>
+
+namespace Core3D
+{
+	// COMMENT : Number of events kept by a profiler, older events are overwritten
+	const UINT32 PROFILER_MAX_EVENTS = 16384;
+
+	struct ProfileEvent
+	{
+		const char*	szName;							// Static string
+		char		acDetail[64];					// Copy of the event's detail, e.g. the loaded file
+		UINT32		uiThread;						// Profiler's number of the recording thread
+		UINT64		uiBegin;						// Time-stamps, see ReadTimeStamp()
+		UINT64		uiEnd;
+		bool		bStages;
+		UINT64		auiStageTicks[PST_NUMSTAGES];	// Time-stamp ticks spent in each stage of a draw
+	};
+
+	// COMMENT : Keeps timed events of any thread in a ring buffer and writes them as a Chrome trace
+	// (chrome://tracing, Perfetto). Recording is switched on and off at runtime, while it's off events
+	// cost a single test. Every device owns a profiler, which times its draws, their stages and Present().
+	class Profiler
+	{
+	public:
+		Profiler();
+		~Profiler();
+
+		void	SetEnabled(bool bEnabled);
+		bool	IsEnabled() const {return m_bEnabled;}
+		void	Clear();
+
+		// COMMENT : Adds an event which lasted from uiBegin to uiEnd. szName must stay valid, szDetail is copied.
+		void	AddEvent(const char* szName, const char* szDetail, UINT64 uiBegin, UINT64 uiEnd, const UINT64* puiStageTicks = NULL);
+
+		UINT32	GetNumEvents();
+		UINT32	GetLostEvents();		// Events overwritten since the last Clear()
+		FLOAT64	GetTimeStampFrequency();
+
+		// COMMENT : Writes the recorded events in Chrome's trace event format. The stages of a draw are its
+		// arguments and additionally shown as child events one after another, as they interleave per triangle.
+		Result	ExportChromeTrace(const char* szFileName);
+	private:
+		Profiler(const Profiler&);
+		Profiler& operator=(const Profiler&);
+	private:
+		Mutex						m_kLock;
+		volatile bool				m_bEnabled;
+		std::vector<ProfileEvent>	m_vecEvents;
+		UINT32						m_uiNextEvent;
+		UINT32						m_uiNumEvents;
+		UINT32						m_uiLostEvents;
+
+		UINT64						m_uiCalibrationTimeStamp;
+		FLOAT64						m_fCalibrationSeconds;
+	};
+
+	// COMMENT : Adds an event for its lifetime to a profiler(which may be NULL), if it's enabled at construction.
+	class ProfileScope
+	{
+	public:
+		ProfileScope(Profiler* pkProfiler, const char* szName, const char* szDetail = NULL)
+			: m_pkProfiler((NULL != pkProfiler && true == pkProfiler->IsEnabled()) ? pkProfiler : NULL)
+			, m_szName(szName)
+			, m_szDetail(szDetail)
+			, m_uiBegin((NULL != m_pkProfiler) ? ReadTimeStamp() : 0)
+		{
+		}
+
+		~ProfileScope()
+		{
+			if(NULL != m_pkProfiler) {m_pkProfiler->AddEvent(m_szName, m_szDetail, m_uiBegin, ReadTimeStamp());}
+		}
+	private:
+		ProfileScope(const ProfileScope&);
+		ProfileScope& operator=(const ProfileScope&);
+	private:
+		Profiler*	m_pkProfiler;
+		const char*	m_szName;
+		const char*	m_szDetail;
+		UINT64		m_uiBegin;
+	};
+}
@@ -0,0 +1,17 @@
+#include "RenderContext.h"
+#include "Core3DThread.h"
+
+namespace Core3D
+{
+	static CORE3D_THREAD_LOCAL RenderContext* s_pkCurrentRenderContext = NULL;
+
+	RenderContext* GetCurrentRenderContext()
+	{
+		return s_pkCurrentRenderContext;
+	}
+
+	void SetCurrentRenderContext(RenderContext* pkRenderContext)
+	{
+		s_pkCurrentRenderContext = pkRenderContext;
+	}
+}
@@ -0,0 +1,303 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+#include "Core3DThread.h"
+
+// COMMENT : Evaluates its argument only if pipeline statistics are compiled in
+#if CORE3D_PIPELINE_STATISTICS
+#define CORE3D_STATISTIC(expr)	{expr;}
+#else
+#define CORE3D_STATISTIC(expr)	{}
+#endif
+
+namespace Core3D
+{
+	class Device;
+	struct RenderContext;
+
+	// COMMENT : Extent of the guard-band in multiples of the view-port. Triangles inside of it are not clipped to the
+	// side planes of the frustum. It's small enough to keep the screen-space positions precise.
+	const FLOAT32 GUARD_BAND_SCALE = 8.0f;
+
+	// COMMENT : Fraction bits of the rasterizer's fixed-point screen-space positions. Projected vertices are snapped
+	// to this grid in INT32, so pixel coordinates keep 23 bits and a sign for the guard-band.
+	const INT32		SUBPIXEL_BITS	= 8;
+	const FLOAT32	SUBPIXEL_SCALE	= static_cast<FLOAT32>(1 << SUBPIXEL_BITS);
+
+	// COMMENT : Rounds a screen-space coordinate to the nearest sub-pixel, independent of the SSE rounding mode(the
+	// conversion truncates, which is corrected for negative coordinates)
+	inline INT32 ToSubPixel(FLOAT32 f)
+	{
+		const FLOAT32 fSubPixel = f * SUBPIXEL_SCALE + 0.5f;
+		const INT32 iSubPixel	= static_cast<INT32>(fSubPixel);
+		return (static_cast<FLOAT32>(iSubPixel) > fSubPixel) ? iSubPixel - 1 : iSubPixel;
+	}
+
+	// COMMENT : First pixel center at or after a fixed-point coordinate
+	inline INT32 SubPixelCeil(INT64 iSubPixel) {return static_cast<INT32>((iSubPixel + (1 << SUBPIXEL_BITS) - 1) >> SUBPIXEL_BITS);}
+
+	// COMMENT : Compares a pixel's depth with the one in the depth-buffer, which is only read if the comparison needs it
+	inline bool DepthTest(CmpFunc eDepthCompare, FLOAT32 fDepth, const FLOAT32* pfDepthData)
+	{
+		switch(eDepthCompare)
+		{
+		case CMP_NEVER:			return false;
+		case CMP_EQUAL:			return fabsf(fDepth - *pfDepthData) < FLT_EPSILON;
+		case CMP_NOTEQUAL:		return fabsf(fDepth - *pfDepthData) >= FLT_EPSILON;
+		case CMP_LESS:			return fDepth < *pfDepthData;
+		case CMP_LESSEQUAL:		return fDepth <= *pfDepthData;
+		case CMP_GREATEREQUAL:	return fDepth >= *pfDepthData;
+		case CMP_GREATER:		return fDepth > *pfDepthData;
+		case CMP_ALWAYS:
+		default:				return true;
+		}
+	}
+
+	// COMMENT : Compares the masked reference value with a pixel's masked stencil value
+	inline bool StencilTest(CmpFunc eStencilCompare, UINT32 uiRef, UINT32 uiStencil)
+	{
+		switch(eStencilCompare)
+		{
+		case CMP_NEVER:			return false;
+		case CMP_EQUAL:			return uiRef == uiStencil;
+		case CMP_NOTEQUAL:		return uiRef != uiStencil;
+		case CMP_LESS:			return uiRef < uiStencil;
+		case CMP_LESSEQUAL:		return uiRef <= uiStencil;
+		case CMP_GREATEREQUAL:	return uiRef >= uiStencil;
+		case CMP_GREATER:		return uiRef > uiStencil;
+		case CMP_ALWAYS:
+		default:				return true;
+		}
+	}
+
+	inline UINT32 StencilOperation(StencilOp eOperation, UINT32 uiRef, UINT32 uiStencil)
+	{
+		switch(eOperation)
+		{
+		case SOP_ZERO:			return 0;
+		case SOP_REPLACE:		return uiRef;
+		case SOP_INCRSAT:		return (uiStencil < MAX_STENCIL_VALUE) ? uiStencil + 1 : MAX_STENCIL_VALUE;
+		case SOP_DECRSAT:		return (uiStencil > 0) ? uiStencil - 1 : 0;
+		case SOP_INVERT:		return ~uiStencil & MAX_STENCIL_VALUE;
+		case SOP_INCR:			return (uiStencil + 1) & MAX_STENCIL_VALUE;
+		case SOP_DECR:			return (uiStencil - 1) & MAX_STENCIL_VALUE;
+		case SOP_KEEP:
+		default:				return uiStencil;
+		}
+	}
+
+	// COMMENT : Stencil states of the triangles facing one way. The operations are SOP_KEEP where the write mask is 0.
+	struct StencilFace
+	{
+		CmpFunc			eCompare;
+		StencilOp		eFail;
+		StencilOp		eDepthFail;
+		StencilOp		ePass;
+	};
+
+	// COMMENT : Rows of the screen strips a visibility pass is resolved in. Every job shades a draw's pixels in one strip, so
+	// jobs don't share lines of the color-buffer and step along whole scan-lines.
+	const UINT32	VISIBILITY_STRIP_ROWS = 16;
+
+	// COMMENT : Triangles whose bounding box spans at most this many pixel centers in both directions are rasterized by
+	// testing each of them, which is cheaper than setting up the edges for stepping.
+	const INT32		SMALL_TRIANGLE_SIZE = 4;
+
+	// COMMENT : Steps an edge between two fixed-point positions from scan-line to scan-line without any rounding error.
+	// iX is the first pixel whose center is on or right of the edge, so a left edge includes the pixels on it and a right
+	// edge excludes them. Together with including scan-lines on a top edge only, this is the top-left fill rule:
+	// triangles sharing an edge cover each pixel along it exactly once.
+	struct RasterEdge
+	{
+		INT32	iX;
+		INT32	iStepX;
+		INT64	iRemainder;			// iX is exact X minus iRemainder / iDenominator
+		INT64	iStepRemainder;
+		INT64	iDenominator;
+
+		// COMMENT : Sets up the edge from (iX0, iY0) to (iX1, iY1) with iY1 > iY0 for the scan-line iY
+		void Setup(INT64 iX0, INT64 iY0, INT64 iX1, INT64 iY1, INT32 iY)
+		{
+			// COMMENT : x = ceil((iX0 * dy + (y - iY0) * dx) / (dy * SUBPIXEL_SCALE)), with y in sub-pixels
+			const INT64 iDeltaX		= iX1 - iX0;
+			const INT64 iDeltaY		= iY1 - iY0;
+			const INT64 iNumerator	= iX0 * iDeltaY + ((static_cast<INT64>(iY) << SUBPIXEL_BITS) - iY0) * iDeltaX;
+			iDenominator			= iDeltaY << SUBPIXEL_BITS;
+			iX						= static_cast<INT32>(-FloorDiv(-iNumerator, iDenominator));
+			iRemainder				= static_cast<INT64>(iX) * iDenominator - iNumerator;
+
+			const INT64 iStep		= iDeltaX << SUBPIXEL_BITS;
+			iStepX					= static_cast<INT32>(FloorDiv(iStep, iDenominator));
+			iStepRemainder			= iStep - static_cast<INT64>(iStepX) * iDenominator;
+		}
+
+		// COMMENT : Advances to the next scan-line
+		inline void Step()
+		{
+			iX			+= iStepX;
+			iRemainder	-= iStepRemainder;
+			if(iRemainder < 0) {++iX; iRemainder += iDenominator;}
+		}
+
+		static inline INT64 FloorDiv(INT64 iNumerator, INT64 iDenominator)
+		{
+			const INT64 iQuotient = iNumerator / iDenominator;
+			return ((iQuotient * iDenominator) > iNumerator) ? iQuotient - 1 : iQuotient;
+		}
+	};
+
+	// COMMENT : Pipeline states derived from the device's states when drawing starts.
+	struct RenderInfo
+	{
+		ShaderRegType	aeVSInputs[VERTEX_SHADER_REGISTERS];
+		ShaderRegType	aeVSOutputs[PIXEL_SHADER_REGISTERS];
+		UINT32			uiVSOutputSize;			// Bytes of a VertexShaderOutput up to the highest register in use
+
+		// COMMENT : The output registers split by their interpolation, SRT_UNUSED where a register is interpolated otherwise
+		ShaderRegInterpolation	aeVSOutputInterpolations[PIXEL_SHADER_REGISTERS];
+		ShaderRegType	aePerspectiveVSOutputs[PIXEL_SHADER_REGISTERS];		// Divided by W
+		ShaderRegType	aeLinearVSOutputs[PIXEL_SHADER_REGISTERS];
+		ShaderRegType	aeFlatVSOutputs[PIXEL_SHADER_REGISTERS];
+		ShaderRegType	aeInterpolatedVSOutputs[PIXEL_SHADER_REGISTERS];	// Perspective and linear ones, which have gradients
+		bool			bPerspectiveVSOutputs;
+		bool			bLinearVSOutputs;
+		bool			bFlatVSOutputs;
+
+		FLOAT32*		pfFrameData;
+		UINT32			uiColorFloats;
+		UINT32			uiColorBufferPitch;
+		bool			bColorWrite;
+
+		// COMMENT : All color-buffers of the render-target, the first one is the one above. Draws into more than one of them are
+		// rasterized by RasterizeScanlineColors() and DrawPixelColors().
+		UINT32			uiColorBuffers;
+		FLOAT32*		apfColorData[MAX_COLOR_BUFFERS];
+		UINT32			auiColorFloats[MAX_COLOR_BUFFERS];
+		UINT32			auiColorBufferPitches[MAX_COLOR_BUFFERS];
+
+		FLOAT32*		pfDepthData;
+		UINT32			uiDepthBufferPitch;
+		CmpFunc			eDepthCompare;
+		bool			bDepthWrite;
+		bool			bDepthOnly;				// Only the depth-buffer is written: no registers are interpolated, no pixel shader runs
+
+		// COMMENT : Scan-lines are stencil tested by RasterizeStencilScanline() before anything is interpolated, only the runs of
+		// passing pixels reach the scan-line functions. Those apply the depth-fail and pass operations(see UpdateStencil()).
+		UINT32*			puiStencilData;			// NULL unless stencil testing is enabled
+		UINT32			uiStencilBufferPitch;
+		UINT32			uiStencilRef;
+		UINT32			uiStencilMask;
+		UINT32			uiStencilWriteMask;
+		bool			bTwoSidedStencil;
+		StencilFace		akStencilFaces[2];		// Clockwise and counter-clockwise triangles
+
+		// COMMENT : Draws of a visibility pass(see Device::BeginVisibilityPass()) are rasterized depth-only, writing the ids
+		// of their triangles. Their registers are kept for shading the pixels when the pass is resolved.
+		bool			bDeferred;
+		UINT32*			puiVisibilityData;		// NULL unless deferred
+		UINT32*			puiVisibilitySpans;		// Per pixel the first one of its scan-line, where the rasterizer began stepping
+		UINT32			uiVisibilityPitch;
+
+		void (Device::*pfnRasterizeScanLine)(RenderContext&, UINT32, UINT32, UINT32, VertexShaderOutput*);
+		void (Device::*pfnDrawPixel)(RenderContext&, UINT32, UINT32, const VertexShaderOutput*);
+
+		UINT32			uiRenderedPixels;
+		Rect			rcViewportRect;
+		Rect			rcRasterRect;			// View-port or the scissor rect within it, if scissor testing is enabled
+		Plane			akClippingPlanes[CP_NUMPLANES];
+		bool			abClippingPlaneEnabled[CP_NUMPLANES];
+		UINT32			uiGuardBandPlanes;		// Bit-mask of the side planes the rasterizer's view-port bounds replace inside the guard-band
+	};
+
+	// COMMENT : Transient pipeline state of one drawing thread.
+	// Every device owns a context, so devices sharing shaders and textures can draw concurrently.
+	struct RenderContext
+	{
+		Device*				pkDevice;
+		RenderInfo			kRenderInfo;
+		TriangleInfo		kTriangleInfo;
+
+		UINT32				uiNumValidCacheEntries;
+		UINT32				uiFetchedVertices;
+		VertexCacheEntry	akVertexCache[VERTEX_CACH_SIZE];
+		VertexShaderInput	kVertexInput;							// Input of the fetched vertex while subdivision is off
+		VertexShaderInput	akVertexCacheInputs[VERTEX_CACH_SIZE];	// Inputs of the cached vertices, kept for subdivision
+
+		VertexShaderOutput	akClipVertices[20];
+		UINT32				uiNextFreeClipVertex;
+		VertexShaderOutput*	aapkClipVertices[2][20];
+
+		VertexShaderOutput	kPixelShaderInput;		// Flat registers are set once per triangle, the others per pixel
+		UINT32				uiVisibilityID;			// Id the triangle being rasterized writes in a visibility pass, 0 is no triangle
+		const StencilFace*	pkStencilFace;			// Stencil states of the triangle being rasterized, NULL unless stencil testing is enabled
+
+		PipelineStatistics	kStatistics;			// Counted since PreRender()
+
+		// COMMENT : Time-stamp ticks of each stage since PreRender(), while the device's profiler is enabled
+		bool				bProfiling;
+		ProfileStage		eProfileStage;			// Stage the time since uiProfileTimeStamp belongs to
+		UINT64				uiProfileTimeStamp;
+		UINT64				uiProfileBegin;
+		UINT64				auiStageTicks[PST_NUMSTAGES];
+	};
+
+	// COMMENT : Applies a stencil operation to a pixel, only the bits of the write mask change
+	inline void UpdateStencil(RenderContext& rkContext, StencilOp eOperation, UINT32 uiX, UINT32 uiY)
+	{
+		if(SOP_KEEP == eOperation) {return;}
+
+		const RenderInfo& rkRenderInfo	= rkContext.kRenderInfo;
+		UINT32* puiStencil				= rkRenderInfo.puiStencilData + (uiY * rkRenderInfo.uiStencilBufferPitch + uiX);
+		const UINT32 uiStencil			= StencilOperation(eOperation, rkRenderInfo.uiStencilRef, *puiStencil);
+		*puiStencil = (*puiStencil & ~rkRenderInfo.uiStencilWriteMask) | (uiStencil & rkRenderInfo.uiStencilWriteMask);
+	}
+
+	// COMMENT : Operations of the scan-line functions on pixels which passed the stencil test
+	inline void StencilDepthFail(RenderContext& rkContext, UINT32 uiX, UINT32 uiY)
+	{
+		if(NULL != rkContext.pkStencilFace) {UpdateStencil(rkContext, rkContext.pkStencilFace->eDepthFail, uiX, uiY);}
+	}
+
+	inline void StencilPass(RenderContext& rkContext, UINT32 uiX, UINT32 uiY)
+	{
+		if(NULL != rkContext.pkStencilFace) {UpdateStencil(rkContext, rkContext.pkStencilFace->ePass, uiX, uiY);}
+	}
+
+	// COMMENT : Charges the time until now to the current stage and continues with another one.
+	inline void SwitchProfileStage(RenderContext& rkContext, ProfileStage eStage)
+	{
+		const UINT64 uiTimeStamp = ReadTimeStamp();
+		rkContext.auiStageTicks[rkContext.eProfileStage] += uiTimeStamp - rkContext.uiProfileTimeStamp;
+		rkContext.uiProfileTimeStamp	= uiTimeStamp;
+		rkContext.eProfileStage			= eStage;
+	}
+
+	// COMMENT : Times a stage for its lifetime, the enclosing stage continues afterwards.
+	class ProfileStageScope
+	{
+	public:
+		ProfileStageScope(RenderContext& rkContext, ProfileStage eStage) : m_rkContext(rkContext), m_eEnclosingStage(rkContext.eProfileStage)
+		{
+			if(true == rkContext.bProfiling) {SwitchProfileStage(rkContext, eStage);}
+		}
+
+		~ProfileStageScope()
+		{
+			if(true == m_rkContext.bProfiling) {SwitchProfileStage(m_rkContext, m_eEnclosingStage);}
+		}
+	private:
+		ProfileStageScope(const ProfileStageScope&);
+		ProfileStageScope& operator=(const ProfileStageScope&);
+	private:
+		RenderContext&	m_rkContext;
+		ProfileStage	m_eEnclosingStage;
+	};
+
+	// COMMENT : Context the calling thread is drawing with, NULL outside of drawing.
+	// Shaders reach the device and the triangle being rasterized through it.
+	RenderContext*	GetCurrentRenderContext();
+	void			SetCurrentRenderContext(RenderContext* pkRenderContext);
+}
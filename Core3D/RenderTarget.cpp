@@ -1,121 +1,253 @@
-#include "RenderTarget.h"
-#include "Device.h"
-#include "Surface.h"
-
-namespace Core3D
-{
-	RenderTarget::RenderTarget(Device* pkDevice)
-		: m_pkDevice(pkDevice)
-		, m_pkColorBuffer(NULL)
-		, m_pkDepthBuffer(NULL)
-	{
-		m_pkDevice->AddRef();
-	}
-
-	RenderTarget::~RenderTarget()
-	{
-		CORE3D_SAFE_RELEASE(m_pkColorBuffer);
-		CORE3D_SAFE_RELEASE(m_pkDepthBuffer);
-		CORE3D_SAFE_RELEASE(m_pkDevice);
-	}
-
-	Device* RenderTarget::GetDevice()
-	{
-		if(NULL != m_pkDevice) {m_pkDevice->AddRef();}
-		return m_pkDevice;
-	}
-
-	Result RenderTarget::ClearColorBuffer(const Vector4& rkColor, const Rect* pkRect)
-	{
-		if(NULL == m_pkColorBuffer)
-		{
-			CORE3D_ERROR(_T("RenderTarget::ClearColorBuffer() - No frame buffer has been set.\n"));
-			return INVALID_STATE;
-		}
-		return m_pkColorBuffer->Clear(rkColor, pkRect);
-	}
-
-	Result RenderTarget::ClearDepthBuffer(FLOAT32 fDepth, const Rect* pkRect)
-	{
-		if(NULL == m_pkDepthBuffer)
-		{
-			CORE3D_ERROR(_T("RenderTarget::ClearDepthBuffer() - No depth buffer has been set.\n"));
-			return INVALID_STATE;
-		}
-		return m_pkDepthBuffer->Clear(Vector4(fDepth, 0.0f, 0.0f, 0.0f), pkRect);
-	}
-
-	Result RenderTarget::SetColorBuffer(Surface* pkColorBuffer)
-	{
-		if(NULL != pkColorBuffer)
-		{
-			if((pkColorBuffer->GetFormat() < FMT_R32F) || (pkColorBuffer->GetFormat() > FMT_R32G32B32A32F))
-			{
-				CORE3D_ERROR(_T("RenderTarget::SetColorBuffer() - Invalid texture format.\n"));
-				return INVALID_FORMAT;
-			}
-
-			if(NULL != m_pkDepthBuffer)
-			{
-				if(	(m_pkDepthBuffer->GetWidth()  != pkColorBuffer->GetWidth()) || 
-					(m_pkDepthBuffer->GetHeight() != pkColorBuffer->GetHeight()) )
-				{
-					CORE3D_ERROR(_T("RenderTarget::SetColorBuffer() - Frame buffer and depth buffer dimensions are not equal.\n"));
-					return INVALID_FORMAT;
-				}
-			}
-		}
-		CORE3D_SAFE_RELEASE(m_pkColorBuffer);
-		m_pkColorBuffer = pkColorBuffer;
-		if(NULL != m_pkColorBuffer) {m_pkColorBuffer->AddRef();}
-		return OK;
-	}
-
-	Result RenderTarget::SetDepthBuffer(Surface* pkDepthBuffer)
-	{
-		if(NULL != pkDepthBuffer)
-		{
-			if(FMT_R32F != pkDepthBuffer->GetFormat())
-			{
-				CORE3D_ERROR(_T("RenderTarget::SetDepthBuffer() - Invalid texture format.\n"));
-				return INVALID_FORMAT;
-			}
-
-			if(NULL != m_pkColorBuffer)
-			{
-				if(	(pkDepthBuffer->GetWidth()  != m_pkColorBuffer->GetWidth()) || 
-					(pkDepthBuffer->GetHeight() != m_pkColorBuffer->GetHeight()) )
-				{
-					CORE3D_ERROR(_T("RenderTarget::SetDepthBuffer() - Depth buffer and frame buffer dimensions are not equal.\n"));
-					return INVALID_FORMAT;
-				}
-			}
-		}
-		CORE3D_SAFE_RELEASE(m_pkDepthBuffer);
-		m_pkDepthBuffer = pkDepthBuffer;
-		if(NULL != m_pkDepthBuffer) {m_pkDepthBuffer->AddRef();}
-		return OK;
-	}
-
-	Surface* RenderTarget::GetColorBuffer()
-	{
-		if(NULL != m_pkColorBuffer) {m_pkColorBuffer->AddRef();}
-		return m_pkColorBuffer;
-	}
-
-	Surface* RenderTarget::GetDepthBuffer()
-	{
-		if(NULL != m_pkDepthBuffer) {m_pkDepthBuffer->AddRef();}
-		return m_pkDepthBuffer;
-	}
-
-	void RenderTarget::SetViewportMatrix(const Matrix4x4& rkMatViewport)
-	{
-		m_kMatViewport = rkMatViewport;
-	}
-
-	const Matrix4x4& RenderTarget::GetViewportMatrix()
-	{
-		return m_kMatViewport;
-	}
+#include "RenderTarget.h"
+#include "Device.h"
+#include "Surface.h"
+
+namespace Core3D
+{
+	RenderTarget::RenderTarget(Device* pkDevice)
+		: m_pkDevice(pkDevice)
+		, m_pkDepthBuffer(NULL)
+		, m_pkStencilBuffer(NULL)
+	{
+		memset(m_apkColorBuffers, 0, sizeof(m_apkColorBuffers));
+		m_pkDevice->AddRef();
+	}
+
+	RenderTarget::~RenderTarget()
+	{
+		for(UINT32 uiIndex = 0; uiIndex < MAX_COLOR_BUFFERS; ++uiIndex) {CORE3D_SAFE_RELEASE(m_apkColorBuffers[uiIndex]);}
+		CORE3D_SAFE_RELEASE(m_pkDepthBuffer);
+		CORE3D_SAFE_RELEASE(m_pkStencilBuffer);
+		CORE3D_SAFE_RELEASE(m_pkDevice);
+	}
+
+	Device* RenderTarget::GetDevice()
+	{
+		if(NULL != m_pkDevice) {m_pkDevice->AddRef();}
+		return m_pkDevice;
+	}
+
+	Result RenderTarget::ClearColorBuffer(const Vector4& rkColor, const Rect* pkRect)
+	{
+		if(NULL == m_apkColorBuffers[0])
+		{
+			CORE3D_ERROR(_T("RenderTarget::ClearColorBuffer() - No frame buffer has been set.\n"));
+			return INVALID_STATE;
+		}
+
+		for(UINT32 uiIndex = 0; uiIndex < MAX_COLOR_BUFFERS; ++uiIndex)
+		{
+			if(NULL == m_apkColorBuffers[uiIndex]) {continue;}
+
+			const Result eResult = m_apkColorBuffers[uiIndex]->Clear(rkColor, pkRect);
+			if(CORE3D_FAILED(eResult)) {return eResult;}
+		}
+		return OK;
+	}
+
+	Result RenderTarget::ClearDepthBuffer(FLOAT32 fDepth, const Rect* pkRect)
+	{
+		if(NULL == m_pkDepthBuffer)
+		{
+			CORE3D_ERROR(_T("RenderTarget::ClearDepthBuffer() - No depth buffer has been set.\n"));
+			return INVALID_STATE;
+		}
+		return m_pkDepthBuffer->Clear(Vector4(fDepth, 0.0f, 0.0f, 0.0f), pkRect);
+	}
+
+	Result RenderTarget::ClearStencilBuffer(UINT32 uiStencil, const Rect* pkRect)
+	{
+		if(NULL == m_pkStencilBuffer)
+		{
+			CORE3D_ERROR(_T("RenderTarget::ClearStencilBuffer() - No stencil buffer has been set.\n"));
+			return INVALID_STATE;
+		}
+		return m_pkStencilBuffer->Clear(Vector4(static_cast<FLOAT32>(uiStencil & MAX_STENCIL_VALUE), 0.0f, 0.0f, 0.0f), pkRect);
+	}
+
+	Result RenderTarget::SetColorBuffer(Surface* pkColorBuffer)
+	{
+		return SetColorBuffer(0, pkColorBuffer);
+	}
+
+	Result RenderTarget::SetColorBuffer(UINT32 uiIndex, Surface* pkColorBuffer)
+	{
+		if(uiIndex >= MAX_COLOR_BUFFERS)
+		{
+			CORE3D_ERROR(_T("RenderTarget::SetColorBuffer() - Invalid color-buffer index.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if(NULL != pkColorBuffer)
+		{
+			if((pkColorBuffer->GetFormat() < FMT_R32F) || (pkColorBuffer->GetFormat() > FMT_R32G32B32A32F))
+			{
+				CORE3D_ERROR(_T("RenderTarget::SetColorBuffer() - Invalid texture format.\n"));
+				return INVALID_FORMAT;
+			}
+
+			if(NULL != m_pkDepthBuffer)
+			{
+				if(	(m_pkDepthBuffer->GetWidth()  != pkColorBuffer->GetWidth()) || 
+					(m_pkDepthBuffer->GetHeight() != pkColorBuffer->GetHeight()) )
+				{
+					CORE3D_ERROR(_T("RenderTarget::SetColorBuffer() - Frame buffer and depth buffer dimensions are not equal.\n"));
+					return INVALID_FORMAT;
+				}
+			}
+
+			if(NULL != m_pkStencilBuffer)
+			{
+				if(	(m_pkStencilBuffer->GetWidth()  != pkColorBuffer->GetWidth()) || 
+					(m_pkStencilBuffer->GetHeight() != pkColorBuffer->GetHeight()) )
+				{
+					CORE3D_ERROR(_T("RenderTarget::SetColorBuffer() - Frame buffer and stencil buffer dimensions are not equal.\n"));
+					return INVALID_FORMAT;
+				}
+			}
+
+			// COMMENT : The color-buffers are locked together for drawing, so a surface can only be bound once
+			for(UINT32 uiOther = 0; uiOther < MAX_COLOR_BUFFERS; ++uiOther)
+			{
+				Surface* pkOther = m_apkColorBuffers[uiOther];
+				if((uiOther == uiIndex) || (NULL == pkOther)) {continue;}
+
+				if(pkOther == pkColorBuffer)
+				{
+					CORE3D_ERROR(_T("RenderTarget::SetColorBuffer() - Surface is already bound to another color-buffer index.\n"));
+					return INVALID_PARAMETERS;
+				}
+
+				if(	(pkOther->GetWidth()  != pkColorBuffer->GetWidth()) || 
+					(pkOther->GetHeight() != pkColorBuffer->GetHeight()) )
+				{
+					CORE3D_ERROR(_T("RenderTarget::SetColorBuffer() - Frame buffer dimensions are not equal.\n"));
+					return INVALID_FORMAT;
+				}
+			}
+		}
+		CORE3D_SAFE_RELEASE(m_apkColorBuffers[uiIndex]);
+		m_apkColorBuffers[uiIndex] = pkColorBuffer;
+		if(NULL != m_apkColorBuffers[uiIndex]) {m_apkColorBuffers[uiIndex]->AddRef();}
+		return OK;
+	}
+
+	Result RenderTarget::SetDepthBuffer(Surface* pkDepthBuffer)
+	{
+		if(NULL != pkDepthBuffer)
+		{
+			if(FMT_R32F != pkDepthBuffer->GetFormat())
+			{
+				CORE3D_ERROR(_T("RenderTarget::SetDepthBuffer() - Invalid texture format.\n"));
+				return INVALID_FORMAT;
+			}
+
+			for(UINT32 uiIndex = 0; uiIndex < MAX_COLOR_BUFFERS; ++uiIndex)
+			{
+				Surface* pkColorBuffer = m_apkColorBuffers[uiIndex];
+				if(NULL == pkColorBuffer) {continue;}
+
+				if(	(pkDepthBuffer->GetWidth()  != pkColorBuffer->GetWidth()) || 
+					(pkDepthBuffer->GetHeight() != pkColorBuffer->GetHeight()) )
+				{
+					CORE3D_ERROR(_T("RenderTarget::SetDepthBuffer() - Depth buffer and frame buffer dimensions are not equal.\n"));
+					return INVALID_FORMAT;
+				}
+			}
+
+			if(NULL != m_pkStencilBuffer)
+			{
+				if(	(pkDepthBuffer->GetWidth()  != m_pkStencilBuffer->GetWidth()) || 
+					(pkDepthBuffer->GetHeight() != m_pkStencilBuffer->GetHeight()) )
+				{
+					CORE3D_ERROR(_T("RenderTarget::SetDepthBuffer() - Depth buffer and stencil buffer dimensions are not equal.\n"));
+					return INVALID_FORMAT;
+				}
+			}
+		}
+		CORE3D_SAFE_RELEASE(m_pkDepthBuffer);
+		m_pkDepthBuffer = pkDepthBuffer;
+		if(NULL != m_pkDepthBuffer) {m_pkDepthBuffer->AddRef();}
+		return OK;
+	}
+
+	Result RenderTarget::SetStencilBuffer(Surface* pkStencilBuffer)
+	{
+		if(NULL != pkStencilBuffer)
+		{
+			if(FMT_S8 != pkStencilBuffer->GetFormat())
+			{
+				CORE3D_ERROR(_T("RenderTarget::SetStencilBuffer() - Invalid texture format.\n"));
+				return INVALID_FORMAT;
+			}
+
+			for(UINT32 uiIndex = 0; uiIndex < MAX_COLOR_BUFFERS; ++uiIndex)
+			{
+				Surface* pkColorBuffer = m_apkColorBuffers[uiIndex];
+				if(NULL == pkColorBuffer) {continue;}
+
+				if(	(pkStencilBuffer->GetWidth()  != pkColorBuffer->GetWidth()) || 
+					(pkStencilBuffer->GetHeight() != pkColorBuffer->GetHeight()) )
+				{
+					CORE3D_ERROR(_T("RenderTarget::SetStencilBuffer() - Stencil buffer and frame buffer dimensions are not equal.\n"));
+					return INVALID_FORMAT;
+				}
+			}
+
+			if(NULL != m_pkDepthBuffer)
+			{
+				if(	(pkStencilBuffer->GetWidth()  != m_pkDepthBuffer->GetWidth()) || 
+					(pkStencilBuffer->GetHeight() != m_pkDepthBuffer->GetHeight()) )
+				{
+					CORE3D_ERROR(_T("RenderTarget::SetStencilBuffer() - Stencil buffer and depth buffer dimensions are not equal.\n"));
+					return INVALID_FORMAT;
+				}
+			}
+		}
+		CORE3D_SAFE_RELEASE(m_pkStencilBuffer);
+		m_pkStencilBuffer = pkStencilBuffer;
+		if(NULL != m_pkStencilBuffer) {m_pkStencilBuffer->AddRef();}
+		return OK;
+	}
+
+	Surface* RenderTarget::GetColorBuffer()
+	{
+		return GetColorBuffer(0);
+	}
+
+	Surface* RenderTarget::GetColorBuffer(UINT32 uiIndex)
+	{
+		if(uiIndex >= MAX_COLOR_BUFFERS) {return NULL;}
+		if(NULL != m_apkColorBuffers[uiIndex]) {m_apkColorBuffers[uiIndex]->AddRef();}
+		return m_apkColorBuffers[uiIndex];
+	}
+
+	UINT32 RenderTarget::GetNumColorBuffers()
+	{
+		UINT32 uiNumColorBuffers = 0;
+		while((uiNumColorBuffers < MAX_COLOR_BUFFERS) && (NULL != m_apkColorBuffers[uiNumColorBuffers])) {++uiNumColorBuffers;}
+		return uiNumColorBuffers;
+	}
+
+	Surface* RenderTarget::GetDepthBuffer()
+	{
+		if(NULL != m_pkDepthBuffer) {m_pkDepthBuffer->AddRef();}
+		return m_pkDepthBuffer;
+	}
+
+	Surface* RenderTarget::GetStencilBuffer()
+	{
+		if(NULL != m_pkStencilBuffer) {m_pkStencilBuffer->AddRef();}
+		return m_pkStencilBuffer;
+	}
+
+	void RenderTarget::SetViewportMatrix(const Matrix4x4& rkMatViewport)
+	{
+		m_kMatViewport = rkMatViewport;
+	}
+
+	const Matrix4x4& RenderTarget::GetViewportMatrix()
+	{
+		return m_kMatViewport;
+	}
 }
\ No newline at end of file
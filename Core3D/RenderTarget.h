@@ -1,36 +1,48 @@
-#pragma once
-//////////////////////////////////////////////////////////////////////////
-// Core3D : Software Graphic API
-// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
-//////////////////////////////////////////////////////////////////////////
-
-#include "Core3DTypes.h"
-
-namespace Core3D
-{
-	class Device;
-	class Surface;
-	class RenderTarget : public RefObject
-	{
-	public:
-		Device*		GetDevice();
-		Result		ClearColorBuffer(const Vector4& rkColor, const Rect* pkRect);
-		Result		ClearDepthBuffer(FLOAT32 fDepth, const Rect* pkRect);
-		Result		SetColorBuffer(Surface* pkColorBuffer);
-		Result		SetDepthBuffer(Surface* pkDepthBuffer);
-		Surface*	GetColorBuffer();
-		Surface*	GetDepthBuffer();
-		void		SetViewportMatrix(const Matrix4x4& rkMatViewport);
-		const Matrix4x4& GetViewportMatrix();
-	protected:
-		friend class Device;
-
-		RenderTarget(Device* pkDevice);
-		~RenderTarget();
-	private:
-		Device*		m_pkDevice;
-		Surface*	m_pkColorBuffer;
-		Surface*	m_pkDepthBuffer;
-		Matrix4x4	m_kMatViewport;
-	};
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+#include "Core3DTypes.h"
+
+namespace Core3D
+{
+	class Device;
+	class Surface;
+	class RenderTarget : public RefObject
+	{
+	public:
+		Device*		GetDevice();
+		Result		ClearColorBuffer(const Vector4& rkColor, const Rect* pkRect);
+		Result		ClearDepthBuffer(FLOAT32 fDepth, const Rect* pkRect);
+		Result		SetColorBuffer(Surface* pkColorBuffer);
+		Result		SetDepthBuffer(Surface* pkDepthBuffer);
+		Surface*	GetColorBuffer();
+		Surface*	GetDepthBuffer();
+
+		// COMMENT : Stencil-buffers are surfaces of the format FMT_S8, they're tested if RS_STENCILENABLE is set.
+		Result		ClearStencilBuffer(UINT32 uiStencil, const Rect* pkRect);
+		Result		SetStencilBuffer(Surface* pkStencilBuffer);
+		Surface*	GetStencilBuffer();
+
+		// COMMENT : Pixel shaders write a color to each of the consecutive color-buffers from index 0(see PixelShader::ExecuteColors()).
+		// The color-buffer without an index is the one at index 0, clears clear all color-buffers.
+		Result		SetColorBuffer(UINT32 uiIndex, Surface* pkColorBuffer);
+		Surface*	GetColorBuffer(UINT32 uiIndex);
+		UINT32		GetNumColorBuffers();
+		void		SetViewportMatrix(const Matrix4x4& rkMatViewport);
+		const Matrix4x4& GetViewportMatrix();
+	protected:
+		friend class Device;
+
+		RenderTarget(Device* pkDevice);
+		~RenderTarget();
+	private:
+		Device*		m_pkDevice;
+		Surface*	m_apkColorBuffers[MAX_COLOR_BUFFERS];
+		Surface*	m_pkDepthBuffer;
+		Surface*	m_pkStencilBuffer;
+		Matrix4x4	m_kMatViewport;
+	};
 }
\ No newline at end of file
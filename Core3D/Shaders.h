@@ -1,40 +1,46 @@
-#pragma once
-//////////////////////////////////////////////////////////////////////////
-// Core3D : Software Graphic API
-// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
-//////////////////////////////////////////////////////////////////////////
-
-#include "BaseShader.h"
-
-namespace Core3D
-{
-	class VertexShader : public BaseShader
-	{
-	protected:
-		friend class Device;
-		virtual void Execute(const ShaderReg* pkIput, Vector4& rkPosition, ShaderReg* pkOutput) = 0;
-		virtual ShaderRegType GetOutputRegisters(UINT32 uiRegister) = 0;
-	};
-
-	class TriangleShader : public BaseShader
-	{
-	protected:
-		friend class Device;
-		virtual bool Execute(ShaderReg* pkShaderRegs0, ShaderReg* pkShaderRegs1, ShaderReg* pkShaderRegs2) = 0;
-	};
-
-	class PixelShader : public BaseShader
-	{
-	protected:
-		friend class Device;
-		virtual PixelShaderOutput GetShaderOutput();
-		virtual bool MightKillPixels();
-		virtual bool Execute(const ShaderReg* pkInput, Vector4& rkColor, FLOAT32& rfDepth) = 0;
-
-		void SetInfo(const ShaderRegType* peVSOutputs, const TriangleInfo* pkTriangleInfo);
-		void GetDerivatives(UINT32 uiRegister, Vector4& rkDdx, Vector4& rkDdy) const;
-	private:
-		const ShaderRegType*	m_peVSOutputs;
-		const TriangleInfo*		m_pkTriangleInfo;
-	};
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+#include "BaseShader.h"
+
+namespace Core3D
+{
+	class VertexShader : public BaseShader
+	{
+	protected:
+		friend class Device;
+		friend class FrameCapture;
+		virtual void Execute(const ShaderReg* pkIput, Vector4& rkPosition, ShaderReg* pkOutput) = 0;
+		virtual ShaderRegType GetOutputRegisters(UINT32 uiRegister) = 0;
+		virtual ShaderRegInterpolation GetOutputInterpolation(UINT32 uiRegister);
+	};
+
+	class TriangleShader : public BaseShader
+	{
+	protected:
+		friend class Device;
+		virtual bool Execute(ShaderReg* pkShaderRegs0, ShaderReg* pkShaderRegs1, ShaderReg* pkShaderRegs2) = 0;
+	};
+
+	class PixelShader : public BaseShader
+	{
+	protected:
+		friend class Device;
+		virtual PixelShaderOutput GetShaderOutput();
+		virtual bool MightKillPixels();
+
+		// COMMENT : Whether the color the shader outputs depends on the color it's handed from the color-buffer(blending).
+		// Such draws render as usual in a visibility pass, after the draws before them have been shaded.
+		virtual bool MightBlendColors();
+		virtual bool Execute(const ShaderReg* pkInput, Vector4& rkColor, FLOAT32& rfDepth) = 0;
+
+		// COMMENT : Executed instead of Execute() while the render-target has more than one color-buffer, with the pixel's colors
+		// of all of them. Shaders filling a G-buffer override it, by default only the first color is shaded.
+		virtual bool ExecuteColors(const ShaderReg* pkInput, Vector4* pkColors, FLOAT32& rfDepth);
+
+		void GetDerivatives(UINT32 uiRegister, Vector4& rkDdx, Vector4& rkDdy) const;
+	};
 }
\ No newline at end of file
@@ -0,0 +1,149 @@
+#include "SwapChain.h"
+#include "Device.h"
+#include "PresentTarget.h"
+#include "Surface.h"
+
+namespace Core3D
+{
+	SwapChain::SwapChain(Device* pkDevice)
+		: m_pkDevice(pkDevice)
+		, m_pkPresentTarget(NULL)
+		, m_uiNumBuffers(0)
+		, m_uiBackBuffer(0)
+		, m_uiFrontBuffer(0)
+		, m_iPresentedFrames(0)
+		, m_iPresentResult(OK)
+		, m_bQuit(false)
+	{
+		// COMMENT: Cannot add a reference to device or the swap-chain will never be free
+		memset(m_apkBuffers, 0, sizeof(m_apkBuffers));
+		memset(m_akConversions, 0, sizeof(m_akConversions));
+	}
+
+	SwapChain::~SwapChain()
+	{
+		if(true == m_kPresentThread.IsRunning())
+		{
+			// COMMENT : Finish all queued frames before stopping the present thread
+			WaitForPresent();
+			m_bQuit = true;
+			m_kQueuedBuffers.Post();
+			m_kPresentThread.Join();
+		}
+
+		for(UINT32 uiBuffer = 0; uiBuffer < MAX_SWAPCHAIN_BUFFERS; ++uiBuffer)
+		{
+			CORE3D_SAFE_RELEASE(m_apkBuffers[uiBuffer]);
+		}
+		CORE3D_SAFE_RELEASE(m_pkPresentTarget);
+	}
+
+	Result SwapChain::Create(PresentTarget* pkPresentTarget, UINT32 uiNumBuffers)
+	{
+		if(NULL == pkPresentTarget)
+		{
+			CORE3D_ERROR(_T("SwapChain::Create() - Parameter present-target pointers to NULL.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		if((uiNumBuffers < 2) || (uiNumBuffers > MAX_SWAPCHAIN_BUFFERS))
+		{
+			CORE3D_ERROR(_T("SwapChain::Create() - Invalid number of back-buffers.\n"));
+			return INVALID_PARAMETERS;
+		}
+
+		m_pkPresentTarget = pkPresentTarget;
+		m_pkPresentTarget->AddRef();
+
+		const DeviceParameters& rkDeviceParameters = m_pkDevice->GetDeviceParameters();
+		for(UINT32 uiBuffer = 0; uiBuffer < uiNumBuffers; ++uiBuffer)
+		{
+			Result eResult = m_pkDevice->CreateSurface(&m_apkBuffers[uiBuffer], rkDeviceParameters.uiBackBufferWidth,
+				rkDeviceParameters.uiBackBufferHeight, FMT_R32G32B32A32F);
+			if(CORE3D_FAILED(eResult))
+			{
+				m_apkBuffers[uiBuffer] = NULL;
+				return eResult;
+			}
+		}
+		m_uiNumBuffers = uiNumBuffers;
+
+		// COMMENT : The first buffer is rendered into, all others are free
+		m_kFreeBuffers.Post(m_uiNumBuffers - 1);
+		return m_kPresentThread.Start(PresentThread, this);
+	}
+
+	Device* SwapChain::GetDevice()
+	{
+		if(NULL != m_pkDevice) {m_pkDevice->AddRef();}
+		return m_pkDevice;
+	}
+
+	Surface* SwapChain::GetBackBuffer()
+	{
+		Surface* pkBackBuffer = m_apkBuffers[m_uiBackBuffer];
+		if(NULL != pkBackBuffer) {pkBackBuffer->AddRef();}
+		return pkBackBuffer;
+	}
+
+	UINT32 SwapChain::GetNumBuffers()
+	{
+		return m_uiNumBuffers;
+	}
+
+	UINT32 SwapChain::GetPresentedFrames()
+	{
+		return static_cast<UINT32>(AtomicAdd(&m_iPresentedFrames, 0));
+	}
+
+	Result SwapChain::WaitForPresent()
+	{
+		// COMMENT : All queued frames have been presented once every buffer except the current back-buffer is free
+		for(UINT32 uiBuffer = 1; uiBuffer < m_uiNumBuffers; ++uiBuffer) {m_kFreeBuffers.Wait();}
+		m_kFreeBuffers.Post(m_uiNumBuffers - 1);
+
+		return static_cast<Result>(AtomicExchange(&m_iPresentResult, OK));
+	}
+
+	Result SwapChain::Present(const PresentConversion& rkConversion)
+	{
+		// COMMENT : Queue the current back-buffer and continue with the next one as soon as it is free.
+		// Buffers are presented in order, so the next one in the ring is always the first to become free.
+		m_akConversions[m_uiBackBuffer] = rkConversion;
+		m_kQueuedBuffers.Post();
+
+		m_uiBackBuffer = (m_uiBackBuffer + 1) % m_uiNumBuffers;
+		m_kFreeBuffers.Wait();
+
+		// COMMENT : Errors of asynchronous presentation are reported by the following call
+		return static_cast<Result>(AtomicExchange(&m_iPresentResult, OK));
+	}
+
+	void SwapChain::PresentThread(void* pvSwapChain)
+	{
+		SwapChain* pkSwapChain = reinterpret_cast<SwapChain*>(pvSwapChain);
+		for(;;)
+		{
+			pkSwapChain->m_kQueuedBuffers.Wait();
+			if(true == pkSwapChain->m_bQuit) {break;}
+
+			const UINT32 uiBuffer			= pkSwapChain->m_uiFrontBuffer;
+			pkSwapChain->m_uiFrontBuffer	= (uiBuffer + 1) % pkSwapChain->m_uiNumBuffers;
+
+			Surface* pkBuffer	= pkSwapChain->m_apkBuffers[uiBuffer];
+			FLOAT32* pfSource	= NULL;
+			Result eResult		= pkBuffer->LockRect((void**)&pfSource, NULL);
+			if(OK == eResult)
+			{
+				ProfileScope kProfileScope(pkSwapChain->m_pkDevice->GetProfiler(), "SwapChain::Present");
+				eResult = pkSwapChain->m_pkPresentTarget->Present(pfSource, pkBuffer->GetFormatFloats(),
+					pkSwapChain->m_akConversions[uiBuffer]);
+				pkBuffer->UnlockRect();
+			}
+
+			if(CORE3D_FAILED(eResult)) {AtomicExchange(&pkSwapChain->m_iPresentResult, eResult);}
+			AtomicIncrement(&pkSwapChain->m_iPresentedFrames);
+			pkSwapChain->m_kFreeBuffers.Post();
+		}
+	}
+}
@@ -0,0 +1,53 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+#include "Core3DThread.h"
+
+namespace Core3D
+{
+	class Device;
+	class Surface;
+	class PresentTarget;
+
+	// COMMENT : Ring of back-buffers which are presented by a dedicated thread.
+	// The device renders into one buffer while the previous ones are converted and shown.
+	class SwapChain : public RefObject
+	{
+	public:
+		Device*		GetDevice();
+		Surface*	GetBackBuffer();
+		UINT32		GetNumBuffers();
+
+		UINT32		GetPresentedFrames();
+		Result		WaitForPresent();
+	protected:
+		friend class Device;
+
+		SwapChain(Device* pkDevice);
+		~SwapChain();
+
+		Result	Create(PresentTarget* pkPresentTarget, UINT32 uiNumBuffers);
+		Result	Present(const PresentConversion& rkConversion);
+	private:
+		static void PresentThread(void* pvSwapChain);
+	private:
+		Device*				m_pkDevice;
+		PresentTarget*		m_pkPresentTarget;
+
+		Surface*			m_apkBuffers[MAX_SWAPCHAIN_BUFFERS];
+		PresentConversion	m_akConversions[MAX_SWAPCHAIN_BUFFERS];
+		UINT32				m_uiNumBuffers;
+		UINT32				m_uiBackBuffer;			// Buffer the device renders into
+		UINT32				m_uiFrontBuffer;		// Buffer presented next by the present thread
+
+		Thread				m_kPresentThread;
+		Semaphore			m_kQueuedBuffers;		// Signaled once for each buffer waiting to be presented
+		Semaphore			m_kFreeBuffers;			// Signaled once for each presented buffer which can be rendered into again
+		volatile INT32		m_iPresentedFrames;
+		volatile INT32		m_iPresentResult;		// Result of the last failed presentation(OK if none)
+		bool				m_bQuit;
+	};
+}
@@ -1,16 +1,16 @@
-#pragma once
-#include "../Core3D/FWApplication.h"
-#include "../Core3D/FWScene.h"
-
-class FreeCamera;
-class App : public Core3D::FWApplicationWin32
-{
-public:
-	bool CreateWorld();
-	void DestroyWorld();
-	void FrameMove();
-	void RenderWorld();
-private:
-	FreeCamera*		m_pkCamera;
-	Core3D::HENTITY m_hBoard;
+#pragma once
+#include "../Core3D/FWApplication.h"
+#include "../Core3D/FWScene.h"
+
+class FreeCamera;
+class App : public Core3D::FWApplicationWin32
+{
+public:
+	bool CreateWorld();
+	void DestroyWorld();
+	void FrameMove();
+	void RenderWorld();
+private:
+	FreeCamera*		m_pkCamera;
+	Core3D::HENTITY m_hBoard;
 };
\ No newline at end of file
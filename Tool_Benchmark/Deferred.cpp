@@ -0,0 +1,372 @@
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+// COMMENT : The geometry pass writes the G-buffer layers the way FWDeferredLighting reads them, from world-space positions
+// and normals. The check repeats the lighting's formulas in plain floats, so only the tiles' culling, the reciprocal square
+// root estimates and the order of the additions can make the two differ.
+
+#include "Deferred.h"
+#include "../Core3D/FWApplication.h"
+#include "../Core3D/FWCamera.h"
+#include "../Core3D/FWDeferredLighting.h"
+#include "../Core3D/FWEntity.h"
+#include "../Core3D/FWGraphics.h"
+#include "../Core3D/FWLight.h"
+#include "../Core3D/FWScene.h"
+#include <math.h>
+#include <string.h>
+#include <vector>
+
+using namespace Core3D;
+
+const UINT32 DEFERRED_BOXES		= 4;		// Per side of the floor
+const UINT32 DEFERRED_FLOATS	= 6;		// Position, normal
+
+//------------------------------------------------------------------------
+// COMMENT : Shaders of the geometry pass
+class DeferredVertexShader : public VertexShader
+{
+protected:
+	void Execute(const ShaderReg* pkInput, Vector4& rkPosition, ShaderReg* pkOutput)
+	{
+		rkPosition	= pkInput[0] * GetMatrix(SC_WVPMATRIX);
+		pkOutput[0]	= pkInput[0];
+		pkOutput[1]	= pkInput[1];
+	}
+
+	ShaderRegType GetOutputRegisters(UINT32 uiRegister)
+	{
+		return (uiRegister < 2) ? SRT_VECTOR3 : SRT_UNUSED;
+	}
+};
+
+// COMMENT : Checkered albedo, the squares alternate between a dull and a shiny material
+class DeferredPixelShader : public PixelShader
+{
+public:
+	bool MightKillPixels() {return false;}
+protected:
+	bool Execute(const ShaderReg* pkInput, Vector4& rkColor, FLOAT32& rfDepth)
+	{
+		rkColor = GetAlbedo(pkInput);
+		return true;
+	}
+
+	bool ExecuteColors(const ShaderReg* pkInput, Vector4* pkColors, FLOAT32& rfDepth)
+	{
+		pkColors[GBUFFER_ALBEDO]	= GetAlbedo(pkInput);
+		pkColors[GBUFFER_NORMAL]	= Vector4(pkInput[1].x, pkInput[1].y, pkInput[1].z, IsShiny(pkInput) ? 48.0f : 8.0f);
+		pkColors[GBUFFER_POSITION]	= Vector4(pkInput[0].x, pkInput[0].y, pkInput[0].z, 1.0f);
+		return true;
+	}
+private:
+	bool IsShiny(const ShaderReg* pkInput)
+	{
+		return 0 != (((INT32)floorf(pkInput[0].x) + (INT32)floorf(pkInput[0].z)) & 1);
+	}
+
+	Vector4 GetAlbedo(const ShaderReg* pkInput)
+	{
+		return IsShiny(pkInput) ? Vector4(0.9f, 0.8f, 0.7f, 0.75f) : Vector4(0.3f, 0.4f, 0.6f, 0.25f);
+	}
+};
+
+//------------------------------------------------------------------------
+// COMMENT : The floor and DEFERRED_BOXES * DEFERRED_BOXES boxes of different heights, without their bottoms
+class DeferredBoxes : public FWEntity
+{
+public:
+	DeferredBoxes(FWScene* pkScene) : m_pkVertexFormat(NULL), m_pkVertexBuffer(NULL), m_pkVertexShader(NULL), m_pkPixelShader(NULL), m_uiTriangles(0)
+	{
+		m_pkScene = pkScene;
+	}
+
+	~DeferredBoxes()
+	{
+		CORE3D_SAFE_RELEASE(m_pkPixelShader);
+		CORE3D_SAFE_RELEASE(m_pkVertexShader);
+		CORE3D_SAFE_RELEASE(m_pkVertexBuffer);
+		CORE3D_SAFE_RELEASE(m_pkVertexFormat);
+	}
+
+	bool Initialize()
+	{
+		std::vector<FLOAT32> vecVertices;
+		AddQuad(vecVertices, Vector3(-20.0f, 0.0f, -20.0f), Vector3(40.0f, 0.0f, 0.0f), Vector3(0.0f, 0.0f, 40.0f), Vector3(0.0f, 1.0f, 0.0f));
+		for(UINT32 uiBox = 0; uiBox < DEFERRED_BOXES * DEFERRED_BOXES; ++uiBox)
+		{
+			const FLOAT32 fX		= -15.0f + 10.0f * (FLOAT32)(uiBox % DEFERRED_BOXES);
+			const FLOAT32 fZ		= -15.0f + 10.0f * (FLOAT32)(uiBox / DEFERRED_BOXES);
+			const FLOAT32 fSize		= 2.0f + (FLOAT32)(uiBox % 3);
+			const FLOAT32 fHeight	= 1.0f + (FLOAT32)(uiBox % 4);
+			const Vector3 kLower(fX - 0.5f * fSize, 0.0f, fZ - 0.5f * fSize);
+			const Vector3 kWidth(fSize, 0.0f, 0.0f), kDepth(0.0f, 0.0f, fSize), kUp(0.0f, fHeight, 0.0f);
+			AddQuad(vecVertices, kLower + kUp, kWidth, kDepth, Vector3(0.0f, 1.0f, 0.0f));
+			AddQuad(vecVertices, kLower, kWidth, kUp, Vector3(0.0f, 0.0f, -1.0f));
+			AddQuad(vecVertices, kLower + kDepth, kWidth, kUp, Vector3(0.0f, 0.0f, 1.0f));
+			AddQuad(vecVertices, kLower, kDepth, kUp, Vector3(-1.0f, 0.0f, 0.0f));
+			AddQuad(vecVertices, kLower + kWidth, kDepth, kUp, Vector3(1.0f, 0.0f, 0.0f));
+		}
+		m_uiTriangles = (UINT32)vecVertices.size() / (DEFERRED_FLOATS * 3);
+
+		Device* pkDevice = m_pkScene->GetApplication()->GetGraphics()->GetDevice();
+		VertexElement akDeclaration[] = {CORE3D_VERTEXFORMAT_DECL(0, VET_VECTOR3, 0), CORE3D_VERTEXFORMAT_DECL(0, VET_VECTOR3, 1)};
+		if(CORE3D_FAILED(pkDevice->CreateVertexFormat(&m_pkVertexFormat, akDeclaration, sizeof(akDeclaration)))) {return false;}
+		if(CORE3D_FAILED(pkDevice->CreateVertexBuffer(&m_pkVertexBuffer, (UINT32)vecVertices.size() * sizeof(FLOAT32)))) {return false;}
+
+		FLOAT32* pfVertices = NULL;
+		if(CORE3D_FAILED(m_pkVertexBuffer->GetPointer(0, (void**)&pfVertices))) {return false;}
+		memcpy(pfVertices, &vecVertices[0], vecVertices.size() * sizeof(FLOAT32));
+
+		m_pkVertexShader	= new DeferredVertexShader;
+		m_pkPixelShader		= new DeferredPixelShader;
+		return true;
+	}
+
+	bool FrameMove()
+	{
+		return false;
+	}
+
+	void Render(UINT32 uiPass)
+	{
+		FWGraphics* pkGraphics	= m_pkScene->GetApplication()->GetGraphics();
+		FWCamera* pkCamera		= pkGraphics->GetCurrentCamera();
+		m_pkVertexShader->SetMatrix(SC_WVPMATRIX, pkCamera->GetViewMatrix() * pkCamera->GetProjectionMatrix());
+
+		pkGraphics->SetVertexFormat(m_pkVertexFormat);
+		pkGraphics->SetVertexStream(0, m_pkVertexBuffer, 0, DEFERRED_FLOATS * sizeof(FLOAT32));
+		pkGraphics->SetVertexShader(m_pkVertexShader);
+		pkGraphics->SetPixelShader(m_pkPixelShader);
+		pkGraphics->SetRenderState(RS_CULLMODE, CULL_NONE);
+		pkGraphics->GetDevice()->DrawPrimitive(PT_TRIANGLELIST, 0, m_uiTriangles);
+	}
+private:
+	static void AddQuad(std::vector<FLOAT32>& rvecVertices, const Vector3& rkCorner, const Vector3& rkEdge0, const Vector3& rkEdge1, const Vector3& rkNormal)
+	{
+		const Vector3 akCorners[6] = {rkCorner, rkCorner + rkEdge0, rkCorner + rkEdge0 + rkEdge1, rkCorner, rkCorner + rkEdge0 + rkEdge1, rkCorner + rkEdge1};
+		for(UINT32 uiVertex = 0; uiVertex < 6; ++uiVertex)
+		{
+			const FLOAT32 afVertex[DEFERRED_FLOATS] = {akCorners[uiVertex].x, akCorners[uiVertex].y, akCorners[uiVertex].z, rkNormal.x, rkNormal.y, rkNormal.z};
+			rvecVertices.insert(rvecVertices.end(), afVertex, afVertex + DEFERRED_FLOATS);
+		}
+	}
+private:
+	VertexFormat*			m_pkVertexFormat;
+	VertexBuffer*			m_pkVertexBuffer;
+	DeferredVertexShader*	m_pkVertexShader;
+	DeferredPixelShader*	m_pkPixelShader;
+	UINT32					m_uiTriangles;
+};
+
+static FWEntity* CreateDeferredBoxes(FWScene* pkScene)
+{
+	return new DeferredBoxes(pkScene);
+}
+
+class DeferredCamera : public FWCamera
+{
+public:
+	DeferredCamera(FWGraphics* pkGraphics) : FWCamera(pkGraphics) {}
+
+	void RenderPass(INT32 iPass)
+	{
+		GetGraphics()->GetApplication()->GetScene()->RenderDeferred(0);
+	}
+};
+
+//------------------------------------------------------------------------
+class DeferredScene : public FWApplicationHeadless
+{
+public:
+	DeferredScene() : m_pkCamera(NULL), m_hEntity(0) {}
+
+	bool CreateWorld();
+	void DestroyWorld();
+
+	void FrameMove() {}
+	void RenderWorld();
+
+	bool Check(FLOAT32& rfMaxDifference, UINT32& ruiLitPixels, UINT32& ruiFailedPixels);
+private:
+	// COMMENT : Uniform in [0, 1), the same on every platform
+	static FLOAT32 Random(UINT32& ruiSeed)
+	{
+		ruiSeed = ruiSeed * 1664525 + 1013904223;
+		return (FLOAT32)(ruiSeed >> 8) * (1.0f / 16777216.0f);
+	}
+private:
+	DeferredCamera*	m_pkCamera;
+	HENTITY			m_hEntity;
+};
+
+bool DeferredScene::CreateWorld()
+{
+	m_pkCamera = new DeferredCamera(GetGraphics());
+	if(false == m_pkCamera->CreateRenderCamera(GetWindowWidth(), GetWindowHeight())) {return false;}
+	if(false == m_pkCamera->CreateGBuffer()) {return false;}
+	m_pkCamera->CalculateProjection(CORE3D_PI * 0.25f, 100.0f, 0.5f, (FLOAT32)GetWindowWidth() / (FLOAT32)GetWindowHeight());
+	m_pkCamera->SetPosition(Vector3(0.0f, 12.0f, -28.0f));
+	m_pkCamera->SetLookAt(Vector3(0.0f, 0.0f, 0.0f), Vector3(0.0f, 1.0f, 0.0f));
+	m_pkCamera->CalculateView();
+
+	GetScene()->RegisterEntityType(_T("DeferredBoxes"), &CreateDeferredBoxes);
+	m_hEntity = GetScene()->CreateEntity(_T("DeferredBoxes"));
+	if(0 == m_hEntity) {return false;}
+	if(false == static_cast<DeferredBoxes*>(GetScene()->GetEntity(m_hEntity))->Initialize()) {return false;}
+
+	// COMMENT : Lights close above the floor, most of them only reach a few tiles. The scene releases them.
+	GetScene()->SetAmbientLightColor(Vector4(0.1f, 0.1f, 0.1f, 1.0f));
+	UINT32 uiSeed = 7;
+	for(UINT32 uiLight = 0; uiLight < DEFERRED_LIGHTS; ++uiLight)
+	{
+		FWLight* pkLight = GetScene()->GetLight(GetScene()->CreateLight());
+		if(NULL == pkLight) {return false;}
+		const FLOAT32 fX = 40.0f * Random(uiSeed) - 20.0f, fY = 0.2f + 3.0f * Random(uiSeed), fZ = 40.0f * Random(uiSeed) - 20.0f;
+		pkLight->SetPosition(Vector3(fX, fY, fZ));
+		pkLight->SetRange(2.0f + 3.0f * Random(uiSeed));
+		const FLOAT32 fR = Random(uiSeed), fG = Random(uiSeed), fB = Random(uiSeed);
+		pkLight->SetColor(Vector4(fR, fG, fB, 1.0f));
+	}
+	return true;
+}
+
+void DeferredScene::DestroyWorld()
+{
+	if(0 != m_hEntity) {GetScene()->ReleaseEntity(m_hEntity);}
+	m_hEntity = 0;
+	CORE3D_SAFE_DELETE(m_pkCamera);
+}
+
+void DeferredScene::RenderWorld()
+{
+	m_pkCamera->BeginRender();
+	m_pkCamera->ClearToSceneColor();
+	m_pkCamera->RenderPass(-1);
+	m_pkCamera->EndRender(false);
+}
+
+bool DeferredScene::Check(FLOAT32& rfMaxDifference, UINT32& ruiLitPixels, UINT32& ruiFailedPixels)
+{
+	rfMaxDifference	= 0.0f;
+	ruiLitPixels	= 0;
+	ruiFailedPixels	= 0;
+
+	Surface* apkSurfaces[GBUFFER_LAYERS + 1];
+	const FLOAT32* apfData[GBUFFER_LAYERS + 1];
+	for(UINT32 uiLayer = 0; uiLayer < GBUFFER_LAYERS; ++uiLayer) {apkSurfaces[uiLayer] = m_pkCamera->GetGBuffer()->GetColorBuffer(uiLayer);}
+	apkSurfaces[GBUFFER_LAYERS] = m_pkCamera->GetRenderTarget()->GetColorBuffer();
+
+	bool bResult	= true;
+	UINT32 uiLocked	= 0;
+	for(; uiLocked <= GBUFFER_LAYERS; ++uiLocked)
+	{
+		if(NULL == apkSurfaces[uiLocked] || CORE3D_FAILED(apkSurfaces[uiLocked]->LockRect((void**)&apfData[uiLocked], NULL)))
+		{
+			bResult = false;
+			break;
+		}
+	}
+
+	if(true == bResult)
+	{
+		const UINT32 uiPixels		= (UINT32)GetWindowWidth() * GetWindowHeight();
+		const UINT32 uiColorFloats	= apkSurfaces[GBUFFER_LAYERS]->GetFormatFloats();
+		const Vector4& rkAmbient	= GetScene()->GetAmbientLightColor();
+		const Vector3& rkCamera		= m_pkCamera->GetPosition();
+		for(UINT32 uiPixel = 0; uiPixel < uiPixels; ++uiPixel)
+		{
+			const FLOAT32* pfAlbedo		= &apfData[GBUFFER_ALBEDO][uiPixel * 4];
+			const FLOAT32* pfNormal		= &apfData[GBUFFER_NORMAL][uiPixel * 4];
+			const FLOAT32* pfPosition	= &apfData[GBUFFER_POSITION][uiPixel * 4];
+			if(pfPosition[3] <= 0.0f) {continue;}
+			++ruiLitPixels;
+
+			const Vector3 kPosition(pfPosition[0], pfPosition[1], pfPosition[2]);
+			Vector3 kNormal(pfNormal[0], pfNormal[1], pfNormal[2]);
+			Vector3 kView = rkCamera - kPosition;
+			kNormal.Normalize();
+			kView.Normalize();
+
+			FLOAT32 afColor[3] = {pfAlbedo[0] * rkAmbient.r, pfAlbedo[1] * rkAmbient.g, pfAlbedo[2] * rkAmbient.b};
+			for(UINT32 uiLight = 0; uiLight < GetScene()->GetNumLights(); ++uiLight)
+			{
+				const FWLight* pkLight		= GetScene()->GetLightFromNum(uiLight);
+				const FLOAT32 fRange		= pkLight->GetRange();
+				Vector3 kToLight			= pkLight->GetPosition() - kPosition;
+				const FLOAT32 fDistanceSq	= kToLight.x * kToLight.x + kToLight.y * kToLight.y + kToLight.z * kToLight.z;
+				FLOAT32 fAttenuation		= 1.0f - fDistanceSq / (fRange * fRange);
+				if(fAttenuation <= 0.0f || fDistanceSq <= 0.0f) {continue;}
+				fAttenuation *= fAttenuation;
+
+				kToLight *= 1.0f / sqrtf(fDistanceSq);
+				const FLOAT32 fNDotL = kNormal.x * kToLight.x + kNormal.y * kToLight.y + kNormal.z * kToLight.z;
+				if(fNDotL <= 0.0f) {continue;}
+
+				Vector3 kHalf = kToLight + kView;
+				kHalf.Normalize();
+				FLOAT32 fNDotH = kNormal.x * kHalf.x + kNormal.y * kHalf.y + kNormal.z * kHalf.z;
+				if(fNDotH < 0.0f) {fNDotH = 0.0f;}
+				const FLOAT32 fSpecular = fNDotH / (pfNormal[3] - pfNormal[3] * fNDotH + fNDotH) * pfAlbedo[3];
+
+				const Vector4& rkColor = pkLight->GetColor();
+				afColor[0] += rkColor.r * fAttenuation * (pfAlbedo[0] * fNDotL + fSpecular);
+				afColor[1] += rkColor.g * fAttenuation * (pfAlbedo[1] * fNDotL + fSpecular);
+				afColor[2] += rkColor.b * fAttenuation * (pfAlbedo[2] * fNDotL + fSpecular);
+			}
+
+			const FLOAT32* pfColor = &apfData[GBUFFER_LAYERS][uiPixel * uiColorFloats];
+			FLOAT32 fDifference = 0.0f;
+			for(UINT32 uiChannel = 0; uiChannel < 3; ++uiChannel)
+			{
+				const FLOAT32 fReference	= afColor[uiChannel];
+				const FLOAT32 fChannel		= fabsf(pfColor[uiChannel] - fReference) / ((fReference > 1.0f) ? fReference : 1.0f);
+				if(fChannel > fDifference) {fDifference = fChannel;}
+			}
+			if(fDifference > rfMaxDifference) {rfMaxDifference = fDifference;}
+			if(fDifference > DEFERRED_TOLERANCE) {++ruiFailedPixels;}
+		}
+	}
+
+	for(UINT32 uiSurface = 0; uiSurface < uiLocked; ++uiSurface) {apkSurfaces[uiSurface]->UnlockRect();}
+	for(UINT32 uiSurface = 0; uiSurface <= GBUFFER_LAYERS; ++uiSurface) {CORE3D_SAFE_RELEASE(apkSurfaces[uiSurface]);}
+	return bResult;
+}
+
+//------------------------------------------------------------------------
+DeferredScene* CreateDeferredScene(UINT32 uiWidth, UINT32 uiHeight)
+{
+	CreationFlags kCreateFlags;
+	kCreateFlags.strWindowTitle	= _T("Deferred");
+#	ifdef WIN32
+	kCreateFlags.hIcon			= NULL;
+#	endif
+	kCreateFlags.uiWindowWidth	= (UINT16)uiWidth;
+	kCreateFlags.uiWindowHeight	= (UINT16)uiHeight;
+	kCreateFlags.bWindowed		= true;
+
+	DeferredScene* pkScene = new DeferredScene;
+	if(false == pkScene->Initialize(kCreateFlags)) {CORE3D_SAFE_DELETE(pkScene);}
+	return pkScene;
+}
+
+void ReleaseDeferredScene(DeferredScene* pkScene)
+{
+	if(NULL == pkScene) {return;}
+	pkScene->DestroyWorld();
+	delete pkScene;
+}
+
+UINT64 RenderDeferredScene(DeferredScene* pkScene)
+{
+	pkScene->RenderFrame();
+	return (UINT64)pkScene->GetWindowWidth() * pkScene->GetWindowHeight();
+}
+
+bool CheckDeferredScene(DeferredScene* pkScene, FLOAT32& rfMaxDifference, UINT32& ruiLitPixels, UINT32& ruiFailedPixels)
+{
+	pkScene->RenderFrame();
+	return pkScene->Check(rfMaxDifference, ruiLitPixels, ruiFailedPixels);
+}
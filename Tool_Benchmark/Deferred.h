@@ -0,0 +1,26 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+#include "../Core3D/Core3D.h"
+
+// COMMENT : Boxes on a floor, rendered with the framework's deferred lighting(FWScene::RenderDeferred()) and lit by
+// DEFERRED_LIGHTS point-lights. The scene runs on an application and device of its own, with a worker per processor.
+// The tolerance is relative to channels above 1 : the lighting's reciprocal square root estimates are exact to about 4e-4,
+// and the specular term multiplies that by up to its power(48), which leaves differences of up to 0.5%.
+const Core3D::UINT32	DEFERRED_LIGHTS		= 384;
+const Core3D::FLOAT32	DEFERRED_TOLERANCE	= 0.01f;
+
+class DeferredScene;
+
+DeferredScene*	CreateDeferredScene(Core3D::UINT32 uiWidth, Core3D::UINT32 uiHeight);
+void			ReleaseDeferredScene(DeferredScene* pkScene);
+
+// COMMENT : Renders a frame, returns the number of pixels
+Core3D::UINT64	RenderDeferredScene(DeferredScene* pkScene);
+
+// COMMENT : Renders a frame and lights its G-buffer again, per pixel with all lights and exact square roots. A lit pixel
+// fails if a channel differs by more than DEFERRED_TOLERANCE, the differences are relative for channels above 1. Returns false if the buffers couldn't be read.
+bool			CheckDeferredScene(DeferredScene* pkScene, Core3D::FLOAT32& rfMaxDifference, Core3D::UINT32& ruiLitPixels,
+					Core3D::UINT32& ruiFailedPixels);
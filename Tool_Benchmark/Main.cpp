@@ -0,0 +1,1076 @@
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+// COMMENT : Renders fixed scenarios without a window and reports their timings, for tracking performance changes.
+// Every scenario runs a fixed number of iterations after one warm-up iteration, so results of different builds
+// are comparable. The buffers are cleared before each iteration, outside of the measured time.
+// If the G-buffer scenarios ran, both ways of filling the G-buffer are checked to write bit-identical layers. If the deferred
+// scenario ran, its lighting is checked against a brute-force lighting of every pixel by every light.
+// Usage : Tool_Benchmark [-json file] [-filter text] [-iterations count] [-size width height]
+//                        [-threads count(0 : one per processor)] [-obj file]
+
+#include "Deferred.h"
+#include "../Core3D/Core3D.h"
+#include "../Core3D/Object.h"
+#include "../Core3D/Device.h"
+#include "../Core3D/CubeTexture.h"
+#include "../Core3D/IndexBuffer.h"
+#include "../Core3D/RenderTarget.h"
+#include "../Core3D/Shaders.h"
+#include "../Core3D/Surface.h"
+#include "../Core3D/Texture.h"
+#include "../Core3D/VertexBuffer.h"
+#include "../Core3D/VertexFormat.h"
+#include "../Core3D/VolumeTexture.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+#ifndef CORE3D_SOURCE_DIR
+#define CORE3D_SOURCE_DIR "."
+#endif
+
+using namespace Core3D;
+
+const UINT32 BENCHMARK_VERSION	= 1;
+const UINT32 VERTEX_FLOATS		= 6;		// Position, texture coordinates
+const UINT32 SPHERE_SLICES		= 128;
+const UINT32 SPHERE_STACKS		= 64;
+const UINT32 CLIPPED_TRIANGLES	= 256;
+const UINT32 GBUFFER_LAYERS		= 3;
+
+//------------------------------------------------------------------------
+// COMMENT : Shaders
+class BenchmarkVertexShader : public VertexShader
+{
+public:
+	BenchmarkVertexShader() : m_eInterpolation(SRI_PERSPECTIVE) {}
+	void SetInterpolation(ShaderRegInterpolation eInterpolation) {m_eInterpolation = eInterpolation;}
+protected:
+	void Execute(const ShaderReg* pkInput, Vector4& rkPosition, ShaderReg* pkOutput)
+	{
+		rkPosition	= pkInput[0] * GetMatrix(SC_WVPMATRIX);
+		pkOutput[0]	= pkInput[1];
+	}
+
+	ShaderRegType GetOutputRegisters(UINT32 uiRegister)
+	{
+		return (0 == uiRegister) ? SRT_VECTOR3 : SRT_UNUSED;
+	}
+
+	ShaderRegInterpolation GetOutputInterpolation(UINT32 uiRegister)
+	{
+		return m_eInterpolation;
+	}
+private:
+	ShaderRegInterpolation m_eInterpolation;
+};
+
+class FlatPixelShader : public PixelShader
+{
+public:
+	bool MightKillPixels() {return false;}
+protected:
+	bool Execute(const ShaderReg* pkInput, Vector4& rkColor, FLOAT32& rfDepth)
+	{
+		rkColor = Vector4(pkInput[0].x, pkInput[0].y, 0.5f, 1.0f);
+		return true;
+	}
+};
+
+// COMMENT : Samples sampler 0, with the texture coordinates' derivatives for mip-mapping if bGradients is set
+class TexturePixelShader : public PixelShader
+{
+public:
+	TexturePixelShader(bool bGradients) : m_bGradients(bGradients) {}
+	bool MightKillPixels() {return false;}
+protected:
+	bool Execute(const ShaderReg* pkInput, Vector4& rkColor, FLOAT32& rfDepth)
+	{
+		if(true == m_bGradients)
+		{
+			Vector4 kDdx, kDdy;
+			GetDerivatives(0, kDdx, kDdy);
+			SampleTexture(rkColor, 0, pkInput[0].x, pkInput[0].y, pkInput[0].z, &kDdx, &kDdy);
+		}
+		else
+		{
+			SampleTexture(rkColor, 0, pkInput[0].x, pkInput[0].y, pkInput[0].z);
+		}
+		return true;
+	}
+private:
+	bool m_bGradients;
+};
+
+// COMMENT : Four mip-mapped samples and some arithmetic, the cost of a typical lit and textured pixel
+class HeavyPixelShader : public PixelShader
+{
+public:
+	bool MightKillPixels() {return false;}
+protected:
+	bool Execute(const ShaderReg* pkInput, Vector4& rkColor, FLOAT32& rfDepth)
+	{
+		Vector4 kDdx, kDdy;
+		GetDerivatives(0, kDdx, kDdy);
+
+		rkColor = Vector4(0.0f, 0.0f, 0.0f, 0.0f);
+		for(UINT32 uiSample = 0; uiSample < 4; ++uiSample)
+		{
+			Vector4 kSample;
+			const FLOAT32 fOffset = 0.01f * (FLOAT32)uiSample;
+			SampleTexture(kSample, 0, pkInput[0].x + fOffset, pkInput[0].y - fOffset, 0.0f, &kDdx, &kDdy);
+			rkColor += kSample * 0.25f;
+		}
+
+		Vector4 kLight(0.2f, 0.2f, 0.2f, 1.0f);
+		for(UINT32 uiIteration = 0; uiIteration < 16; ++uiIteration)
+		{
+			kLight = kLight * 0.9f + rkColor * 0.1f;
+		}
+		rkColor = rkColor * kLight;
+		return true;
+	}
+};
+
+// COMMENT : Writes the layers of a G-buffer : the texture's color, the texture coordinates and a shading term. Execute() writes
+// layer m_uiLayer only, for filling the G-buffer with one pass per layer.
+class GBufferPixelShader : public PixelShader
+{
+public:
+	GBufferPixelShader() : m_uiLayer(0) {}
+	void SetLayer(UINT32 uiLayer) {m_uiLayer = uiLayer;}
+	bool MightKillPixels() {return false;}
+protected:
+	bool Execute(const ShaderReg* pkInput, Vector4& rkColor, FLOAT32& rfDepth)
+	{
+		rkColor = GetLayer(pkInput, m_uiLayer);
+		return true;
+	}
+
+	bool ExecuteColors(const ShaderReg* pkInput, Vector4* pkColors, FLOAT32& rfDepth)
+	{
+		for(UINT32 uiLayer = 0; uiLayer < GBUFFER_LAYERS; ++uiLayer) {pkColors[uiLayer] = GetLayer(pkInput, uiLayer);}
+		return true;
+	}
+private:
+	Vector4 GetLayer(const ShaderReg* pkInput, UINT32 uiLayer)
+	{
+		Vector4 kColor;
+		switch(uiLayer)
+		{
+		case 0:		SampleTexture(kColor, 0, pkInput[0].x, pkInput[0].y, 0.0f);					break;
+		case 1:		kColor = Vector4(pkInput[0].x, pkInput[0].y, pkInput[0].z, 1.0f);			break;
+		default:	kColor = Vector4(0.5f + 0.5f * sinf(pkInput[0].x * 6.28f), 0.5f, 0.5f, 1.0f);	break;
+		}
+		return kColor;
+	}
+private:
+	UINT32 m_uiLayer;
+};
+
+//------------------------------------------------------------------------
+// COMMENT : Objects shared by all scenarios
+struct Benchmark
+{
+	UINT32					uiWidth, uiHeight;
+	Device*					pkDevice;
+	Device*					apkPresentDevices[3];	// PF_R8G8B8A8, PF_B8G8R8, PF_R5G6B5
+	std::vector<BYTE8>		vecFrameBuffer;
+	RenderTarget*			pkRenderTarget;
+	Surface*				pkColorBuffer;
+	Surface*				pkDepthBuffer;
+	Surface*				pkStencilBuffer;		// Only tested by the stencil scenarios
+	RenderTarget*			pkGBufferTarget;		// Shares the depth-buffer
+	Surface*				apkGBuffers[GBUFFER_LAYERS];
+
+	VertexFormat*			pkVertexFormat;
+	BenchmarkVertexShader*	pkVertexShader;
+	FlatPixelShader*		pkFlatPixelShader;
+	TexturePixelShader*		pkTexturePixelShader;
+	TexturePixelShader*		pkGradientPixelShader;
+	HeavyPixelShader*		pkHeavyPixelShader;
+	GBufferPixelShader*		pkGBufferPixelShader;
+
+	Texture*				pkTexture;
+	CubeTexture*			pkCubeTexture;
+	VolumeTexture*			pkVolumeTexture;
+	Texture*				pkMipTexture;			// Only used for mip-map generation
+	CubeTexture*			pkMipCubeTexture;
+	VolumeTexture*			pkMipVolumeTexture;
+
+	VertexBuffer*			pkQuads;				// Screen-filling quads with 2D, cube and volume coordinates
+	VertexBuffer*			pkGrid;					// Small triangles covering the screen
+	IndexBuffer*			pkGridIndices;
+	UINT32					uiGridVertices, uiGridTriangles;
+	VertexBuffer*			pkSphere;
+	IndexBuffer*			pkSphereIndices;
+	VertexBuffer*			pkMesh;					// Loaded from an OBJ file
+	UINT32					uiMeshTriangles;
+	VertexBuffer*			pkClipped;				// Large triangles crossing all frustum planes
+	DeferredScene*			pkDeferredScene;
+
+	Matrix4x4				matProjection;
+	UINT64					uiPixels;				// Pixels rendered by the current iteration
+};
+
+typedef UINT64 (*PFN_SCENARIO)(Benchmark& rkBench, UINT32 uiParameter);
+
+struct Scenario
+{
+	const char*		szName;
+	const char*		szUnit;			// Unit of the items a scenario processes per iteration
+	UINT32			uiIterations;
+	bool			bClear;
+	PFN_SCENARIO	pfnRun;
+	UINT32			uiParameter;
+};
+
+struct ScenarioResult
+{
+	const Scenario*	pkScenario;
+	UINT32			uiIterations;
+	UINT64			uiItems;		// Per iteration
+	UINT64			uiPixels;		// Per iteration
+	FLOAT64			fMin, fMedian, fMean, fMax;
+};
+
+//------------------------------------------------------------------------
+// COMMENT : Setup
+static UINT32 s_uiRandom = 12345;
+static FLOAT32 Random(FLOAT32 fMin, FLOAT32 fMax)
+{
+	s_uiRandom = s_uiRandom * 1664525 + 1013904223;
+	return fMin + (fMax - fMin) * (FLOAT32)(s_uiRandom >> 8) / (FLOAT32)(1 << 24);
+}
+
+static FLOAT32* WriteVertex(FLOAT32* pfVertex, FLOAT32 fX, FLOAT32 fY, FLOAT32 fZ, FLOAT32 fU, FLOAT32 fV, FLOAT32 fW)
+{
+	pfVertex[0] = fX; pfVertex[1] = fY; pfVertex[2] = fZ;
+	pfVertex[3] = fU; pfVertex[4] = fV; pfVertex[5] = fW;
+	return pfVertex + VERTEX_FLOATS;
+}
+
+static VertexBuffer* CreateVertices(Device* pkDevice, const std::vector<FLOAT32>& rvecVertices)
+{
+	VertexBuffer* pkVertexBuffer = NULL;
+	if(CORE3D_FAILED(pkDevice->CreateVertexBuffer(&pkVertexBuffer, (UINT32)rvecVertices.size() * sizeof(FLOAT32)))) {return NULL;}
+
+	void* pvData = NULL;
+	pkVertexBuffer->GetPointer(0, &pvData);
+	memcpy(pvData, &rvecVertices[0], rvecVertices.size() * sizeof(FLOAT32));
+	return pkVertexBuffer;
+}
+
+static IndexBuffer* CreateIndices(Device* pkDevice, const std::vector<UINT32>& rvecIndices)
+{
+	IndexBuffer* pkIndexBuffer = NULL;
+	if(CORE3D_FAILED(pkDevice->CreateIndexBuffer(&pkIndexBuffer, (UINT32)rvecIndices.size() * sizeof(UINT32), FMT_INDEX32))) {return NULL;}
+
+	void* pvData = NULL;
+	pkIndexBuffer->GetPointer(0, &pvData);
+	memcpy(pvData, &rvecIndices[0], rvecIndices.size() * sizeof(UINT32));
+	return pkIndexBuffer;
+}
+
+// COMMENT : Reads the positions and texture coordinates of an OBJ file's triangles(polygons are split into fans)
+static bool LoadObjMesh(const char* szFileName, std::vector<FLOAT32>& rvecVertices)
+{
+	FILE* pkFile = fopen(szFileName, "r");
+	if(NULL == pkFile) {return false;}
+
+	std::vector<Vector3> vecPositions;
+	std::vector<Vector2> vecTexCoords;
+	char szLine[512];
+	while(NULL != fgets(szLine, sizeof(szLine), pkFile))
+	{
+		if('v' == szLine[0] && ' ' == szLine[1])
+		{
+			Vector3 kPosition(0.0f, 0.0f, 0.0f);
+			sscanf(szLine + 2, "%f %f %f", &kPosition.x, &kPosition.y, &kPosition.z);
+			vecPositions.push_back(kPosition);
+		}
+		else if('v' == szLine[0] && 't' == szLine[1])
+		{
+			Vector2 kTexCoord(0.0f, 0.0f);
+			sscanf(szLine + 3, "%f %f", &kTexCoord.x, &kTexCoord.y);
+			vecTexCoords.push_back(kTexCoord);
+		}
+		else if('f' == szLine[0] && ' ' == szLine[1])
+		{
+			INT32 aiPosition[16], aiTexCoord[16];
+			UINT32 uiCorners = 0;
+			for(char* szCorner = strtok(szLine + 2, " \t\r\n"); NULL != szCorner && uiCorners < 16; szCorner = strtok(NULL, " \t\r\n"))
+			{
+				aiTexCoord[uiCorners] = 0;
+				if(sscanf(szCorner, "%d/%d", &aiPosition[uiCorners], &aiTexCoord[uiCorners]) < 1) {continue;}
+				++uiCorners;
+			}
+
+			for(UINT32 uiCorner = 2; uiCorner < uiCorners; ++uiCorner)
+			{
+				const UINT32 auiCorners[3] = {0, uiCorner - 1, uiCorner};
+				for(UINT32 uiVertex = 0; uiVertex < 3; ++uiVertex)
+				{
+					const INT32 iPosition = aiPosition[auiCorners[uiVertex]] - 1;
+					const INT32 iTexCoord = aiTexCoord[auiCorners[uiVertex]] - 1;
+					if(iPosition < 0 || iPosition >= (INT32)vecPositions.size()) {fclose(pkFile); return false;}
+
+					const Vector3& rkPosition	= vecPositions[iPosition];
+					const Vector2 kTexCoord		= (iTexCoord >= 0 && iTexCoord < (INT32)vecTexCoords.size()) ? vecTexCoords[iTexCoord] : Vector2(0.0f, 0.0f);
+					const FLOAT32 afVertex[VERTEX_FLOATS] = {rkPosition.x, rkPosition.y, -rkPosition.z, kTexCoord.x, 1.0f - kTexCoord.y, 0.0f};
+					rvecVertices.insert(rvecVertices.end(), afVertex, afVertex + VERTEX_FLOATS);
+				}
+			}
+		}
+	}
+	fclose(pkFile);
+	return false == rvecVertices.empty();
+}
+
+static void FillTexels(FLOAT32* pfTexel, UINT32 uiTexels, UINT32 uiWidth, UINT32 uiSeed)
+{
+	for(UINT32 uiTexel = 0; uiTexel < uiTexels; ++uiTexel)
+	{
+		const UINT32 uiX = uiTexel % uiWidth, uiY = uiTexel / uiWidth;
+		*pfTexel++ = (((uiX / 8) ^ (uiY / 8) ^ uiSeed) & 1) ? 1.0f : 0.1f;
+		*pfTexel++ = (FLOAT32)(uiX % 64) / 63.0f;
+		*pfTexel++ = (FLOAT32)(uiY % 64) / 63.0f;
+	}
+}
+
+static bool CreateTextures(Benchmark& rkBench, Texture** ppkTexture, CubeTexture** ppkCubeTexture, VolumeTexture** ppkVolumeTexture,
+	UINT32 uiSize, UINT32 uiCubeSize, UINT32 uiVolumeSize)
+{
+	void* pvData = NULL;
+	if(CORE3D_FAILED(rkBench.pkDevice->CreateTexture(ppkTexture, uiSize, uiSize, 0, FMT_R32G32B32F))) {return false;}
+	(*ppkTexture)->LockRect(0, &pvData, NULL);
+	FillTexels((FLOAT32*)pvData, uiSize * uiSize, uiSize, 0);
+	(*ppkTexture)->UnlockRect(0);
+	(*ppkTexture)->GenerateMipSubLevels(0);
+
+	if(CORE3D_FAILED(rkBench.pkDevice->CreateCubeTexture(ppkCubeTexture, uiCubeSize, 0, FMT_R32G32B32F))) {return false;}
+	for(UINT32 uiFace = CF_POSITIVE_X; uiFace <= CF_NEGATIVE_Z; ++uiFace)
+	{
+		(*ppkCubeTexture)->LockRect((CubeFaces)uiFace, 0, &pvData, NULL);
+		FillTexels((FLOAT32*)pvData, uiCubeSize * uiCubeSize, uiCubeSize, uiFace);
+		(*ppkCubeTexture)->UnlockRect((CubeFaces)uiFace, 0);
+	}
+	(*ppkCubeTexture)->GenerateMipSubLevels(0);
+
+	if(CORE3D_FAILED(rkBench.pkDevice->CreateVolumeTexture(ppkVolumeTexture, uiVolumeSize, uiVolumeSize, uiVolumeSize, 0, FMT_R32G32B32F))) {return false;}
+	(*ppkVolumeTexture)->LockBox(0, &pvData, NULL);
+	FillTexels((FLOAT32*)pvData, uiVolumeSize * uiVolumeSize * uiVolumeSize, uiVolumeSize, 0);
+	(*ppkVolumeTexture)->UnlockBox(0);
+	(*ppkVolumeTexture)->GenerateMipSubLevels(0);
+	return true;
+}
+
+static bool CreateGeometry(Benchmark& rkBench, const char* szObjFile)
+{
+	Device* pkDevice = rkBench.pkDevice;
+	std::vector<FLOAT32> vecVertices;
+	std::vector<UINT32> vecIndices;
+
+	// COMMENT : Quads in clip-space, with 2D coordinates repeating the texture 4 times, cube directions
+	// reaching into 5 faces and volume coordinates cutting diagonally through the volume
+	vecVertices.resize(3 * 6 * VERTEX_FLOATS);
+	FLOAT32* pfVertex = &vecVertices[0];
+	static const FLOAT32 CORNERS[6][2] = {{-1, -1}, {-1, 1}, {1, 1}, {-1, -1}, {1, 1}, {1, -1}};
+	for(UINT32 uiQuad = 0; uiQuad < 3; ++uiQuad)
+	{
+		for(UINT32 uiCorner = 0; uiCorner < 6; ++uiCorner)
+		{
+			const FLOAT32 fX = CORNERS[uiCorner][0], fY = CORNERS[uiCorner][1];
+			const FLOAT32 fU = fX * 0.5f + 0.5f, fV = 0.5f - fY * 0.5f;
+			switch(uiQuad)
+			{
+			case 0: pfVertex = WriteVertex(pfVertex, fX, fY, 0.5f, fU * 4.0f, fV * 4.0f, 0.0f);		break;
+			case 1: pfVertex = WriteVertex(pfVertex, fX, fY, 0.5f, fX * 2.0f, fY * 2.0f, 1.0f);		break;
+			case 2: pfVertex = WriteVertex(pfVertex, fX, fY, 0.5f, fU, fV, (fU + fV) * 0.5f);		break;
+			}
+		}
+	}
+	rkBench.pkQuads = CreateVertices(pkDevice, vecVertices);
+
+	// COMMENT : Grid of 4x4 pixel cells, each split into two triangles
+	const UINT32 uiCellsX = rkBench.uiWidth / 4, uiCellsY = rkBench.uiHeight / 4;
+	vecVertices.resize((uiCellsX + 1) * (uiCellsY + 1) * VERTEX_FLOATS);
+	pfVertex = &vecVertices[0];
+	for(UINT32 uiY = 0; uiY <= uiCellsY; ++uiY)
+	{
+		for(UINT32 uiX = 0; uiX <= uiCellsX; ++uiX)
+		{
+			const FLOAT32 fU = (FLOAT32)uiX / (FLOAT32)uiCellsX, fV = (FLOAT32)uiY / (FLOAT32)uiCellsY;
+			pfVertex = WriteVertex(pfVertex, fU * 2.0f - 1.0f, 1.0f - fV * 2.0f, 0.5f, fU, fV, 0.0f);
+		}
+	}
+	vecIndices.clear();
+	for(UINT32 uiY = 0; uiY < uiCellsY; ++uiY)
+	{
+		for(UINT32 uiX = 0; uiX < uiCellsX; ++uiX)
+		{
+			const UINT32 uiCorner = uiY * (uiCellsX + 1) + uiX;
+			vecIndices.push_back(uiCorner);		vecIndices.push_back(uiCorner + 1);				vecIndices.push_back(uiCorner + uiCellsX + 1);
+			vecIndices.push_back(uiCorner + 1);	vecIndices.push_back(uiCorner + uiCellsX + 2);	vecIndices.push_back(uiCorner + uiCellsX + 1);
+		}
+	}
+	rkBench.pkGrid			= CreateVertices(pkDevice, vecVertices);
+	rkBench.pkGridIndices	= CreateIndices(pkDevice, vecIndices);
+	rkBench.uiGridVertices	= (uiCellsX + 1) * (uiCellsY + 1);
+	rkBench.uiGridTriangles	= uiCellsX * uiCellsY * 2;
+
+	// COMMENT : Unit sphere, also used for subdivision with its positions as normals
+	vecVertices.resize((SPHERE_SLICES + 1) * (SPHERE_STACKS + 1) * VERTEX_FLOATS);
+	pfVertex = &vecVertices[0];
+	for(UINT32 uiStack = 0; uiStack <= SPHERE_STACKS; ++uiStack)
+	{
+		for(UINT32 uiSlice = 0; uiSlice <= SPHERE_SLICES; ++uiSlice)
+		{
+			const FLOAT32 fU = (FLOAT32)uiSlice / (FLOAT32)SPHERE_SLICES, fV = (FLOAT32)uiStack / (FLOAT32)SPHERE_STACKS;
+			const FLOAT32 fTheta = fU * 2.0f * 3.14159265f, fPhi = fV * 3.14159265f;
+			pfVertex = WriteVertex(pfVertex, sinf(fPhi) * cosf(fTheta), cosf(fPhi), sinf(fPhi) * sinf(fTheta), fU * 4.0f, fV * 2.0f, 0.0f);
+		}
+	}
+	vecIndices.clear();
+	for(UINT32 uiStack = 0; uiStack < SPHERE_STACKS; ++uiStack)
+	{
+		for(UINT32 uiSlice = 0; uiSlice < SPHERE_SLICES; ++uiSlice)
+		{
+			const UINT32 uiCorner = uiStack * (SPHERE_SLICES + 1) + uiSlice;
+			vecIndices.push_back(uiCorner);		vecIndices.push_back(uiCorner + 1);					vecIndices.push_back(uiCorner + SPHERE_SLICES + 1);
+			vecIndices.push_back(uiCorner + 1);	vecIndices.push_back(uiCorner + SPHERE_SLICES + 2);	vecIndices.push_back(uiCorner + SPHERE_SLICES + 1);
+		}
+	}
+	rkBench.pkSphere		= CreateVertices(pkDevice, vecVertices);
+	rkBench.pkSphereIndices	= CreateIndices(pkDevice, vecIndices);
+
+	// COMMENT : Large triangles around the viewer, reaching behind the near and beyond the far plane
+	vecVertices.resize(CLIPPED_TRIANGLES * 3 * VERTEX_FLOATS);
+	pfVertex = &vecVertices[0];
+	for(UINT32 uiVertex = 0; uiVertex < CLIPPED_TRIANGLES * 3; ++uiVertex)
+	{
+		pfVertex = WriteVertex(pfVertex, Random(-150.0f, 150.0f), Random(-150.0f, 150.0f), Random(-20.0f, 140.0f),
+			Random(0.0f, 8.0f), Random(0.0f, 8.0f), 0.0f);
+	}
+	rkBench.pkClipped = CreateVertices(pkDevice, vecVertices);
+
+	vecVertices.clear();
+	if(false == LoadObjMesh(szObjFile, vecVertices))
+	{
+		printf("Error : Couldn't load %s.\n", szObjFile);
+		return false;
+	}
+	rkBench.pkMesh			= CreateVertices(pkDevice, vecVertices);
+	rkBench.uiMeshTriangles	= (UINT32)vecVertices.size() / (3 * VERTEX_FLOATS);
+
+	return NULL != rkBench.pkQuads && NULL != rkBench.pkGrid && NULL != rkBench.pkGridIndices && NULL != rkBench.pkSphere &&
+		NULL != rkBench.pkSphereIndices && NULL != rkBench.pkClipped && NULL != rkBench.pkMesh;
+}
+
+//------------------------------------------------------------------------
+// COMMENT : Scenarios
+static void SetDefaultStates(Benchmark& rkBench)
+{
+	Device* pkDevice = rkBench.pkDevice;
+	pkDevice->SetRenderTarget(rkBench.pkRenderTarget);
+	pkDevice->SetVertexFormat(rkBench.pkVertexFormat);
+	pkDevice->SetVertexShader(rkBench.pkVertexShader);
+	pkDevice->SetPixelShader(rkBench.pkFlatPixelShader);
+	pkDevice->SetIndexBuffer(NULL);
+	pkDevice->SetTexture(0, rkBench.pkTexture);
+	pkDevice->SetTextureSamplerState(0, TSS_MINFILTER, TF_LINEAR);
+	pkDevice->SetTextureSamplerState(0, TSS_MAGFILTER, TF_LINEAR);
+	pkDevice->SetTextureSamplerState(0, TSS_MIPFILTER, TF_POINT);
+	pkDevice->SetRenderState(RS_ZENABLE, true);
+	pkDevice->SetRenderState(RS_ZFUNC, CMP_LESS);
+	pkDevice->SetRenderState(RS_CULLMODE, CULL_NONE);
+	pkDevice->SetRenderState(RS_SUBDIVISIONMODE, SUBDIV_NONE);
+	pkDevice->SetRenderState(RS_COLORWRITEENABLE, true);
+	pkDevice->SetRenderState(RS_STENCILENABLE, BT_FALSE);
+
+	Matrix4x4 matIdentity;
+	rkBench.pkVertexShader->SetMatrix(SC_WVPMATRIX, MatrixIdentity(matIdentity));
+}
+
+static void Draw(Benchmark& rkBench, PrimitiveType ePrimitiveType, UINT32 uiStartVertex, UINT32 uiPrimitiveCount)
+{
+	rkBench.pkDevice->DrawPrimitive(ePrimitiveType, uiStartVertex, uiPrimitiveCount);
+	rkBench.uiPixels += rkBench.pkDevice->GetRenderedPixels();
+}
+
+static void DrawIndexed(Benchmark& rkBench, UINT32 uiNumVertices, UINT32 uiPrimitiveCount)
+{
+	rkBench.pkDevice->DrawIndexedPrimitive(PT_TRIANGLELIST, 0, 0, uiNumVertices, 0, uiPrimitiveCount);
+	rkBench.uiPixels += rkBench.pkDevice->GetRenderedPixels();
+}
+
+// COMMENT : Full-screen quad shaded with PixelShader uiParameter(0 : flat, 1 : one bilinear sample, 2 : heavy)
+static UINT64 RunFill(Benchmark& rkBench, UINT32 uiParameter)
+{
+	PixelShader* apkPixelShaders[3] = {rkBench.pkFlatPixelShader, rkBench.pkTexturePixelShader, rkBench.pkHeavyPixelShader};
+	rkBench.pkDevice->SetPixelShader(apkPixelShaders[uiParameter]);
+	rkBench.pkDevice->SetTextureSamplerState(0, TSS_MIPFILTER, (2 == uiParameter) ? TF_LINEAR : TF_POINT);
+	rkBench.pkDevice->SetVertexStream(0, rkBench.pkQuads, 0, VERTEX_FLOATS * sizeof(FLOAT32));
+	Draw(rkBench, PT_TRIANGLELIST, 0, 2);
+	return rkBench.uiPixels;
+}
+
+// COMMENT : Full-screen quad shaded flat, with the vertex shader's output interpolated as uiParameter(ShaderRegInterpolation)
+static UINT64 RunInterpolation(Benchmark& rkBench, UINT32 uiParameter)
+{
+	rkBench.pkVertexShader->SetInterpolation((ShaderRegInterpolation)uiParameter);
+	RunFill(rkBench, 0);
+	rkBench.pkVertexShader->SetInterpolation(SRI_PERSPECTIVE);
+	return rkBench.uiPixels;
+}
+
+static UINT64 RunSmallTriangles(Benchmark& rkBench, UINT32 uiParameter)
+{
+	rkBench.pkDevice->SetVertexStream(0, rkBench.pkGrid, 0, VERTEX_FLOATS * sizeof(FLOAT32));
+	rkBench.pkDevice->SetIndexBuffer(rkBench.pkGridIndices);
+	DrawIndexed(rkBench, rkBench.uiGridVertices, rkBench.uiGridTriangles);
+	return rkBench.uiGridTriangles;
+}
+
+static void SetWorldMatrix(Benchmark& rkBench, FLOAT32 fX, FLOAT32 fY, FLOAT32 fZ, FLOAT32 fScale, FLOAT32 fRotation)
+{
+	Matrix4x4 matScale, matRotation, matTranslation;
+	MatrixScaling(matScale, Vector3(fScale, fScale, fScale));
+	MatrixRotationY(matRotation, fRotation);
+	MatrixTranslation(matTranslation, Vector3(fX, fY, fZ));
+	rkBench.pkVertexShader->SetMatrix(SC_WVPMATRIX, matScale * matRotation * matTranslation * rkBench.matProjection);
+}
+
+// COMMENT : OBJ mesh drawn 4x4 times(uiParameter 0), or the indexed sphere drawn 4 times(uiParameter 1)
+static UINT64 RunMesh(Benchmark& rkBench, UINT32 uiParameter)
+{
+	rkBench.pkDevice->SetPixelShader(rkBench.pkTexturePixelShader);
+	rkBench.pkDevice->SetRenderState(RS_CULLMODE, CULL_CCW);
+	if(0 == uiParameter)
+	{
+		rkBench.pkDevice->SetVertexStream(0, rkBench.pkMesh, 0, VERTEX_FLOATS * sizeof(FLOAT32));
+		for(UINT32 uiInstance = 0; uiInstance < 16; ++uiInstance)
+		{
+			SetWorldMatrix(rkBench, (FLOAT32)(uiInstance % 4) * 1.5f - 2.25f, (FLOAT32)(uiInstance / 4) * 1.2f - 1.8f, 6.0f, 1.0f, (FLOAT32)uiInstance);
+			Draw(rkBench, PT_TRIANGLELIST, 0, rkBench.uiMeshTriangles);
+		}
+		return 16 * 3 * rkBench.uiMeshTriangles;
+	}
+
+	rkBench.pkDevice->SetVertexStream(0, rkBench.pkSphere, 0, VERTEX_FLOATS * sizeof(FLOAT32));
+	rkBench.pkDevice->SetIndexBuffer(rkBench.pkSphereIndices);
+	for(UINT32 uiInstance = 0; uiInstance < 4; ++uiInstance)
+	{
+		SetWorldMatrix(rkBench, (FLOAT32)(uiInstance % 2) * 2.0f - 1.0f, (FLOAT32)(uiInstance / 2) * 2.0f - 1.0f, 5.0f, 0.9f, (FLOAT32)uiInstance);
+		DrawIndexed(rkBench, (SPHERE_SLICES + 1) * (SPHERE_STACKS + 1), SPHERE_SLICES * SPHERE_STACKS * 2);
+	}
+	return 4 * (SPHERE_SLICES + 1) * (SPHERE_STACKS + 1);
+}
+
+// COMMENT : Textured full-screen quad(0) or spheres(1) rendered depth-only, as for a shadow-map or a depth pre-pass
+static UINT64 RunDepthOnly(Benchmark& rkBench, UINT32 uiParameter)
+{
+	rkBench.pkDevice->SetRenderState(RS_COLORWRITEENABLE, false);
+	const UINT64 uiItems = (0 == uiParameter) ? RunFill(rkBench, 1) : RunMesh(rkBench, 1);
+	rkBench.pkDevice->SetRenderState(RS_COLORWRITEENABLE, true);
+	return uiItems;
+}
+
+// COMMENT : Indexed spheres drawn into a G-buffer, with one pass per layer(uiParameter 0) or in one pass into all of its
+// layers as color-buffers of one render-target(uiParameter 1)
+static UINT64 RunGBuffer(Benchmark& rkBench, UINT32 uiParameter)
+{
+	Device* pkDevice = rkBench.pkDevice;
+	pkDevice->SetRenderTarget(rkBench.pkGBufferTarget);
+	pkDevice->SetPixelShader(rkBench.pkGBufferPixelShader);
+	pkDevice->SetRenderState(RS_ZFUNC, CMP_LESSEQUAL);
+	pkDevice->SetRenderState(RS_CULLMODE, CULL_CCW);
+	pkDevice->SetVertexStream(0, rkBench.pkSphere, 0, VERTEX_FLOATS * sizeof(FLOAT32));
+	pkDevice->SetIndexBuffer(rkBench.pkSphereIndices);
+
+	const UINT32 uiPasses = (0 == uiParameter) ? GBUFFER_LAYERS : 1;
+	for(UINT32 uiPass = 0; uiPass < uiPasses; ++uiPass)
+	{
+		for(UINT32 uiLayer = 0; uiLayer < GBUFFER_LAYERS; ++uiLayer) {rkBench.pkGBufferTarget->SetColorBuffer(uiLayer, NULL);}
+		if(0 == uiParameter)
+		{
+			rkBench.pkGBufferTarget->SetColorBuffer(0, rkBench.apkGBuffers[uiPass]);
+			rkBench.pkGBufferPixelShader->SetLayer(uiPass);
+		}
+		else
+		{
+			for(UINT32 uiLayer = 0; uiLayer < GBUFFER_LAYERS; ++uiLayer) {rkBench.pkGBufferTarget->SetColorBuffer(uiLayer, rkBench.apkGBuffers[uiLayer]);}
+		}
+
+		for(UINT32 uiInstance = 0; uiInstance < 4; ++uiInstance)
+		{
+			SetWorldMatrix(rkBench, (FLOAT32)(uiInstance % 2) * 2.0f - 1.0f, (FLOAT32)(uiInstance / 2) * 2.0f - 1.0f, 5.0f, 0.9f, (FLOAT32)uiInstance);
+			DrawIndexed(rkBench, (SPHERE_SLICES + 1) * (SPHERE_STACKS + 1), SPHERE_SLICES * SPHERE_STACKS * 2);
+		}
+	}
+	return 4 * (SPHERE_SLICES + 1) * (SPHERE_STACKS + 1);
+}
+
+// COMMENT : Full-screen quad shaded flat, with the stencil test disabled(uiParameter 0) or failing for every pixel(uiParameter 1).
+// The stencil-buffer is cleared to 0, the masked draw only compares the stencil values.
+static UINT64 RunStencil(Benchmark& rkBench, UINT32 uiParameter)
+{
+	if(1 == uiParameter)
+	{
+		rkBench.pkDevice->SetRenderState(RS_STENCILENABLE, BT_TRUE);
+		rkBench.pkDevice->SetRenderState(RS_STENCILFUNC, CMP_NOTEQUAL);
+		rkBench.pkDevice->SetRenderState(RS_STENCILREF, 0);
+	}
+	RunFill(rkBench, 0);
+	rkBench.pkDevice->SetRenderState(RS_STENCILFUNC, CMP_ALWAYS);
+	return (UINT64)rkBench.uiWidth * rkBench.uiHeight;
+}
+
+// COMMENT : A frame of the deferred scene, its geometry pass and the lighting by DEFERRED_LIGHTS lights
+static UINT64 RunDeferred(Benchmark& rkBench, UINT32 uiParameter)
+{
+	return RenderDeferredScene(rkBench.pkDeferredScene);
+}
+
+// COMMENT : Both ways of filling the G-buffer have to write bit-identical layers, compares them after a draw of each.
+// Covered pixels are those with the alpha of layer 1 written.
+static bool CheckGBufferLayers(Benchmark& rkBench, UINT32& ruiDifferentValues, UINT32& ruiCoveredPixels)
+{
+	std::vector<FLOAT32> avecLayers[GBUFFER_LAYERS];
+	ruiDifferentValues	= 0;
+	ruiCoveredPixels	= 0;
+	for(UINT32 uiMode = 0; uiMode < 2; ++uiMode)
+	{
+		for(UINT32 uiLayer = 0; uiLayer < GBUFFER_LAYERS; ++uiLayer) {rkBench.apkGBuffers[uiLayer]->Clear(Vector4(0.0f, 0.0f, 0.0f, 0.0f), NULL);}
+		rkBench.pkRenderTarget->ClearDepthBuffer(1.0f, NULL);
+		SetDefaultStates(rkBench);
+		RunGBuffer(rkBench, uiMode);
+
+		for(UINT32 uiLayer = 0; uiLayer < GBUFFER_LAYERS; ++uiLayer)
+		{
+			const FLOAT32* pfData = NULL;
+			if(CORE3D_FAILED(rkBench.apkGBuffers[uiLayer]->LockRect((void**)&pfData, NULL))) {return false;}
+			const UINT32 uiFloats = rkBench.uiWidth * rkBench.uiHeight * 4;
+			if(0 == uiMode)
+			{
+				avecLayers[uiLayer].assign(pfData, pfData + uiFloats);
+				for(UINT32 uiFloat = 3; 1 == uiLayer && uiFloat < uiFloats; uiFloat += 4) {if(1.0f == pfData[uiFloat]) {++ruiCoveredPixels;}}
+			}
+			else
+			{
+				for(UINT32 uiFloat = 0; uiFloat < uiFloats; ++uiFloat)
+				{
+					if(0 != memcmp(&pfData[uiFloat], &avecLayers[uiLayer][uiFloat], sizeof(FLOAT32))) {++ruiDifferentValues;}
+				}
+			}
+			rkBench.apkGBuffers[uiLayer]->UnlockRect();
+		}
+	}
+	return true;
+}
+
+static UINT64 RunClipped(Benchmark& rkBench, UINT32 uiParameter)
+{
+	Matrix4x4 matProjection;
+	MatrixPerspectiveFovLH(matProjection, 1.2f, (FLOAT32)rkBench.uiWidth / (FLOAT32)rkBench.uiHeight, 1.0f, 100.0f);
+	rkBench.pkVertexShader->SetMatrix(SC_WVPMATRIX, matProjection);
+	rkBench.pkDevice->SetVertexStream(0, rkBench.pkClipped, 0, VERTEX_FLOATS * sizeof(FLOAT32));
+	Draw(rkBench, PT_TRIANGLELIST, 0, CLIPPED_TRIANGLES);
+	return CLIPPED_TRIANGLES;
+}
+
+// COMMENT : Coarse part of the sphere subdivided with SubDiv uiParameter
+static UINT64 RunSubdivision(Benchmark& rkBench, UINT32 uiParameter)
+{
+	Device* pkDevice = rkBench.pkDevice;
+	pkDevice->SetRenderState(RS_SUBDIVISIONMODE, uiParameter);
+	pkDevice->SetRenderState(RS_CULLMODE, CULL_CCW);
+	switch(uiParameter)
+	{
+	case SUBDIV_SIMPLE:
+		pkDevice->SetRenderState(RS_SUBDIVISIONLEVELS, 3);
+		break;
+	case SUBDIV_SMOOTH:
+		pkDevice->SetRenderState(RS_SUBDIVISIONLEVELS, 2);
+		pkDevice->SetRenderState(RS_SUBDIVISIONPOSITIONREGISTER, 0);
+		pkDevice->SetRenderState(RS_SUBDIVISIONNORMALREGISTER, 0);
+		break;
+	case SUBDIV_ADAPTIVE:
+		{
+			const FLOAT32 fMaxScreenArea = 0.001f;
+			pkDevice->SetRenderState(RS_SUBDIVISIONLEVELS, 1);
+			pkDevice->SetRenderState(RS_SUBDIVISIONMAXSCREENAREA, *(UINT32*)&fMaxScreenArea);
+			pkDevice->SetRenderState(RS_SUBDIVISIONMAXINNERLEVELS, 3);
+		}
+		break;
+	}
+
+	// COMMENT : The first 8 stacks of the sphere
+	const UINT32 uiTriangles = SPHERE_SLICES * 8 * 2;
+	SetWorldMatrix(rkBench, 0.0f, -0.5f, 2.5f, 1.0f, 0.0f);
+	pkDevice->SetVertexStream(0, rkBench.pkSphere, 0, VERTEX_FLOATS * sizeof(FLOAT32));
+	pkDevice->SetIndexBuffer(rkBench.pkSphereIndices);
+	DrawIndexed(rkBench, (SPHERE_SLICES + 1) * 9, uiTriangles);
+	return uiTriangles;
+}
+
+// COMMENT : Sphere stacks subdivided to level 5, which leaves most triangles smaller than a pixel
+static UINT64 RunSubpixelSubdivision(Benchmark& rkBench, UINT32 uiParameter)
+{
+	Device* pkDevice = rkBench.pkDevice;
+	pkDevice->SetRenderState(RS_SUBDIVISIONMODE, SUBDIV_SIMPLE);
+	pkDevice->SetRenderState(RS_SUBDIVISIONLEVELS, 5);
+	pkDevice->SetRenderState(RS_CULLMODE, CULL_CCW);
+
+	const UINT32 uiTriangles = SPHERE_SLICES * 8 * 2;
+	SetWorldMatrix(rkBench, 0.0f, -0.5f, 2.5f, 1.0f, 0.0f);
+	pkDevice->SetVertexStream(0, rkBench.pkSphere, 0, VERTEX_FLOATS * sizeof(FLOAT32));
+	pkDevice->SetIndexBuffer(rkBench.pkSphereIndices);
+	DrawIndexed(rkBench, (SPHERE_SLICES + 1) * 9, uiTriangles);
+	return uiTriangles;
+}
+
+// COMMENT : Full-screen quad sampling a texture, uiParameter : 0 point, 1 bilinear, 2 trilinear, 3 cube, 4 volume
+static UINT64 RunSampling(Benchmark& rkBench, UINT32 uiParameter)
+{
+	Device* pkDevice = rkBench.pkDevice;
+	const UINT32 uiFilter = (0 == uiParameter) ? TF_POINT : TF_LINEAR;
+	pkDevice->SetTextureSamplerState(0, TSS_MINFILTER, uiFilter);
+	pkDevice->SetTextureSamplerState(0, TSS_MAGFILTER, uiFilter);
+	pkDevice->SetTextureSamplerState(0, TSS_MIPFILTER, (uiParameter >= 2) ? TF_LINEAR : TF_POINT);
+	pkDevice->SetPixelShader((uiParameter >= 2) ? rkBench.pkGradientPixelShader : rkBench.pkTexturePixelShader);
+
+	UINT32 uiQuad = 0;
+	switch(uiParameter)
+	{
+	case 3:		pkDevice->SetTexture(0, rkBench.pkCubeTexture);		uiQuad = 1; break;
+	case 4:		pkDevice->SetTexture(0, rkBench.pkVolumeTexture);	uiQuad = 2; break;
+	default:	pkDevice->SetTexture(0, rkBench.pkTexture);						break;
+	}
+
+	pkDevice->SetVertexStream(0, rkBench.pkQuads, 0, VERTEX_FLOATS * sizeof(FLOAT32));
+	Draw(rkBench, PT_TRIANGLELIST, uiQuad * 6, 2);
+	return rkBench.uiPixels;
+}
+
+// COMMENT : uiParameter : 0 texture, 1 cube-texture, 2 volume-texture
+static UINT64 RunMipGeneration(Benchmark& rkBench, UINT32 uiParameter)
+{
+	switch(uiParameter)
+	{
+	case 0:
+		rkBench.pkMipTexture->GenerateMipSubLevels(0);
+		return (UINT64)rkBench.pkMipTexture->GetWidth() * rkBench.pkMipTexture->GetHeight();
+	case 1:
+		rkBench.pkMipCubeTexture->GenerateMipSubLevels(0);
+		return (UINT64)rkBench.pkMipCubeTexture->GetEdgeLength() * rkBench.pkMipCubeTexture->GetEdgeLength() * 6;
+	default:
+		rkBench.pkMipVolumeTexture->GenerateMipSubLevels(0);
+		return (UINT64)rkBench.pkMipVolumeTexture->GetWidth() * rkBench.pkMipVolumeTexture->GetHeight() * rkBench.pkMipVolumeTexture->GetDepth();
+	}
+}
+
+// COMMENT : Presents the color-buffer, uiParameter : 0 RGBA8, 1 BGR8, 2 R5G6B5 dithered, 3 RGBA8 with Reinhard tone-mapping and dithering
+static UINT64 RunPresent(Benchmark& rkBench, UINT32 uiParameter)
+{
+	static const UINT32 DEVICES[4] = {0, 1, 2, 0};
+	Device* pkDevice = rkBench.apkPresentDevices[DEVICES[uiParameter]];
+
+	PresentConversion kConversion;
+	kConversion.eToneMapping	= (3 == uiParameter) ? TM_REINHARD : TM_NONE;
+	kConversion.fExposure		= 1.0f;
+	kConversion.bDither			= (uiParameter >= 2);
+	pkDevice->SetPresentConversion(kConversion);
+
+	pkDevice->Present(rkBench.pkRenderTarget);
+	return (UINT64)rkBench.uiWidth * rkBench.uiHeight;
+}
+
+static const Scenario SCENARIOS[] =
+{
+	{"fill/flat",				"pixels",		100,	true,	RunFill,			0},
+	{"fill/texture",			"pixels",		50,		true,	RunFill,			1},
+	{"fill/heavy",				"pixels",		10,		true,	RunFill,			2},
+	{"interpolation/linear",	"pixels",		100,	true,	RunInterpolation,	SRI_LINEAR},
+	{"interpolation/flat",		"pixels",		100,	true,	RunInterpolation,	SRI_FLAT},
+	{"geometry/small_triangles","triangles",	20,		true,	RunSmallTriangles,	0},
+	{"geometry/obj_mesh",		"vertices",		20,		true,	RunMesh,			0},
+	{"geometry/indexed_sphere",	"vertices",		20,		true,	RunMesh,			1},
+	{"geometry/clipped",		"triangles",	20,		true,	RunClipped,			0},
+	{"depth/fill",				"pixels",		100,	true,	RunDepthOnly,		0},
+	{"depth/indexed_sphere",	"vertices",		20,		true,	RunDepthOnly,		1},
+	{"stencil/disabled",		"pixels",		100,	true,	RunStencil,			0},
+	{"stencil/masked",			"pixels",		100,	true,	RunStencil,			1},
+	{"gbuffer/multipass",		"vertices",		10,		true,	RunGBuffer,			0},
+	{"gbuffer/mrt",				"vertices",		10,		true,	RunGBuffer,			1},
+	{"deferred/lights",			"pixels",		10,		false,	RunDeferred,		0},
+	{"subdivision/simple",		"triangles",	10,		true,	RunSubdivision,		SUBDIV_SIMPLE},
+	{"subdivision/smooth",		"triangles",	10,		true,	RunSubdivision,		SUBDIV_SMOOTH},
+	{"subdivision/adaptive",	"triangles",	10,		true,	RunSubdivision,		SUBDIV_ADAPTIVE},
+	{"subdivision/subpixel",	"triangles",	5,		true,	RunSubpixelSubdivision,	0},
+	{"sampling/point",			"pixels",		50,		true,	RunSampling,		0},
+	{"sampling/bilinear",		"pixels",		50,		true,	RunSampling,		1},
+	{"sampling/trilinear",		"pixels",		20,		true,	RunSampling,		2},
+	{"sampling/cube",			"pixels",		20,		true,	RunSampling,		3},
+	{"sampling/volume",			"pixels",		20,		true,	RunSampling,		4},
+	{"mipgen/texture",			"texels",		20,		false,	RunMipGeneration,	0},
+	{"mipgen/cube",				"texels",		20,		false,	RunMipGeneration,	1},
+	{"mipgen/volume",			"texels",		20,		false,	RunMipGeneration,	2},
+	{"present/rgba8",			"pixels",		100,	false,	RunPresent,			0},
+	{"present/bgr8",			"pixels",		100,	false,	RunPresent,			1},
+	{"present/r5g6b5_dither",	"pixels",		100,	false,	RunPresent,			2},
+	{"present/reinhard_dither",	"pixels",		100,	false,	RunPresent,			3}
+};
+
+static ScenarioResult RunScenario(Benchmark& rkBench, const Scenario& rkScenario, UINT32 uiIterations)
+{
+	ScenarioResult kResult;
+	kResult.pkScenario		= &rkScenario;
+	kResult.uiIterations	= uiIterations;
+
+	std::vector<FLOAT64> vecSeconds;
+	for(UINT32 uiIteration = 0; uiIteration <= uiIterations; ++uiIteration)
+	{
+		if(true == rkScenario.bClear)
+		{
+			rkBench.pkRenderTarget->ClearColorBuffer(Vector4(0.2f, 0.3f, 0.4f, 1.0f), NULL);
+			rkBench.pkRenderTarget->ClearDepthBuffer(1.0f, NULL);
+			rkBench.pkRenderTarget->ClearStencilBuffer(0, NULL);
+		}
+		SetDefaultStates(rkBench);
+		rkBench.uiPixels = 0;
+
+		const FLOAT64 fStart	= GetSeconds();
+		kResult.uiItems			= rkScenario.pfnRun(rkBench, rkScenario.uiParameter);
+		const FLOAT64 fSeconds	= GetSeconds() - fStart;
+		kResult.uiPixels		= rkBench.uiPixels;
+
+		// COMMENT : The first iteration warms up caches and isn't counted
+		if(0 != uiIteration) {vecSeconds.push_back(fSeconds);}
+	}
+
+	std::sort(vecSeconds.begin(), vecSeconds.end());
+	kResult.fMin	= vecSeconds.front();
+	kResult.fMax	= vecSeconds.back();
+	kResult.fMedian	= (vecSeconds[(uiIterations - 1) / 2] + vecSeconds[uiIterations / 2]) * 0.5;
+	kResult.fMean	= 0.0;
+	for(UINT32 uiIteration = 0; uiIteration < uiIterations; ++uiIteration) {kResult.fMean += vecSeconds[uiIteration];}
+	kResult.fMean	/= (FLOAT64)uiIterations;
+	return kResult;
+}
+
+static bool WriteJSON(const char* szFileName, const Benchmark& rkBench, UINT32 uiThreads, const std::vector<ScenarioResult>& rvecResults)
+{
+	FILE* pkFile = fopen(szFileName, "w");
+	if(NULL == pkFile) {return false;}
+
+	fprintf(pkFile, "{\n\t\"benchmark\": \"Core3D\",\n\t\"version\": %u,\n", BENCHMARK_VERSION);
+#ifdef NDEBUG
+	fprintf(pkFile, "\t\"build\": \"release\",\n");
+#else
+	fprintf(pkFile, "\t\"build\": \"debug\",\n");
+#endif
+	fprintf(pkFile, "\t\"pipeline_statistics\": %s,\n", CORE3D_PIPELINE_STATISTICS ? "true" : "false");
+	fprintf(pkFile, "\t\"width\": %u,\n\t\"height\": %u,\n\t\"threads\": %u,\n\t\"scenarios\": [", rkBench.uiWidth, rkBench.uiHeight, uiThreads);
+	for(size_t uiResult = 0; uiResult < rvecResults.size(); ++uiResult)
+	{
+		const ScenarioResult& rkResult = rvecResults[uiResult];
+		fprintf(pkFile, "%s\n\t\t{\"name\": \"%s\", \"unit\": \"%s\", \"iterations\": %u, \"items\": %llu, \"pixels\": %llu, "
+			"\"min_ms\": %.4f, \"median_ms\": %.4f, \"mean_ms\": %.4f, \"max_ms\": %.4f, \"items_per_second\": %.1f}",
+			(0 == uiResult) ? "" : ",", rkResult.pkScenario->szName, rkResult.pkScenario->szUnit, rkResult.uiIterations,
+			(unsigned long long)rkResult.uiItems, (unsigned long long)rkResult.uiPixels,
+			rkResult.fMin * 1e3, rkResult.fMedian * 1e3, rkResult.fMean * 1e3, rkResult.fMax * 1e3,
+			(rkResult.fMedian > 0.0) ? (FLOAT64)rkResult.uiItems / rkResult.fMedian : 0.0);
+	}
+	fprintf(pkFile, "\n\t]\n}\n");
+
+	const bool bResult = (0 == ferror(pkFile));
+	fclose(pkFile);
+	return bResult;
+}
+
+static void ReleaseObject(RefObject* pkObject)
+{
+	if(NULL != pkObject) {pkObject->Release();}
+}
+
+int main(int argc, char** argv)
+{
+	const char* szJSONFile	= NULL;
+	const char* szFilter	= NULL;
+	const char* szObjFile	= CORE3D_SOURCE_DIR "/Sample_Crystal/data/headobject.obj";
+	UINT32 uiIterations		= 0;
+	UINT32 uiNumThreads		= 0;
+	Benchmark kBench;
+	memset(&kBench, 0, sizeof(kBench));
+	kBench.uiWidth			= 640;
+	kBench.uiHeight			= 480;
+	for(int iArg = 1; iArg < argc; ++iArg)
+	{
+		if(0 == strcmp(argv[iArg], "-json") && iArg + 1 < argc)					{szJSONFile = argv[++iArg];}
+		else if(0 == strcmp(argv[iArg], "-filter") && iArg + 1 < argc)			{szFilter = argv[++iArg];}
+		else if(0 == strcmp(argv[iArg], "-iterations") && iArg + 1 < argc)		{uiIterations = (UINT32)atoi(argv[++iArg]);}
+		else if(0 == strcmp(argv[iArg], "-threads") && iArg + 1 < argc)			{uiNumThreads = (UINT32)atoi(argv[++iArg]);}
+		else if(0 == strcmp(argv[iArg], "-obj") && iArg + 1 < argc)				{szObjFile = argv[++iArg];}
+		else if(0 == strcmp(argv[iArg], "-size") && iArg + 2 < argc)
+		{
+			kBench.uiWidth	= (UINT32)atoi(argv[++iArg]);
+			kBench.uiHeight	= (UINT32)atoi(argv[++iArg]);
+		}
+		else
+		{
+			printf("Usage : Tool_Benchmark [-json file] [-filter text] [-iterations count] [-size width height] [-threads count] [-obj file]\n");
+			return 1;
+		}
+	}
+
+	if(kBench.uiWidth < 16 || kBench.uiHeight < 16) {printf("Error : The size has to be at least 16x16.\n"); return 1;}
+
+	Object* pkObject = NULL;
+	if(CORE3D_FAILED(CreateObject(&pkObject))) {printf("Error : Couldn't create object.\n"); return 1;}
+
+	// COMMENT : The rendering device doesn't present, the present devices convert into kBench.vecFrameBuffer
+	DeviceParameters kParams;
+	memset(&kParams, 0, sizeof(kParams));
+	kParams.uiBackBufferWidth	= kBench.uiWidth;
+	kParams.uiBackBufferHeight	= kBench.uiHeight;
+	kParams.bWindowed			= true;
+	kParams.uiWorkerThreads		= uiNumThreads;
+	if(CORE3D_FAILED(pkObject->CreateDevice(&kBench.pkDevice, &kParams))) {printf("Error : Couldn't create device.\n"); return 1;}
+
+	kBench.vecFrameBuffer.resize(kBench.uiWidth * kBench.uiHeight * 4);
+	static const PresentFormat PRESENT_FORMATS[3] = {PF_R8G8B8A8, PF_B8G8R8, PF_R5G6B5};
+	for(UINT32 uiDevice = 0; uiDevice < 3; ++uiDevice)
+	{
+		kParams.pFrameBuffer		= &kBench.vecFrameBuffer[0];
+		kParams.eFrameBufferFormat	= PRESENT_FORMATS[uiDevice];
+		if(CORE3D_FAILED(pkObject->CreateDevice(&kBench.apkPresentDevices[uiDevice], &kParams))) {printf("Error : Couldn't create device.\n"); return 1;}
+	}
+
+	Device* pkDevice = kBench.pkDevice;
+	pkDevice->CreateRenderTarget(&kBench.pkRenderTarget);
+	pkDevice->CreateSurface(&kBench.pkColorBuffer, kBench.uiWidth, kBench.uiHeight, FMT_R32G32B32A32F);
+	pkDevice->CreateSurface(&kBench.pkDepthBuffer, kBench.uiWidth, kBench.uiHeight, FMT_R32F);
+	pkDevice->CreateSurface(&kBench.pkStencilBuffer, kBench.uiWidth, kBench.uiHeight, FMT_S8);
+	kBench.pkRenderTarget->SetColorBuffer(kBench.pkColorBuffer);
+	kBench.pkRenderTarget->SetDepthBuffer(kBench.pkDepthBuffer);
+	kBench.pkRenderTarget->SetStencilBuffer(kBench.pkStencilBuffer);
+
+	Matrix4x4 matViewport;
+	MatrixViewport(matViewport, 0, 0, kBench.uiWidth, kBench.uiHeight, 0.0f, 1.0f);
+	kBench.pkRenderTarget->SetViewportMatrix(matViewport);
+
+	pkDevice->CreateRenderTarget(&kBench.pkGBufferTarget);
+	kBench.pkGBufferTarget->SetDepthBuffer(kBench.pkDepthBuffer);
+	kBench.pkGBufferTarget->SetViewportMatrix(matViewport);
+	for(UINT32 uiLayer = 0; uiLayer < GBUFFER_LAYERS; ++uiLayer)
+	{
+		pkDevice->CreateSurface(&kBench.apkGBuffers[uiLayer], kBench.uiWidth, kBench.uiHeight, FMT_R32G32B32A32F);
+	}
+	MatrixPerspectiveFovLH(kBench.matProjection, 1.0f, (FLOAT32)kBench.uiWidth / (FLOAT32)kBench.uiHeight, 0.5f, 100.0f);
+
+	VertexElement akDeclaration[] = {CORE3D_VERTEXFORMAT_DECL(0, VET_VECTOR3, 0), CORE3D_VERTEXFORMAT_DECL(0, VET_VECTOR3, 1)};
+	pkDevice->CreateVertexFormat(&kBench.pkVertexFormat, akDeclaration, sizeof(akDeclaration));
+	kBench.pkVertexShader			= new BenchmarkVertexShader;
+	kBench.pkFlatPixelShader		= new FlatPixelShader;
+	kBench.pkTexturePixelShader		= new TexturePixelShader(false);
+	kBench.pkGradientPixelShader	= new TexturePixelShader(true);
+	kBench.pkHeavyPixelShader		= new HeavyPixelShader;
+	kBench.pkGBufferPixelShader		= new GBufferPixelShader;
+
+	if(false == CreateTextures(kBench, &kBench.pkTexture, &kBench.pkCubeTexture, &kBench.pkVolumeTexture, 256, 128, 32) ||
+		false == CreateTextures(kBench, &kBench.pkMipTexture, &kBench.pkMipCubeTexture, &kBench.pkMipVolumeTexture, 512, 256, 64))
+	{
+		printf("Error : Couldn't create textures.\n");
+		return 1;
+	}
+	if(false == CreateGeometry(kBench, szObjFile)) {printf("Error : Couldn't create geometry.\n"); return 1;}
+	kBench.pkDeferredScene = CreateDeferredScene(kBench.uiWidth, kBench.uiHeight);
+	if(NULL == kBench.pkDeferredScene) {printf("Error : Couldn't create the deferred scene.\n"); return 1;}
+
+	// COMMENT : Colors above 1 for the present conversions' tone-mapping
+	kBench.pkRenderTarget->ClearColorBuffer(Vector4(1.5f, 0.75f, 0.25f, 1.0f), NULL);
+
+	// COMMENT : The thread waiting for a job's completion executes jobs as well
+	const UINT32 uiThreads = pkDevice->GetJobSystem()->GetNumWorkers() + 1;
+	printf("Core3D benchmark %ux%u, %u threads\n", kBench.uiWidth, kBench.uiHeight, uiThreads);
+	printf("%-28s %6s %10s %10s %10s %14s\n", "Scenario", "Iter.", "Min ms", "Median ms", "Mean ms", "Items/s");
+
+	std::vector<ScenarioResult> vecResults;
+	bool bGBufferRun = false, bDeferredRun = false;
+	for(UINT32 uiScenario = 0; uiScenario < sizeof(SCENARIOS) / sizeof(SCENARIOS[0]); ++uiScenario)
+	{
+		const Scenario& rkScenario = SCENARIOS[uiScenario];
+		if(NULL != szFilter && NULL == strstr(rkScenario.szName, szFilter)) {continue;}
+
+		const ScenarioResult kResult = RunScenario(kBench, rkScenario, (0 != uiIterations) ? uiIterations : rkScenario.uiIterations);
+		printf("%-28s %6u %10.3f %10.3f %10.3f %10.2f M %s\n", rkScenario.szName, kResult.uiIterations,
+			kResult.fMin * 1e3, kResult.fMedian * 1e3, kResult.fMean * 1e3,
+			(kResult.fMedian > 0.0) ? (FLOAT64)kResult.uiItems / kResult.fMedian * 1e-6 : 0.0, rkScenario.szUnit);
+		vecResults.push_back(kResult);
+		bGBufferRun = bGBufferRun || (RunGBuffer == rkScenario.pfnRun);
+		bDeferredRun = bDeferredRun || (RunDeferred == rkScenario.pfnRun);
+	}
+
+	bool bResult = true;
+	if(true == bGBufferRun)
+	{
+		UINT32 uiDifferentValues = 0, uiCoveredPixels = 0;
+		bResult = CheckGBufferLayers(kBench, uiDifferentValues, uiCoveredPixels) && 0 == uiDifferentValues && 0 != uiCoveredPixels;
+		if(true == bResult)	{printf("Check gbuffer/mrt : layers are bit-identical to gbuffer/multipass, %u covered pixels\n", uiCoveredPixels);}
+		else				{printf("Error : %u values of the gbuffer/mrt layers differ from gbuffer/multipass.\n", uiDifferentValues);}
+	}
+
+	if(true == bDeferredRun)
+	{
+		FLOAT32 fMaxDifference = 0.0f;
+		UINT32 uiLitPixels = 0, uiFailedPixels = 0;
+		const bool bMatched = CheckDeferredScene(kBench.pkDeferredScene, fMaxDifference, uiLitPixels, uiFailedPixels) &&
+			0 == uiFailedPixels && 0 != uiLitPixels;
+		if(true == bMatched)
+		{
+			printf("Check deferred/lights : matches the brute-force lighting by %u lights within %g, %u lit pixels(max. difference %g)\n",
+				DEFERRED_LIGHTS, DEFERRED_TOLERANCE, uiLitPixels, fMaxDifference);
+		}
+		else
+		{
+			printf("Error : %u of %u deferred/lights pixels differ from the brute-force lighting by more than %g(max. difference %g).\n",
+				uiFailedPixels, uiLitPixels, DEFERRED_TOLERANCE, fMaxDifference);
+		}
+		bResult = bResult && bMatched;
+	}
+
+	if(NULL != szJSONFile && false == WriteJSON(szJSONFile, kBench, uiThreads, vecResults))
+	{
+		printf("Error : Couldn't write %s.\n", szJSONFile);
+		bResult = false;
+	}
+
+	// COMMENT : The device doesn't reference bound objects
+	pkDevice->SetVertexFormat(NULL);
+	pkDevice->SetVertexShader(NULL);
+	pkDevice->SetPixelShader(NULL);
+	pkDevice->SetIndexBuffer(NULL);
+	pkDevice->SetTexture(0, NULL);
+	pkDevice->SetVertexStream(0, NULL, 0, 1);
+	pkDevice->SetRenderTarget(NULL);
+	ReleaseDeferredScene(kBench.pkDeferredScene);
+
+	RefObject* apkObjects[] =
+	{
+		kBench.pkVertexShader, kBench.pkFlatPixelShader, kBench.pkTexturePixelShader, kBench.pkGradientPixelShader, kBench.pkHeavyPixelShader,
+		kBench.pkGBufferPixelShader, kBench.pkGBufferTarget, kBench.apkGBuffers[0], kBench.apkGBuffers[1], kBench.apkGBuffers[2],
+		kBench.pkVertexFormat, kBench.pkQuads, kBench.pkGrid, kBench.pkGridIndices, kBench.pkSphere, kBench.pkSphereIndices,
+		kBench.pkMesh, kBench.pkClipped, kBench.pkTexture, kBench.pkCubeTexture, kBench.pkVolumeTexture,
+		kBench.pkMipTexture, kBench.pkMipCubeTexture, kBench.pkMipVolumeTexture,
+		kBench.pkStencilBuffer, kBench.pkDepthBuffer, kBench.pkColorBuffer, kBench.pkRenderTarget,
+		kBench.apkPresentDevices[0], kBench.apkPresentDevices[1], kBench.apkPresentDevices[2], kBench.pkDevice, pkObject
+	};
+	for(UINT32 uiObject = 0; uiObject < sizeof(apkObjects) / sizeof(apkObjects[0]); ++uiObject) {ReleaseObject(apkObjects[uiObject]);}
+	return (true == bResult) ? 0 : 1;
+}
@@ -0,0 +1,297 @@
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+// COMMENT : Replays a frame written by Device::CaptureNextFrame() without a window and prints the time of each draw.
+// Shaders of the capturing application aren't known to the tool and are replaced by pass-through shaders, the
+// timings then show the cost of the frame's geometry and pixels with simple shading.
+// With -verify the render-target is compared with the capture after each draw, which only matches for frames
+// using the tool's own shaders, e.g. the demo frame written by -demo.
+// With -trace the last execution is recorded by the device's profiler and written as a Chrome trace.
+// Usage : Tool_FrameReplay <capture file> [-repeat count] [-threads count(0 : one per processor)] [-verify] [-trace file]
+//         Tool_FrameReplay -demo <capture file> [...] : captures a built-in frame and replays it
+
+#include "../Core3D/Core3D.h"
+#include "../Core3D/Object.h"
+#include "../Core3D/Device.h"
+#include "../Core3D/FrameReplay.h"
+#include "../Core3D/IndexBuffer.h"
+#include "../Core3D/RenderTarget.h"
+#include "../Core3D/Shaders.h"
+#include "../Core3D/Surface.h"
+#include "../Core3D/Texture.h"
+#include "../Core3D/VertexBuffer.h"
+#include "../Core3D/VertexFormat.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <typeinfo>
+#include <vector>
+
+using namespace Core3D;
+
+const UINT32 DEMO_WIDTH		= 320;
+const UINT32 DEMO_HEIGHT	= 240;
+const UINT32 DEMO_GRID		= 24;
+
+class DemoVertexShader : public VertexShader
+{
+protected:
+	void Execute(const ShaderReg* pkInput, Vector4& rkPosition, ShaderReg* pkOutput)
+	{
+		rkPosition	= pkInput[0] * GetMatrix(SC_WVPMATRIX);
+		pkOutput[0]	= pkInput[1];
+	}
+
+	ShaderRegType GetOutputRegisters(UINT32 uiRegister)
+	{
+		return (0 == uiRegister) ? SRT_VECTOR2 : SRT_UNUSED;
+	}
+};
+
+class DemoPixelShader : public PixelShader
+{
+protected:
+	bool Execute(const ShaderReg* pkInput, Vector4& rkColor, FLOAT32& rfDepth)
+	{
+		SampleTexture(rkColor, 0, pkInput[0].x, pkInput[0].y);
+		return true;
+	}
+};
+
+static BaseShader* CreateDemoVertexShader()	{return new DemoVertexShader;}
+static BaseShader* CreateDemoPixelShader()	{return new DemoPixelShader;}
+
+// COMMENT : Renders a textured grid and a wireframe part of it while the frame is captured
+static bool CaptureDemoFrame(Device* pkDevice, const char* szFileName)
+{
+	RenderTarget* pkRenderTarget = NULL;
+	Surface* pkColorBuffer = NULL, *pkDepthBuffer = NULL;
+	Texture* pkTexture = NULL;
+	VertexBuffer* pkVertexBuffer = NULL;
+	IndexBuffer* pkIndexBuffer = NULL;
+	VertexFormat* pkVertexFormat = NULL;
+
+	pkDevice->CreateRenderTarget(&pkRenderTarget);
+	pkDevice->CreateSurface(&pkColorBuffer, DEMO_WIDTH, DEMO_HEIGHT, FMT_R32G32B32A32F);
+	pkDevice->CreateSurface(&pkDepthBuffer, DEMO_WIDTH, DEMO_HEIGHT, FMT_R32F);
+	pkRenderTarget->SetColorBuffer(pkColorBuffer);
+	pkRenderTarget->SetDepthBuffer(pkDepthBuffer);
+
+	Matrix4x4 matViewport;
+	MatrixViewport(matViewport, 0, 0, DEMO_WIDTH, DEMO_HEIGHT, 0.0f, 1.0f);
+	pkRenderTarget->SetViewportMatrix(matViewport);
+
+	pkDevice->CreateTexture(&pkTexture, 64, 64, 7, FMT_R32G32B32F);
+	FLOAT32* pfTexel = NULL;
+	pkTexture->LockRect(0, (void**)&pfTexel, NULL);
+	for(UINT32 uiY = 0; uiY < 64; ++uiY)
+	{
+		for(UINT32 uiX = 0; uiX < 64; ++uiX)
+		{
+			*pfTexel++ = (((uiX / 8) ^ (uiY / 8)) & 1) ? 1.0f : 0.1f;
+			*pfTexel++ = (FLOAT32)uiX / 63.0f;
+			*pfTexel++ = (FLOAT32)uiY / 63.0f;
+		}
+	}
+	pkTexture->UnlockRect(0);
+	pkTexture->GenerateMipSubLevels(0);
+
+	const UINT32 uiNumVertices = (DEMO_GRID + 1) * (DEMO_GRID + 1);
+	pkDevice->CreateVertexBuffer(&pkVertexBuffer, uiNumVertices * 5 * sizeof(FLOAT32));
+	FLOAT32* pfVertex = NULL;
+	pkVertexBuffer->GetPointer(0, (void**)&pfVertex);
+	for(UINT32 uiZ = 0; uiZ <= DEMO_GRID; ++uiZ)
+	{
+		for(UINT32 uiX = 0; uiX <= DEMO_GRID; ++uiX)
+		{
+			*pfVertex++ = ((FLOAT32)uiX - DEMO_GRID / 2) * 2.0f;
+			*pfVertex++ = -1.0f + 0.06f * (FLOAT32)((uiX * 7 + uiZ * 3) % 5);
+			*pfVertex++ = ((FLOAT32)uiZ - 2.0f) * 2.0f;
+			*pfVertex++ = (FLOAT32)uiX * 0.5f;
+			*pfVertex++ = (FLOAT32)uiZ * 0.5f;
+		}
+	}
+
+	pkDevice->CreateIndexBuffer(&pkIndexBuffer, DEMO_GRID * DEMO_GRID * 6 * sizeof(UINT16), FMT_INDEX16);
+	UINT16* pIndex = NULL;
+	pkIndexBuffer->GetPointer(0, (void**)&pIndex);
+	for(UINT32 uiZ = 0; uiZ < DEMO_GRID; ++uiZ)
+	{
+		for(UINT32 uiX = 0; uiX < DEMO_GRID; ++uiX)
+		{
+			const UINT16 uiCorner = (UINT16)(uiZ * (DEMO_GRID + 1) + uiX);
+			*pIndex++ = uiCorner;		*pIndex++ = uiCorner + DEMO_GRID + 1;	*pIndex++ = uiCorner + 1;
+			*pIndex++ = uiCorner + 1;	*pIndex++ = uiCorner + DEMO_GRID + 1;	*pIndex++ = uiCorner + DEMO_GRID + 2;
+		}
+	}
+
+	VertexElement akDeclaration[] = {CORE3D_VERTEXFORMAT_DECL(0, VET_VECTOR3, 0), CORE3D_VERTEXFORMAT_DECL(0, VET_VECTOR2, 1)};
+	pkDevice->CreateVertexFormat(&pkVertexFormat, akDeclaration, sizeof(akDeclaration));
+
+	DemoVertexShader* pkVertexShader	= new DemoVertexShader;
+	DemoPixelShader* pkPixelShader		= new DemoPixelShader;
+
+	pkDevice->SetVertexFormat(pkVertexFormat);
+	pkDevice->SetVertexStream(0, pkVertexBuffer, 0, 5 * sizeof(FLOAT32));
+	pkDevice->SetIndexBuffer(pkIndexBuffer);
+	pkDevice->SetVertexShader(pkVertexShader);
+	pkDevice->SetPixelShader(pkPixelShader);
+	pkDevice->SetTexture(0, pkTexture);
+	pkDevice->SetTextureSamplerState(0, TSS_MIPFILTER, TF_LINEAR);
+	pkDevice->SetRenderState(RS_CULLMODE, CULL_NONE);
+	pkDevice->SetRenderTarget(pkRenderTarget);
+
+	const bool bResult = CORE3D_SUCCESSFUL(pkDevice->CaptureNextFrame(szFileName));
+	if(true == bResult)
+	{
+		Matrix4x4 matRotation, matTranslation, matProjection;
+		MatrixPerspectiveFovLH(matProjection, 1.2f, (FLOAT32)DEMO_WIDTH / (FLOAT32)DEMO_HEIGHT, 0.5f, 100.0f);
+		MatrixRotationY(matRotation, 0.3f);
+
+		pkRenderTarget->ClearColorBuffer(Vector4(0.2f, 0.3f, 0.4f, 1.0f), NULL);
+		pkRenderTarget->ClearDepthBuffer(1.0f, NULL);
+
+		MatrixTranslation(matTranslation, Vector3(0.0f, -1.0f, 3.0f));
+		pkVertexShader->SetMatrix(SC_WVPMATRIX, matRotation * matTranslation * matProjection);
+		pkDevice->DrawIndexedPrimitive(PT_TRIANGLELIST, 0, 0, uiNumVertices, 0, DEMO_GRID * DEMO_GRID * 2);
+
+		MatrixTranslation(matTranslation, Vector3(0.0f, -0.5f, 6.0f));
+		pkVertexShader->SetMatrix(SC_WVPMATRIX, matRotation * matTranslation * matProjection);
+		pkDevice->SetRenderState(RS_FILLMODE, FILL_WIREFRAME);
+		pkDevice->DrawIndexedPrimitive(PT_TRIANGLELIST, 0, 0, uiNumVertices, 0, 40);
+		pkDevice->SetRenderState(RS_FILLMODE, FILL_SOLID);
+
+		pkDevice->Present(pkRenderTarget);
+		pkDevice->WaitForPresent();
+	}
+
+	// COMMENT : The device doesn't reference bound objects
+	pkDevice->SetVertexFormat(NULL);
+	pkDevice->SetVertexShader(NULL);
+	pkDevice->SetPixelShader(NULL);
+	pkDevice->SetIndexBuffer(NULL);
+	pkDevice->SetTexture(0, NULL);
+	pkDevice->SetVertexStream(0, NULL, 0, 1);
+	pkDevice->SetRenderTarget(NULL);
+
+	pkVertexShader->Release();
+	pkPixelShader->Release();
+	pkVertexFormat->Release();
+	pkIndexBuffer->Release();
+	pkVertexBuffer->Release();
+	pkTexture->Release();
+	pkDepthBuffer->Release();
+	pkColorBuffer->Release();
+	pkRenderTarget->Release();
+	return bResult;
+}
+
+int main(int argc, char** argv)
+{
+	const char* szFileName	= NULL;
+	const char* szTraceFile	= NULL;
+	bool bDemo				= false;
+	bool bVerify			= false;
+	UINT32 uiRepeat			= 10;
+	UINT32 uiNumThreads		= 0;
+	for(int iArg = 1; iArg < argc; ++iArg)
+	{
+		if(0 == strcmp(argv[iArg], "-demo"))									{bDemo = true;}
+		else if(0 == strcmp(argv[iArg], "-verify"))								{bVerify = true;}
+		else if(0 == strcmp(argv[iArg], "-repeat") && iArg + 1 < argc)			{uiRepeat = (UINT32)atoi(argv[++iArg]);}
+		else if(0 == strcmp(argv[iArg], "-threads") && iArg + 1 < argc)			{uiNumThreads = (UINT32)atoi(argv[++iArg]);}
+		else if(0 == strcmp(argv[iArg], "-trace") && iArg + 1 < argc)			{szTraceFile = argv[++iArg];}
+		else if(NULL == szFileName)												{szFileName = argv[iArg];}
+	}
+
+	if(NULL == szFileName || 0 == uiRepeat)
+	{
+		printf("Usage : Tool_FrameReplay [-demo] <capture file> [-repeat count] [-threads count] [-verify] [-trace file]\n");
+		return 1;
+	}
+
+	Object* pkObject = NULL;
+	if(CORE3D_FAILED(CreateObject(&pkObject))) {printf("Error : Couldn't create object.\n"); return 1;}
+
+	DeviceParameters kParams;
+	memset(&kParams, 0, sizeof(kParams));
+	kParams.uiBackBufferWidth	= DEMO_WIDTH;
+	kParams.uiBackBufferHeight	= DEMO_HEIGHT;
+	kParams.bWindowed			= true;
+	kParams.uiWorkerThreads		= uiNumThreads;
+
+	Device* pkDevice = NULL;
+	if(CORE3D_FAILED(pkObject->CreateDevice(&pkDevice, &kParams))) {printf("Error : Couldn't create device.\n"); return 1;}
+
+	if(true == bDemo && false == CaptureDemoFrame(pkDevice, szFileName))
+	{
+		printf("Error : Couldn't capture demo frame to %s.\n", szFileName);
+		return 1;
+	}
+
+	FrameReplay* pkReplay = new FrameReplay;
+	pkReplay->RegisterShader(typeid(DemoVertexShader).name(), CreateDemoVertexShader);
+	pkReplay->RegisterShader(typeid(DemoPixelShader).name(), CreateDemoPixelShader);
+	if(CORE3D_FAILED(pkReplay->Load(szFileName))) {printf("Error : Couldn't load %s.\n", szFileName); return 1;}
+
+	// COMMENT : The fastest time of each draw over all executions
+	std::vector<FLOAT64> vecMinSeconds;
+	FLOAT64 fMinUploadSeconds = 0.0;
+	UINT32 uiMismatches = 0;
+	for(UINT32 uiExecution = 0; uiExecution < uiRepeat; ++uiExecution)
+	{
+		// COMMENT : Profiling slows the draws down, so only the last execution is recorded
+		if(NULL != szTraceFile && uiExecution + 1 == uiRepeat) {pkDevice->GetProfiler()->SetEnabled(true);}
+		if(CORE3D_FAILED(pkReplay->Execute(pkDevice, bVerify))) {printf("Error : Couldn't execute %s.\n", szFileName); return 1;}
+
+		if(0 == uiExecution) {vecMinSeconds.assign(pkReplay->GetNumDraws(), 1e30);}
+		for(UINT32 uiDraw = 0; uiDraw < pkReplay->GetNumDraws() && uiDraw < vecMinSeconds.size(); ++uiDraw)
+		{
+			const ReplayDrawInfo& rkDraw = pkReplay->GetDrawInfo(uiDraw);
+			if(rkDraw.fSeconds < vecMinSeconds[uiDraw]) {vecMinSeconds[uiDraw] = rkDraw.fSeconds;}
+			if(true == bVerify && rkDraw.uiReplayedHash != rkDraw.uiCapturedHash) {++uiMismatches;}
+		}
+		if(0 == uiExecution || pkReplay->GetUploadSeconds() < fMinUploadSeconds) {fMinUploadSeconds = pkReplay->GetUploadSeconds();}
+	}
+
+	static const char* s_aszDrawTypes[] = {"DrawPrimitive", "DrawIndexedPrimitive", "DrawDynamicPrimitive"};
+	printf("%s : %u draws, %u substituted shaders, best of %u executions\n",
+		szFileName, pkReplay->GetNumDraws(), pkReplay->GetNumSubstitutedShaders(), uiRepeat);
+
+	FLOAT64 fTotalSeconds = 0.0;
+	for(UINT32 uiDraw = 0; uiDraw < pkReplay->GetNumDraws(); ++uiDraw)
+	{
+		const ReplayDrawInfo& rkDraw = pkReplay->GetDrawInfo(uiDraw);
+		printf("%5u %-22s %10.3f ms %10u pixels%s%s\n", uiDraw,
+			(rkDraw.eDrawType <= CDT_DYNAMICPRIMITIVE) ? s_aszDrawTypes[rkDraw.eDrawType] : "?",
+			vecMinSeconds[uiDraw] * 1e3, rkDraw.uiRenderedPixels,
+			CORE3D_FAILED(rkDraw.eResult) ? " failed" : "",
+			(true == bVerify && rkDraw.uiReplayedHash != rkDraw.uiCapturedHash) ? " mismatch" : "");
+		fTotalSeconds += vecMinSeconds[uiDraw];
+	}
+
+	printf("Draws %.3f ms, uploads %.3f ms\n", fTotalSeconds * 1e3, fMinUploadSeconds * 1e3);
+	printf("Frame hash %016llx, captured %016llx\n",
+		(unsigned long long)pkReplay->GetReplayedFrameHash(), (unsigned long long)pkReplay->GetCapturedFrameHash());
+
+	if(NULL != szTraceFile)
+	{
+		pkDevice->GetProfiler()->SetEnabled(false);
+		if(CORE3D_FAILED(pkDevice->GetProfiler()->ExportChromeTrace(szTraceFile)))	{printf("Error : Couldn't write trace %s.\n", szTraceFile);}
+		else																		{printf("Trace of the last execution written to %s.\n", szTraceFile);}
+	}
+
+	const bool bMatch = (pkReplay->GetReplayedFrameHash() == pkReplay->GetCapturedFrameHash());
+	if(true == bVerify)
+	{
+		if(0 == uiMismatches && true == bMatch)	{printf("Verified : replay matches the capture.\n");}
+		else									{printf("Error : %u draws differ from the capture.\n", uiMismatches);}
+	}
+
+	delete pkReplay;
+	pkDevice->Release();
+	pkObject->Release();
+	return (true == bVerify && (0 != uiMismatches || false == bMatch)) ? 1 : 0;
+}
@@ -0,0 +1,123 @@
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+// COMMENT : Measures the scheduling overhead of the job system.
+// Prints the time per job for empty jobs, parallel-for loops of varying grain size and dependency chains.
+// Usage : Tool_JobBenchmark [threads(0 : one per processor)] [jobs]
+
+#include "../Core3D/Core3D.h"
+#include "../Core3D/JobSystem.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+using namespace Core3D;
+
+static volatile INT32 s_iExecutedIndices = 0;
+
+static void EmptyJob(void* pvData, UINT32 uiBegin, UINT32 uiEnd)
+{
+	AtomicAdd(&s_iExecutedIndices, static_cast<INT32>(uiEnd - uiBegin));
+}
+
+// COMMENT : Some work per index, so splitting pays off for larger grain sizes
+static void SmallJob(void* pvData, UINT32 uiBegin, UINT32 uiEnd)
+{
+	FLOAT32* pfData = reinterpret_cast<FLOAT32*>(pvData);
+	for(UINT32 ui = uiBegin; ui < uiEnd; ++ui)
+	{
+		FLOAT32 fValue = (FLOAT32)ui;
+		for(UINT32 uiIteration = 0; uiIteration < 64; ++uiIteration) {fValue = fValue * 0.999f + 1.0f;}
+		pfData[ui] = fValue;
+	}
+	AtomicAdd(&s_iExecutedIndices, static_cast<INT32>(uiEnd - uiBegin));
+}
+
+static bool Check(const char* szTest, INT32 iExpected)
+{
+	const INT32 iExecuted = AtomicExchange(&s_iExecutedIndices, 0);
+	if(iExecuted == iExpected) {return true;}
+	printf("Error : %s executed %d of %d indices.\n", szTest, iExecuted, iExpected);
+	return false;
+}
+
+static void Report(const char* szTest, FLOAT64 fSeconds, UINT32 uiJobs)
+{
+	printf("%-36s %10.1f ns/job %10.3f ms\n", szTest, fSeconds * 1e9 / (FLOAT64)uiJobs, fSeconds * 1e3);
+}
+
+int main(int argc, char** argv)
+{
+	const UINT32 uiNumThreads	= (argc > 1) ? (UINT32)atoi(argv[1]) : 0;
+	const UINT32 uiNumJobs		= (argc > 2) ? (UINT32)atoi(argv[2]) : 100000;
+	if(0 == uiNumJobs) {printf("Error : Number of jobs has to be positive.\n"); return 1;}
+
+	JobSystem kJobSystem;
+	if(CORE3D_FAILED(kJobSystem.Create(uiNumThreads))) {printf("Error : Couldn't create job system.\n"); return 1;}
+	printf("Job system with %u workers, %u jobs per test\n", kJobSystem.GetNumWorkers(), uiNumJobs);
+
+	bool bResult = true;
+	char szTest[64];
+
+	// COMMENT : Single jobs submitted one by one from outside the job system
+	{
+		JobCounter kCounter;
+		const FLOAT64 fStart = GetSeconds();
+		for(UINT32 uiJob = 0; uiJob < uiNumJobs; ++uiJob) {kJobSystem.Submit(&kCounter, EmptyJob, NULL);}
+		kJobSystem.Wait(&kCounter);
+		Report("Submit, empty jobs", GetSeconds() - fStart, uiNumJobs);
+		bResult &= Check("Submit", uiNumJobs);
+	}
+
+	// COMMENT : One range split into jobs by the workers
+	{
+		const FLOAT64 fStart = GetSeconds();
+		kJobSystem.ParallelFor(EmptyJob, NULL, 0, uiNumJobs);
+		Report("ParallelFor, empty jobs", GetSeconds() - fStart, uiNumJobs);
+		bResult &= Check("ParallelFor", uiNumJobs);
+	}
+
+	FLOAT32* pfData = new FLOAT32[uiNumJobs];
+	{
+		const FLOAT64 fStart = GetSeconds();
+		SmallJob(pfData, 0, uiNumJobs);
+		Report("Serial loop, small jobs", GetSeconds() - fStart, uiNumJobs);
+		bResult &= Check("Serial loop", uiNumJobs);
+	}
+
+	for(UINT32 uiGrainSize = 1; uiGrainSize <= 4096; uiGrainSize *= 8)
+	{
+		const FLOAT64 fStart = GetSeconds();
+		kJobSystem.ParallelFor(SmallJob, pfData, 0, uiNumJobs, uiGrainSize);
+		const FLOAT64 fSeconds = GetSeconds() - fStart;
+
+		sprintf(szTest, "ParallelFor, small jobs, grain %u", uiGrainSize);
+		Report(szTest, fSeconds, uiNumJobs);
+		bResult &= Check(szTest, uiNumJobs);
+	}
+	delete[] pfData;
+
+	// COMMENT : Every job waits for the previous one, which measures the latency of starting dependent jobs
+	{
+		const UINT32 uiChainLength	= (uiNumJobs < 10000) ? uiNumJobs : 10000;
+		JobCounter* pkCounters		= new JobCounter[uiChainLength];
+
+		const FLOAT64 fStart = GetSeconds();
+		kJobSystem.Submit(&pkCounters[0], EmptyJob, NULL);
+		for(UINT32 uiJob = 1; uiJob < uiChainLength; ++uiJob)
+		{
+			kJobSystem.Submit(&pkCounters[uiJob], EmptyJob, NULL, 0, 1, 1, &pkCounters[uiJob - 1]);
+		}
+		kJobSystem.Wait(&pkCounters[uiChainLength - 1]);
+		Report("Dependency chain, empty jobs", GetSeconds() - fStart, uiChainLength);
+		bResult &= Check("Dependency chain", uiChainLength);
+
+		// COMMENT : Earlier links of the chain may still be finishing
+		for(UINT32 uiJob = 0; uiJob < uiChainLength; ++uiJob) {kJobSystem.Wait(&pkCounters[uiJob]);}
+		delete[] pkCounters;
+	}
+
+	printf(bResult ? "OK\n" : "FAILED\n");
+	return bResult ? 0 : 1;
+}
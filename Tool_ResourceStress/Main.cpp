@@ -0,0 +1,210 @@
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+// COMMENT : Stress test for sharing resources between threads.
+// A loader thread creates textures and hands them through a chain of threads, the last one releases them.
+// Meanwhile every thread adds and releases references to a few textures shared by all of them.
+// Usage : Tool_ResourceStress [threads] [textures]
+
+#include "../Core3D/Core3D.h"
+#include "../Core3D/Core3DThread.h"
+#include "../Core3D/Object.h"
+#include "../Core3D/Device.h"
+#include "../Core3D/Texture.h"
+#include "../Core3D/Surface.h"
+#include <stdio.h>
+
+using namespace Core3D;
+
+const UINT32 MAX_STAGES		= 16;
+const UINT32 NUM_SHARED		= 4;
+const UINT32 QUEUE_LENGTH	= 8;
+const UINT32 TEXTURE_SIZE	= 16;
+
+static volatile INT32 s_iErrors = 0;
+
+// COMMENT : Bounded queue handing textures(and their references) from one thread to the next
+class TextureQueue
+{
+public:
+	TextureQueue() : m_uiRead(0), m_uiWrite(0) {m_kFreeSlots.Post(QUEUE_LENGTH);}
+
+	void Push(Texture* pkTexture)
+	{
+		m_kFreeSlots.Wait();
+		m_kLock.Lock();
+		m_apkTextures[m_uiWrite] = pkTexture;
+		m_uiWrite = (m_uiWrite + 1) % QUEUE_LENGTH;
+		m_kLock.Unlock();
+		m_kQueuedTextures.Post();
+	}
+
+	Texture* Pop()
+	{
+		m_kQueuedTextures.Wait();
+		m_kLock.Lock();
+		Texture* pkTexture = m_apkTextures[m_uiRead];
+		m_uiRead = (m_uiRead + 1) % QUEUE_LENGTH;
+		m_kLock.Unlock();
+		m_kFreeSlots.Post();
+		return pkTexture;
+	}
+private:
+	Texture*	m_apkTextures[QUEUE_LENGTH];
+	UINT32		m_uiRead, m_uiWrite;
+	Mutex		m_kLock;
+	Semaphore	m_kQueuedTextures;
+	Semaphore	m_kFreeSlots;
+};
+
+struct StressInfo
+{
+	Device*			pkDevice;
+	Texture*		apkShared[NUM_SHARED];
+	TextureQueue	akQueues[MAX_STAGES];
+	UINT32			uiNumStages;
+	UINT32			uiNumTextures;
+};
+
+struct StageInfo
+{
+	StressInfo*		pkStress;
+	UINT32			uiStage;
+};
+
+static void ReportError(const char* szError, UINT32 uiTexture)
+{
+	// COMMENT : Print the first few errors only
+	if(AtomicIncrement(&s_iErrors) <= 10) {printf("Error : %s(texture %u)\n", szError, uiTexture);}
+}
+
+static FLOAT32 ReadTexture(Texture* pkTexture)
+{
+	Vector4 kColor;
+	Surface* pkLevel = pkTexture->GetMipLevel(0);
+	pkLevel->SamplePoint(kColor, 0.5f, 0.5f);
+	pkLevel->Release();
+	return kColor.x;
+}
+
+static void LoaderThread(void* pvStress)
+{
+	StressInfo* pkStress = reinterpret_cast<StressInfo*>(pvStress);
+	for(UINT32 uiTexture = 0; uiTexture < pkStress->uiNumTextures; ++uiTexture)
+	{
+		Texture* pkTexture = NULL;
+		if(CORE3D_FAILED(pkStress->pkDevice->CreateTexture(&pkTexture, TEXTURE_SIZE, TEXTURE_SIZE, 1, FMT_R32F)))
+		{
+			ReportError("Couldn't create texture", uiTexture);
+			pkTexture = NULL;
+		}
+		else
+		{
+			// COMMENT : Nobody else knows the texture yet, so it can be locked
+			FLOAT32* pfData = NULL;
+			pkTexture->LockRect(0, (void**)&pfData, NULL);
+			for(UINT32 uiTexel = 0; uiTexel < TEXTURE_SIZE * TEXTURE_SIZE; ++uiTexel) {pfData[uiTexel] = (FLOAT32)uiTexture;}
+			pkTexture->UnlockRect(0);
+		}
+		pkStress->akQueues[0].Push(pkTexture);
+	}
+}
+
+static void StageThread(void* pvStage)
+{
+	StageInfo* pkStage		= reinterpret_cast<StageInfo*>(pvStage);
+	StressInfo* pkStress	= pkStage->pkStress;
+	const bool bLastStage	= (pkStage->uiStage + 1 == pkStress->uiNumStages);
+
+	for(UINT32 uiTexture = 0; uiTexture < pkStress->uiNumTextures; ++uiTexture)
+	{
+		Texture* pkTexture = pkStress->akQueues[pkStage->uiStage].Pop();
+		if(NULL == pkTexture) {continue;}
+
+		// COMMENT : Take temporary references to the shared textures, all threads do this at the same time
+		for(UINT32 uiRound = 0; uiRound < 16; ++uiRound)
+		{
+			Texture* pkShared = pkStress->apkShared[(uiTexture + uiRound) % NUM_SHARED];
+			pkShared->AddRef();
+			if(ReadTexture(pkShared) != (FLOAT32)((uiTexture + uiRound) % NUM_SHARED)) {ReportError("Shared texture has wrong contents", uiTexture);}
+			pkShared->Release();
+		}
+
+		if(ReadTexture(pkTexture) != (FLOAT32)uiTexture) {ReportError("Handed over texture has wrong contents", uiTexture);}
+
+		if(true == bLastStage)	{pkTexture->Release();}
+		else					{pkStress->akQueues[pkStage->uiStage + 1].Push(pkTexture);}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	UINT32 uiNumStages		= (argc > 1) ? (UINT32)atoi(argv[1]) : 4;
+	UINT32 uiNumTextures	= (argc > 2) ? (UINT32)atoi(argv[2]) : 20000;
+	if(uiNumStages < 1)				{uiNumStages = 1;}
+	if(uiNumStages > MAX_STAGES)	{uiNumStages = MAX_STAGES;}
+
+	Object* pkObject = NULL;
+	if(CORE3D_FAILED(CreateObject(&pkObject))) {printf("Error : Couldn't create object.\n"); return 1;}
+
+	DeviceParameters kParams;
+	memset(&kParams, 0, sizeof(kParams));
+	kParams.uiBackBufferWidth	= TEXTURE_SIZE;
+	kParams.uiBackBufferHeight	= TEXTURE_SIZE;
+	kParams.bWindowed			= true;
+
+	StressInfo* pkStress = new StressInfo;
+	pkStress->uiNumStages	= uiNumStages;
+	pkStress->uiNumTextures	= uiNumTextures;
+	if(CORE3D_FAILED(pkObject->CreateDevice(&pkStress->pkDevice, &kParams))) {printf("Error : Couldn't create device.\n"); return 1;}
+
+	for(UINT32 uiShared = 0; uiShared < NUM_SHARED; ++uiShared)
+	{
+		pkStress->pkDevice->CreateTexture(&pkStress->apkShared[uiShared], TEXTURE_SIZE, TEXTURE_SIZE, 1, FMT_R32F);
+		pkStress->apkShared[uiShared]->Clear(0, Vector4((FLOAT32)uiShared, 0.0f, 0.0f, 0.0f), NULL);
+	}
+
+	// COMMENT : Textures hold a reference to their device, all of them have to be given back at the end
+	const UINT32 uiDeviceRefs = pkStress->pkDevice->AddRef() - 1;
+	pkStress->pkDevice->Release();
+
+	printf("Handing %u textures through %u threads...\n", uiNumTextures, uiNumStages);
+
+	Thread kLoader;
+	Thread akStages[MAX_STAGES];
+	StageInfo akStageInfos[MAX_STAGES];
+	kLoader.Start(LoaderThread, pkStress);
+	for(UINT32 uiStage = 0; uiStage < uiNumStages; ++uiStage)
+	{
+		akStageInfos[uiStage].pkStress	= pkStress;
+		akStageInfos[uiStage].uiStage	= uiStage;
+		akStages[uiStage].Start(StageThread, &akStageInfos[uiStage]);
+	}
+
+	kLoader.Join();
+	for(UINT32 uiStage = 0; uiStage < uiNumStages; ++uiStage) {akStages[uiStage].Join();}
+
+	// COMMENT : Every temporary reference must have been released again
+	for(UINT32 uiShared = 0; uiShared < NUM_SHARED; ++uiShared)
+	{
+		if(2 != pkStress->apkShared[uiShared]->AddRef()) {ReportError("Shared texture has wrong reference count", uiShared);}
+		pkStress->apkShared[uiShared]->Release();
+		pkStress->apkShared[uiShared]->Release();
+	}
+
+	if(uiDeviceRefs - NUM_SHARED + 1 != pkStress->pkDevice->AddRef()) {ReportError("Device has wrong reference count", 0);}
+	pkStress->pkDevice->Release();
+	pkStress->pkDevice->Release();
+	delete pkStress;
+	pkObject->Release();
+
+	if(0 != s_iErrors)
+	{
+		printf("FAILED : %d errors.\n", s_iErrors);
+		return 1;
+	}
+	printf("OK\n");
+	return 0;
+}
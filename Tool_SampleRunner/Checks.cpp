@@ -0,0 +1,663 @@
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+// COMMENT : Checks of the rasterization which the samples' golden images don't cover, e.g. because no sample hits the
+// case. Vertices are given in pixels of a CHECK_SIZE * CHECK_SIZE render-target, pixel centers lie at integer positions.
+// Their W only changes the perspective correction of the texture coordinate, which the pixel shader adds to its color.
+
+#include "Checks.h"
+#include "../Core3D/Core3D.h"
+#include "../Core3D/Core3DThread.h"
+#include "../Core3D/Object.h"
+#include "../Core3D/Device.h"
+#include "../Core3D/RenderTarget.h"
+#include "../Core3D/Shaders.h"
+#include "../Core3D/Surface.h"
+#include "../Core3D/Texture.h"
+#include "../Core3D/VertexBuffer.h"
+#include "../Core3D/VertexFormat.h"
+#include <stdio.h>
+#include <math.h>
+#include <string.h>
+#include <vector>
+
+using namespace Core3D;
+
+const UINT32 CHECK_SIZE			= 64;
+const UINT32 CHECK_MAX_VERTICES	= 4096;
+
+struct CheckVertex
+{
+	FLOAT32 fX, fY, fZ, fW;
+	FLOAT32 fU, fV;
+};
+
+class CheckVertexShader : public VertexShader
+{
+protected:
+	void Execute(const ShaderReg* pkInput, Vector4& rkPosition, ShaderReg* pkOutput)
+	{
+		const FLOAT32 fW	= pkInput[0].w;
+		rkPosition			= Vector4((pkInput[0].x * 2.0f / CHECK_SIZE - 1.0f) * fW, (1.0f - pkInput[0].y * 2.0f / CHECK_SIZE) * fW, pkInput[0].z * fW, fW);
+		pkOutput[0]			= pkInput[1];
+	}
+
+	ShaderRegType GetOutputRegisters(UINT32 uiRegister)
+	{
+		return (0 == uiRegister) ? SRT_VECTOR2 : SRT_UNUSED;
+	}
+};
+
+class CheckPixelShader : public PixelShader
+{
+protected:
+	bool Execute(const ShaderReg* pkInput, Vector4& rkColor, FLOAT32& rfDepth)
+	{
+		rkColor = GetVector(0) + Vector4(pkInput[0].x, pkInput[0].y, 0.0f, 0.0f);
+		return true;
+	}
+};
+
+// COMMENT : Samples sampler 0 mip-mapped, with the derivatives of the texture coordinates of the drawing thread's triangle
+class CheckTexturePixelShader : public PixelShader
+{
+public:
+	bool MightKillPixels() {return false;}
+protected:
+	bool Execute(const ShaderReg* pkInput, Vector4& rkColor, FLOAT32& rfDepth)
+	{
+		Vector4 kDdx, kDdy;
+		GetDerivatives(0, kDdx, kDdy);
+		SampleTexture(rkColor, 0, pkInput[0].x, pkInput[0].y, 0.0f, &kDdx, &kDdy);
+		return true;
+	}
+};
+
+// COMMENT : The objects shared by all checks
+struct CheckDevice
+{
+	Object*				pkObject;
+	Device*				pkDevice;
+	RenderTarget*		pkRenderTarget;
+	Surface*			pkColorBuffer;
+	Surface*			pkDepthBuffer;
+	Surface*			pkStencilBuffer;
+	VertexFormat*		pkVertexFormat;
+	VertexBuffer*		pkVertexBuffer;
+	CheckVertexShader*	pkVertexShader;
+	CheckPixelShader*	pkPixelShader;
+};
+
+// COMMENT : A device with back-buffers renders into its swap-chain, its presented frames are passed to the callback
+static bool CreateCheckDevice(CheckDevice& rkCheck, UINT32 uiBackBufferCount = 0, PFN_PRESENTCALLBACK pfnPresentCallback = NULL,
+	void* pvPresentUserData = NULL)
+{
+	memset(&rkCheck, 0, sizeof(rkCheck));
+	if(CORE3D_FAILED(CreateObject(&rkCheck.pkObject))) {return false;}
+
+	DeviceParameters kParams;
+	memset(&kParams, 0, sizeof(kParams));
+	kParams.uiBackBufferWidth	= CHECK_SIZE;
+	kParams.uiBackBufferHeight	= CHECK_SIZE;
+	kParams.bWindowed			= true;
+	kParams.pfnPresentCallback	= pfnPresentCallback;
+	kParams.pvPresentUserData	= pvPresentUserData;
+	kParams.uiBackBufferCount	= uiBackBufferCount;
+	if(CORE3D_FAILED(rkCheck.pkObject->CreateDevice(&rkCheck.pkDevice, &kParams))) {return false;}
+
+	Device* pkDevice = rkCheck.pkDevice;
+	pkDevice->CreateRenderTarget(&rkCheck.pkRenderTarget);
+	rkCheck.pkColorBuffer = pkDevice->GetBackBuffer();
+	if(NULL == rkCheck.pkColorBuffer) {pkDevice->CreateSurface(&rkCheck.pkColorBuffer, CHECK_SIZE, CHECK_SIZE, FMT_R32G32B32A32F);}
+	pkDevice->CreateSurface(&rkCheck.pkDepthBuffer, CHECK_SIZE, CHECK_SIZE, FMT_R32F);
+	pkDevice->CreateSurface(&rkCheck.pkStencilBuffer, CHECK_SIZE, CHECK_SIZE, FMT_S8);
+	rkCheck.pkRenderTarget->SetColorBuffer(rkCheck.pkColorBuffer);
+	rkCheck.pkRenderTarget->SetDepthBuffer(rkCheck.pkDepthBuffer);
+	rkCheck.pkRenderTarget->SetStencilBuffer(rkCheck.pkStencilBuffer);
+
+	Matrix4x4 matViewport;
+	MatrixViewport(matViewport, 0, 0, CHECK_SIZE, CHECK_SIZE, 0.0f, 1.0f);
+	rkCheck.pkRenderTarget->SetViewportMatrix(matViewport);
+
+	VertexElement akDeclaration[] = {CORE3D_VERTEXFORMAT_DECL(0, VET_VECTOR4, 0), CORE3D_VERTEXFORMAT_DECL(0, VET_VECTOR2, 1)};
+	pkDevice->CreateVertexFormat(&rkCheck.pkVertexFormat, akDeclaration, sizeof(akDeclaration));
+	pkDevice->CreateVertexBuffer(&rkCheck.pkVertexBuffer, CHECK_MAX_VERTICES * sizeof(CheckVertex));
+
+	rkCheck.pkVertexShader	= new CheckVertexShader;
+	rkCheck.pkPixelShader	= new CheckPixelShader;
+
+	pkDevice->SetVertexFormat(rkCheck.pkVertexFormat);
+	pkDevice->SetVertexStream(0, rkCheck.pkVertexBuffer, 0, sizeof(CheckVertex));
+	pkDevice->SetVertexShader(rkCheck.pkVertexShader);
+	pkDevice->SetPixelShader(rkCheck.pkPixelShader);
+	pkDevice->SetRenderState(RS_CULLMODE, CULL_NONE);
+	pkDevice->SetRenderTarget(rkCheck.pkRenderTarget);
+	return true;
+}
+
+static void ReleaseCheckDevice(CheckDevice& rkCheck)
+{
+	// COMMENT : The device doesn't reference bound objects
+	if(NULL != rkCheck.pkDevice)
+	{
+		rkCheck.pkDevice->SetVertexFormat(NULL);
+		rkCheck.pkDevice->SetVertexShader(NULL);
+		rkCheck.pkDevice->SetPixelShader(NULL);
+		rkCheck.pkDevice->SetVertexStream(0, NULL, 0, 1);
+		rkCheck.pkDevice->SetRenderTarget(NULL);
+	}
+
+	if(NULL != rkCheck.pkVertexShader)	{rkCheck.pkVertexShader->Release();}
+	if(NULL != rkCheck.pkPixelShader)	{rkCheck.pkPixelShader->Release();}
+	if(NULL != rkCheck.pkVertexFormat)	{rkCheck.pkVertexFormat->Release();}
+	if(NULL != rkCheck.pkVertexBuffer)	{rkCheck.pkVertexBuffer->Release();}
+	if(NULL != rkCheck.pkDepthBuffer)	{rkCheck.pkDepthBuffer->Release();}
+	if(NULL != rkCheck.pkStencilBuffer)	{rkCheck.pkStencilBuffer->Release();}
+	if(NULL != rkCheck.pkColorBuffer)	{rkCheck.pkColorBuffer->Release();}
+	if(NULL != rkCheck.pkRenderTarget)	{rkCheck.pkRenderTarget->Release();}
+	if(NULL != rkCheck.pkDevice)		{rkCheck.pkDevice->Release();}
+	if(NULL != rkCheck.pkObject)		{rkCheck.pkObject->Release();}
+}
+
+// COMMENT : Clears the color-buffer to black, the depth-buffer to the far plane and the stencil-buffer to 0
+static void ClearCheckTarget(CheckDevice& rkCheck)
+{
+	rkCheck.pkRenderTarget->ClearColorBuffer(Vector4(0.0f, 0.0f, 0.0f, 0.0f), NULL);
+	rkCheck.pkRenderTarget->ClearDepthBuffer(1.0f, NULL);
+	rkCheck.pkRenderTarget->ClearStencilBuffer(0, NULL);
+}
+
+// COMMENT : Draws a triangle-list with a white pixel shader
+static void DrawTriangles(CheckDevice& rkCheck, const CheckVertex* pkVertices, UINT32 uiNumTriangles)
+{
+	CheckVertex* pkVertex = NULL;
+	rkCheck.pkVertexBuffer->GetPointer(0, (void**)&pkVertex);
+	memcpy(pkVertex, pkVertices, uiNumTriangles * 3 * sizeof(CheckVertex));
+
+	rkCheck.pkPixelShader->SetVector(0, Vector4(1.0f, 1.0f, 1.0f, 1.0f));
+	rkCheck.pkDevice->DrawPrimitive(PT_TRIANGLELIST, 0, uiNumTriangles);
+}
+
+// COMMENT : Counts the pixels written since the last clear
+static UINT32 CountColoredPixels(CheckDevice& rkCheck)
+{
+	const FLOAT32* pfColor = NULL;
+	if(CORE3D_FAILED(rkCheck.pkColorBuffer->LockRect((void**)&pfColor, NULL))) {return 0;}
+
+	UINT32 uiColored = 0;
+	for(UINT32 uiPixel = 0; uiPixel < CHECK_SIZE * CHECK_SIZE; ++uiPixel, pfColor += 4)
+	{
+		if(pfColor[0] > 0.5f) {++uiColored;}
+	}
+	rkCheck.pkColorBuffer->UnlockRect();
+	return uiColored;
+}
+
+// COMMENT : Copies the color-buffer, four floats per pixel
+static void ReadColors(CheckDevice& rkCheck, std::vector<FLOAT32>& rvecColors)
+{
+	rvecColors.assign(CHECK_SIZE * CHECK_SIZE * 4, 0.0f);
+	const FLOAT32* pfColor = NULL;
+	if(CORE3D_FAILED(rkCheck.pkColorBuffer->LockRect((void**)&pfColor, NULL))) {return;}
+	memcpy(&rvecColors[0], pfColor, rvecColors.size() * sizeof(FLOAT32));
+	rkCheck.pkColorBuffer->UnlockRect();
+}
+
+static bool ReportCheck(const char* szName, bool bPassed, const char* szDetails)
+{
+	printf("Check %-24s : %s, %s\n", szName, (true == bPassed) ? "passed" : "FAILED", szDetails);
+	return bPassed;
+}
+
+// COMMENT : A sliver between two columns of pixel centers covers none of them. Its longer edges cross three rows
+// and have to be drawn in wire-frame mode, although the polygon is rejected as empty when it's filled.
+static bool CheckSubPixelWireframe(CheckDevice& rkCheck)
+{
+	static const CheckVertex s_akSliver[] = {
+		{10.2f, 20.1f, 0.5f, 1.0f, 0.0f, 0.0f}, {10.8f, 20.3f, 0.5f, 1.0f, 0.0f, 0.0f}, {10.5f, 23.9f, 0.5f, 1.0f, 0.0f, 0.0f}};
+
+	ClearCheckTarget(rkCheck);
+	DrawTriangles(rkCheck, s_akSliver, 1);
+	const UINT32 uiFilled = CountColoredPixels(rkCheck);
+
+	ClearCheckTarget(rkCheck);
+	rkCheck.pkDevice->SetRenderState(RS_FILLMODE, FILL_WIREFRAME);
+	DrawTriangles(rkCheck, s_akSliver, 1);
+	rkCheck.pkDevice->SetRenderState(RS_FILLMODE, FILL_SOLID);
+	const UINT32 uiEdges = CountColoredPixels(rkCheck);
+
+	char szDetails[128];
+	snprintf(szDetails, sizeof(szDetails), "%u pixels filled, %u pixels of wire-frame edges", uiFilled, uiEdges);
+	return ReportCheck("wireframe/subpixel", 0 == uiFilled && uiEdges > 0, szDetails);
+}
+
+// COMMENT : Stenciled scan-lines are rasterized in runs of passing pixels, each interpolated from its first pixel. Every
+// passing pixel has to be shaded like without stenciling.
+static bool CheckStencilRuns(CheckDevice& rkCheck)
+{
+	static const CheckVertex s_akTriangle[] = {
+		{2.0f, 2.0f, 0.5f, 1.0f, 0.0f, 0.0f}, {62.0f, 2.0f, 0.5f, 4.0f, 1.0f, 0.0f}, {2.0f, 62.0f, 0.5f, 2.0f, 0.0f, 1.0f}};
+
+	std::vector<FLOAT32> vecUnstenciled, vecStenciled;
+	ClearCheckTarget(rkCheck);
+	DrawTriangles(rkCheck, s_akTriangle, 1);
+	ReadColors(rkCheck, vecUnstenciled);
+
+	// COMMENT : Irregular runs of pixels with the stencil value 0 pass
+	ClearCheckTarget(rkCheck);
+	UINT32* puiStencil = NULL;
+	if(CORE3D_SUCCESSFUL(rkCheck.pkStencilBuffer->LockRect((void**)&puiStencil, NULL)))
+	{
+		for(UINT32 uiPixel = 0; uiPixel < CHECK_SIZE * CHECK_SIZE; ++uiPixel) {puiStencil[uiPixel] = ((uiPixel * 5 + uiPixel / CHECK_SIZE) % 7 < 3) ? 1 : 0;}
+		rkCheck.pkStencilBuffer->UnlockRect();
+	}
+	rkCheck.pkDevice->SetRenderState(RS_STENCILENABLE, BT_TRUE);
+	rkCheck.pkDevice->SetRenderState(RS_STENCILFUNC, CMP_EQUAL);
+	rkCheck.pkDevice->SetRenderState(RS_STENCILREF, 0);
+	DrawTriangles(rkCheck, s_akTriangle, 1);
+	rkCheck.pkDevice->SetRenderState(RS_STENCILENABLE, BT_FALSE);
+	ReadColors(rkCheck, vecStenciled);
+
+	// COMMENT : Runs start from interpolated instead of stepped registers, which leaves rounding differences
+	UINT32 uiCompared = 0, uiDifferent = 0;
+	for(UINT32 uiPixel = 0; uiPixel < CHECK_SIZE * CHECK_SIZE; ++uiPixel)
+	{
+		const FLOAT32* pfUnstenciled	= &vecUnstenciled[uiPixel * 4];
+		const FLOAT32* pfStenciled		= &vecStenciled[uiPixel * 4];
+		if((uiPixel * 5 + uiPixel / CHECK_SIZE) % 7 < 3)
+		{
+			if(0.0f != pfStenciled[0]) {++uiDifferent;}
+			continue;
+		}
+
+		if(pfUnstenciled[0] > 0.5f) {++uiCompared;}
+		if(fabsf(pfUnstenciled[0] - pfStenciled[0]) > 1e-4f || fabsf(pfUnstenciled[1] - pfStenciled[1]) > 1e-4f) {++uiDifferent;}
+	}
+
+	char szDetails[128];
+	snprintf(szDetails, sizeof(szDetails), "%u of %u passing pixels differ by more than 1e-4 from the unstenciled draw", uiDifferent, uiCompared);
+	return ReportCheck("stencil/runs", 0 == uiDifferent && uiCompared > 0, szDetails);
+}
+
+// COMMENT : A jittered grid of triangles covering the render-target has to shade every pixel exactly once. Its vertices lie
+// on pixel centers, pixel edges, sub-pixels and in between, and its cells alternate their diagonals. The stencil-buffer
+// counts how often each pixel is shaded, with the depth test disabled.
+static bool CheckWatertightness(CheckDevice& rkCheck)
+{
+	const UINT32 GRID_CELLS		= 16;
+	const FLOAT32 fCellSize		= (CHECK_SIZE + 8.0f) / GRID_CELLS;
+	std::vector<CheckVertex> vecCorners((GRID_CELLS + 1) * (GRID_CELLS + 1));
+	for(UINT32 uiY = 0; uiY <= GRID_CELLS; ++uiY)
+	{
+		for(UINT32 uiX = 0; uiX <= GRID_CELLS; ++uiX)
+		{
+			CheckVertex& rkCorner	= vecCorners[uiY * (GRID_CELLS + 1) + uiX];
+			const UINT32 uiHash		= (uiX * 7919 + uiY * 104729) ^ (uiX * uiY * 31);
+			rkCorner.fX = -4.0f + fCellSize * uiX;
+			rkCorner.fY = -4.0f + fCellSize * uiY;
+			rkCorner.fZ = 0.5f; rkCorner.fW = 1.0f; rkCorner.fU = 0.0f; rkCorner.fV = 0.0f;
+			if(0 == uiX || 0 == uiY || GRID_CELLS == uiX || GRID_CELLS == uiY) {continue;}
+
+			// COMMENT : Up to one pixel, in whole sub-pixels for every other corner
+			if(0 == (uiX + uiY) % 2)
+			{
+				rkCorner.fX += static_cast<FLOAT32>(static_cast<INT32>(uiHash % 513) - 256) / 256.0f;
+				rkCorner.fY += static_cast<FLOAT32>(static_cast<INT32>((uiHash / 513) % 513) - 256) / 256.0f;
+			}
+			else
+			{
+				rkCorner.fX += static_cast<FLOAT32>(uiHash % 1000) * 0.002f - 0.999f;
+				rkCorner.fY += static_cast<FLOAT32>((uiHash / 1000) % 1000) * 0.002f - 0.999f;
+			}
+		}
+	}
+
+	std::vector<CheckVertex> vecTriangles;
+	for(UINT32 uiY = 0; uiY < GRID_CELLS; ++uiY)
+	{
+		for(UINT32 uiX = 0; uiX < GRID_CELLS; ++uiX)
+		{
+			const CheckVertex* pkCorner = &vecCorners[uiY * (GRID_CELLS + 1) + uiX];
+			const CheckVertex& rkA = pkCorner[0], &rkB = pkCorner[1], &rkC = pkCorner[GRID_CELLS + 1], &rkD = pkCorner[GRID_CELLS + 2];
+			if(0 == (uiX + uiY) % 2)
+			{
+				vecTriangles.push_back(rkA); vecTriangles.push_back(rkB); vecTriangles.push_back(rkD);
+				vecTriangles.push_back(rkA); vecTriangles.push_back(rkD); vecTriangles.push_back(rkC);
+			}
+			else
+			{
+				vecTriangles.push_back(rkA); vecTriangles.push_back(rkB); vecTriangles.push_back(rkC);
+				vecTriangles.push_back(rkC); vecTriangles.push_back(rkB); vecTriangles.push_back(rkD);
+			}
+		}
+	}
+
+	Device* pkDevice = rkCheck.pkDevice;
+	ClearCheckTarget(rkCheck);
+	pkDevice->SetRenderState(RS_ZENABLE, BT_FALSE);
+	pkDevice->SetRenderState(RS_STENCILENABLE, BT_TRUE);
+	pkDevice->SetRenderState(RS_STENCILPASS, SOP_INCR);
+	DrawTriangles(rkCheck, &vecTriangles[0], static_cast<UINT32>(vecTriangles.size() / 3));
+	pkDevice->SetRenderState(RS_STENCILPASS, SOP_KEEP);
+	pkDevice->SetRenderState(RS_STENCILENABLE, BT_FALSE);
+	pkDevice->SetRenderState(RS_ZENABLE, BT_TRUE);
+
+	const UINT32* puiStencil = NULL;
+	if(CORE3D_FAILED(rkCheck.pkStencilBuffer->LockRect((void**)&puiStencil, NULL))) {return ReportCheck("raster/watertight", false, "couldn't lock the stencil-buffer");}
+	UINT32 uiOverlaps = 0, uiHoles = 0;
+	for(UINT32 uiPixel = 0; uiPixel < CHECK_SIZE * CHECK_SIZE; ++uiPixel)
+	{
+		if(0 == puiStencil[uiPixel])	{++uiHoles;}
+		else if(puiStencil[uiPixel] > 1)	{++uiOverlaps;}
+	}
+	rkCheck.pkStencilBuffer->UnlockRect();
+
+	char szDetails[128];
+	snprintf(szDetails, sizeof(szDetails), "%u triangles, %u pixels shaded more than once, %u pixels missed",
+		static_cast<UINT32>(vecTriangles.size() / 3), uiOverlaps, uiHoles);
+	return ReportCheck("raster/watertight", 0 == uiOverlaps && 0 == uiHoles, szDetails);
+}
+
+// COMMENT : The expected result of a stencil operation, written independently of the device's
+static UINT32 ApplyStencilOp(StencilOp eOperation, UINT32 uiValue, UINT32 uiRef, UINT32 uiWriteMask)
+{
+	UINT32 uiResult = uiValue;
+	switch(eOperation)
+	{
+	case SOP_KEEP:		break;
+	case SOP_ZERO:		uiResult = 0; break;
+	case SOP_REPLACE:	uiResult = uiRef; break;
+	case SOP_INCRSAT:	uiResult = (uiValue < MAX_STENCIL_VALUE) ? uiValue + 1 : MAX_STENCIL_VALUE; break;
+	case SOP_DECRSAT:	uiResult = (uiValue > 0) ? uiValue - 1 : 0; break;
+	case SOP_INVERT:	uiResult = ~uiValue & MAX_STENCIL_VALUE; break;
+	case SOP_INCR:		uiResult = (uiValue + 1) & MAX_STENCIL_VALUE; break;
+	case SOP_DECR:		uiResult = (uiValue - 1) & MAX_STENCIL_VALUE; break;
+	}
+	return (uiValue & ~uiWriteMask) | (uiResult & uiWriteMask);
+}
+
+static bool CompareStencil(CmpFunc eCompare, UINT32 uiRef, UINT32 uiValue)
+{
+	switch(eCompare)
+	{
+	case CMP_NEVER:			return false;
+	case CMP_EQUAL:			return uiRef == uiValue;
+	case CMP_NOTEQUAL:		return uiRef != uiValue;
+	case CMP_LESS:			return uiRef < uiValue;
+	case CMP_LESSEQUAL:		return uiRef <= uiValue;
+	case CMP_GREATEREQUAL:	return uiRef >= uiValue;
+	case CMP_GREATER:		return uiRef > uiValue;
+	default:				return true;
+	}
+}
+
+struct StencilCase
+{
+	const char*	szName;
+	CmpFunc		eCompare;
+	UINT32		uiRef, uiMask, uiWriteMask;
+	StencilOp	eFail, ePass;
+	bool		bTwoSided;
+	StencilOp	eCounterClockwisePass;
+};
+
+// COMMENT : The stencil-buffer starts with all values from 0 to MAX_STENCIL_VALUE. The left half of the render-target is
+// covered by clockwise triangles, the right half by counter-clockwise ones.
+static bool CheckStencilCase(CheckDevice& rkCheck, const StencilCase& rkCase)
+{
+	static const CheckVertex s_akHalves[] = {
+		{-1.0f, -1.0f, 0.5f, 1.0f, 0.0f, 0.0f}, {31.5f, -1.0f, 0.5f, 1.0f, 0.0f, 0.0f}, {-1.0f, 65.0f, 0.5f, 1.0f, 0.0f, 0.0f},
+		{31.5f, -1.0f, 0.5f, 1.0f, 0.0f, 0.0f}, {31.5f, 65.0f, 0.5f, 1.0f, 0.0f, 0.0f}, {-1.0f, 65.0f, 0.5f, 1.0f, 0.0f, 0.0f},
+		{31.5f, -1.0f, 0.5f, 1.0f, 0.0f, 0.0f}, {31.5f, 65.0f, 0.5f, 1.0f, 0.0f, 0.0f}, {65.0f, -1.0f, 0.5f, 1.0f, 0.0f, 0.0f},
+		{65.0f, -1.0f, 0.5f, 1.0f, 0.0f, 0.0f}, {31.5f, 65.0f, 0.5f, 1.0f, 0.0f, 0.0f}, {65.0f, 65.0f, 0.5f, 1.0f, 0.0f, 0.0f}};
+
+	ClearCheckTarget(rkCheck);
+	std::vector<UINT32> vecInitial(CHECK_SIZE * CHECK_SIZE);
+	for(UINT32 uiPixel = 0; uiPixel < CHECK_SIZE * CHECK_SIZE; ++uiPixel) {vecInitial[uiPixel] = (uiPixel * 37 + (uiPixel / CHECK_SIZE) * 11) & MAX_STENCIL_VALUE;}
+	UINT32* puiStencil = NULL;
+	if(CORE3D_FAILED(rkCheck.pkStencilBuffer->LockRect((void**)&puiStencil, NULL))) {return ReportCheck(rkCase.szName, false, "couldn't lock the stencil-buffer");}
+	memcpy(puiStencil, &vecInitial[0], vecInitial.size() * sizeof(UINT32));
+	rkCheck.pkStencilBuffer->UnlockRect();
+
+	Device* pkDevice = rkCheck.pkDevice;
+	pkDevice->SetRenderState(RS_STENCILENABLE, BT_TRUE);
+	pkDevice->SetRenderState(RS_STENCILFUNC, rkCase.eCompare);
+	pkDevice->SetRenderState(RS_STENCILREF, rkCase.uiRef);
+	pkDevice->SetRenderState(RS_STENCILMASK, rkCase.uiMask);
+	pkDevice->SetRenderState(RS_STENCILWRITEMASK, rkCase.uiWriteMask);
+	pkDevice->SetRenderState(RS_STENCILFAIL, rkCase.eFail);
+	pkDevice->SetRenderState(RS_STENCILPASS, rkCase.ePass);
+	pkDevice->SetRenderState(RS_TWOSIDEDSTENCILMODE, (true == rkCase.bTwoSided) ? BT_TRUE : BT_FALSE);
+	pkDevice->SetRenderState(RS_CCW_STENCILFUNC, rkCase.eCompare);
+	pkDevice->SetRenderState(RS_CCW_STENCILPASS, rkCase.eCounterClockwisePass);
+	DrawTriangles(rkCheck, s_akHalves, 4);
+	pkDevice->SetRenderState(RS_STENCILENABLE, BT_FALSE);
+	pkDevice->SetRenderState(RS_STENCILFUNC, CMP_ALWAYS);
+	pkDevice->SetRenderState(RS_STENCILREF, 0);
+	pkDevice->SetRenderState(RS_STENCILMASK, MAX_STENCIL_VALUE);
+	pkDevice->SetRenderState(RS_STENCILWRITEMASK, MAX_STENCIL_VALUE);
+	pkDevice->SetRenderState(RS_STENCILFAIL, SOP_KEEP);
+	pkDevice->SetRenderState(RS_STENCILPASS, SOP_KEEP);
+	pkDevice->SetRenderState(RS_TWOSIDEDSTENCILMODE, BT_FALSE);
+	pkDevice->SetRenderState(RS_CCW_STENCILFUNC, CMP_ALWAYS);
+	pkDevice->SetRenderState(RS_CCW_STENCILPASS, SOP_KEEP);
+
+	if(CORE3D_FAILED(rkCheck.pkStencilBuffer->LockRect((void**)&puiStencil, NULL))) {return ReportCheck(rkCase.szName, false, "couldn't lock the stencil-buffer");}
+	UINT32 uiWrong = 0;
+	for(UINT32 uiPixel = 0; uiPixel < CHECK_SIZE * CHECK_SIZE; ++uiPixel)
+	{
+		const UINT32 uiValue		= vecInitial[uiPixel];
+		const bool bCounterClockwise	= (true == rkCase.bTwoSided) && (uiPixel % CHECK_SIZE >= CHECK_SIZE / 2);
+		const bool bPassed			= CompareStencil(rkCase.eCompare, rkCase.uiRef & rkCase.uiMask, uiValue & rkCase.uiMask);
+		const StencilOp eOperation	= (false == bPassed) ? rkCase.eFail : ((true == bCounterClockwise) ? rkCase.eCounterClockwisePass : rkCase.ePass);
+		if(puiStencil[uiPixel] != ApplyStencilOp(eOperation, uiValue, rkCase.uiRef, rkCase.uiWriteMask)) {++uiWrong;}
+	}
+	rkCheck.pkStencilBuffer->UnlockRect();
+
+	char szDetails[128];
+	snprintf(szDetails, sizeof(szDetails), "%u of %u stencil values differ from the expected ones", uiWrong, CHECK_SIZE * CHECK_SIZE);
+	return ReportCheck(rkCase.szName, 0 == uiWrong, szDetails);
+}
+
+static bool CheckStencilOperations(CheckDevice& rkCheck)
+{
+	static const StencilCase s_akCases[] =
+	{
+		{"stencil/incrsat",		CMP_ALWAYS,	0,		0xff,	0xff,	SOP_KEEP,	SOP_INCRSAT,	false,	SOP_KEEP},
+		{"stencil/decr",		CMP_ALWAYS,	0,		0xff,	0xff,	SOP_KEEP,	SOP_DECR,		false,	SOP_KEEP},
+		{"stencil/writemask",	CMP_ALWAYS,	0xa5,	0xff,	0x3c,	SOP_KEEP,	SOP_REPLACE,	false,	SOP_KEEP},
+		{"stencil/twosided",	CMP_ALWAYS,	0,		0xff,	0xff,	SOP_KEEP,	SOP_INCR,		true,	SOP_INVERT},
+		{"stencil/compare",		CMP_LESS,	0x80,	0xf0,	0xff,	SOP_ZERO,	SOP_KEEP,		false,	SOP_KEEP}
+	};
+
+	bool bPassed = true;
+	for(UINT32 uiCase = 0; uiCase < sizeof(s_akCases) / sizeof(s_akCases[0]); ++uiCase) {bPassed = CheckStencilCase(rkCheck, s_akCases[uiCase]) && bPassed;}
+	return bPassed;
+}
+
+const UINT32 CHECK_PRESENT_FRAMES = 16;
+
+// COMMENT : Appends a presented frame to a byte vector, on the present thread if the device has a swap-chain
+static void CollectPresentedFrame(const BYTE8* pFrame, UINT32 uiWidth, UINT32 uiHeight, UINT32 uiPitch, void* pvUserData)
+{
+	std::vector<BYTE8>& rvecFrames = *(std::vector<BYTE8>*)pvUserData;
+	for(UINT32 uiY = 0; uiY < uiHeight; ++uiY) {rvecFrames.insert(rvecFrames.end(), &pFrame[uiY * uiPitch], &pFrame[uiY * uiPitch + uiWidth * 4]);}
+}
+
+// COMMENT : Presents CHECK_PRESENT_FRAMES frames with a moving triangle, returns the presented frames counted by the device
+static UINT32 PresentCheckFrames(CheckDevice& rkCheck)
+{
+	for(UINT32 uiFrame = 0; uiFrame < CHECK_PRESENT_FRAMES; ++uiFrame)
+	{
+		const FLOAT32 fOffset = 2.0f * uiFrame;
+		const CheckVertex akTriangle[] = {
+			{4.0f + fOffset, 4.0f, 0.5f, 1.0f, 0.0f, 0.0f}, {30.0f + fOffset, 10.0f, 0.5f, 2.0f, 1.0f, 0.0f}, {8.0f + fOffset, 60.0f, 0.5f, 1.0f, 0.0f, 1.0f}};
+		ClearCheckTarget(rkCheck);
+		DrawTriangles(rkCheck, akTriangle, 1);
+		rkCheck.pkDevice->Present(rkCheck.pkRenderTarget);
+	}
+	rkCheck.pkDevice->WaitForPresent();
+	return rkCheck.pkDevice->GetPresentedFrames();
+}
+
+// COMMENT : Devices with 2 to 4 back-buffers present on their present thread while the next frame is rendered. They have
+// to present the same images as a device presenting synchronously, and count all frames once WaitForPresent() returns.
+static bool CheckSwapChains()
+{
+	std::vector<BYTE8> vecSynchronous;
+	CheckDevice kSynchronous;
+	if(true == CreateCheckDevice(kSynchronous, 0, CollectPresentedFrame, &vecSynchronous)) {PresentCheckFrames(kSynchronous);}
+	ReleaseCheckDevice(kSynchronous);
+	bool bPassed = (vecSynchronous.size() == CHECK_PRESENT_FRAMES * CHECK_SIZE * CHECK_SIZE * 4);
+
+	UINT32 uiDifferent = 0, uiMiscounted = 0;
+	for(UINT32 uiBackBuffers = 2; uiBackBuffers <= 4; ++uiBackBuffers)
+	{
+		std::vector<BYTE8> vecFrames;
+		CheckDevice kSwapChain;
+		UINT32 uiPresented = 0;
+		if(true == CreateCheckDevice(kSwapChain, uiBackBuffers, CollectPresentedFrame, &vecFrames)) {uiPresented = PresentCheckFrames(kSwapChain);}
+		ReleaseCheckDevice(kSwapChain);
+
+		if(CHECK_PRESENT_FRAMES != uiPresented) {++uiMiscounted;}
+		if(vecFrames != vecSynchronous) {++uiDifferent;}
+	}
+
+	char szDetails[128];
+	snprintf(szDetails, sizeof(szDetails), "%u of 3 swap-chains differ from synchronous presentation, %u miscount their %u frames",
+		uiDifferent, uiMiscounted, CHECK_PRESENT_FRAMES);
+	return ReportCheck("present/swapchain", bPassed && 0 == uiDifferent && 0 == uiMiscounted, szDetails);
+}
+
+const UINT32 CHECK_THREAD_DEVICES	= 4;
+const UINT32 CHECK_THREAD_FRAMES	= 8;
+
+struct ThreadCheck
+{
+	CheckDevice				kCheck;
+	UINT32					uiDevice;
+	std::vector<FLOAT32>	vecColors;
+};
+
+// COMMENT : Draws a textured quad a few times and keeps every frame's image. The texture coordinates are scaled by the device's
+// number, so every device draws another image with other derivatives.
+static void DrawThreadCheck(void* pvThreadCheck)
+{
+	ThreadCheck* pkThreadCheck	= reinterpret_cast<ThreadCheck*>(pvThreadCheck);
+	const FLOAT32 fScale		= 1.0f + pkThreadCheck->uiDevice;
+	const CheckVertex akQuad[] = {
+		{1.0f, 1.0f, 0.5f, 1.0f, 0.0f, 0.0f}, {63.0f, 1.0f, 0.5f, 3.0f, fScale, 0.0f}, {1.0f, 63.0f, 0.5f, 2.0f, 0.0f, fScale},
+		{63.0f, 1.0f, 0.5f, 3.0f, fScale, 0.0f}, {63.0f, 63.0f, 0.5f, 4.0f, fScale, fScale}, {1.0f, 63.0f, 0.5f, 2.0f, 0.0f, fScale}};
+
+	std::vector<FLOAT32> vecFrame;
+	pkThreadCheck->vecColors.clear();
+	for(UINT32 uiFrame = 0; uiFrame < CHECK_THREAD_FRAMES; ++uiFrame)
+	{
+		ClearCheckTarget(pkThreadCheck->kCheck);
+		DrawTriangles(pkThreadCheck->kCheck, akQuad, 2);
+		ReadColors(pkThreadCheck->kCheck, vecFrame);
+		pkThreadCheck->vecColors.insert(pkThreadCheck->vecColors.end(), vecFrame.begin(), vecFrame.end());
+	}
+}
+
+// COMMENT : Devices drawing on threads of their own with the same shader instances and texture have to draw the images they
+// draw one after another. Shaders read the draw's state from the context of the calling thread(see RenderContext).
+static bool CheckThreadedDevices()
+{
+	ThreadCheck akChecks[CHECK_THREAD_DEVICES];
+	bool bCreated = true;
+	for(UINT32 uiDevice = 0; uiDevice < CHECK_THREAD_DEVICES; ++uiDevice)
+	{
+		akChecks[uiDevice].uiDevice = uiDevice;
+		bCreated = CreateCheckDevice(akChecks[uiDevice].kCheck) && bCreated;
+	}
+
+	CheckVertexShader* pkVertexShader		= new CheckVertexShader;
+	CheckTexturePixelShader* pkPixelShader	= new CheckTexturePixelShader;
+	Texture* pkTexture						= NULL;
+	if(true == bCreated && CORE3D_SUCCESSFUL(akChecks[0].kCheck.pkDevice->CreateTexture(&pkTexture, 32, 32, 0, FMT_R32G32B32A32F)))
+	{
+		Vector4* pkTexel = NULL;
+		pkTexture->LockRect(0, (void**)&pkTexel, NULL);
+		for(UINT32 uiTexel = 0; uiTexel < 32 * 32; ++uiTexel, ++pkTexel)
+		{
+			const UINT32 uiX = uiTexel % 32, uiY = uiTexel / 32;
+			*pkTexel = Vector4((((uiX / 4) + (uiY / 4)) & 1) ? 1.0f : 0.0f, uiX / 31.0f, uiY / 31.0f, 1.0f);
+		}
+		pkTexture->UnlockRect(0);
+		pkTexture->GenerateMipSubLevels(0);
+	}
+	else
+	{
+		pkTexture = NULL;
+		bCreated = false;
+	}
+
+	UINT32 uiDifferent = 0;
+	if(true == bCreated)
+	{
+		for(UINT32 uiDevice = 0; uiDevice < CHECK_THREAD_DEVICES; ++uiDevice)
+		{
+			Device* pkDevice = akChecks[uiDevice].kCheck.pkDevice;
+			pkDevice->SetVertexShader(pkVertexShader);
+			pkDevice->SetPixelShader(pkPixelShader);
+			pkDevice->SetTexture(0, pkTexture);
+			pkDevice->SetTextureSamplerState(0, TSS_MINFILTER, TF_LINEAR);
+			pkDevice->SetTextureSamplerState(0, TSS_MAGFILTER, TF_LINEAR);
+			pkDevice->SetTextureSamplerState(0, TSS_MIPFILTER, TF_LINEAR);
+		}
+
+		std::vector<FLOAT32> avecSequential[CHECK_THREAD_DEVICES];
+		for(UINT32 uiDevice = 0; uiDevice < CHECK_THREAD_DEVICES; ++uiDevice)
+		{
+			DrawThreadCheck(&akChecks[uiDevice]);
+			avecSequential[uiDevice].swap(akChecks[uiDevice].vecColors);
+		}
+
+		Thread akThreads[CHECK_THREAD_DEVICES];
+		for(UINT32 uiDevice = 0; uiDevice < CHECK_THREAD_DEVICES; ++uiDevice)
+		{
+			if(CORE3D_FAILED(akThreads[uiDevice].Start(DrawThreadCheck, &akChecks[uiDevice]))) {DrawThreadCheck(&akChecks[uiDevice]);}
+		}
+		for(UINT32 uiDevice = 0; uiDevice < CHECK_THREAD_DEVICES; ++uiDevice)
+		{
+			akThreads[uiDevice].Join();
+			if(akChecks[uiDevice].vecColors != avecSequential[uiDevice]) {++uiDifferent;}
+		}
+
+		for(UINT32 uiDevice = 0; uiDevice < CHECK_THREAD_DEVICES; ++uiDevice) {akChecks[uiDevice].kCheck.pkDevice->SetTexture(0, NULL);}
+	}
+
+	if(NULL != pkTexture) {pkTexture->Release();}
+	pkVertexShader->Release();
+	pkPixelShader->Release();
+	for(UINT32 uiDevice = 0; uiDevice < CHECK_THREAD_DEVICES; ++uiDevice) {ReleaseCheckDevice(akChecks[uiDevice].kCheck);}
+
+	char szDetails[128];
+	snprintf(szDetails, sizeof(szDetails), "%u of %u devices on their own threads differ from drawing one after another", uiDifferent, CHECK_THREAD_DEVICES);
+	return ReportCheck("device/threads", bCreated && 0 == uiDifferent, szDetails);
+}
+
+bool RunDeviceChecks()
+{
+	CheckDevice kCheck;
+	if(false == CreateCheckDevice(kCheck))
+	{
+		printf("Error : Couldn't create the device of the checks.\n");
+		ReleaseCheckDevice(kCheck);
+		return false;
+	}
+
+	bool bPassed = true;
+	bPassed = CheckSubPixelWireframe(kCheck) && bPassed;
+	bPassed = CheckWatertightness(kCheck) && bPassed;
+	bPassed = CheckStencilRuns(kCheck) && bPassed;
+	bPassed = CheckStencilOperations(kCheck) && bPassed;
+
+	ReleaseCheckDevice(kCheck);
+	bPassed = CheckSwapChains() && bPassed;
+	bPassed = CheckThreadedDevices() && bPassed;
+	return bPassed;
+}
@@ -0,0 +1,9 @@
+#pragma once
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+// COMMENT : Draws small scenes with known results on devices of their own and prints one line per check.
+// Returns false if a check failed.
+bool RunDeviceChecks();
@@ -0,0 +1,544 @@
+//////////////////////////////////////////////////////////////////////////
+// Core3D : Software Graphic API
+// Copyright (C) 2009 DevCoder <renderwizard@gmail.com>
+//////////////////////////////////////////////////////////////////////////
+
+// COMMENT : Runs a sample without window and input, moving its camera along a scripted path with a fixed time-step.
+// Every GOLDEN_INTERVAL-th frame is compared with a golden image, the frame times are reported as mean and percentiles.
+// The samples' cameras and shaders share names, so this file is built once per sample(CORE3D_SAMPLE_<NAME>).
+// Usage : Tool_SampleRunner_<Sample> [-frames count] [-update] [-golden directory] [-dump directory]
+//                                    [-threshold levels] [-tolerance percent] [-maxdifference levels] [-json file]
+//                                    [-prepass on|off] [-visibility]
+// A frame fails if more than the tolerance of its pixels differ by more than the threshold, or if any channel differs by more
+// than the max. difference. The golden images have to be updated by every change of the rasterization.
+// -prepass overrides the sample's choice of the camera's depth pre-pass, -visibility renders the scene in a visibility pass
+// of the device. The runners count pipeline statistics in all build types, and report the pixel shader invocations per
+// frame to compare them. Their frame times include the counting.
+// Before the frames, device checks draw cases with known results that no sample covers(not with -update). After them, the
+// last frame is rendered with and without the entities' command-lists, which have to render bit-identical colors.
+
+#include "Checks.h"
+#include "../Core3D/FWApplication.h"
+#include "../Core3D/FWGraphics.h"
+#include "../Core3D/FWLight.h"
+#include "../Core3D/FWResManager.h"
+#include "../Core3D/FWScene.h"
+#include <png.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <vector>
+
+#ifndef CORE3D_SOURCE_DIR
+#define CORE3D_SOURCE_DIR "."
+#endif
+
+#if defined(CORE3D_SAMPLE_BUBBLE)
+#	include "../Sample_Bubble/Bubble.h"
+#	include "../Sample_Bubble/FreeCamera.h"
+#	define SAMPLE_NAME "Bubble"
+#elif defined(CORE3D_SAMPLE_CHECKBOARD)
+#	include "../Sample_Checkboard/Checkboard.h"
+#	include "../Sample_Checkboard/FreeCamera.h"
+#	define SAMPLE_NAME "Checkboard"
+#elif defined(CORE3D_SAMPLE_CRYSTAL)
+#	include "../Sample_Crystal/Crystal.h"
+#	include "../Sample_Crystal/FreeCamera.h"
+#	define SAMPLE_NAME "Crystal"
+#elif defined(CORE3D_SAMPLE_DISPLACEDSPHERE)
+#	include "../Sample_DisplacedSphere/DisplacedSphere.h"
+#	include "../Sample_DisplacedSphere/FreeCamera.h"
+#	define SAMPLE_NAME "DisplacedSphere"
+#elif defined(CORE3D_SAMPLE_DISPLACEDTRI)
+#	include "../Sample_DisplacedTri/DisplacedTri.h"
+#	include "../Sample_DisplacedTri/FreeCamera.h"
+#	define SAMPLE_NAME "DisplacedTri"
+#elif defined(CORE3D_SAMPLE_ENVSPHERE)
+#	include "../Sample_EnvSphere/EnvSphere.h"
+#	include "../Sample_EnvSphere/FreeCamera.h"
+#	define SAMPLE_NAME "EnvSphere"
+#else
+#	error Define CORE3D_SAMPLE_<NAME> for the sample to run.
+#endif
+
+using namespace Core3D;
+
+const UINT32	GOLDEN_INTERVAL		= 30;
+const FLOAT32	TIME_STEP			= 1.0f / 30.0f;
+
+enum DepthPrepass
+{
+	PREPASS_SAMPLE = 0,		// As chosen by the sample
+	PREPASS_ON,
+	PREPASS_OFF
+};
+static DepthPrepass gs_eDepthPrepass = PREPASS_SAMPLE;
+static bool gs_bVisibilityPass = false;
+
+//------------------------------------------------------------------------
+// COMMENT : The sample's App, with the world created like in its App.cpp and the input replaced by a camera path
+class SampleApp : public FWApplicationHeadless
+{
+public:
+	SampleApp() : FWApplicationHeadless(TIME_STEP), m_pkCamera(NULL), m_hEntity(0), m_hLight(0) {}
+
+	bool CreateWorld();
+	void DestroyWorld();
+
+	void FrameMove();
+	void RenderWorld();
+
+	bool CheckCommandLists();
+private:
+	// COMMENT : Places the camera like the samples' mouse control, at the given angles around the origin
+	void Orbit(FLOAT32 fRotX, FLOAT32 fRotY, FLOAT32 fDistance, FLOAT32 fHeight)
+	{
+		m_pkCamera->SetPosition(C3DVECTOR3(-fDistance * sinf(fRotX), -fHeight * sinf(fRotY), -fDistance * cosf(fRotX)));
+		m_pkCamera->SetLookAt(C3DVECTOR3(0.0f, 0.0f, 0.0f), C3DVECTOR3(0.0f, 1.0f, 0.0f));
+		m_pkCamera->CalculateView();
+	}
+private:
+	FreeCamera*	m_pkCamera;
+	HENTITY		m_hEntity;
+	HLIGHT		m_hLight;
+};
+
+bool SampleApp::CreateWorld()
+{
+	m_pkCamera = new FreeCamera(GetGraphics());
+	if(false == m_pkCamera->CreateRenderCamera(GetWindowWidth(), GetWindowHeight())) {return false;}
+
+#if defined(CORE3D_SAMPLE_BUBBLE)
+	m_pkCamera->CalculateProjection(CORE3D_PI / 6.0f, 1000.0f, 1.0f);
+	GetScene()->SetClearColor(C3DVECTOR4(0.0f, 0.0f, 0.5f, 0.0f));
+
+	GetScene()->RegisterEntityType(_T("Bubble"), &Core3D::CreateBubble);
+	m_hEntity = GetScene()->CreateEntity(_T("Bubble"));
+	if(0 == m_hEntity) {return false;}
+	if(false == static_cast<Bubble*>(GetScene()->GetEntity(m_hEntity))->Initialize(20.0f, 16, 16)) {return false;}
+#elif defined(CORE3D_SAMPLE_CHECKBOARD)
+	m_pkCamera->CalculateProjection(CORE3D_PI * 0.5f, 2.0f, 0.001f);
+
+	GetScene()->RegisterEntityType(_T("Board"), &Core3D::CreateCheckboard);
+	m_hEntity = GetScene()->CreateEntity(_T("Board"));
+	if(0 == m_hEntity) {return false;}
+	if(false == static_cast<Checkboard*>(GetScene()->GetEntity(m_hEntity))->Initialize()) {return false;}
+#elif defined(CORE3D_SAMPLE_CRYSTAL)
+	m_pkCamera->CalculateProjection(CORE3D_PI / 6.0f, 2000.0f, 10.0f);
+	GetScene()->SetClearColor(C3DVECTOR4(0.0f, 0.0f, 0.5f, 0.0f));
+
+	GetScene()->RegisterEntityType(_T("Crystal"), &Core3D::CreateCrystal);
+	m_hEntity = GetScene()->CreateEntity(_T("Crystal"));
+	if(0 == m_hEntity) {return false;}
+	Crystal* pkCrystal = static_cast<Crystal*>(GetScene()->GetEntity(m_hEntity));
+	if(false == pkCrystal->Initialize(_T("headobject.obj"), _T("turtlebase.png"), _T("turtlenormals.png"))) {return false;}
+#elif defined(CORE3D_SAMPLE_DISPLACEDSPHERE)
+	m_pkCamera->CalculateProjection(CORE3D_PI * 0.5f, 10.0f, 0.1f);
+
+	GetScene()->RegisterEntityType(_T("DisplacedSphere"), &Core3D::CreateDisplacedSphere);
+	m_hEntity = GetScene()->CreateEntity(_T("DisplacedSphere"));
+	if(0 == m_hEntity) {return false;}
+	DisplacedSphere* pkSphere = static_cast<DisplacedSphere*>(GetScene()->GetEntity(m_hEntity));
+	if(false == pkSphere->Initialize(1.0f, 12, 12, _T("earth.png"))) {return false;}
+
+	GetGraphics()->SetRenderState(RS_SUBDIVISIONMODE, SUBDIV_ADAPTIVE);
+	GetGraphics()->SetRenderState(RS_SUBDIVISIONLEVELS, 1);
+	const C3DFLOAT32 fSubdivisionMaxScreenArea = 14.0f * 14.0f;
+	GetGraphics()->SetRenderState(RS_SUBDIVISIONMAXSCREENAREA, *(C3DUINT32*)&fSubdivisionMaxScreenArea);
+	GetGraphics()->SetRenderState(RS_SUBDIVISIONMAXINNERLEVELS, 2);
+	GetGraphics()->SetRenderState(RS_FILLMODE, FILL_WIREFRAME);
+	// COMMENT : The wireframe's lines overlap, with the depth pre-pass fewer of its pixels are shaded
+	m_pkCamera->SetDepthPrepass(true);
+#elif defined(CORE3D_SAMPLE_DISPLACEDTRI)
+	m_pkCamera->CalculateProjection(CORE3D_PI * 0.5f, 10.0f, 0.1f);
+	m_pkCamera->SetPosition(C3DVECTOR3(0.15f, -0.2f, -0.8f));
+	m_pkCamera->SetLookAt(C3DVECTOR3(0.0f, 0.0f, 0.0f), C3DVECTOR3(0.0f, 1.0f, 0.0f));
+	m_pkCamera->CalculateView();
+
+	GetScene()->RegisterEntityType(_T("DisplacedTri"), &Core3D::CreateDisplacedTri);
+	m_hEntity = GetScene()->CreateEntity(_T("DisplacedTri"));
+	if(0 == m_hEntity) {return false;}
+
+	DisplacedTri::VertexData akVertices[3];
+	akVertices[0].kPosition		= C3DVECTOR3(-1.0f, -0.5f, 0.0f);
+	akVertices[0].kTexCoord0	= C3DVECTOR2(0.0, 1.0f);
+	akVertices[1].kPosition		= C3DVECTOR3(0.0f, 1.0f, 0.5f);
+	akVertices[1].kTexCoord0	= C3DVECTOR2(0.5f, 0.0f);
+	akVertices[2].kPosition		= C3DVECTOR3(1.0f, 0.0f, 0.25f);
+	akVertices[2].kTexCoord0	= C3DVECTOR2(1.0f, 0.0f);
+	DisplacedTri* pkTriangle = static_cast<DisplacedTri*>(GetScene()->GetEntity(m_hEntity));
+	if(false == pkTriangle->Initialize(akVertices, _T("triangle.png"), _T("triangle_normals.png"))) {return false;}
+
+	m_hLight = GetScene()->CreateLight();
+	if(0 == m_hLight) {return false;}
+	GetScene()->GetLight(m_hLight)->SetColor(C3DVECTOR4(1.0f, 1.0f, 1.0f, 1.0f));
+
+	GetGraphics()->SetRenderState(RS_SUBDIVISIONMODE, SUBDIV_SIMPLE);
+	GetGraphics()->SetRenderState(RS_SUBDIVISIONLEVELS, 5);
+#elif defined(CORE3D_SAMPLE_ENVSPHERE)
+	m_pkCamera->CalculateProjection(CORE3D_PI * 0.5f, 10.0f, 0.1f);
+
+	GetScene()->RegisterEntityType(_T("EnvSphere"), &Core3D::CreateEnvSphere);
+	m_hEntity = GetScene()->CreateEntity(_T("EnvSphere"));
+	if(0 == m_hEntity) {return false;}
+	EnvSphere* pkSphere = static_cast<EnvSphere*>(GetScene()->GetEntity(m_hEntity));
+	if(false == pkSphere->Initialize(1.0f, 16, 16, _T("majestic.cube"))) {return false;}
+
+	m_hLight = GetScene()->CreateLight();
+	if(0 == m_hLight) {return false;}
+	GetScene()->GetLight(m_hLight)->SetPosition(C3DVECTOR3(1.5f, 0.25f, 0.0f));
+	GetScene()->GetLight(m_hLight)->SetColor(C3DVECTOR4(1.0f, 1.0f, 0.0f, 1.0f));
+
+	GetGraphics()->SetRenderState(RS_SUBDIVISIONMODE, SUBDIV_SMOOTH);
+	GetGraphics()->SetRenderState(RS_SUBDIVISIONLEVELS, 1);
+	GetGraphics()->SetRenderState(RS_SUBDIVISIONPOSITIONREGISTER, 0);
+	GetGraphics()->SetRenderState(RS_SUBDIVISIONNORMALREGISTER, 0);
+#endif
+	if(PREPASS_SAMPLE != gs_eDepthPrepass) {m_pkCamera->SetDepthPrepass(PREPASS_ON == gs_eDepthPrepass);}
+	return true;
+}
+
+void SampleApp::DestroyWorld()
+{
+	if(0 != m_hLight) {GetScene()->ReleaseLight(m_hLight);}
+	if(0 != m_hEntity) {GetScene()->ReleaseEntity(m_hEntity);}
+	m_hLight	= 0;
+	m_hEntity	= 0;
+	CORE3D_SAFE_DELETE(m_pkCamera);
+}
+
+// COMMENT : The camera path only depends on the elapsed time, so a frame's image doesn't depend on the number of frames
+void SampleApp::FrameMove()
+{
+	const FLOAT32 fTime = GetElapsedTime();
+#if defined(CORE3D_SAMPLE_BUBBLE)
+	Orbit(0.5f * fTime, 0.4f * sinf(fTime), 150.0f, 100.0f);
+#elif defined(CORE3D_SAMPLE_CHECKBOARD)
+	// COMMENT : Moves towards the board and back, like with the sample's W and S keys
+	m_pkCamera->SetPosition(C3DVECTOR3(-0.01f, 0.025f, 0.0f));
+	m_pkCamera->SetLookAt(C3DVECTOR3(0.0f, 0.0f, 0.05f), C3DVECTOR3(0.0f, 1.0f, 0.0f));
+	m_pkCamera->CalculateView();
+	m_pkCamera->SetPositionRel(m_pkCamera->GetDirection() * (-0.02f * sinf(fTime)));
+	m_pkCamera->CalculateView();
+#elif defined(CORE3D_SAMPLE_CRYSTAL)
+	Orbit(-0.4f * fTime, 0.3f * sinf(fTime), 750.0f, 300.0f);
+#elif defined(CORE3D_SAMPLE_DISPLACEDSPHERE)
+	Orbit(DegToRad(-30.0f * fTime), DegToRad(20.0f * sinf(fTime)), 2.0f, 2.0f);
+#elif defined(CORE3D_SAMPLE_DISPLACEDTRI)
+	// COMMENT : Moves the light around in front of the triangle, like the sample's mouse cursor
+	GetScene()->GetLight(m_hLight)->SetPosition(C3DVECTOR3(0.8f * cosf(fTime), 0.5f, 0.4f * sinf(fTime) - 0.6f));
+#elif defined(CORE3D_SAMPLE_ENVSPHERE)
+	Orbit(0.5f - 0.3f * fTime, 0.5f * sinf(fTime), 2.0f, 1.0f);
+#endif
+}
+
+void SampleApp::RenderWorld()
+{
+	if(NULL != m_pkCamera)
+	{
+		m_pkCamera->BeginRender();
+		m_pkCamera->ClearToSceneColor();
+		if(true == gs_bVisibilityPass) {GetGraphics()->GetDevice()->BeginVisibilityPass();}
+		m_pkCamera->RenderPass(-1);
+		if(true == gs_bVisibilityPass) {GetGraphics()->GetDevice()->ResolveVisibilityPass();}
+		m_pkCamera->EndRender(true);
+	}
+}
+
+// COMMENT : Renders the current frame with the entities recording command-lists(see FWEntity::Record()) and again with all
+// of them rendered directly. The camera's color-buffers have to be bit-identical. Samples without recording entities skip it.
+bool SampleApp::CheckCommandLists()
+{
+	std::vector<FLOAT32> avecColors[2];
+	UINT32 uiRecordedEntities = 0;
+	for(UINT32 uiRun = 0; uiRun < 2; ++uiRun)
+	{
+		GetScene()->SetCommandLists(0 == uiRun);
+		RenderWorld();
+		if(0 == uiRun)
+		{
+			uiRecordedEntities = GetScene()->GetNumRecordedEntities();
+			if(0 == uiRecordedEntities)
+			{
+				printf("Check %-24s : skipped, no entity of the sample records a command-list\n", "scene/commandlists");
+				return true;
+			}
+		}
+
+		Surface* pkColorBuffer	= m_pkCamera->GetRenderTarget()->GetColorBuffer();
+		const FLOAT32* pfData	= NULL;
+		if(NULL != pkColorBuffer && CORE3D_SUCCESSFUL(pkColorBuffer->LockRect((void**)&pfData, NULL)))
+		{
+			avecColors[uiRun].assign(pfData, pfData + pkColorBuffer->GetWidth() * pkColorBuffer->GetHeight() * pkColorBuffer->GetFormatFloats());
+			pkColorBuffer->UnlockRect();
+		}
+		CORE3D_SAFE_RELEASE(pkColorBuffer);
+	}
+	GetScene()->SetCommandLists(true);
+
+	UINT32 uiDifferentValues = 0;
+	for(size_t uiValue = 0; uiValue < avecColors[0].size() && uiValue < avecColors[1].size(); ++uiValue)
+	{
+		if(0 != memcmp(&avecColors[0][uiValue], &avecColors[1][uiValue], sizeof(FLOAT32))) {++uiDifferentValues;}
+	}
+
+	const bool bPassed = (false == avecColors[0].empty()) && (avecColors[0].size() == avecColors[1].size()) && (0 == uiDifferentValues);
+	printf("Check %-24s : %s, %u entities recorded, %u color values differ from the direct rendering\n", "scene/commandlists",
+		(true == bPassed) ? "passed" : "FAILED", uiRecordedEntities, uiDifferentValues);
+	return bPassed;
+}
+
+//------------------------------------------------------------------------
+// COMMENT : Images are compared and stored as 8-bit RGB
+static bool WritePNG(const char* szFileName, const BYTE8* pRGB, UINT32 uiWidth, UINT32 uiHeight)
+{
+	FILE* pkFile = fopen(szFileName, "wb");
+	if(NULL == pkFile) {return false;}
+
+	png_structp pkPNG	= png_create_write_struct(PNG_LIBPNG_VER_STRING, 0, 0, 0);
+	png_infop pkInfo	= (NULL != pkPNG) ? png_create_info_struct(pkPNG) : NULL;
+	if(NULL == pkInfo || setjmp(png_jmpbuf(pkPNG)))
+	{
+		png_destroy_write_struct(&pkPNG, &pkInfo);
+		fclose(pkFile);
+		return false;
+	}
+
+	png_init_io(pkPNG, pkFile);
+	png_set_IHDR(pkPNG, pkInfo, uiWidth, uiHeight, 8, PNG_COLOR_TYPE_RGB, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+	png_write_info(pkPNG, pkInfo);
+	for(UINT32 uiY = 0; uiY < uiHeight; ++uiY) {png_write_row(pkPNG, (png_bytep)(pRGB + uiY * uiWidth * 3));}
+	png_write_end(pkPNG, NULL);
+
+	png_destroy_write_struct(&pkPNG, &pkInfo);
+	fclose(pkFile);
+	return true;
+}
+
+static bool ReadPNG(const char* szFileName, std::vector<BYTE8>& rvecRGB, UINT32& ruiWidth, UINT32& ruiHeight)
+{
+	FILE* pkFile = fopen(szFileName, "rb");
+	if(NULL == pkFile) {return false;}
+
+	png_structp pkPNG	= png_create_read_struct(PNG_LIBPNG_VER_STRING, 0, 0, 0);
+	png_infop pkInfo	= (NULL != pkPNG) ? png_create_info_struct(pkPNG) : NULL;
+	if(NULL == pkInfo || setjmp(png_jmpbuf(pkPNG)))
+	{
+		png_destroy_read_struct(&pkPNG, &pkInfo, NULL);
+		fclose(pkFile);
+		return false;
+	}
+
+	png_init_io(pkPNG, pkFile);
+	png_read_info(pkPNG, pkInfo);
+	ruiWidth	= png_get_image_width(pkPNG, pkInfo);
+	ruiHeight	= png_get_image_height(pkPNG, pkInfo);
+
+	bool bResult = (8 == png_get_bit_depth(pkPNG, pkInfo) && PNG_COLOR_TYPE_RGB == png_get_color_type(pkPNG, pkInfo));
+	if(true == bResult)
+	{
+		rvecRGB.resize(ruiWidth * ruiHeight * 3);
+		for(UINT32 uiY = 0; uiY < ruiHeight; ++uiY) {png_read_row(pkPNG, (png_bytep)&rvecRGB[uiY * ruiWidth * 3], NULL);}
+	}
+
+	png_destroy_read_struct(&pkPNG, &pkInfo, NULL);
+	fclose(pkFile);
+	return bResult;
+}
+
+struct Comparison
+{
+	UINT32	uiFrame;
+	bool	bPassed;
+	UINT32	uiMaxDifference;		// Largest difference of a channel
+	FLOAT64	fMeanDifference;		// Mean absolute difference of all channels
+	FLOAT64	fDifferentPixels;		// Percentage of pixels with a channel differing by more than the threshold
+};
+
+static FLOAT64 Percentile(const std::vector<FLOAT64>& rvecSorted, FLOAT64 fPercentile)
+{
+	// COMMENT : Nearest-rank percentile
+	size_t uiRank = (size_t)ceil(fPercentile / 100.0 * (FLOAT64)rvecSorted.size());
+	return rvecSorted[(uiRank > 0) ? uiRank - 1 : 0];
+}
+
+int main(int argc, char** argv)
+{
+	UINT32 uiFrames				= 3 * GOLDEN_INTERVAL;
+	bool bUpdate				= false;
+	const char* szGoldenDir		= CORE3D_SOURCE_DIR "/Tool_SampleRunner/golden";
+	const char* szDumpDir		= NULL;
+	const char* szJSONFile		= NULL;
+	UINT32 uiThreshold			= 8;
+	FLOAT64 fTolerance			= 0.01;
+	UINT32 uiMaxDifference		= 32;
+	for(int iArg = 1; iArg < argc; ++iArg)
+	{
+		if(0 == strcmp(argv[iArg], "-frames") && iArg + 1 < argc)				{uiFrames = (UINT32)atoi(argv[++iArg]);}
+		else if(0 == strcmp(argv[iArg], "-update"))								{bUpdate = true;}
+		else if(0 == strcmp(argv[iArg], "-golden") && iArg + 1 < argc)			{szGoldenDir = argv[++iArg];}
+		else if(0 == strcmp(argv[iArg], "-dump") && iArg + 1 < argc)			{szDumpDir = argv[++iArg];}
+		else if(0 == strcmp(argv[iArg], "-threshold") && iArg + 1 < argc)		{uiThreshold = (UINT32)atoi(argv[++iArg]);}
+		else if(0 == strcmp(argv[iArg], "-tolerance") && iArg + 1 < argc)		{fTolerance = atof(argv[++iArg]);}
+		else if(0 == strcmp(argv[iArg], "-maxdifference") && iArg + 1 < argc)	{uiMaxDifference = (UINT32)atoi(argv[++iArg]);}
+		else if(0 == strcmp(argv[iArg], "-json") && iArg + 1 < argc)			{szJSONFile = argv[++iArg];}
+		else if(0 == strcmp(argv[iArg], "-prepass") && iArg + 1 < argc && 0 == strcmp(argv[iArg + 1], "on"))	{gs_eDepthPrepass = PREPASS_ON; ++iArg;}
+		else if(0 == strcmp(argv[iArg], "-prepass") && iArg + 1 < argc && 0 == strcmp(argv[iArg + 1], "off"))	{gs_eDepthPrepass = PREPASS_OFF; ++iArg;}
+		else if(0 == strcmp(argv[iArg], "-visibility"))							{gs_bVisibilityPass = true;}
+		else
+		{
+			printf("Usage : Tool_SampleRunner_" SAMPLE_NAME " [-frames count] [-update] [-golden directory] [-dump directory]\n"
+				"       [-threshold levels] [-tolerance percent] [-maxdifference levels] [-json file] [-prepass on|off] [-visibility]\n");
+			return 1;
+		}
+	}
+	if(0 == uiFrames) {printf("Error : At least one frame has to be rendered.\n"); return 1;}
+
+	bool bPassed = (true == bUpdate) || RunDeviceChecks();
+
+	SampleApp kApp;
+	kApp.SetDataPath(_T(CORE3D_SOURCE_DIR "/Sample_" SAMPLE_NAME "/data"));
+
+	CreationFlags kCreateFlags;
+	kCreateFlags.strWindowTitle	= _T(SAMPLE_NAME);
+#	ifdef WIN32
+	kCreateFlags.hIcon			= NULL;
+#	endif
+#	if defined(CORE3D_SAMPLE_CHECKBOARD)
+	kCreateFlags.uiWindowWidth	= 640;
+	kCreateFlags.uiWindowHeight	= 480;
+#	else
+	kCreateFlags.uiWindowWidth	= 400;
+	kCreateFlags.uiWindowHeight	= 300;
+#	endif
+	kCreateFlags.bWindowed		= true;
+	if(false == kApp.Initialize(kCreateFlags)) {printf("Error : Couldn't create the world of " SAMPLE_NAME ".\n"); return 1;}
+
+	const UINT32 uiWidth	= kApp.GetWindowWidth();
+	const UINT32 uiHeight	= kApp.GetWindowHeight();
+	std::vector<BYTE8> vecFrame(uiWidth * uiHeight * 3), vecGolden;
+	std::vector<FLOAT64> vecSeconds;
+	std::vector<Comparison> vecComparisons;
+
+	for(UINT32 uiFrame = 0; uiFrame < uiFrames; ++uiFrame)
+	{
+		const FLOAT64 fStart = GetSeconds();
+		kApp.RenderFrame();
+		vecSeconds.push_back(GetSeconds() - fStart);
+
+		if(0 != uiFrame % GOLDEN_INTERVAL) {continue;}
+
+		const BYTE8* pRGBA = kApp.GetFrameBuffer();
+		for(UINT32 uiPixel = 0; uiPixel < uiWidth * uiHeight; ++uiPixel)
+		{
+			vecFrame[uiPixel * 3 + 0] = pRGBA[uiPixel * 4 + 0];
+			vecFrame[uiPixel * 3 + 1] = pRGBA[uiPixel * 4 + 1];
+			vecFrame[uiPixel * 3 + 2] = pRGBA[uiPixel * 4 + 2];
+		}
+
+		char szGoldenFile[512];
+		snprintf(szGoldenFile, sizeof(szGoldenFile), "%s/%s_%03u.png", szGoldenDir, SAMPLE_NAME, uiFrame);
+		if(true == bUpdate)
+		{
+			if(false == WritePNG(szGoldenFile, &vecFrame[0], uiWidth, uiHeight)) {printf("Error : Couldn't write %s.\n", szGoldenFile); bPassed = false;}
+			else {printf("Updated %s\n", szGoldenFile);}
+			continue;
+		}
+
+		if(NULL != szDumpDir)
+		{
+			char szDumpFile[512];
+			snprintf(szDumpFile, sizeof(szDumpFile), "%s/%s_%03u.png", szDumpDir, SAMPLE_NAME, uiFrame);
+			WritePNG(szDumpFile, &vecFrame[0], uiWidth, uiHeight);
+		}
+
+		UINT32 uiGoldenWidth = 0, uiGoldenHeight = 0;
+		if(false == ReadPNG(szGoldenFile, vecGolden, uiGoldenWidth, uiGoldenHeight) || uiGoldenWidth != uiWidth || uiGoldenHeight != uiHeight)
+		{
+			printf("Error : Frame %u has no matching golden image %s.\n", uiFrame, szGoldenFile);
+			bPassed = false;
+			continue;
+		}
+
+		Comparison kComparison;
+		kComparison.uiFrame			= uiFrame;
+		kComparison.uiMaxDifference	= 0;
+		UINT64 uiSumDifference		= 0;
+		UINT32 uiDifferentPixels	= 0;
+		for(UINT32 uiPixel = 0; uiPixel < uiWidth * uiHeight; ++uiPixel)
+		{
+			UINT32 uiPixelDifference = 0;
+			for(UINT32 uiChannel = 0; uiChannel < 3; ++uiChannel)
+			{
+				const UINT32 uiDifference = (UINT32)abs((INT32)vecFrame[uiPixel * 3 + uiChannel] - (INT32)vecGolden[uiPixel * 3 + uiChannel]);
+				uiSumDifference		+= uiDifference;
+				uiPixelDifference	= std::max(uiPixelDifference, uiDifference);
+			}
+			kComparison.uiMaxDifference = std::max(kComparison.uiMaxDifference, uiPixelDifference);
+			if(uiPixelDifference > uiThreshold) {++uiDifferentPixels;}
+		}
+		kComparison.fMeanDifference		= (FLOAT64)uiSumDifference / (FLOAT64)(uiWidth * uiHeight * 3);
+		kComparison.fDifferentPixels	= 100.0 * (FLOAT64)uiDifferentPixels / (FLOAT64)(uiWidth * uiHeight);
+		kComparison.bPassed				= (kComparison.fDifferentPixels <= fTolerance) && (kComparison.uiMaxDifference <= uiMaxDifference);
+		bPassed							= bPassed && kComparison.bPassed;
+		vecComparisons.push_back(kComparison);
+
+		printf("Frame %3u : %s, %.3f%% of the pixels differ by more than %u, max. difference %u, mean difference %.3f\n", uiFrame,
+			(true == kComparison.bPassed) ? "passed" : "FAILED", kComparison.fDifferentPixels, uiThreshold,
+			kComparison.uiMaxDifference, kComparison.fMeanDifference);
+	}
+
+	// COMMENT : The statistics are those of the frames, the check renders after them
+	PipelineStatistics kStatistics;
+	const bool bStatistics = CORE3D_SUCCESSFUL(kApp.GetGraphics()->GetDevice()->GetPipelineStatistics(kStatistics, PSR_TOTAL));
+	if(false == bUpdate) {bPassed = kApp.CheckCommandLists() && bPassed;}
+	kApp.DestroyWorld();
+
+	// COMMENT : The first frame loads and builds resources on demand and isn't part of the statistics
+	std::vector<FLOAT64> vecSorted(vecSeconds.begin() + ((vecSeconds.size() > 1) ? 1 : 0), vecSeconds.end());
+	std::sort(vecSorted.begin(), vecSorted.end());
+	FLOAT64 fMean = 0.0;
+	for(size_t uiFrame = 0; uiFrame < vecSorted.size(); ++uiFrame) {fMean += vecSorted[uiFrame];}
+	fMean /= (FLOAT64)vecSorted.size();
+
+	printf("%s %ux%u, %u frames : mean %.3f ms, min %.3f ms, p50 %.3f ms, p90 %.3f ms, p99 %.3f ms, max %.3f ms\n",
+		SAMPLE_NAME, uiWidth, uiHeight, uiFrames, fMean * 1e3, vecSorted.front() * 1e3, Percentile(vecSorted, 50.0) * 1e3,
+		Percentile(vecSorted, 90.0) * 1e3, Percentile(vecSorted, 99.0) * 1e3, vecSorted.back() * 1e3);
+	if(true == bStatistics)
+	{
+		printf("%s per frame : %u depth tested pixels, %u shaded pixels\n", SAMPLE_NAME,
+			kStatistics.uiDepthTestedPixels / uiFrames, kStatistics.uiShadedPixels / uiFrames);
+	}
+
+	if(NULL != szJSONFile)
+	{
+		FILE* pkFile = fopen(szJSONFile, "w");
+		if(NULL == pkFile) {printf("Error : Couldn't write %s.\n", szJSONFile); return 1;}
+
+		fprintf(pkFile, "{\n\t\"sample\": \"%s\",\n\t\"width\": %u,\n\t\"height\": %u,\n\t\"frames\": %u,\n\t\"passed\": %s,\n", SAMPLE_NAME,
+			uiWidth, uiHeight, uiFrames, (true == bPassed) ? "true" : "false");
+		fprintf(pkFile, "\t\"frame_ms\": {\"mean\": %.4f, \"min\": %.4f, \"p50\": %.4f, \"p90\": %.4f, \"p99\": %.4f, \"max\": %.4f},\n",
+			fMean * 1e3, vecSorted.front() * 1e3, Percentile(vecSorted, 50.0) * 1e3, Percentile(vecSorted, 90.0) * 1e3,
+			Percentile(vecSorted, 99.0) * 1e3, vecSorted.back() * 1e3);
+		if(true == bStatistics)
+		{
+			fprintf(pkFile, "\t\"pixels_per_frame\": {\"depth_tested\": %u, \"shaded\": %u},\n",
+				kStatistics.uiDepthTestedPixels / uiFrames, kStatistics.uiShadedPixels / uiFrames);
+		}
+		fprintf(pkFile, "\t\"comparisons\": [");
+		for(size_t uiComparison = 0; uiComparison < vecComparisons.size(); ++uiComparison)
+		{
+			const Comparison& rkComparison = vecComparisons[uiComparison];
+			fprintf(pkFile, "%s\n\t\t{\"frame\": %u, \"passed\": %s, \"max_difference\": %u, \"mean_difference\": %.4f, \"different_pixels_percent\": %.4f}",
+				(0 == uiComparison) ? "" : ",", rkComparison.uiFrame, (true == rkComparison.bPassed) ? "true" : "false",
+				rkComparison.uiMaxDifference, rkComparison.fMeanDifference, rkComparison.fDifferentPixels);
+		}
+		fprintf(pkFile, "\n\t]\n}\n");
+		fclose(pkFile);
+	}
+
+	if(false == bUpdate) {printf("%s\n", (true == bPassed) ? "Passed : all frames match their golden images." : "Failed : frames differ from their golden images.");}
+	return (true == bPassed) ? 0 : 1;
+}